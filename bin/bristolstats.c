@@ -0,0 +1,164 @@
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Ask a running engine for its health counters over the control port, the
+ * same values the engine writes with -metrics. Each request returns 14 bits
+ * so every value takes two of them.
+ *
+ * With -denormals on|off it instead changes the engine's denormal mode.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bristol.h"
+#include "bristolmidi.h"
+
+static bristolMidiMsg reply;
+static int replied;
+
+static int
+statsCallback(bristolMidiMsg *msg, void *param)
+{
+	bcopy(msg, &reply, sizeof(bristolMidiMsg));
+	replied = 1;
+
+	return(0);
+}
+
+static int
+bristolStat(int handle, int stat)
+{
+	bristolMidiMsg msg;
+	int half, value = 0, retry;
+
+	for (half = 1; half >= 0; half--)
+	{
+		replied = 0;
+
+		bristolMidiSendMsg(handle, 0, 127, 0,
+			BRISTOL_REQ_STATS|(stat << 1)|half);
+
+		/*
+		 * Replies come back through the callback, each read polls the socket
+		 * for a few ms so keep at it for a second.
+		 */
+		for (retry = 100; replied == 0; retry--)
+		{
+			if (retry <= 0)
+				return(-1);
+			bristolMidiDevRead(bristolGetMidiFD(handle), &msg);
+		}
+
+		value = (value << 14) + (reply.params.bristol.valueMSB << 7)
+			+ reply.params.bristol.valueLSB;
+	}
+
+	return(value);
+}
+
+int
+main(int argc, char *argv[])
+{
+	int handle, argCount = 1, port = 5028, i, count = 0, denormals = -1;
+	int stat[BRISTOL_STAT_COUNT];
+	bristolMidiMsg msg;
+	unsigned int sysid = 0x534C6162;
+	char *host = "localhost";
+
+	for (; argCount < argc; argCount++)
+	{
+		if ((strcmp(argv[argCount], "-host") == 0) && (argc > argCount + 1))
+			host = argv[++argCount];
+		else if ((strcmp(argv[argCount], "-port") == 0)
+			&& (argc > argCount + 1))
+			port = atoi(argv[++argCount]);
+		else if ((strcmp(argv[argCount], "-sysid") == 0)
+			&& (argc > argCount + 1))
+			sscanf(argv[++argCount], "0x%x", &sysid);
+		else if ((strcmp(argv[argCount], "-denormals") == 0)
+			&& (argc > argCount + 1))
+			denormals = (strcmp(argv[++argCount], "on") == 0);
+		else {
+			printf("usage: %s [-host <h>] [-port <p>] [-sysid <0xid>]"
+				" [-denormals on|off]\n", argv[0]);
+			return(-1);
+		}
+	}
+
+	/* The engine drops SysEx that does not carry its ID */
+	sysid &= 0x7f7f7f7f;
+	bristolMidiOption(0, BRISTOL_NRP_SYSID_H, sysid >> 16);
+	bristolMidiOption(0, BRISTOL_NRP_SYSID_L, sysid & 0x0000ffff);
+
+	if ((handle = bristolMidiOpen(host, BRISTOL_CONN_TCP|BRISTOL_DUPLEX,
+		port, -1, statsCallback, NULL)) < 0)
+	{
+		printf("%s: could not connect to the engine on %s:%i\n",
+			argv[0], host, port);
+		return(-2);
+	}
+
+	if (denormals >= 0)
+	{
+		bristolMidiSendMsg(handle, 0, 127, 0,
+			BRISTOL_REQ_DENORMALS|denormals);
+		/* Wait for the acknowledgement so the message is not lost on close */
+		for (i = 100; (replied == 0) && (i > 0); i--)
+			bristolMidiDevRead(bristolGetMidiFD(handle), &msg);
+		bristolMidiClose(handle);
+		printf("STATS: denormals %s\n", denormals? "on":"off");
+		return(0);
+	}
+
+	for (i = 0; i < BRISTOL_STAT_COUNT; i++)
+		if ((stat[i] = bristolStat(handle, i)) < 0)
+		{
+			printf("%s: no reply from the engine\n", argv[0]);
+			bristolMidiClose(handle);
+			return(-3);
+		}
+
+	bristolMidiClose(handle);
+
+	printf("STATS: load %.1f%% peak %.1f%% periods %i\n",
+		stat[BRISTOL_STAT_LOAD] / 10.0, stat[BRISTOL_STAT_PEAK] / 10.0,
+		stat[BRISTOL_STAT_PERIODS]);
+	printf("STATS: xruns %i restarts %i steals %i clips %i\n",
+		stat[BRISTOL_STAT_XRUNS], stat[BRISTOL_STAT_RESTARTS],
+		stat[BRISTOL_STAT_STEALS], stat[BRISTOL_STAT_CLIPS]);
+	printf("STATS: jitter us p50 %i p90 %i p99 %i max %i\n",
+		stat[BRISTOL_STAT_JITTER50], stat[BRISTOL_STAT_JITTER90],
+		stat[BRISTOL_STAT_JITTER99], stat[BRISTOL_STAT_JITTERMAX]);
+
+	/* Periods by the share of the period they took, 10% per bucket */
+	printf("STATS: period load");
+	for (i = 0; i < BRISTOL_HIST_BUCKETS; i++)
+	{
+		printf(" %i", stat[BRISTOL_STAT_HIST + i]);
+		count += stat[BRISTOL_STAT_HIST + i];
+	}
+	printf(" (%i)\n", count);
+
+	return(0);
+}
+
@@ -202,13 +202,30 @@ char *helptext = "\nA synthesiser emulation package.\n\
         Audio driver:\n\
 \n\
             -audio [oss|alsa|jack] - audio driver selection (alsa)\n\
+            -dummyaudio            - no audio device, clocked at the period\n\
+            -freewheel             - dummy audio runs as fast as it can\n\
             -audiodev <dev>        - audio device selection\n\
             -count <samples>       - sample period count (256)\n\
             -outgain <gn>          - digital output signal gain (default 4)\n\
             -ingain <gn>           - digital input signal gain (default 4)\n\
             -preload <periods>     - configure preload buffer count (default 4)\n\
             -rate <hz>             - sample rate (44100)\n\
+            -oversample <1|2|4>    - nonlinear filter oversampling (2)\n\
+            -fxbus <op>[,<op>]     - shared effects, eg 36 reverb, 12 chorus\n\
+            -fxsend <0..1>         - default level to the shared effects (1)\n\
+            -cpubudget <%>         - period share for voices, 0 no limit (0)\n\
+            -reserve <n>           - voices the CPU budget will not steal (0)\n\
+            -arena <MB>            - locked memory for engine allocations (32)\n\
+            -trace <file>          - engine trace, written on SIGHUP and exit\n\
+            -metrics <file>        - engine load and xrun counters, every 10s\n\
             -priority <p>          - audio RT priority, 0=no realtime (75)\n\
+            -workers <n>           - render emulations on n RT threads (0)\n\
+            -workerprio <p>        - worker RT priority (audio priority)\n\
+            -workercpus <c>[,<c>]  - CPU for each worker in turn\n\
+            -denormals             - do not flush denormals to zero\n\
+            -fdnreverb             - delay network reverb for the emulations\n\
+            -midiecho              - send the MIDI input back out (-midi seq)\n\
+            -interpolate <type>    - chorus and rotor delays, linear|allpass|cubic\n\
             -autoconn              - attempt JACK port auto-connect\n\
             -multi <c>             - register 'c' IO channels (jack only)\n\
             -migc <f>              - multi IO input gain scaling (jack only)\n\
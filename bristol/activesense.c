@@ -60,9 +60,11 @@ bristolActiveSenseCheck(audioMain *audiomain, Baudio *baudio)
 	if (audiomain->debuglevel > 13)
 		printf("ActiveSenseCheck %p: %i\n", baudio, baudio->sensecount);
 
+	/* Freewheeling samples say nothing about how long the GUI has been gone */
 	if ((~baudio->mixflags & BRISTOL_SENSE)
 		|| (baudio->sensecount == 0)
-		|| (baudio->mixflags & (BRISTOL_HOLDDOWN|BRISTOL_REMOVE)))
+		|| (baudio->mixflags & (BRISTOL_HOLDDOWN|BRISTOL_REMOVE))
+		|| (audiomain->flags & BRISTOL_FREEWHEEL))
 		return(1);
 
 	if ((baudio->sensecount -= audiomain->samplecount) > 0)
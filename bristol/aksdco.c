@@ -39,7 +39,6 @@
 #include "aksdco.h"
 
 static float note_diff;
-static float *zbuf;
 
 #define BRISTOL_SQR 4
 #define SINE_LIM 0.05f
@@ -77,14 +76,14 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
-	bristolfree(((bristolAKSDCO *) operator)->wave[0]);
-	bristolfree(((bristolAKSDCO *) operator)->wave[1]);
-	bristolfree(((bristolAKSDCO *) operator)->wave[2]);
-	bristolfree(((bristolAKSDCO *) operator)->wave[3]);
-	bristolfree(((bristolAKSDCO *) operator)->wave[4]);
-	bristolfree(((bristolAKSDCO *) operator)->wave[5]);
-	bristolfree(((bristolAKSDCO *) operator)->wave[6]);
-	bristolfree(((bristolAKSDCO *) operator)->wave[7]);
+	bristolfree(((bristolAKSDCO *) operator->specs)->wave[0]);
+	bristolfree(((bristolAKSDCO *) operator->specs)->wave[1]);
+	bristolfree(((bristolAKSDCO *) operator->specs)->wave[2]);
+	bristolfree(((bristolAKSDCO *) operator->specs)->wave[3]);
+	bristolfree(((bristolAKSDCO *) operator->specs)->wave[4]);
+	bristolfree(((bristolAKSDCO *) operator->specs)->wave[5]);
+	bristolfree(((bristolAKSDCO *) operator->specs)->wave[6]);
+	bristolfree(((bristolAKSDCO *) operator->specs)->wave[7]);
 
 	bristolfree(operator->specs);
 
@@ -110,8 +109,10 @@ static int reset(bristolOP *operator, bristolOPParams *param)
 	if (param->param[1].mem != 0)
 		bristolfree(param->param[1].mem);
 
-	param->param[0].mem = bristolmalloc0(sizeof(float) * AKSDCO_WAVE_SZE);
-	param->param[1].mem = bristolmalloc0(sizeof(float) * AKSDCO_WAVE_SZE);
+	param->param[0].mem = bristolmalloc0(sizeof(float)
+		* (AKSDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	param->param[1].mem = bristolmalloc0(sizeof(float)
+		* (AKSDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
 
 	param->param[0].float_val = 0.5;
 	param->param[1].float_val = 0.5;
@@ -211,6 +212,8 @@ static int param(bristolOP *operator, bristolOPParams *param,
 					param->param[2].float_val,
 					param->param[4].float_val);
 			}
+			waveCoreGuard(param->param[0].mem, AKSDCO_WAVE_SZE);
+			waveCoreGuard(param->param[1].mem, AKSDCO_WAVE_SZE);
 			break;
 		case 5: /* LFO.... Encodes the type of oscillator. */
 			param->param[index].int_val = value * CONTROLLER_RANGE;
@@ -319,9 +322,10 @@ static int operate(bristolOP *operator,
 	void *lcl)
 {
 	bristolAKSDCOlocal *local = lcl;
-	int obp, count;
+	int obp, count, i, shift;
 	float *wt1, *wt2;
-	float *ib, *ob1, *ob2, *mb, wtp, gdelta, transp;
+	float *ib, *ob1, *ob2, *mb, gdelta, transp;
+	bristolPhase phase;
 	bristolAKSDCO *specs;
 
 	specs = (bristolAKSDCO *) operator->specs;
@@ -347,7 +351,8 @@ static int operate(bristolOP *operator,
 	 */
 	transp = param->param[0].float_val * param->param[1].float_val;
 
-	wtp = local->wtp;
+	shift = waveCoreShift(AKSDCO_WAVE_SZE);
+	phase = local->phase;
 
 	/*
 	 * Go jumping through the wavetable, with each jump defined by the value
@@ -356,42 +361,23 @@ static int operate(bristolOP *operator,
 	for (obp = 0; obp < count; obp++)
 	{
 		/*
-		 * Take a sample from the wavetable into the output buffer. This 
-		 * should also be scaled by gain parameter.
-		 *
-		 * We can separate this into subroutine calls, or we can take our
-		 * values and take each wave?
+		 * Take a sample from both wavetables at the same phase, the tables
+		 * have a guard sample so the interpolation does not wrap.
 		 */
-		gdelta = wtp - ((float) ((int) wtp));
-
-		if (wtp >= AKSDCO_WAVE_SZE_M) {
-			ob1[obp] = wt1[(int) wtp] + (wt1[0] - wt1[(int) wtp]) * gdelta;
-			ob2[obp] = wt2[(int) wtp] + (wt2[0] - wt2[(int) wtp]) * gdelta;
-		} else {
-			ob1[obp] = wt1[(int) wtp]
-				+ (wt1[(int) wtp + 1] - wt1[(int) wtp]) * gdelta;
-			ob2[obp] = wt2[(int) wtp]
-				+ (wt2[(int) wtp + 1] - wt2[(int) wtp]) * gdelta;
-		}
+		i = phase >> shift;
+		gdelta = waveCoreFrac(phase, shift);
+
+		ob1[obp] = wt1[i] + (wt1[i + 1] - wt1[i]) * gdelta;
+		ob2[obp] = wt2[i] + (wt2[i + 1] - wt2[i]) * gdelta;
 
 		/*
 		 * Move the wavetable pointer forward by amount indicated in input 
-		 * buffer for this sample.
-		 */
-		if ((wtp += ib[obp] * transp) >= AKSDCO_WAVE_SZE)
-		{
-			while (wtp >= AKSDCO_WAVE_SZE)
-				wtp -= AKSDCO_WAVE_SZE;
-		}
-		/*
-		 * If we have gone negative, round back up. Allows us to run the 
-		 * oscillator backwards.
+		 * buffer for this sample, it wraps by itself in either direction.
 		 */
-		while (wtp < 0)
-			wtp += AKSDCO_WAVE_SZE;
+		phase += waveCoreStep(ib[obp] * transp, shift);
 	}
 
-	local->wtp = wtp;
+	local->phase = phase;
 	return(0);
 }
 
@@ -456,7 +442,6 @@ aksdcoinit(bristolOP **operator, int index, int samplerate, int samplecount)
 		(float *) bristolmalloc(AKSDCO_WAVE_SZE * sizeof(float));
 	specs->wave[7] =
 		(float *) bristolmalloc(AKSDCO_WAVE_SZE * sizeof(float));
-	zbuf = (float *) bristolmalloc(AKSDCO_WAVE_SZE * sizeof(float));
 
 	/*
 	 * FillWave is something that should be called as a parameter change, but
@@ -22,6 +22,8 @@
 #ifndef AKSDCO_H
 #define AKSDCO_H
 
+#include "wavecore.h"
+
 #define AKSDCO_WAVE_SZE 1024
 #define AKSDCO_WAVE_SZE_M 1023
 #define AKSDCO_SYNC 0x01
@@ -33,7 +35,7 @@ typedef struct BristolAKSDCO {
 
 typedef struct BristolAKSDCOlocal {
 	unsigned int flags;
-	float wtp;
+	bristolPhase phase;
 	float cpwm;
 	float note_diff;
 	float lsv;
@@ -313,6 +313,12 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 				{
 					if (param->param[3].int_val != 0)
 						local->cstate = STATE_ATTACK;
+					else {
+						/* Not retriggered, the rest of the period is off */
+						while (count-- > 0)
+							*ob++ = 0.0f;
+						oncount = 0;
+					}
 				}
 				break;
 		}
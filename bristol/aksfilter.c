@@ -68,6 +68,7 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
+	bristolfree(((bristolAKSFILTER *) operator->specs)->wave);
 	bristolfree(operator->specs);
 
 	/*
@@ -40,7 +40,6 @@
 #include "arpdco.h"
 
 static float note_diff;
-static float *zbuf;
 
 #define BRISTOL_SQR 4
 
@@ -71,7 +70,6 @@ static void fillWave();
  * We should not be doing this however I need a quick resolution to some issues
  * with sync of square waves and this is a scratch buffer for the edge detector
  */
-static float *sbuf = NULL;
 
 /*
  * Reset any local memory information.
@@ -85,15 +83,17 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
-	bristolfree(((bristolARPDCO *) operator)->wave[0]);
-	bristolfree(((bristolARPDCO *) operator)->wave[1]);
-	bristolfree(((bristolARPDCO *) operator)->wave[2]);
-	bristolfree(((bristolARPDCO *) operator)->wave[3]);
-	bristolfree(((bristolARPDCO *) operator)->wave[4]);
-	bristolfree(((bristolARPDCO *) operator)->wave[5]);
-	bristolfree(((bristolARPDCO *) operator)->wave[6]);
-	bristolfree(((bristolARPDCO *) operator)->wave[7]);
-
+	bristolfree(((bristolARPDCO *) operator->specs)->wave[0]);
+	bristolfree(((bristolARPDCO *) operator->specs)->wave[1]);
+	bristolfree(((bristolARPDCO *) operator->specs)->wave[2]);
+	bristolfree(((bristolARPDCO *) operator->specs)->wave[3]);
+	bristolfree(((bristolARPDCO *) operator->specs)->wave[4]);
+	bristolfree(((bristolARPDCO *) operator->specs)->wave[5]);
+	bristolfree(((bristolARPDCO *) operator->specs)->wave[6]);
+	bristolfree(((bristolARPDCO *) operator->specs)->wave[7]);
+
+	bristolfree(((bristolARPDCO *) operator->specs)->sbuf);
+	bristolfree(((bristolARPDCO *) operator->specs)->zbuf);
 	bristolfree(operator->specs);
 
 	/*
@@ -116,9 +116,11 @@ static int reset(bristolOP *operator, bristolOPParams *param)
 
 	param->param[0].int_val = ARPDCO_WAVE_SZE / 2;
 	if (param->param[0].mem != NULL) bristolfree(param->param[0].mem);
-	param->param[0].mem = bristolmalloc0(sizeof(float) * ARPDCO_WAVE_SZE);
+	param->param[0].mem = bristolmalloc0(sizeof(float)
+		* (ARPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
 	if (param->param[1].mem != NULL) bristolfree(param->param[1].mem);
-	param->param[1].mem = bristolmalloc0(sizeof(float) * ARPDCO_WAVE_SZE);
+	param->param[1].mem = bristolmalloc0(sizeof(float)
+		* (ARPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
 	param->param[1].float_val = 1.0;
 	param->param[2].float_val = 1.0;
 	param->param[3].float_val = 1.0;
@@ -349,13 +351,16 @@ static int operate(bristolOP *operator,
 	void *lcl)
 {
 	bristolARPDCOlocal *local = lcl;
-	int obp, count, dosquare;
+	int obp, count, dosquare, shift, wdelta;
 	float *ramp, wtpSqr, gdelta, width, ssg;
-	float *ib, *ob, *ob2, *mb, *sb, *wt, wtp, gain, transp, cpwm, lsv;
+	float *ib, *ob, *ob2, *mb, *sb, *wt, gain, transp, cpwm, lsv;
+	bristolPhase phase;
 	float *obsin, *obtri, *sinwave, *triwave;
 	bristolARPDCO *specs;
+	float *sbuf;
 
 	specs = (bristolARPDCO *) operator->specs;
+	sbuf = specs->sbuf;
 
 #ifdef BRISTOL_DBG
 	printf("arpdco(%x, %x, %x)\n", operator, param, local);
@@ -367,9 +372,9 @@ static int operate(bristolOP *operator,
 	ob = specs->spec.io[DCO_OUT_RAMP].buf;
 	ob2 = specs->spec.io[DCO_OUT_SQUARE].buf;
 	if ((obsin = specs->spec.io[DCO_OUT_SINE].buf) == 0)
-		obsin = zbuf;
+		obsin = specs->zbuf;
 	if ((obtri = specs->spec.io[DCO_OUT_TRIANGLE].buf) == 0)
-		obtri = zbuf;
+		obtri = specs->zbuf;
 
 	lsv = local->lsv;
 
@@ -396,7 +401,8 @@ static int operate(bristolOP *operator,
 	transp = param->param[1].float_val * param->param[2].float_val
 		* param->param[9].float_val * param->param[10].float_val
 		* param->param[11].float_val;
-	wtp = local->wtp;
+	shift = waveCoreShift(ARPDCO_WAVE_SZE);
+	phase = local->phase;
 	cpwm = local->cpwm;
 
 	sinwave = specs->wave[0];
@@ -410,6 +416,8 @@ static int operate(bristolOP *operator,
 		triwave = param->param[1].mem;
 		generateBLOwaveformF(voice->cFreq*transp, ramp, BLO_SAW);
 		generateBLOwaveformF(voice->cFreq*transp, triwave, BLO_TRI);
+		waveCoreGuard(ramp, ARPDCO_WAVE_SZE);
+		waveCoreGuard(triwave, ARPDCO_WAVE_SZE);
 	} else {
 		wt = ramp = specs->wave[3];
 		triwave = specs->wave[4];
@@ -428,27 +436,17 @@ static int operate(bristolOP *operator,
 		 * We can separate this into subroutine calls, or we can take our
 		 * values and take each wave?
 		 */
-		gdelta = wtp - ((float) ((int) wtp));
-
-		if (wtp >= ARPDCO_WAVE_SZE_M) {
-			ob[obp] += (wt[(int) wtp] + (wt[0] - wt[(int) wtp])
-				* gdelta) * gain;
-			obsin[obp] += (sinwave[(int) wtp]
-				+ (sinwave[0] - sinwave[(int) wtp])
-				* gdelta) * gain;
-			obtri[obp] += (triwave[(int) wtp]
-				+ (triwave[0] - triwave[(int) wtp])
-				* gdelta) * gain;
-		} else {
-			ob[obp] += (wt[(int) wtp] + ((wt[(int) wtp + 1] - wt[(int) wtp])
-				* gdelta)) * gain;
-			obsin[obp] += (sinwave[(int) wtp]
-				+ ((sinwave[(int) wtp + 1] - sinwave[(int) wtp])
-				* gdelta)) * gain;
-			obtri[obp] += (triwave[(int) wtp]
-				+ ((triwave[(int) wtp + 1] - triwave[(int) wtp])
-				* gdelta)) * gain;
-		}
+		wdelta = phase >> shift;
+		gdelta = waveCoreFrac(phase, shift);
+
+		ob[obp] += (wt[wdelta] + ((wt[wdelta + 1] - wt[wdelta])
+			* gdelta)) * gain;
+		obsin[obp] += (sinwave[wdelta]
+			+ ((sinwave[wdelta + 1] - sinwave[wdelta])
+			* gdelta)) * gain;
+		obtri[obp] += (triwave[wdelta]
+			+ ((triwave[wdelta + 1] - triwave[wdelta])
+			* gdelta)) * gain;
 
 		/*
 		 * The square has to be computed real time as we are going to have
@@ -465,26 +463,10 @@ static int operate(bristolOP *operator,
 		else if (wtpSqr > ARPDCO_WAVE_PWMAX)
 			wtpSqr = ARPDCO_WAVE_PWMAX;
 
-		if ((wtpSqr = wtp + wtpSqr) > ARPDCO_WAVE_SZE_M)
-			wtpSqr -= ARPDCO_WAVE_SZE;
-
-		if (wtp >= ARPDCO_WAVE_SZE_M)
-			ob2[obp] += (ramp[(int) wtp] + (ramp[0] - ramp[(int) wtp])
-				* gdelta) * ssg;
-		else
-			ob2[obp] +=
-				(ramp[(int) wtp] + ((ramp[(int) wtp + 1] - ramp[(int) wtp])
-				* gdelta)) * ssg;
-
-		gdelta = wtpSqr - ((float) ((int) wtpSqr));
-
-		if (wtpSqr == ARPDCO_WAVE_SZE_M)
-			ob2[obp] -= (ramp[(int) wtpSqr] + (ramp[0] - ramp[(int) wtpSqr])
-				* gdelta) * ssg;
-		else
-			ob2[obp] -=
-				(ramp[(int) wtpSqr] + ((ramp[(int) wtpSqr + 1]
-				- ramp[(int) wtpSqr]) * gdelta)) * ssg;
+		ob2[obp] += (ramp[wdelta] + ((ramp[wdelta + 1] - ramp[wdelta])
+			* gdelta)) * ssg;
+		ob2[obp] -= waveCoreLerp(ramp,
+			phase + waveCoreStep(wtpSqr, shift), shift) * ssg;
 
 		if (sb && (sbuf[obp] != 0))
 		{
@@ -492,7 +474,7 @@ static int operate(bristolOP *operator,
 			 * These are positive edged zero crossings on the sync buffer. If
 			 * we find them, wtp is moved to zero resampled from buffer.
 			 */
-			wtp = sbuf[obp];
+			phase = waveCorePhase(sbuf[obp], shift);
 			ssg = -ssg;
 
 			/* We may need to resample here */
@@ -502,23 +484,12 @@ static int operate(bristolOP *operator,
 
 		/*
 		 * Move the wavetable pointer forward by amount indicated in input 
-		 * buffer for this sample.
+		 * buffer for this sample, it wraps by itself in either direction.
 		 */
-		if ((wtp += ib[obp] * transp) >= ARPDCO_WAVE_SZE)
-		{
-			while (wtp >= ARPDCO_WAVE_SZE)
-				wtp -= ARPDCO_WAVE_SZE;
-		}
-
-		/*
-		 * If we have gone negative, round back up. Allows us to run the 
-		 * oscillator backwards.
-		 */
-		while (wtp < 0)
-			wtp += ARPDCO_WAVE_SZE;
+		phase += waveCoreStep(ib[obp] * transp, shift);
 	}
 
-	local->wtp = wtp;
+	local->phase = phase;
 	local->cpwm = cpwm;
 	local->ssg = ssg;
 
@@ -543,9 +514,6 @@ arpdcoinit(bristolOP **operator, int index, int samplerate, int samplecount)
 
 	note_diff = pow(2, ((double) 1)/12);
 
-	if (sbuf == NULL)
-		sbuf = bristolmalloc(sizeof(float) * samplecount);
-
 	/*
 	 * Then the local parameters specific to this operator. These will be
 	 * the same for each operator, but must be init'ed in the local code.
@@ -559,6 +527,9 @@ arpdcoinit(bristolOP **operator, int index, int samplerate, int samplecount)
 	(*operator)->specs = (bristolOPSpec *) specs;
 	(*operator)->size = sizeof(bristolARPDCO);
 
+	specs->sbuf = bristolmalloc(sizeof(float) * samplecount);
+	specs->zbuf = bristolmalloc(sizeof(float) * samplecount);
+
 	/*
 	 * These are specific to this operator, and will need to be altered for
 	 * each operator.
@@ -573,36 +544,43 @@ arpdcoinit(bristolOP **operator, int index, int samplerate, int samplecount)
 	 * We are going to assign multiple waves to this oscillator.
 	 * sine, ramp, square, triangle?
 	 */
-	specs->wave[0] =
-		(float *) bristolmalloc(ARPDCO_WAVE_SZE * sizeof(float));
-	specs->wave[1] =
-		(float *) bristolmalloc(ARPDCO_WAVE_SZE * sizeof(float));
-	specs->wave[2] =
-		(float *) bristolmalloc(ARPDCO_WAVE_SZE * sizeof(float));
-	specs->wave[3] =
-		(float *) bristolmalloc(ARPDCO_WAVE_SZE * sizeof(float));
-	specs->wave[4] =
-		(float *) bristolmalloc(ARPDCO_WAVE_SZE * sizeof(float));
-	specs->wave[5] =
-		(float *) bristolmalloc(ARPDCO_WAVE_SZE * sizeof(float));
-	specs->wave[6] =
-		(float *) bristolmalloc(ARPDCO_WAVE_SZE * sizeof(float));
-	specs->wave[7] =
-		(float *) bristolmalloc(ARPDCO_WAVE_SZE * sizeof(float));
-	zbuf = (float *) bristolmalloc(ARPDCO_WAVE_SZE * sizeof(float));
+	specs->wave[0] = (float *) bristolmalloc(sizeof(float)
+		* (ARPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[1] = (float *) bristolmalloc(sizeof(float)
+		* (ARPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[2] = (float *) bristolmalloc(sizeof(float)
+		* (ARPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[3] = (float *) bristolmalloc(sizeof(float)
+		* (ARPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[4] = (float *) bristolmalloc(sizeof(float)
+		* (ARPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[5] = (float *) bristolmalloc(sizeof(float)
+		* (ARPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[6] = (float *) bristolmalloc(sizeof(float)
+		* (ARPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[7] = (float *) bristolmalloc(sizeof(float)
+		* (ARPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
 
 	/*
 	 * FillWave is something that should be called as a parameter change, but
 	 * for testing will load it here.
 	 */
 	fillWave(specs->wave[0], ARPDCO_WAVE_SZE, 0);
+	waveCoreGuard(specs->wave[0], ARPDCO_WAVE_SZE);
 	fillWave(specs->wave[1], ARPDCO_WAVE_SZE, 1);
+	waveCoreGuard(specs->wave[1], ARPDCO_WAVE_SZE);
 	fillWave(specs->wave[2], ARPDCO_WAVE_SZE, 2);
+	waveCoreGuard(specs->wave[2], ARPDCO_WAVE_SZE);
 	fillWave(specs->wave[3], ARPDCO_WAVE_SZE, 3);
+	waveCoreGuard(specs->wave[3], ARPDCO_WAVE_SZE);
 	fillWave(specs->wave[4], ARPDCO_WAVE_SZE, 4);
+	waveCoreGuard(specs->wave[4], ARPDCO_WAVE_SZE);
 	fillWave(specs->wave[5], ARPDCO_WAVE_SZE, 5);
+	waveCoreGuard(specs->wave[5], ARPDCO_WAVE_SZE);
 	fillWave(specs->wave[6], ARPDCO_WAVE_SZE, 6);
+	waveCoreGuard(specs->wave[6], ARPDCO_WAVE_SZE);
 	fillWave(specs->wave[7], ARPDCO_WAVE_SZE, 7);
+	waveCoreGuard(specs->wave[7], ARPDCO_WAVE_SZE);
 
 	/*
 	 * Now fill in the dco specs for this operator. These are specific to an
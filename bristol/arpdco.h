@@ -22,6 +22,8 @@
 #ifndef ARPDCO_H
 #define ARPDCO_H
 
+#include "wavecore.h"
+
 #define ARPDCO_WAVE_SZE 1024
 #define ARPDCO_WAVE_SZE_M 1023
 #define ARPDCO_WAVE_PWMIN 50
@@ -31,11 +33,13 @@
 typedef struct BristolARPDCO {
 	bristolOPSpec spec;
 	float *wave[8];
+	float *sbuf;
+	float *zbuf; /* Outputs nobody reads */
 } bristolARPDCO;
 
 typedef struct BristolARPDCOlocal {
 	unsigned int flags;
-	float wtp;
+	bristolPhase phase;
 	float cpwm;
 	float note_diff;
 	float lsv;
@@ -40,6 +40,27 @@ static void desequence(audioMain *am, Baudio *ba)
 	}
 }
 
+/*
+ * When following the clock the rate selects the step length in clock ticks
+ * from whole notes through triplets down to 1/32, slowest first.
+ */
+static int arpeggioDivisions[] = {
+	96, 72, 48, 36, 32, 24, 18, 16, 12, 9, 8, 6, 4, 3
+};
+
+static int
+arpeggioDivision(float value)
+{
+	int index = value * (sizeof(arpeggioDivisions) / sizeof(int) - 1) + 0.5;
+
+	if (index < 0)
+		index = 0;
+	else if (index >= sizeof(arpeggioDivisions) / sizeof(int))
+		index = sizeof(arpeggioDivisions) / sizeof(int) - 1;
+
+	return(arpeggioDivisions[index]);
+}
+
 /*
  * This is sent arpeggiator messages via controller BRISTOL_ARPEGGIATOR (125)
  * and does the configuration of the arpeggiator.
@@ -137,9 +158,10 @@ bristolArpeggiator(audioMain *audiomain, bristolMidiMsg *msg)
 			baudio->arpeggio.a.span = tval + 1;
 			break;
 		case BRISTOL_ARPEG_CLOCK:
-			if (value != 0)
+			if (value != 0) {
 				baudio->arpeggio.flags |= BRISTOL_A_CLOCK;
-			else
+				baudio->arpeggio.a.tick = audiomain->clock.tick - 1;
+			} else
 				baudio->arpeggio.flags &= ~BRISTOL_A_CLOCK;
 			break;
 		case BRISTOL_ARPEG_RATE:
@@ -148,6 +170,7 @@ bristolArpeggiator(audioMain *audiomain, bristolMidiMsg *msg)
 				audiomain->samplerate;
 			if (baudio->arpeggio.a.rate < baudio->arpeggio.a.count)
 				baudio->arpeggio.a.count = baudio->arpeggio.a.rate;
+			baudio->arpeggio.a.ticks = arpeggioDivision(value);
 			break;
 		case BRISTOL_ARPEG_TRIGGER:
 			/* retrigger */
@@ -202,9 +225,10 @@ bristolArpeggiator(audioMain *audiomain, bristolMidiMsg *msg)
 			baudio->arpeggio.s.span = tval + 1;
 			break;
 		case BRISTOL_SEQ_CLOCK:
-			if (value != 0)
+			if (value != 0) {
 				baudio->arpeggio.flags |= BRISTOL_S_CLOCK;
-			else
+				baudio->arpeggio.s.tick = audiomain->clock.tick - 1;
+			} else
 				baudio->arpeggio.flags &= ~BRISTOL_S_CLOCK;
 			break;
 		case BRISTOL_SEQ_RATE:
@@ -215,6 +239,7 @@ bristolArpeggiator(audioMain *audiomain, bristolMidiMsg *msg)
 				audiomain->samplerate;
 			if (baudio->arpeggio.s.rate < baudio->arpeggio.s.count)
 				baudio->arpeggio.s.count = baudio->arpeggio.s.rate;
+			baudio->arpeggio.s.ticks = arpeggioDivision(value);
 			break;
 		case BRISTOL_SEQ_TRIGGER:
 			/* retrigger */
@@ -523,90 +548,162 @@ bristolArpeggiatorNoteEvent(Baudio *baudio, bristolMidiMsg *msg)
 }
 
 /*
- * Take a sequence structure, roll its counters, then see what we have to
- * do with the index selections for key and octave.
+ * Move the sequence index selections for key and octave on one step.
  */
-static int
-arpeggioCounterCheck(arpSeq *seq, int samplecount)
+static void
+arpeggioStep(arpSeq *seq)
 {
-	if ((seq->count -= samplecount) <= 0)
-	{
-		seq->count += seq->rate;
-
-		switch (seq->dir) {
-			case BRISTOL_ARPEG_UP:
-			default:
-				if (++seq->current >= seq->max)
+	switch (seq->dir) {
+		case BRISTOL_ARPEG_UP:
+		default:
+			if (++seq->current >= seq->max)
+			{
+				seq->current = 0;
+				/*
+				 * See if we need to move up an octave
+				 */
+				if (++seq->octave > seq->span)
+					seq->octave = 1;
+			}
+			break;
+		case BRISTOL_ARPEG_DOWN:
+			if (--seq->current < 0)
+			{
+				seq->current = seq->max - 1;
+				/*
+				 * See if we need to move down an octave
+				 */
+				if (--seq->octave <= 0)
+					seq->octave = seq->span;
+			}
+			break;
+		case BRISTOL_ARPEG_UD:
+			if ((seq->current += seq->step) < 0)
+			{
+				/*
+				 * We have gone through all the notes on the way
+				 * down, see if we have got to bottom octave
+				 */
+				if (--seq->octave <= 0)
 				{
-					seq->current = 0;
 					/*
-					 * See if we need to move up an octave
+					 * Start going back up. The s.current is moved to
+					 * 1 since we have already played zero and I do not
+					 * want two strikes on the first and last notes.
+					 * We might tweak that idea though, it fails if we 
+					 * only have a single note.
 					 */
-					if (++seq->octave > seq->span)
-						seq->octave = 1;
-				}
-				break;
-			case BRISTOL_ARPEG_DOWN:
-				if (--seq->current < 0)
-				{
+					seq->current = 0;
+					seq->step = 1;
+					seq->octave = 1;
+				} else
+					/* Continue down through another octave */
 					seq->current = seq->max - 1;
-					/*
-					 * See if we need to move down an octave
-					 */
-					if (--seq->octave <= 0)
-						seq->octave = seq->span;
-				}
-				break;
-			case BRISTOL_ARPEG_UD:
-				if ((seq->current += seq->step) < 0)
+			} else if (seq->current >= seq->max) {
+				if (++seq->octave > seq->span)
 				{
 					/*
-					 * We have gone through all the notes on the way
-					 * down, see if we have got to bottom octave
+					 * Start going back down
 					 */
-					if (--seq->octave <= 0)
-					{
-						/*
-						 * Start going back up. The s.current is moved to
-						 * 1 since we have already played zero and I do not
-						 * want two strikes on the first and last notes.
-						 * We might tweak that idea though, it fails if we 
-						 * only have a single note.
-						 */
-						seq->current = 0;
-						seq->step = 1;
-						seq->octave = 1;
-					} else
-						/* Continue down through another octave */
-						seq->current = seq->max - 1;
-				} else if (seq->current >= seq->max) {
-					if (++seq->octave > seq->span)
-					{
-						/*
-						 * Start going back down
-						 */
-						seq->current = seq->max - 1;
-						seq->step = -1;
-						seq->octave = seq->span;
-					} else
-						/* Continue up through this octave */
-						seq->current = 0;
-				}
-				break;
-			case BRISTOL_ARPEG_RND:
-				/*
-				 * We need to take a random note from a random octave
-				 */
-				seq->current = (rand() & 0x00ff) % seq->max;
-				seq->octave = ((rand() & 0x00003) % seq->span) + 1;
-				break;
-		}
+					seq->current = seq->max - 1;
+					seq->step = -1;
+					seq->octave = seq->span;
+				} else
+					/* Continue up through this octave */
+					seq->current = 0;
+			}
+			break;
+		case BRISTOL_ARPEG_RND:
+			/*
+			 * We need to take a random note from a random octave
+			 */
+			seq->current = (rand() & 0x00ff) % seq->max;
+			seq->octave = ((rand() & 0x00003) % seq->span) + 1;
+			break;
+	}
+}
+
+/*
+ * Take a sequence structure, roll its counters, then see what we have to
+ * do with the index selections for key and octave. The count is the number
+ * of frames from the start of this period to the next step so the step can
+ * be given to the voices at its frame offset rather than at the start of the
+ * period, that way the rate does not drift with the period size. With short
+ * rates and long periods there may be more than one step per period, only
+ * the last one will be heard.
+ */
+static int
+arpeggioCounterCheck(arpSeq *seq, int samplecount)
+{
+	int stepped = -1;
+
+	seq->d_offset = -1;
+
+	/* Nothing has set a rate, stepping would never catch up with the period */
+	if (seq->rate <= 0)
+		return(-1);
+
+	while (seq->count < samplecount)
+	{
+		seq->d_offset = seq->count < 0? 0:seq->count;
+		seq->count += seq->rate;
+
+		arpeggioStep(seq);
+
 		/*
 		 * have wound the counters, tell parent to retrigger
 		 */
-		return(1);
+		stepped = 1;
 	}
-	return(-1);
+
+	seq->count -= samplecount;
+
+	return(stepped);
+}
+
+/*
+ * The same for a sequence that is following the external clock. The steps are
+ * placed on the predicted tick times from the clock filter. We only freewheel
+ * for a beat past the last tick received so that if the clock goes away the
+ * sequence stops rather than running on at the last tempo.
+ */
+static int
+arpeggioClockCheck(arpSeq *seq, arpClock *clock, int samplecount)
+{
+	double t;
+	int k, stepped = -1;
+
+	seq->d_offset = -1;
+
+	if ((~clock->flags & BRISTOL_CLOCK_RUN)
+		|| (~clock->flags & BRISTOL_CLOCK_LOCK))
+		return(-1);
+
+	/*
+	 * Do not try to catch up on ticks that went by whilst we were not synced
+	 */
+	if ((k = seq->tick + 1) < clock->tick - 1)
+		k = clock->tick - 1;
+
+	for (; k <= clock->tick + BRISTOL_CLOCK_AHEAD; k++)
+	{
+		if ((t = clock->t1 + (k - clock->tick) * clock->period - clock->frame)
+			>= samplecount)
+			break;
+
+		seq->tick = k;
+
+		if ((k % seq->ticks) != 0)
+			continue;
+
+		seq->d_offset = t < 0? 0:(int) t;
+
+		arpeggioStep(seq);
+
+		stepped = 1;
+	}
+
+	return(stepped);
 }
 
 /*
@@ -624,12 +721,17 @@ int
 bristolArpegReAudio(audioMain *audiomain, Baudio *baudio)
 {
 	baudio->arpeggio.flags &= ~BRISTOL_REQ_TRIGGER;
+	baudio->arpeggio.a.d_offset = baudio->arpeggio.s.d_offset = -1;
 
 	if (baudio->mixflags & BRISTOL_ARPEGGIATE)
 	{
 		if (baudio->arpeggio.flags & BRISTOL_POLY_2)
 			baudio->arpeggio.a.count = 8;
-		else if (arpeggioCounterCheck(&baudio->arpeggio.a,
+		else if (baudio->arpeggio.flags & BRISTOL_A_CLOCK) {
+			if (arpeggioClockCheck(&baudio->arpeggio.a, &audiomain->clock,
+				audiomain->samplecount) >= 0)
+				baudio->arpeggio.flags |= BRISTOL_REQ_TRIGGER;
+		} else if (arpeggioCounterCheck(&baudio->arpeggio.a,
 			audiomain->samplecount) >= 0)
 			baudio->arpeggio.flags |= BRISTOL_REQ_TRIGGER;
 		baudio->arpeggio.flags &= ~BRISTOL_DONE_FIRST;
@@ -646,8 +748,12 @@ bristolArpegReAudio(audioMain *audiomain, Baudio *baudio)
 		if (baudio->arpeggio.flags & BRISTOL_SEQ_LEARN)
 			return(0);
 
-		if (arpeggioCounterCheck(&baudio->arpeggio.s, audiomain->samplecount)
-			>= 0)
+		if (baudio->arpeggio.flags & BRISTOL_S_CLOCK) {
+			if (arpeggioClockCheck(&baudio->arpeggio.s, &audiomain->clock,
+				audiomain->samplecount) >= 0)
+				baudio->arpeggio.flags |= BRISTOL_REQ_TRIGGER;
+		} else if (arpeggioCounterCheck(&baudio->arpeggio.s,
+			audiomain->samplecount) >= 0)
 			baudio->arpeggio.flags |= BRISTOL_REQ_TRIGGER;
 	}
 
@@ -657,8 +763,8 @@ bristolArpegReAudio(audioMain *audiomain, Baudio *baudio)
 int
 bristolArpegReVoice(Baudio *baudio, bristolVoice *voice, float sr)
 {
-	float dFreq = voice->dFreq;
-	int key = voice->key.key;
+	float dFreq = voice->dFreq, dfreq = voice->dfreq;
+	int key = voice->key.key, offset;
 
 	/*
 	 * See if we should move on to the next sequence in the chain.
@@ -749,6 +855,13 @@ bristolArpegReVoice(Baudio *baudio, bristolVoice *voice, float sr)
 	 * a retrigger and reorganise the glissando. The glissando algorithm should
 	 * also be based on powers.....
 	 */
+	if (baudio->mixflags & BRISTOL_ARPEGGIATE)
+		offset = baudio->arpeggio.a.d_offset;
+	else
+		offset = baudio->arpeggio.s.d_offset;
+
+	voice->aFreq = voice->afreq = 0.0f;
+
 	if (dFreq != voice->dFreq)
 	{
 		if (baudio->glide != 0) {
@@ -762,9 +875,29 @@ bristolArpegReVoice(Baudio *baudio, bristolVoice *voice, float sr)
 		} else {
 			voice->cFreq = voice->dFreq;
 			voice->cfreq = voice->dfreq;
+
+			/*
+			 * If the step fell inside this period then keep the previous
+			 * frequency up to the step, fillFreqTable() takes the step index
+			 * and fillFreqBuf() the frequency in Hz.
+			 */
+			if ((offset > 0) && (~voice->flags & BRISTOL_KEYON)
+				&& (~baudio->arpeggio.flags & BRISTOL_POLY_2))
+			{
+				voice->aFreq = dFreq;
+				voice->afreq = dfreq;
+			}
 		}
 	}
 
+	/*
+	 * Give the step offset to the envelopes for the retrigger. KEYON already
+	 * has its own offset from the MIDI event.
+	 */
+	if ((offset > 0) && (~voice->flags & BRISTOL_KEYON)
+		&& (~baudio->arpeggio.flags & BRISTOL_POLY_2))
+		voice->offset = offset;
+
 	/*
 	 * Trigger should be an arpeggiator flag
 	 */
@@ -814,8 +947,11 @@ bristolArpeggiatorInit(Baudio *baudio)
 	baudio->arpeggio.s.max = 4;
 	baudio->arpeggio.s.span = 1;
 	baudio->arpeggio.s.step = 1;
-	baudio->arpeggio.s.rate = 400000;
+	baudio->arpeggio.s.rate = baudio->arpeggio.a.rate = 400000;
 	baudio->arpeggio.s.current = 0;
+	baudio->arpeggio.s.ticks = baudio->arpeggio.a.ticks = BRISTOL_CLOCK_PPQN;
+	baudio->arpeggio.s.tick = baudio->arpeggio.a.tick = -1;
+	baudio->arpeggio.s.d_offset = baudio->arpeggio.a.d_offset = -1;
 
 	baudio->arpeggio.flags = 0;
 
@@ -830,3 +966,140 @@ bristolArpeggiatorInit(Baudio *baudio)
 	baudio->arpeggio.c.max = 4;
 }
 
+/*
+ * Put all the clocked sequences back to the given tick. Used when the clock
+ * is started or the transport relocated.
+ */
+static void
+arpeggioClockReset(audioMain *audiomain, int tick)
+{
+	Baudio *baudio;
+
+	for (baudio = audiomain->audiolist; baudio != NULL; baudio = baudio->next)
+		baudio->arpeggio.a.tick = baudio->arpeggio.s.tick = tick;
+}
+
+/*
+ * MIDI clock and transport, called from the audio thread with the frame offset
+ * of the event into the current period. The tick times are filtered with a
+ * second order DLL, the bandwidth is in cycles per tick and is low enough to
+ * take out the jitter of period sized MIDI delivery whilst still following
+ * tempo changes within a few beats.
+ */
+#define BRISTOL_CLOCK_BW 0.01
+#define BRISTOL_CLOCK_B (1.4142135 * 2 * M_PI * BRISTOL_CLOCK_BW)
+#define BRISTOL_CLOCK_C \
+	(2 * M_PI * BRISTOL_CLOCK_BW * 2 * M_PI * BRISTOL_CLOCK_BW)
+#define BRISTOL_CLOCK_RELOCK (BRISTOL_CLOCK_PPQN / 2)
+
+void
+bristolArpeggiatorClock(audioMain *audiomain, int command, int offset)
+{
+	arpClock *clock = &audiomain->clock;
+	double t, e;
+
+	/*
+	 * The JACK transport takes priority over MIDI clock whilst it is rolling
+	 */
+	if (clock->flags & BRISTOL_CLOCK_JACK)
+		return;
+
+	switch (command) {
+		case MIDI_RT_START:
+			clock->flags |= BRISTOL_CLOCK_RUN;
+			clock->tick = 0;
+			arpeggioClockReset(audiomain, -1);
+			return;
+		case MIDI_RT_CONTINUE:
+			clock->flags |= BRISTOL_CLOCK_RUN;
+			return;
+		case MIDI_RT_STOP:
+			clock->flags &= ~BRISTOL_CLOCK_RUN;
+			return;
+		case MIDI_RT_CLOCK:
+			break;
+		default:
+			return;
+	}
+
+	t = clock->frame + offset;
+	e = t - clock->t1;
+
+	if ((clock->flags & BRISTOL_CLOCK_LOCK)
+		&& (fabs(e) > clock->period * BRISTOL_CLOCK_RELOCK))
+		/*
+		 * The clock went away for a while or jumped, start again.
+		 */
+		clock->flags &= ~(BRISTOL_CLOCK_LOCK|BRISTOL_CLOCK_FIRST);
+
+	if (~clock->flags & BRISTOL_CLOCK_FIRST)
+	{
+		clock->flags |= BRISTOL_CLOCK_FIRST;
+		clock->t0 = t;
+		clock->tick++;
+		return;
+	}
+
+	if (~clock->flags & BRISTOL_CLOCK_LOCK)
+	{
+		/*
+		 * Second tick, take the tempo from the interval to start the loop.
+		 */
+		if ((clock->period = t - clock->t0) < 1.0)
+			clock->period = 1.0;
+		clock->t0 = t;
+		clock->t1 = t + clock->period;
+		clock->flags |= BRISTOL_CLOCK_LOCK;
+		clock->tick++;
+		return;
+	}
+
+	clock->t0 = t;
+	clock->t1 += BRISTOL_CLOCK_B * e + clock->period;
+	clock->period += BRISTOL_CLOCK_C * e;
+	clock->tick++;
+}
+
+/*
+ * Called from the JACK process callback with the transport state, tempo and
+ * the position in quarter notes at the start of this period. The tick times
+ * are taken directly from the transport, there is no jitter to filter.
+ */
+void
+bristolArpeggiatorTransport(audioMain *audiomain, int rolling, double bpm,
+double beat)
+{
+	arpClock *clock = &audiomain->clock;
+	double pos, expect;
+	int tick;
+
+	if ((rolling == 0) || (bpm <= 0))
+	{
+		if (clock->flags & BRISTOL_CLOCK_JACK)
+			clock->flags &= ~(BRISTOL_CLOCK_RUN|BRISTOL_CLOCK_LOCK
+				|BRISTOL_CLOCK_FIRST|BRISTOL_CLOCK_JACK);
+		return;
+	}
+
+	pos = beat * BRISTOL_CLOCK_PPQN;
+	tick = (int) ceil(pos);
+
+	/*
+	 * See where we thought we were, if the transport has been started or
+	 * relocated then the sequences have to follow.
+	 */
+	if (clock->flags & BRISTOL_CLOCK_JACK)
+	{
+		expect = clock->tick - (clock->t1 - clock->frame) / clock->period;
+		if (fabs(pos - expect) > 1.0)
+			arpeggioClockReset(audiomain, tick - 1);
+	} else
+		arpeggioClockReset(audiomain, tick - 1);
+
+	clock->period = audiomain->samplerate * 60.0 / (bpm * BRISTOL_CLOCK_PPQN);
+	clock->tick = tick;
+	clock->t1 = clock->frame + (tick - pos) * clock->period;
+	clock->t0 = clock->t1 - clock->period;
+	clock->flags |= BRISTOL_CLOCK_RUN|BRISTOL_CLOCK_LOCK|BRISTOL_CLOCK_FIRST
+		|BRISTOL_CLOCK_JACK;
+}
@@ -23,18 +23,23 @@
 
 #include <math.h>
 #include <assert.h>
+#include <time.h>
+#if defined(__SSE__) || defined(__x86_64__)
+#include <xmmintrin.h>
+#endif
 
 #include "bristol.h"
 //#include "bristolmm.h"
 
 #include "dco.h"
+#include "noisecore.h"
 
 extern tableEntry defaultTable[];
 extern void freeBristolAudio();
 static void a440();
 
 #ifndef BRISTOL_SEMAPHORE
-extern void rbMidiNote(audioMain *, bristolMidiMsg *);
+extern void rbMidiNote(audioMain *, bristolEventMsg *);
 #endif
 
 /*
@@ -42,6 +47,96 @@ extern void rbMidiNote(audioMain *, bristolMidiMsg *);
  */
 int s440holder = 0;
 
+/*
+ * Filter, reverb and chorus feedback decays towards zero when a note is
+ * released and the tails end up as denormals, which cost tens to hundreds of
+ * cycles per operation on most FPUs. Flush them to zero in hardware unless
+ * -denormals asked us not to. The mode is per thread and the audio thread may
+ * belong to the driver, so this is called every period, it only writes the
+ * control register when the mode changes. The previous control register is
+ * returned for bristolDenormalsRestore(), a thread that is not ours, the one
+ * calling bristolEngineProcess(), should get its own mode back.
+ */
+#if defined(__SSE__) || defined(__x86_64__)
+#if defined(__SSE2__) || defined(__x86_64__)
+#define BRISTOL_FTZ 0x8040 /* MXCSR flush to zero and denormals are zero */
+#else
+#define BRISTOL_FTZ 0x8000 /* Early SSE may not have DAZ */
+#endif
+#endif
+
+unsigned long
+bristolDenormals(audioMain *audiomain)
+{
+#if defined(BRISTOL_FTZ)
+	unsigned int csr = _mm_getcsr(), mode;
+
+	if (audiomain->denormals)
+		mode = csr & ~BRISTOL_FTZ;
+	else
+		mode = csr | BRISTOL_FTZ;
+
+	if (mode != csr)
+		_mm_setcsr(mode);
+
+	return(csr);
+#elif defined(__aarch64__)
+	unsigned long fpcr, mode;
+
+	__asm__ __volatile__ ("mrs %0, fpcr" : "=r" (fpcr));
+
+	/* FZ, bit 24, covers both inputs and results */
+	if (audiomain->denormals)
+		mode = fpcr & ~(1UL << 24);
+	else
+		mode = fpcr | (1UL << 24);
+
+	if (mode != fpcr)
+		__asm__ __volatile__ ("msr fpcr, %0" : : "r" (mode));
+
+	return(fpcr);
+#elif defined(__arm__) && defined(__ARM_FP)
+	unsigned int fpscr, mode;
+
+	__asm__ __volatile__ ("vmrs %0, fpscr" : "=r" (fpscr));
+
+	if (audiomain->denormals)
+		mode = fpscr & ~(1U << 24);
+	else
+		mode = fpscr | (1U << 24);
+
+	if (mode != fpscr)
+		__asm__ __volatile__ ("vmsr fpscr, %0" : : "r" (mode));
+
+	return(fpscr);
+#else
+	return(0);
+#endif
+}
+
+void
+bristolDenormalsRestore(unsigned long previous)
+{
+#if defined(BRISTOL_FTZ)
+	if (_mm_getcsr() != (unsigned int) previous)
+		_mm_setcsr((unsigned int) previous);
+#elif defined(__aarch64__)
+	unsigned long fpcr;
+
+	__asm__ __volatile__ ("mrs %0, fpcr" : "=r" (fpcr));
+
+	if (fpcr != previous)
+		__asm__ __volatile__ ("msr fpcr, %0" : : "r" (previous));
+#elif defined(__arm__) && defined(__ARM_FP)
+	unsigned int fpscr;
+
+	__asm__ __volatile__ ("vmrs %0, fpscr" : "=r" (fpscr));
+
+	if (fpscr != (unsigned int) previous)
+		__asm__ __volatile__ ("vmsr fpscr, %0" : : "r" (previous));
+#endif
+}
+
 static void
 bristolUnlinkVoice(audioMain *audiomain, bristolVoice *v)
 {
@@ -84,6 +179,404 @@ bristolUnlinkVoice(audioMain *audiomain, bristolVoice *v)
 	audiomain->freelast = vtp;
 }
 
+/*
+ * Run one effect over a pair of buffers, in place. The effect should have
+ * some method of indicating its desired data flows - mono in/stereo out, or
+ * fully stereo, etc. At the moment there is one flag for stereo which
+ * indicates stereo in/out. Without this flag the assumption for an effect is
+ * mono in/stereo out.
+ */
+static void
+doEffect(audioMain *audiomain, bristolSound *effect, bristolOPParams *param,
+bristolVoice *voice, char *locals, float *left, float *right)
+{
+	bristolOP *op = audiomain->palette[effect->index];
+
+	if (op->flags & BRISTOL_FX_STEREO)
+	{
+		op->specs->io[0].buf = left;
+		op->specs->io[1].buf = right;
+		op->specs->io[2].buf = left;
+		op->specs->io[3].buf = right;
+	} else {
+		op->specs->io[0].buf = left;
+		op->specs->io[1].buf = left;
+		op->specs->io[2].buf = right;
+	}
+
+	effect->operate(op, voice, param, locals);
+}
+
+static int
+onFXBus(bristolFXBus *bus, int index)
+{
+	int i;
+
+	for (i = 0; i < bus->count; i++)
+		if (bus->op[i] == index)
+			return(1);
+
+	return(0);
+}
+
+/*
+ * Take the send out of the emulation's buffers. A mono emulation has nothing
+ * in the right buffer until an effect has made it stereo.
+ */
+static void
+fxBusTap(audioMain *audiomain, Baudio *thisaudio, int stereo)
+{
+	float *left = thisaudio->leftbuf, *right = thisaudio->rightbuf;
+	float *sendl = thisaudio->fxleft, *sendr = thisaudio->fxright;
+	float send = thisaudio->fxsend;
+	int i;
+
+	if (!stereo)
+		right = left;
+
+	for (i = 0; i < audiomain->samplecount; i++)
+	{
+		sendl[i] = left[i] * send;
+		sendr[i] = right[i] * send;
+	}
+
+	for (i = 0; i < audiomain->samplecount; i++)
+		left[i] -= sendl[i];
+
+	if (stereo)
+		for (i = 0; i < audiomain->samplecount; i++)
+			right[i] -= sendr[i];
+
+	thisaudio->fxtapped = 1;
+}
+
+/*
+ * The bus effect takes the settings of its owner's own instance of it. Only
+ * the float values, the operators keep their delay lines in the memory and
+ * use the int values as flags to resize them.
+ */
+static bristolOPParams *
+fxBusParams(bristolFXBus *bus, int i)
+{
+	bristolParamSpec *from, *to = bus->effect[i]->param->param;
+	Baudio *baudio = bus->owner[i];
+	int n, j;
+
+	if ((baudio == NULL) || (baudio->effect == NULL))
+		return(bus->effect[i]->param);
+
+	for (n = 0; (n < baudio->soundCount) && (baudio->effect[n] != NULL); n++)
+	{
+		if (baudio->effect[n]->index != bus->op[i])
+			continue;
+
+		from = baudio->effect[n]->param->param;
+
+		for (j = 0; j < BRISTOL_PARAM_COUNT; j++)
+			to[j].float_val = from[j].float_val;
+		break;
+	}
+
+	return(bus->effect[i]->param);
+}
+
+/*
+ * Only the ENV and 5 stage envelopes shorten their release for KEYSTEAL, the
+ * voice is given BRISTOL_STEAL_TIME and the period that ends it and is then
+ * cut off if its envelopes have not finished it.
+ */
+static void
+bristolStealFlags(audioMain *audiomain, bristolVoice *voice)
+{
+	voice->flags |= BRISTOL_KEYOFF|BRISTOL_KEYSTEAL;
+	voice->steal = (int) (BRISTOL_STEAL_TIME * audiomain->samplerate
+		/ audiomain->samplecount) + 2;
+}
+
+static void
+bristolStealVoice(audioMain *audiomain, bristolVoice *voice)
+{
+	bristolStealFlags(audiomain, voice);
+	voice->baudio->lvoices--;
+	audiomain->vbudget.stolen++;
+
+	BRISTOL_TRACE_INSTANT("steal", voice->keyid, voice->baudio->sid);
+}
+
+/*
+ * Work out how many voices fit into the budgeted part of the period from the
+ * measured cost per voice and steal any excess. Voices that are already
+ * releasing go first, then the oldest at the tail of the playlist. An
+ * emulation keeps its reserved voices and a monophonic one its single voice.
+ * Stolen voices are keyed off with a fast release so they are gone within a
+ * period or two, that is better than letting the period overrun.
+ */
+static void
+bristolVoiceSteal(audioMain *audiomain)
+{
+	bristolVoiceBudget *vb = &audiomain->vbudget;
+	bristolVoice *voice;
+	int active = 0, excess;
+
+	if ((vb->budget <= 0) || (vb->cost <= 0))
+		return;
+
+	if ((vb->limit = vb->budget * audiomain->samplecount
+		/ (audiomain->samplerate * vb->cost)) < 1)
+		vb->limit = 1;
+
+	for (voice = audiomain->playlist; voice != NULL; voice = voice->next)
+		if ((voice->baudio != NULL)
+			&& ((voice->flags & (BRISTOL_KEYSTEAL|BRISTOL_KEYDONE)) == 0))
+			active++;
+
+	if ((excess = active - vb->limit) <= 0)
+		return;
+
+	for (voice = audiomain->playlast; (voice != NULL) && (excess > 0);
+		voice = voice->last)
+	{
+		if ((voice->baudio == NULL) || (voice->baudio->voicecount == 1)
+			|| (voice->flags & (BRISTOL_KEYSTEAL|BRISTOL_KEYDONE))
+			|| (~voice->flags & BRISTOL_KEYOFFING))
+			continue;
+
+		bristolStealVoice(audiomain, voice);
+		excess--;
+	}
+
+	for (voice = audiomain->playlast; (voice != NULL) && (excess > 0);
+		voice = voice->last)
+	{
+		if ((voice->baudio == NULL) || (voice->baudio->voicecount == 1)
+			|| (voice->flags & (BRISTOL_KEYSTEAL|BRISTOL_KEYDONE))
+			|| (voice->baudio->lvoices <= voice->baudio->reserved))
+			continue;
+
+		bristolStealVoice(audiomain, voice);
+		excess--;
+	}
+}
+
+/*
+ * Render one voice. Ops is the audioMain the emulation is given, for a worker
+ * that is its own copy carrying the worker palette, anything the engine
+ * accounts for goes to audiomain.
+ */
+static int
+bristolRenderVoice(audioMain *audiomain, audioMain *ops, bristolVoice *voice,
+float *startbuf)
+{
+	if (voice->flags & BRISTOL_KEYDONE)
+		return(0);
+
+	/*
+	 * If this audio is mono, and count is zero and SUSTAIN is not
+	 * active then signal KEY_OFF, clear extreme note;
+	 */
+	if ((voice->baudio->voicecount == 1)
+		&& (voice->baudio->notemap.flags
+			& (BRISTOL_MNL_LNP|BRISTOL_MNL_HNP))
+		&& (voice->baudio->notemap.count == 0)
+		&& (voice->baudio->notemap.extreme >= 0)
+		&& (voice->baudio->contcontroller[BRISTOL_CC_HOLD1] < 0.5))
+	{
+		if (voice->baudio->midiflags & BRISTOL_MIDI_DEBUG1)
+			printf("engine cleared MNL note\n");
+		voice->baudio->notemap.extreme = -1;
+		voice->flags |= BRISTOL_KEYOFF;
+		voice->flags &= ~BRISTOL_KEYSUSTAIN;
+	}
+
+	if (voice->baudio->mixflags & BRISTOL_MUST_PRE)
+	{
+		if (voice->baudio->preops)
+		{
+			BRISTOL_TRACE_BEGIN("preops", 0, voice->baudio->sid);
+			voice->baudio->preops(ops, voice->baudio, voice, startbuf);
+			BRISTOL_TRACE_END("preops");
+		}
+
+		/*
+		 * Keep a pointer to the first voice that was active on any 
+		 * given bristolAudio sound. This is the most recent keypress.
+		 */
+		voice->baudio->firstVoice = voice;
+		voice->baudio->mixflags &= ~BRISTOL_MUST_PRE;
+		voice->baudio->mixflags |= BRISTOL_HAVE_OPED;
+	}
+
+	/*
+	 * Do something - find the buffers and put them in the IO structures
+	 * then get the locals and params, and call the operator, summing
+	 * the outputs into our single float buf.
+	 *
+	 * Each voice, or channel if you want, has its own independent 
+	 * limit on voice counts. This strange hack works only if we have
+	 * allocated a new voice to the head of the list. If we stole an
+	 * existing voice or two it may fail however that is unlikely
+	 * since it requires a full set of notes for a single emulation
+	 * and most of them only request a subset of those available.
+	 * Having said that, if we steal voices then the count does not
+	 * increase anyway.
+	 */
+	if ((++voice->baudio->cvoices > voice->baudio->voicecount)
+		&& (~voice->flags & BRISTOL_KEYSTEAL))
+	{
+		/*
+		 * The assignment code should avoid this situation, if it
+		 * happens the voice gets a fast release rather than being
+		 * cut off. Workers can get here at the same time.
+		 */
+		BRISTOL_TRACE_INSTANT("overvoice", voice->keyid,
+			voice->baudio->sid);
+		__sync_fetch_and_add(&audiomain->telemetry.steals, 1);
+
+		bristolStealFlags(audiomain, voice);
+	}
+
+	/* The old cut, for a stolen voice its envelopes did not release */
+	if ((voice->flags & BRISTOL_KEYSTEAL) && (--voice->steal < 0))
+	{
+		BRISTOL_TRACE_INSTANT("stealcut", voice->keyid, voice->baudio->sid);
+		voice->flags |= BRISTOL_KEYDONE;
+		return(0);
+	}
+
+	/*
+	 * If we are arpeggiating or sequencing we need to check on rolling
+	 * this voice along, and need a couple of sanity checks.
+	 */
+	if (((voice->baudio->mixflags
+		& (BRISTOL_SEQUENCE|BRISTOL_ARPEGGIATE))
+		&& (bristolArpegReVoice(voice->baudio, voice,
+			(float) audiomain->samplerate) < 0))
+		|| ((voice->locals == 0) || (voice->locals[voice->index] == 0)))
+		return(0);
+
+	BRISTOL_TRACE_BEGIN("voice", voice->keyid, voice->baudio->sid);
+	voice->baudio->operate(ops, voice->baudio, voice, startbuf);
+	BRISTOL_TRACE_END("voice");
+
+	if ((voice->baudio->voicecount == 1)
+		&& (voice->baudio->notemap.flags 
+			& (BRISTOL_MNL_LNP|BRISTOL_MNL_HNP)))
+		voice->flags &= ~BRISTOL_KEYDONE;
+
+	/*
+	 * We should not do this, startbuf should be maintained across
+	 * all synths.....
+	 */
+	bristolbzero(startbuf, audiomain->iosize);
+
+	return(1);
+}
+
+static void
+bristolPostops(audioMain *ops, Baudio *thisaudio, float *startbuf)
+{
+	if ((thisaudio->postops == NULL)
+		|| (thisaudio->mixflags & (BRISTOL_HOLDDOWN|BRISTOL_REMOVE))
+		|| ((thisaudio->mixflags & BRISTOL_HAVE_OPED) == 0))
+		return;
+
+	BRISTOL_TRACE_BEGIN("postops", 0, thisaudio->sid);
+	thisaudio->postops(ops, thisaudio, thisaudio->firstVoice, startbuf);
+	BRISTOL_TRACE_END("postops");
+}
+
+/*
+ * nc-17/06/02:
+ * There are larger considerations for stereo effects - these can be
+ * single input or stereo input. Taking a stereo effect (in/out) into
+ * an effect that takes mono input will not give the anticipated 
+ * results, obviously, but is beyond the scope of this piece of code.
+ *
+ * The chain runs until the first empty slot in the effect list. Returns 1 if
+ * any effect ran, they are all stereo, 0 if there are none and -1 if the
+ * emulation has effects but nothing to run them with yet so it should not be
+ * mixed.
+ */
+static int
+bristolAudioEffects(audioMain *ops, Baudio *thisaudio)
+{
+	int n, ran = 0;
+
+	if ((thisaudio->effect == NULL) || (thisaudio->effect[0] == NULL))
+		return(0);
+
+	if ((thisaudio->firstVoice == NULL)
+		|| (thisaudio->firstVoice->baudio == 0))
+		return(-1);
+
+#warning - this voice may have been reassigned. check MIDI channel
+	BRISTOL_TRACE_BEGIN("effects", 0, thisaudio->sid);
+	for (n = 0; (n < thisaudio->soundCount)
+		&& (thisaudio->effect[n] != NULL); n++)
+	{
+		/*
+		 * The send leaves ahead of the first effect the bus also has, the
+		 * direct share goes on through ours unless nothing is left of it.
+		 */
+		if ((thisaudio->fxsend > 0) && (thisaudio->fxleft != NULL)
+			&& (onFXBus(&ops->fxbus, thisaudio->effect[n]->index)))
+		{
+			if (!thisaudio->fxtapped)
+				fxBusTap(ops, thisaudio,
+					ran || (thisaudio->mixflags & BRISTOL_STEREO));
+			if (thisaudio->fxsend >= 1.0f)
+				continue;
+		}
+
+		doEffect(ops, thisaudio->effect[n], thisaudio->effect[n]->param,
+			thisaudio->firstVoice, thisaudio->FXlocals[0][n],
+			thisaudio->leftbuf, thisaudio->rightbuf);
+
+		ran = 1;
+	}
+	BRISTOL_TRACE_END("effects");
+
+	return(ran);
+}
+
+/*
+ * Everything a worker does for its own emulations in a period, in the same
+ * order as doAudioOps() does it for all of them. The playlist is only read
+ * here, the audio thread has done the list management before the workers
+ * were started.
+ */
+int
+bristolWorkerRender(audioMain *audiomain, audioMain *ops, float *startbuf,
+int worker)
+{
+	bristolVoice *voice;
+	Baudio *thisaudio;
+	int rendered = 0;
+
+	for (voice = audiomain->playlist; voice != NULL; voice = voice->next)
+		if ((voice->baudio != NULL) && (voice->baudio->worker == worker)
+			&& ((voice->baudio->mixflags
+				& (BRISTOL_HOLDDOWN|BRISTOL_REMOVE)) == 0))
+			rendered += bristolRenderVoice(audiomain, ops, voice, startbuf);
+
+	for (thisaudio = audiomain->audiolist; thisaudio != NULL;
+		thisaudio = thisaudio->next)
+		if (thisaudio->worker == worker)
+			bristolPostops(ops, thisaudio, startbuf);
+
+	for (voice = audiomain->playlist; voice != NULL; voice = voice->next)
+		if ((voice->baudio != NULL) && (voice->baudio->worker == worker))
+			voice->flags &= ~(BRISTOL_KEYON|BRISTOL_KEYREON);
+
+	for (thisaudio = audiomain->audiolist; thisaudio != NULL;
+		thisaudio = thisaudio->next)
+		if ((thisaudio->worker == worker)
+			&& ((thisaudio->mixflags & BRISTOL_HOLDDOWN) == 0))
+			thisaudio->fxout = bristolAudioEffects(ops, thisaudio);
+
+	return(rendered);
+}
+
 /*
  * This should be organised to be a callback for the JACK and DSSI interfaces.
  * there may be issues of internal buffering that will have to be reviewed, and
@@ -107,7 +600,20 @@ doAudioOps(audioMain *audiomain, float *outbuf, float *startbuf)
 	register int i;
 	register Baudio *thisaudio;
 	register float *extmult, *leftch, *rightch, gain;
-	bristolMidiMsg msg;
+	struct timespec vstart, vend;
+	int rendered = 0, fx;
+#ifndef BRISTOL_SEMAPHORE
+	bristolEventMsg *event;
+	size_t count;
+#endif
+
+	/*
+	 * Whichever driver calls us this is the audio thread, flag it so any
+	 * heap allocation from here on gets reported.
+	 */
+	bristolAllocRealtime(1);
+	bristolTraceThread("audio");
+	bristolDenormals(audiomain);
 
 	/*
 	 * Clear the output buffer at this point.
@@ -127,21 +633,36 @@ doAudioOps(audioMain *audiomain, float *outbuf, float *startbuf)
 	{
 #ifndef BRISTOL_SEMAPHORE
 		/*
-		 * This is not thread-safe. We should flag the rb as inactive.
+		 * Nobody to take the events, the MIDI thread drops them until an
+		 * emulation starts the ringbuffer again.
 		 */
 		jack_ringbuffer_stop(audiomain->rb);
-		jack_ringbuffer_reset(audiomain->rb);
 #endif
 		return(0);
 	}
 
+	BRISTOL_TRACE_BEGIN("period", audiomain->samplecount, 0);
+
 #ifndef BRISTOL_SEMAPHORE
-	while (jack_ringbuffer_read_space(audiomain->rb) >= sizeof(bristolMidiMsg))
+	/*
+	 * The emulation may have been linked in after we last looked at the list
+	 * and stopped the ringbuffer, start it again if so.
+	 */
+	if (jack_ringbuffer_stopped(audiomain->rb))
+		jack_ringbuffer_go(audiomain->rb);
+
+	/*
+	 * Events are taken in place a batch at a time, there are two batches at
+	 * most when the queue wraps.
+	 */
+	while ((count = jack_ringbuffer_peek_records(audiomain->rb,
+		sizeof(bristolEventMsg), (void **) &event)) > 0)
 	{
-		jack_ringbuffer_read(audiomain->rb, (char *) &msg,
-			sizeof(bristolMidiMsg));
+		for (i = 0; i < count; i++)
+			rbMidiNote(audiomain, &event[i]);
 
-		rbMidiNote(audiomain, &msg);
+		jack_ringbuffer_read_advance(audiomain->rb,
+			count * sizeof(bristolEventMsg));
 	}
 #endif
 
@@ -174,6 +695,7 @@ doAudioOps(audioMain *audiomain, float *outbuf, float *startbuf)
 
 				audiomain->atStatus = BRISTOL_TERM;
 				holder->mixflags &= ~BRISTOL_REMOVE;
+				BRISTOL_TRACE_END("period");
 				return(0);
 			}
 
@@ -219,6 +741,11 @@ doAudioOps(audioMain *audiomain, float *outbuf, float *startbuf)
 			&& (audiomain->audiolist->mixflags & A_440))
 		a440(audiomain, outbuf, audiomain->samplecount);
 
+	/*
+	 * The period of shared noise, before any voice or worker reads it.
+	 */
+	noiseCorePeriod(audiomain->samplecount);
+
 	/*
 	 * Get the long semaphore over the whole polyphonic process. We need to 
 	 * replace this with some message passing algorithms using something that
@@ -321,7 +848,8 @@ doAudioOps(audioMain *audiomain, float *outbuf, float *startbuf)
 			v->flags &= ~(BRISTOL_KEYDONE
 				|BRISTOL_KEYOFF
 				|BRISTOL_KEYOFFING
-				|BRISTOL_KEYSUSTAIN);
+				|BRISTOL_KEYSUSTAIN
+				|BRISTOL_KEYSTEAL);
 
 			if ((v->flags & BRISTOL_KEYREON) == 0)
 				v->flags |= BRISTOL_KEYON;
@@ -343,13 +871,22 @@ doAudioOps(audioMain *audiomain, float *outbuf, float *startbuf)
 #endif
 	}
 
+	if (audiomain->vbudget.budget > 0)
+	{
+		bristolVoiceSteal(audiomain);
+		clock_gettime(CLOCK_MONOTONIC, &vstart);
+	}
+
+	BRISTOL_TRACE_BEGIN("voices", 0, 0);
+
 	voice = audiomain->playlist;
 
 	/*
 	 * We need to look through our voice list, and see if any are active. If
 	 * so then start running the voice structures through the sound structures.
 	 *
-	 * This is the polyphonic mixing process.
+	 * This is the polyphonic mixing process. With workers this only does the
+	 * list management, the rendering is handed out below.
 	 */
 	while (voice != NULL)
 	{
@@ -359,7 +896,7 @@ doAudioOps(audioMain *audiomain, float *outbuf, float *startbuf)
 			if ((voice->baudio != NULL)
 				&& (voice->baudio->operate == NULL))
 			{
-				printf("this emulator is not implemented\n");
+				BRISTOL_TRACE_INSTANT("not implemented", voice->keyid, 0);
 				voice->baudio->notemap.flags
 					&= ~(BRISTOL_MNL_LNP|BRISTOL_MNL_HNP);
 			}
@@ -371,128 +908,56 @@ doAudioOps(audioMain *audiomain, float *outbuf, float *startbuf)
 			continue;
 		}
 
-		if (voice->baudio->mixflags & (BRISTOL_HOLDDOWN|BRISTOL_REMOVE))
-		{
-			voice = voice->next;
-			continue;
-		}
-
-		if (~voice->flags & BRISTOL_KEYDONE)
-		{
-			/*
-			 * If this audio is mono, and count is zero and SUSTAIN is not
-			 * active then signal KEY_OFF, clear extreme note;
-			 */
-			if ((voice->baudio->voicecount == 1)
-				&& (voice->baudio->notemap.flags
-					& (BRISTOL_MNL_LNP|BRISTOL_MNL_HNP))
-				&& (voice->baudio->notemap.count == 0)
-				&& (voice->baudio->notemap.extreme >= 0)
-				&& (voice->baudio->contcontroller[BRISTOL_CC_HOLD1] < 0.5))
-			{
-				if (voice->baudio->midiflags & BRISTOL_MIDI_DEBUG1)
-					printf("engine cleared MNL note\n");
-				voice->baudio->notemap.extreme = -1;
-				voice->flags |= BRISTOL_KEYOFF;
-				voice->flags &= ~BRISTOL_KEYSUSTAIN;
-			}
-
-			if (voice->baudio->mixflags & BRISTOL_MUST_PRE)
-			{
-				if (voice->baudio->preops)
-					voice->baudio->preops(audiomain,
-						voice->baudio, voice, startbuf);
+		if ((audiomain->pool == NULL) && ((voice->baudio->mixflags
+			& (BRISTOL_HOLDDOWN|BRISTOL_REMOVE)) == 0))
+			rendered += bristolRenderVoice(audiomain, audiomain, voice,
+				startbuf);
 
-				/*
-				 * Keep a pointer to the first voice that was active on any 
-				 * given bristolAudio sound. This is the most recent keypress.
-				 */
-				voice->baudio->firstVoice = voice;
-				voice->baudio->mixflags &= ~BRISTOL_MUST_PRE;
-				voice->baudio->mixflags |= BRISTOL_HAVE_OPED;
-			}
-
-			/*
-			 * Do something - find the buffers and put them in the IO structures
-			 * then get the locals and params, and call the operator, summing
-			 * the outputs into our single float buf.
-			 *
-			 * Each voice, or channel if you want, has its own independent 
-			 * limit on voice counts. This strange hack works only if we have
-			 * allocated a new voice to the head of the list. If we stole an
-			 * existing voice or two it may fail however that is unlikely
-			 * since it requires a full set of notes for a single emulation
-			 * and most of them only request a subset of those available.
-			 * Having said that, if we steal voices then the count does not
-			 * increase anyway.
-			 */
-			if (++voice->baudio->cvoices > voice->baudio->voicecount)
-			{
-				/*
-				 * This looks a bit brutal however the assignment code should
-				 * avoid this situation.
-				 */
-				if (voice->baudio->midiflags & BRISTOL_MIDI_DEBUG2)
-					printf("overvoice keydone\n");
-
-				voice->flags |= BRISTOL_KEYOFF;
-				voice = voice->next;
-				continue;
-			}
+		voice = voice->next;
+	}
 
-			/*
-			 * If we are arpeggiating or sequencing we need to check on rolling
-			 * this voice along, and need a couple of sanity checks.
-			 */
-			if (((voice->baudio->mixflags
-				& (BRISTOL_SEQUENCE|BRISTOL_ARPEGGIATE))
-				&& (bristolArpegReVoice(voice->baudio, voice,
-					(float) audiomain->samplerate) < 0))
-				|| ((voice->locals == 0) || (voice->locals[voice->index] == 0)))
-			{
-				voice = voice->next;
-				continue;
-			}
+	/*
+	 * The workers do the voices, postops and effects of their emulations and
+	 * we wait for all of them.
+	 */
+	if (audiomain->pool != NULL)
+		rendered = bristolWorkersRun(audiomain, startbuf);
 
-			voice->baudio->operate(audiomain,
-				voice->baudio, voice, startbuf);
+	BRISTOL_TRACE_END("voices");
 
-			if ((voice->baudio->voicecount == 1)
-				&& (voice->baudio->notemap.flags 
-					& (BRISTOL_MNL_LNP|BRISTOL_MNL_HNP)))
-				voice->flags &= ~BRISTOL_KEYDONE;
+	/*
+	 * Smoothed cost of a voice for the CPU budget, this includes the
+	 * emulation preops as they are part of what a voice costs. With workers
+	 * it is the wall time so it follows the parallel speedup.
+	 */
+	if ((audiomain->vbudget.budget > 0) && (rendered > 0))
+	{
+		float cost;
 
-			/*
-			 * We should not do this, startbuf should be maintained across
-			 * all synths.....
-			 */
-			bristolbzero(startbuf, audiomain->iosize);
-		}
+		clock_gettime(CLOCK_MONOTONIC, &vend);
+		cost = ((vend.tv_sec - vstart.tv_sec)
+			+ (vend.tv_nsec - vstart.tv_nsec) * 0.000000001f) / rendered;
 
-		voice = voice->next;
+		if (audiomain->vbudget.cost == 0)
+			audiomain->vbudget.cost = cost;
+		else
+			audiomain->vbudget.cost += (cost - audiomain->vbudget.cost) * 0.1f;
 	}
 
 	/*
 	 * See if any of the voices have postoperators configured.
 	 */
-	thisaudio = audiomain->audiolist;
-	while (thisaudio != NULL)
-	{
-		if (thisaudio->postops != NULL)
-		{
-			if (((thisaudio->mixflags & (BRISTOL_HOLDDOWN|BRISTOL_REMOVE)) == 0)
-				&& (thisaudio->mixflags & BRISTOL_HAVE_OPED))
-				thisaudio->postops(audiomain,
-					thisaudio, thisaudio->firstVoice, startbuf);
-		}
-		thisaudio = thisaudio->next;
-	}
+	if (audiomain->pool == NULL)
+		for (thisaudio = audiomain->audiolist; thisaudio != NULL;
+			thisaudio = thisaudio->next)
+			bristolPostops(audiomain, thisaudio, startbuf);
 
 	voice = audiomain->playlist;
 	while (voice != NULL)
 	{
 		voice->flags &= ~(BRISTOL_KEYON|BRISTOL_KEYREON);
 		voice->offset = -1;
+		voice->aFreq = voice->afreq = 0.0f;
 		voice = voice->next;
 	}
 
@@ -526,113 +991,26 @@ doAudioOps(audioMain *audiomain, float *outbuf, float *startbuf)
 		}
 
 		/*
-		 * nc-17/06/02:
-		 * At the moment this only works for a single effect on the list. Need
-		 * to add another for/while loop inside this if statement.
-		 * There are larger considerations for stereo effects - these can be
-		 * single input or stereo input. Taking a stereo effect (in/out) into
-		 * an effect that takes mono input will not give the anticipated 
-		 * results, obviously, but is beyond the scope of this piece of code.
+		 * A worker has already run the effects, an emulation that arrived
+		 * while they were busy waits for the next period.
 		 */
-		if ((thisaudio->effect != NULL) &&
-			(thisaudio->effect[0] != NULL))
+		if (audiomain->pool == NULL)
+			fx = bristolAudioEffects(audiomain, thisaudio);
+		else if (thisaudio->worker < 0)
+			fx = -1;
+		else
+			fx = thisaudio->fxout;
+
+		if (fx < 0)
 		{
-			int index;
-
-			index = (*thisaudio->effect[0]).index;
-			/*
-			 * One inbuf, two outbuf. The effect should have some method of
-			 * indicating its desired data flows - mono in/stereo out, or
-			 * fully stereo, etc. At the moment there is one flag for stereo
-			 * which indicates stereo in/out. Without this flag the assumption 
-			 * for an effect is mono in/stereo out.
-			 */
-			if (audiomain->palette[index]->flags & BRISTOL_FX_STEREO)
-			{
-				audiomain->palette[index]->specs->io[0].buf
-					= thisaudio->leftbuf;
-				audiomain->palette[index]->specs->io[1].buf
-					= thisaudio->rightbuf;
-				audiomain->palette[index]->specs->io[2].buf
-					= thisaudio->leftbuf;
-				audiomain->palette[index]->specs->io[3].buf
-					= thisaudio->rightbuf;
-			} else {
-				audiomain->palette[index]->specs->io[0].buf
-					= thisaudio->leftbuf;
-				audiomain->palette[index]->specs->io[1].buf
-					= thisaudio->leftbuf;
-				audiomain->palette[index]->specs->io[2].buf
-					= thisaudio->rightbuf;
-			}
-
-			if ((thisaudio->firstVoice == NULL)
-				|| (thisaudio->firstVoice->baudio == 0))
-			{
-				thisaudio = thisaudio->next;
-				continue;
-			}
-#warning - this voice may have been reassigned. check MIDI channel
-			if (thisaudio->firstVoice != NULL)
-				(*thisaudio->effect[0]).operate(
-					audiomain->palette[index],
-					thisaudio->firstVoice,
-					(*thisaudio->effect[0]).param,
-					thisaudio->FXlocals[0][0]);
-
-			/*
-			 * This is a quick hack to allow for two chained effects, it needs 
-			 * to be generalised for arbitrary links, but the ARP 2600 needed
-			 * two effects.
-			 */
-			if (thisaudio->effect[1] != NULL)
-			{
-				index = (*thisaudio->effect[1]).index;
-				/*
-				 * One inbuf, two outbuf. The effect should have some method of
-				 * indicating its desired data flows - mono in/stereo out, or
-				 * fully stereo, etc.
-				 */
-				if (audiomain->palette[index]->flags & BRISTOL_FX_STEREO)
-				{
-					audiomain->palette[index]->specs->io[0].buf
-						= thisaudio->leftbuf;
-					audiomain->palette[index]->specs->io[1].buf
-						= thisaudio->rightbuf;
-					audiomain->palette[index]->specs->io[2].buf
-						= thisaudio->leftbuf;
-					audiomain->palette[index]->specs->io[3].buf
-						= thisaudio->rightbuf;
-				} else {
-					audiomain->palette[index]->specs->io[0].buf
-						= thisaudio->leftbuf;
-					audiomain->palette[index]->specs->io[1].buf
-						= thisaudio->leftbuf;
-					audiomain->palette[index]->specs->io[2].buf
-						= thisaudio->rightbuf;
-				}
+			thisaudio = thisaudio->next;
+			continue;
+		}
 
-				if ((thisaudio->firstVoice == NULL)
-					|| (thisaudio->firstVoice->baudio == 0))
-				{
-					thisaudio = thisaudio->next;
-					continue;
-				}
-#warning - this voice may have been reassigned. check MIDI channel
-				if (thisaudio->firstVoice != NULL)
-					(*thisaudio->effect[1]).operate(
-						audiomain->palette[index],
-						thisaudio->firstVoice,
-						(*thisaudio->effect[1]).param,
-						thisaudio->FXlocals[1][1]);
-			}
+		rightch = (fx > 0)? thisaudio->rightbuf:NULL;
 
-			/*
-			 * If we have FX, apply them. They will all be stereo, and will
-			 * eventually also be chained.
-			 */
-			rightch = thisaudio->rightbuf;
-		} else {
+		if (rightch == NULL)
+		{
 			if (thisaudio->mixflags & BRISTOL_STEREO)
 				rightch = thisaudio->rightbuf;
 			else
@@ -648,6 +1026,49 @@ doAudioOps(audioMain *audiomain, float *outbuf, float *startbuf)
 
 		gain = thisaudio->gain;
 
+		/*
+		 * Add the send to the shared effects. If the effects did not take it
+		 * then it comes out of the direct signal here.
+		 */
+		if ((audiomain->fxbus.count > 0) && (thisaudio->fxsend > 0))
+		{
+			float send = gain * thisaudio->fxsend;
+			float *busl = audiomain->fxbus.leftbuf;
+			float *busr = audiomain->fxbus.rightbuf;
+
+			if (thisaudio->fxtapped)
+			{
+				for (i = 0; i < audiomain->samplecount; i++)
+				{
+					busl[i] += thisaudio->fxleft[i] * gain;
+					busr[i] += thisaudio->fxright[i] * gain;
+				}
+			} else {
+				for (i = 0; i < audiomain->samplecount; i++)
+				{
+					busl[i] += leftch[i] * send;
+					busr[i] += rightch[i] * send;
+				}
+
+				gain -= send;
+			}
+
+			audiomain->fxbus.voice = thisaudio->firstVoice;
+		}
+		thisaudio->fxtapped = 0;
+
+		/*
+		 * Emulations on a channel that a mixer track has selected go to the
+		 * mixer rather than directly to the output.
+		 */
+		if (bristolMixerInput(audiomain, thisaudio, leftch, rightch, gain))
+		{
+			bristolbzero(thisaudio->leftbuf, audiomain->segmentsize);
+			bristolbzero(thisaudio->rightbuf, audiomain->segmentsize);
+			thisaudio = thisaudio->next;
+			continue;
+		}
+
 /*
 		if ((gain = thisaudio->gain) == 0)
 			gain = 1.0;
@@ -679,6 +1100,50 @@ doAudioOps(audioMain *audiomain, float *outbuf, float *startbuf)
 
 		thisaudio = thisaudio->next;
 	}
+
+	/*
+	 * The shared effects run once on the summed sends. They keep running when
+	 * nothing is sending so that reverb and echo tails die away, they only
+	 * start once something has sent to them.
+	 */
+	if ((audiomain->fxbus.count > 0) && (audiomain->fxbus.voice != NULL))
+	{
+		bristolFXBus *bus = &audiomain->fxbus;
+
+		BRISTOL_TRACE_BEGIN("effects bus", bus->count, 0);
+		for (i = 0; i < bus->count; i++)
+			doEffect(audiomain, bus->effect[i], fxBusParams(bus, i),
+				bus->voice, bus->locals[i], bus->leftbuf, bus->rightbuf);
+		BRISTOL_TRACE_END("effects bus");
+
+		leftch = bus->leftbuf;
+		rightch = bus->rightbuf;
+		extmult = outbuf;
+
+		for (i = 0; i < audiomain->samplecount; i++)
+		{
+			*extmult++ += *leftch++;
+			*extmult++ += *rightch++;
+		}
+
+		bristolbzero(bus->leftbuf, audiomain->segmentsize);
+		bristolbzero(bus->rightbuf, audiomain->segmentsize);
+	}
+
+	if (audiomain->mixer != NULL)
+	{
+		BRISTOL_TRACE_BEGIN("mixer", 0, 0);
+		bristolMixerRender(audiomain, outbuf);
+		BRISTOL_TRACE_END("mixer");
+	}
+
+	/*
+	 * Running frame count for the arpeggiator clock.
+	 */
+	audiomain->clock.frame += audiomain->samplecount;
+
+	BRISTOL_TRACE_END("period");
+
 	return(0);
 }
 
@@ -705,8 +1170,18 @@ fillFreqBuf(Baudio *baudio, register bristolVoice *voice, register float *buf,
 		|| (baudio->glide == 0.0f))
 	{
 		/*
-		 * Note has no glide, just fill the table.
+		 * Note has no glide, just fill the table. If the arpeggiator stepped
+		 * within this period then the previous step runs up to the offset.
 		 */
+		if ((voice->afreq > 0.0f) && (voice->offset > 0))
+		{
+			for (i = 0; (i < voice->offset) && (i < size); i++)
+				*buf++ = voice->afreq;
+			for (; i < size; i++)
+				*buf++ = voice->dfreq;
+			return(0);
+		}
+
 		for (i = 0; i < size; i+=8)
 		{
 			*buf++ = voice->dfreq;
@@ -841,8 +1316,18 @@ printf("fft %f %f %1.12f\n", voice->cFreq, voice->dFreq, voice->cFreqmult);
 	{
 //printf("fft %f %f %i\n", voice->cFreq, voice->dFreq, voice->lastkey);
 		/*
-		 * Note has no glide, just fill the table.
+		 * Note has no glide, just fill the table. If the arpeggiator stepped
+		 * within this period then the previous step runs up to the offset.
 		 */
+		if ((voice->aFreq > 0.0f) && (voice->offset > 0))
+		{
+			for (i = 0; (i < voice->offset) && (i < size); i++)
+				*buf++ = voice->aFreq;
+			for (; i < size; i++)
+				*buf++ = voice->dFreq;
+			return(0);
+		}
+
 		for (i = 0; i < size; i+=8)
 		{
 			*buf++ = voice->dFreq;
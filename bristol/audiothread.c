@@ -46,10 +46,11 @@ extern int dupfd;
 extern char *outputfile;
 extern int buildCurrentTable(Baudio *, float);
 extern void initMicrotonalTable(fTab [], int);
+extern bristolSound *dropBristolOp(int, bristolOP *[]);
 
-static void initPalette();
-static void freePalette();
-static void resetAudioThread();
+void initPalette();
+void freePalette();
+void resetAudioThread();
 static void initMidiVoices();
 
 void mapVelocityCurve(int, float []);
@@ -85,6 +86,9 @@ audioThread(audioMain *audiomain)
 #if (BRISTOL_HAS_ALSA == 1)
 	else
 		device = bAAD;
+#else
+	else
+		device = bOAD;
 #endif
 
 	audiomain->opCount = BRISTOL_SYNTHCOUNT;
@@ -234,8 +238,15 @@ audioThread(audioMain *audiomain)
 		 * destination buffer, which we will write, on return, to the audio
 		 * device.
 		 */
-		if (bristolAudioRead(startbuf, audiomain->samplecount) < 0)
+		BRISTOL_TRACE_BEGIN("read", audiomain->samplecount, 0);
+		rr = bristolAudioRead(startbuf, audiomain->samplecount);
+		BRISTOL_TRACE_END("read");
+
+		if (rr < 0)
 		{
+			BRISTOL_TRACE_INSTANT("xrun", rr, 0);
+			audiomain->telemetry.xruns++;
+			audiomain->telemetry.restarts++;
 			printf("Audio device read issue\n");
 
 #ifdef _BRISTOL_DRAIN
@@ -268,6 +279,8 @@ audioThread(audioMain *audiomain)
 #endif
 		}
 
+		bristolTelemetryStart(audiomain);
+
 		/*
 		 * The startbuf is actually interleaved at the moment, something which
 		 * needs to be changed.
@@ -283,10 +296,20 @@ audioThread(audioMain *audiomain)
 		if (audiomain->outgain > 1)
 			llgain(outbuf, audiomain->samplecount, audiomain->outgain);
 
-		if ((rr = bristolAudioWrite(outbuf, audiomain->samplecount)) < 0)
+		bristolTelemetryEnd(audiomain, outbuf, 1.0f);
+
+		BRISTOL_TRACE_BEGIN("write", audiomain->samplecount, 0);
+		rr = bristolAudioWrite(outbuf, audiomain->samplecount);
+		BRISTOL_TRACE_END("write");
+
+		if (rr < 0)
 		{
+			BRISTOL_TRACE_INSTANT("xrun", rr, 1);
+
 			if (rr != -4)
 			{
+				audiomain->telemetry.xruns++;
+				audiomain->telemetry.restarts++;
 				printf("Audio device write issue: restart pl %i\n",
 					audiomain->preload);
 #ifdef _BRISTOL_DRAIN
@@ -413,6 +436,12 @@ bristolMidiController(Baudio *baudio, int NRP, float value)
 		case BRISTOL_NRP_GAIN:
 			baudio->gain = value * 64;
 			return(0);
+		case BRISTOL_NRP_FXSEND:
+			baudio->fxsend = value;
+			return(0);
+		case BRISTOL_NRP_RESERVE:
+			baudio->reserved = (int) (value * CONTROLLER_RANGE);
+			return(0);
 		case BRISTOL_NRP_GLIDE:
 			baudio->glidemax = value * 30;
 			return(0);
@@ -696,6 +725,68 @@ mapVelocityCurve(int velocity, float map[128])
  * problems with timing and was eventually moved as a request from the MIDI
  * thread to the audio thread.
  */
+/*
+ * Emulations that share code can share its static buffers so they must not
+ * be rendered by two workers at once. The variants of a family use the name
+ * of the family for their profiles, hammond/hammondB3, prophet/prophet52,
+ * vox/voxM2, trilogy/trilogyODC, so the group is the first algorithm whose
+ * name is a prefix of ours or that ours is a prefix of.
+ */
+static int
+bristolWorkerGroup(int algo)
+{
+	char *name = bristolAlgos[algo].name, *other;
+	int i;
+
+	if (name == NULL)
+		return(algo);
+
+	for (i = 0; i < algo; i++)
+	{
+		if ((other = bristolAlgos[i].name) == NULL)
+			continue;
+
+		if ((strncmp(name, other, strlen(other)) == 0)
+			|| (strncmp(name, other, strlen(name)) == 0))
+			return(i);
+	}
+
+	return(algo);
+}
+
+/*
+ * Algorithm for an emulation name, the first one that has it, or -1.
+ */
+int
+bristolAlgoIndex(char *name)
+{
+	int i;
+
+	if (name == NULL)
+		return(-1);
+
+	for (i = 0; i < BRISTOL_SYNTHCOUNT; i++)
+		if ((bristolAlgos[i].initialise != NULL)
+			&& (bristolAlgos[i].name != NULL)
+			&& (strcmp(bristolAlgos[i].name, name) == 0))
+			return(i);
+
+	return(-1);
+}
+
+/*
+ * Name of an algorithm, NULL if there is no such emulation.
+ */
+char *
+bristolAlgoName(int algo)
+{
+	if ((algo < 0) || (algo >= BRISTOL_SYNTHCOUNT)
+		|| (bristolAlgos[algo].initialise == NULL))
+		return(NULL);
+
+	return(bristolAlgos[algo].name);
+}
+
 void
 initBristolAudio(audioMain *audiomain, Baudio *baudio)
 {
@@ -720,6 +811,12 @@ initBristolAudio(audioMain *audiomain, Baudio *baudio)
 	baudio->leftbuf = (float *) bristolmalloc0(audiomain->segmentsize);
 	baudio->rightbuf = (float *) bristolmalloc0(audiomain->segmentsize);
 
+	if (audiomain->fxbus.count > 0)
+	{
+		baudio->fxleft = (float *) bristolmalloc0(audiomain->segmentsize);
+		baudio->fxright = (float *) bristolmalloc0(audiomain->segmentsize);
+	}
+
 	baudio->glidemax = 5;
 
 	/*
@@ -746,6 +843,11 @@ initBristolAudio(audioMain *audiomain, Baudio *baudio)
 		bristolAlgos[(audiomain->midiflags & BRISTOL_PARAMMASK)].initialise
 			(audiomain, baudio);
 
+	/* No worker renders it until the next period hands it out */
+	baudio->wgroup
+		= bristolWorkerGroup(audiomain->midiflags & BRISTOL_PARAMMASK);
+	baudio->worker = -1;
+
 	/*
 	 * All of this could go into the midithread?
 	 */
@@ -843,23 +945,18 @@ initBristolAudio(audioMain *audiomain, Baudio *baudio)
 			printf("recovered\n");
 		}
 
-		if ((baudio->effect != NULL) && (baudio->effect[0] != NULL)
-			&& (baudio->soundCount != 0))
+		/*
+		 * Effect locals, the chain runs up to the first empty slot.
+		 */
+		for (j = 0; (baudio->effect != NULL) && (j < baudio->soundCount)
+			&& (baudio->effect[j] != NULL); j++)
 		{
-			op = (audiomain->effects)[(*baudio->effect[0]).index];
+			op = (audiomain->effects)[(*baudio->effect[j]).index];
 			if (op && op->specs)
-				baudio->FXlocals[i][0]
+				baudio->FXlocals[i][j]
 					= (char *) bristolmalloc0(op->specs->localsize);
 			else
-				baudio->FXlocals[i][0] = (char *) bristolmalloc0(256);
-		}
-
-		if ((baudio->soundCount > 1)
-			&& (baudio->effect != NULL) && (baudio->effect[1] != NULL))
-		{
-			op = (audiomain->effects)[(*baudio->effect[1]).index];
-			baudio->FXlocals[i][1]
-				= (char *) bristolmalloc0(op->specs->localsize);
+				baudio->FXlocals[i][j] = (char *) bristolmalloc0(256);
 		}
 
 		/*
@@ -896,6 +993,23 @@ initBristolAudio(audioMain *audiomain, Baudio *baudio)
 			baudio->valuemap[1][i] = (int) tmap[i];
 	}
 
+	/*
+	 * Only send to the shared effects by default if they replace one of our
+	 * own, the NRP can change that later.
+	 */
+	baudio->fxsend = 0;
+	for (j = 0; (baudio->effect != NULL) && (j < baudio->soundCount)
+		&& (baudio->effect[j] != NULL); j++)
+	{
+		for (i = 0; i < audiomain->fxbus.count; i++)
+			if (audiomain->fxbus.op[i] == baudio->effect[j]->index)
+			{
+				baudio->fxsend = audiomain->fxbus.send;
+				if (audiomain->fxbus.owner[i] == NULL)
+					audiomain->fxbus.owner[i] = baudio;
+			}
+	}
+
 	baudio->midi = bristolMidiController;
 	baudio->mixflags &= ~BRISTOL_HOLDDOWN;
 	baudio->lowkey = 0;
@@ -903,6 +1017,75 @@ initBristolAudio(audioMain *audiomain, Baudio *baudio)
 	audiomain->flags &= ~BRISTOL_AUDIOWAIT;
 }
 
+/*
+ * A bus effect owned by an emulation that is going passes to the oldest of
+ * the others that has the same effect, the list has the newest first.
+ */
+static void
+fxBusOwners(audioMain *audiomain, Baudio *leaving)
+{
+	bristolFXBus *bus = &audiomain->fxbus;
+	Baudio *baudio;
+	int i, j;
+
+	for (i = 0; i < bus->count; i++)
+	{
+		if (bus->owner[i] != leaving)
+			continue;
+
+		bus->owner[i] = NULL;
+
+		for (baudio = audiomain->audiolist; baudio != NULL;
+			baudio = baudio->next)
+		{
+			if ((baudio == leaving) || (baudio->effect == NULL))
+				continue;
+
+			for (j = 0; (j < baudio->soundCount)
+				&& (baudio->effect[j] != NULL); j++)
+				if (baudio->effect[j]->index == bus->op[i])
+					bus->owner[i] = baudio;
+		}
+	}
+}
+
+/*
+ * Build the shared effects chain requested with -fxbus. These are instances
+ * like any emulation's effects but with a single set of locals.
+ */
+static void
+initFXBus(audioMain *audiomain)
+{
+	bristolFXBus *bus = &audiomain->fxbus;
+	bristolOP *op;
+	int i;
+
+	if (bus->count == 0)
+		return;
+
+	bus->leftbuf = (float *) bristolmalloc0(audiomain->segmentsize);
+	bus->rightbuf = (float *) bristolmalloc0(audiomain->segmentsize);
+
+	for (i = 0; i < bus->count; i++)
+	{
+		if ((bus->op[i] < 0) || (bus->op[i] >= audiomain->opCount)
+			|| ((op = audiomain->palette[bus->op[i]]) == NULL))
+		{
+			printf("no operator %i for the effects bus\n", bus->op[i]);
+			bus->count = i;
+			break;
+		}
+
+		bus->effect[i] = dropBristolOp(bus->op[i], audiomain->palette);
+		bus->effect[i]->next = -1;
+		bus->effect[i]->flags = BRISTOL_SOUND_START|BRISTOL_SOUND_END;
+		bus->locals[i] = (char *) bristolmalloc0(op->specs->localsize);
+
+		if ((audiomain->debuglevel & BRISTOL_DEBUG_MASK) > BRISTOL_DEBUG1)
+			printf("effects bus %i: %s\n", i, bus->effect[i]->name);
+	}
+}
+
 void
 initAudioThread(audioMain *audiomain)
 {
@@ -933,17 +1116,37 @@ initAudioThread(audioMain *audiomain)
 	 */
 	audiomain->effects = audiomain->palette;
 
+	initFXBus(audiomain);
+
 	/*
 	 * Assign an array of voice pointers. Need to call "initMidiVoices()"
 	 */
 	initMidiVoices(audiomain);
+
+	bristolWorkersInit(audiomain);
 }
 
 void
 freeAudioMain(audioMain *audiomain)
 {
+	int i, j;
+
 	printf("freeAudioMain()\n");
 
+	/* No baudio for freeSoundAlgo(), the bus effects are freed here */
+	for (i = 0; i < audiomain->fxbus.count; i++)
+	{
+		for (j = 0; j < BRISTOL_PARAM_COUNT; j++)
+			bristolfree(audiomain->fxbus.effect[i]->param->param[j].mem);
+		bristolfree(audiomain->fxbus.effect[i]->param);
+		bristolfree(audiomain->fxbus.effect[i]);
+		bristolfree(audiomain->fxbus.locals[i]);
+	}
+	audiomain->fxbus.count = 0;
+	bristolfree(audiomain->fxbus.leftbuf);
+	bristolfree(audiomain->fxbus.rightbuf);
+	audiomain->fxbus.leftbuf = audiomain->fxbus.rightbuf = NULL;
+
 	freePalette(audiomain, audiomain->palette);
 /*	freePalette(audiomain, audiomain->effects); */
 
@@ -953,6 +1156,37 @@ freeAudioMain(audioMain *audiomain)
 /*		bristolfree(audiomain->effects); */
 }
 
+/*
+ * Some operators allocate into their locals as the voice runs, they free it
+ * while the sounds still say which operator each local belongs to.
+ */
+static void
+freeOperatorLocals(audioMain *audiomain, Baudio *baudio)
+{
+	bristolOP *op;
+	int i, j;
+
+	if ((baudio->locals == NULL) || (baudio->sound == NULL))
+		return;
+
+	for (i = 0; i < audiomain->voiceCount; i++)
+	{
+		if (baudio->locals[i] == NULL)
+			continue;
+
+		for (j = 0; j < baudio->soundCount; j++)
+		{
+			if ((baudio->sound[j] == NULL) || (baudio->locals[i][j] == NULL))
+				continue;
+
+			op = (audiomain->palette)[(*baudio->sound[j]).index];
+
+			if (op->freelocal != NULL)
+				op->freelocal(op, baudio->locals[i][j]);
+		}
+	}
+}
+
 void
 freeBristolAudio(audioMain *audiomain, Baudio *baudio)
 {
@@ -966,6 +1200,14 @@ freeBristolAudio(audioMain *audiomain, Baudio *baudio)
 	if ((audiomain->debuglevel & BRISTOL_DEBUG_MASK) > BRISTOL_DEBUG1)
 		printf("freeBristolAudio(%p, %p)\n", audiomain, baudio);
 
+	/* The effects bus stops until someone else sends to it */
+	if ((audiomain->fxbus.voice != NULL)
+		&& (audiomain->fxbus.voice->baudio == baudio))
+		audiomain->fxbus.voice = NULL;
+	fxBusOwners(audiomain, baudio);
+
+	freeOperatorLocals(audiomain, baudio);
+
 	freeSoundAlgo(baudio, 0, baudio->sound);
 	bristolfree(baudio->sound);
 
@@ -983,9 +1225,10 @@ freeBristolAudio(audioMain *audiomain, Baudio *baudio)
 		for (i = 0; i < audiomain->voiceCount; i++)
 		{
 			/*
-			 * Free the individual locals.
+			 * Free the individual locals. An emulation without effects has
+			 * none of FXlocals, its locals still go.
 			 */
-			if (baudio->FXlocals[i][0] == NULL)
+			if ((baudio->locals[i] == NULL) || (baudio->FXlocals[i] == NULL))
 				continue;
 
 			for (j = 0; j < baudio->soundCount; j++) {
@@ -1003,6 +1246,8 @@ freeBristolAudio(audioMain *audiomain, Baudio *baudio)
 
 	bristolfree(baudio->leftbuf);
 	bristolfree(baudio->rightbuf);
+	bristolfree(baudio->fxleft);
+	bristolfree(baudio->fxright);
 
 	/*
 	 * Free the locals pointer itself.
@@ -1058,6 +1303,19 @@ freeMidiVoices(audioMain *audiomain, bristolVoice *voice)
 
 	freeMidiVoices(audiomain, voice->next);
 
+	bristolfree(voice);
+}
+
+/*
+ * Every voice is on one of the lists, initMidiVoices() makes them again.
+ */
+static void
+freeMidiLists(audioMain *audiomain)
+{
+	freeMidiVoices(audiomain, audiomain->playlist);
+	freeMidiVoices(audiomain, audiomain->freelist);
+	freeMidiVoices(audiomain, audiomain->newlist);
+
 	audiomain->playlist = NULL;
 	audiomain->playlast = NULL;
 	audiomain->freelist = NULL;
@@ -1065,7 +1323,7 @@ freeMidiVoices(audioMain *audiomain, bristolVoice *voice)
 	audiomain->newlist = NULL;
 }
 
-static void
+void
 resetAudioThread(audioMain *audiomain)
 {
 	Baudio *holder;
@@ -1073,19 +1331,22 @@ resetAudioThread(audioMain *audiomain)
 	if ((audiomain->debuglevel & BRISTOL_DEBUG_MASK) > BRISTOL_DEBUG1)
 		printf("resetAudioThread()\n");
 
+	bristolWorkersStop(audiomain);
+
 	while (audiomain->audiolist != NULL) {
 		holder = audiomain->audiolist;
 		freeBristolAudio(audiomain, audiomain->audiolist);
+		bristolfree(holder->maps);
 		bristolfree(holder);
 	}
 
 	/*
-	 * Free the array of voice pointers.
+	 * Free the voices.
 	 */
-	freeMidiVoices(audiomain, audiomain->playlist);
+	freeMidiLists(audiomain);
 }
 
-static void
+void
 initPalette(audioMain *audiomain, bristolOP *palette[])
 {
 	int i;
@@ -1114,7 +1375,7 @@ initPalette(audioMain *audiomain, bristolOP *palette[])
 	audiomain->opCount = i - 1;
 }
 
-static void
+void
 freePalette(audioMain *audiomain, bristolOP *palette[])
 {
 	int i;
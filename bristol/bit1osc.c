@@ -94,17 +94,17 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
-	bristolfree(((bristolBITONE *) operator)->wave[0]);
-	bristolfree(((bristolBITONE *) operator)->wave[1]);
-	bristolfree(((bristolBITONE *) operator)->wave[2]);
-	bristolfree(((bristolBITONE *) operator)->wave[3]);
-	bristolfree(((bristolBITONE *) operator)->wave[4]);
-	bristolfree(((bristolBITONE *) operator)->wave[5]);
-	bristolfree(((bristolBITONE *) operator)->wave[6]);
-	bristolfree(((bristolBITONE *) operator)->wave[7]);
-
-	bristolfree(((bristolBITONE *) operator)->sbuf);
-	bristolfree(((bristolBITONE *) operator)->null);
+	bristolfree(((bristolBITONE *) operator->specs)->wave[0]);
+	bristolfree(((bristolBITONE *) operator->specs)->wave[1]);
+	bristolfree(((bristolBITONE *) operator->specs)->wave[2]);
+	bristolfree(((bristolBITONE *) operator->specs)->wave[3]);
+	bristolfree(((bristolBITONE *) operator->specs)->wave[4]);
+	bristolfree(((bristolBITONE *) operator->specs)->wave[5]);
+	bristolfree(((bristolBITONE *) operator->specs)->wave[6]);
+	bristolfree(((bristolBITONE *) operator->specs)->wave[7]);
+
+	bristolfree(((bristolBITONE *) operator->specs)->sbuf);
+	bristolfree(((bristolBITONE *) operator->specs)->null);
 
 	bristolfree(operator->specs);
 
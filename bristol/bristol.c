@@ -19,6 +19,8 @@
  *
  */
 
+#define _GNU_SOURCE
+
 #include <signal.h>
 #include <strings.h>
 #include <stddef.h>
@@ -37,28 +39,31 @@
 #include "bristolhelp.h"
 #include "bristolmidi.h"
 #include "bristolblo.h"
+#include "delayline.h"
+
+#define BRISTOL_METRICS_PERIOD 10 /* Seconds between -metrics updates */
 
 static char defaultcdev[16];
 
 extern int dupfd;
 void inthandler();
 
-int exitReq = 0;
+extern int exitReq;
 static int jh = -1, execreq = 1;
 
 extern void *audioThread();
 extern void midiThreadSaveReq(audioMain *);
 extern void midiThreadLoadReq(audioMain *);
 extern void *midiThread();
-extern void doNoteChanges();
 extern int bristolMidiTerminate();
 
 pthread_t spawnThread();
+pthread_t spawnThreadOn(void * (*)(void *), void *, int, int);
 
-audioMain audiomain;
+extern audioMain audiomain;
 static char sessionfile[1024];
 
-char *outputfile = NULL;
+extern char *outputfile;
 
 #ifdef BRISTOL_PA
 extern int bristolPulseInterface();
@@ -70,7 +75,7 @@ extern int bristolJackInterface();
 extern int bristolJackSessionCheck();
 #endif
 #endif
-static int jsmd = 200;
+static int jsmd = 5000000; /* us, the parent loop subtracts what it slept */
 
 static char *bImport = NULL;
 
@@ -83,6 +88,23 @@ static char *bImport = NULL;
 int sessmgrmode = 1;
 volatile sig_atomic_t ladiRequest = 0;
 
+/*
+ * SIGHUP asks for the trace rings to be written out, see -trace
+ */
+volatile sig_atomic_t traceRequest = 0;
+static char *tracefile = NULL;
+
+#ifndef BRISTOL_SEMAPHORE
+/* Forwarded events are written out once per pass of the parent loop */
+static bristolMidiBatch fwdbatch;
+#endif
+
+static void
+tracehandler()
+{
+	traceRequest = 1;
+}
+
 static void
 savehandler()
 {
@@ -178,13 +200,18 @@ main(int argc, char **argv)
 	pid_t cpid;
 	pthread_t audiothread = (pthread_t) NULL, midithread, logthread;
 	int watchdog = 30000000;
-	int exitdecr = 25000;
+	int exitdecr = 1, slept = 25000;
+	time_t metrics = 0;
 
 #ifndef BRISTOL_SEMAPHORE
-	bristolMidiMsg msg;
+	bristolMidiFwdHdr fwdhdr;
+	unsigned char fwdraw[BRISTOL_MIDI_RAWSIZE];
 #endif
 
 	bzero(&audiomain, sizeof(audioMain));
+#ifndef BRISTOL_SEMAPHORE
+	bristolMidiBatchInit(&fwdbatch);
+#endif
 	audiomain.samplecount = 256; /* default this - gets overridden later */
 	audiomain.iosize = 0; /* This needs to be calculated, samplecount * float */
 	audiomain.preload = 4; /* This should be less, preferably 4 (was 8). */
@@ -193,6 +220,8 @@ main(int argc, char **argv)
 	audiomain.iocount = 0;
 	audiomain.m_io_ogc = 1.0;
 	audiomain.m_io_igc = 1.0;
+	audiomain.fxbus.send = 1.0;
+	audiomain.arena = 32;
 	/* default to OSS until ALSA goes 1.0 */
 /*	audiomain.flags = BRISTOL_OSS|BRISTOL_MIDI_OSS; */
 
@@ -223,6 +252,7 @@ main(int argc, char **argv)
 
 	audiomain.samplerate = 44100; /* This is a default, gets overwritten */
 	audiomain.priority = 65;
+	audiomain.workerprio = -1;
 
 	if ((argc == 2) && (strcmp(argv[1], "warranty") == 0))
 	{
@@ -500,7 +530,7 @@ main(int argc, char **argv)
 		}
 
 		if ((strcmp(argv[argCount], "-jsmd") == 0) && (argc > argCount))
-			jsmd = atoi(argv[++argCount]) / 25;
+			jsmd = atoi(argv[++argCount]) * 1000;
 
 		if ((strcmp(argv[argCount], "-jsmuuid") == 0) && (argc > argCount))
 		{
@@ -552,6 +582,10 @@ main(int argc, char **argv)
 				~(BRISTOL_AUDIOMASK|BRISTOL_MIDIMASK|BRISTOL_MIDI_ALSA))
 				|BRISTOL_DUMMY|BRISTOL_MIDI_SEQ;
 
+		/* Dummy audio only: render as fast as the CPU allows */
+		if (strcmp(argv[argCount], "-freewheel") == 0)
+			audiomain.flags |= BRISTOL_FREEWHEEL;
+
 		if (strcmp(argv[argCount], "-jdo") == 0)
 			audiomain.flags |= BRISTOL_JACK_DUAL;
 
@@ -564,12 +598,126 @@ main(int argc, char **argv)
 		if ((strcmp(argv[argCount], "-preload") == 0) && (argc > argCount))
 			audiomain.preload = atoi(argv[argCount++ + 1]);
 
+		/* Rate for the nonlinear operators, 1, 2 or 4 times samplerate */
+		if ((strcmp(argv[argCount], "-oversample") == 0) && (argc > argCount))
+		{
+			audiomain.oversampling = atoi(argv[argCount++ + 1]);
+
+			if ((audiomain.oversampling != 1) && (audiomain.oversampling != 2)
+				&& (audiomain.oversampling != 4))
+			{
+				printf("oversampling must be 1, 2 or 4, using default\n");
+				audiomain.oversampling = 0;
+			}
+		}
+
+		/*
+		 * Shared effects, a comma separated list of palette operators, and
+		 * the default send level to them.
+		 */
+		if ((strcmp(argv[argCount], "-fxbus") == 0) && (argc > argCount + 1))
+		{
+			char *op = argv[++argCount];
+
+			audiomain.fxbus.count = 0;
+
+			while ((*op != '\0')
+				&& (audiomain.fxbus.count < BRISTOL_FXBUS_MAX))
+			{
+				audiomain.fxbus.op[audiomain.fxbus.count++] = atoi(op);
+
+				if ((op = index(op, ',')) == NULL)
+					break;
+				op++;
+			}
+		}
+
+		if ((strcmp(argv[argCount], "-fxsend") == 0) && (argc > argCount))
+		{
+			audiomain.fxbus.send = atof(argv[argCount++ + 1]);
+
+			if (audiomain.fxbus.send < 0)
+				audiomain.fxbus.send = 0;
+			if (audiomain.fxbus.send > 1)
+				audiomain.fxbus.send = 1;
+		}
+
+		if ((strcmp(argv[argCount], "-trace") == 0) && (argc > argCount + 1))
+			tracefile = argv[argCount++ + 1];
+
+		if ((strcmp(argv[argCount], "-metrics") == 0) && (argc > argCount + 1))
+			audiomain.telemetry.file = argv[argCount++ + 1];
+
+		if ((strcmp(argv[argCount], "-arena") == 0) && (argc > argCount))
+		{
+			if ((audiomain.arena = atoi(argv[argCount++ + 1])) < 0)
+				audiomain.arena = 0;
+		}
+
+		/* Percentage of the period the voices may take, 0 for no limit */
+		if ((strcmp(argv[argCount], "-cpubudget") == 0) && (argc > argCount))
+		{
+			audiomain.vbudget.budget = atof(argv[argCount++ + 1]) / 100;
+
+			if (audiomain.vbudget.budget < 0)
+				audiomain.vbudget.budget = 0;
+			if (audiomain.vbudget.budget > 1)
+				audiomain.vbudget.budget = 1;
+		}
+
+		if ((strcmp(argv[argCount], "-reserve") == 0) && (argc > argCount))
+		{
+			if ((audiomain.reserved = atoi(argv[argCount++ + 1])) < 0)
+				audiomain.reserved = 0;
+		}
+
 		if ((strcmp(argv[argCount], "-priority") == 0) && (argc > argCount))
 		{
 			if ((audiomain.priority = atoi(argv[argCount++ + 1])) < 0)
 				audiomain.priority = 0;
 		}
 
+		/* Emulations rendered in parallel, see bristol/workers.c */
+		if ((strcmp(argv[argCount], "-workers") == 0) && (argc > argCount))
+		{
+			if ((audiomain.workers = atoi(argv[argCount++ + 1])) < 0)
+				audiomain.workers = 0;
+			if (audiomain.workers > BRISTOL_WORKERS_MAX)
+				audiomain.workers = BRISTOL_WORKERS_MAX;
+		}
+
+		if ((strcmp(argv[argCount], "-workerprio") == 0) && (argc > argCount))
+		{
+			if ((audiomain.workerprio = atoi(argv[argCount++ + 1])) < 0)
+				audiomain.workerprio = 0;
+		}
+
+		if ((strcmp(argv[argCount], "-workercpus") == 0)
+			&& (argc > argCount + 1))
+			audiomain.workercpus = argv[argCount++ + 1];
+
+		if (strcmp(argv[argCount], "-denormals") == 0)
+			audiomain.denormals = 1;
+
+		if (strcmp(argv[argCount], "-fdnreverb") == 0)
+			audiomain.fdnreverb = 1;
+
+		if (strcmp(argv[argCount], "-midiecho") == 0)
+			audiomain.midiecho = 1;
+
+		/* Modulated delay interpolation, see bristol/delayline.c */
+		if ((strcmp(argv[argCount], "-interpolate") == 0)
+			&& (argc > argCount + 1))
+		{
+			if (strcmp(argv[argCount + 1], "linear") == 0)
+				delayLineInterp = BRISTOL_DL_LINEAR;
+			else if (strcmp(argv[argCount + 1], "allpass") == 0)
+				delayLineInterp = BRISTOL_DL_ALLPASS;
+			else if (strcmp(argv[argCount + 1], "cubic") == 0)
+				delayLineInterp = BRISTOL_DL_CUBIC;
+			argCount++;
+		}
+
 		/*
 		 * Debug values in the engine will get overridden by the GUI when 
 		 * distributed but this is needed for debug of the init operations.
@@ -645,6 +793,13 @@ main(int argc, char **argv)
 	/* Print the argument list, debug level does not apply here */
 	buildCmdLine(&audiomain, argc, argv);
 
+	/* Before the threads start, everything after this is in locked memory */
+	bristolArenaInit(audiomain.arena);
+
+	/* The trace rings are not in the arena, they take memory as they fill */
+	if ((tracefile != NULL) && (bristolTraceInit(65536) < 0))
+		printf("could not allocate trace buffers\n");
+
 	generateBLOwaveforms(harmonics, BRISTOL_VPO, bloCutin, bloCutoff, bloMin,
 		bloFraction, audiomain.samplerate);
 
@@ -670,6 +825,7 @@ main(int argc, char **argv)
 /*	signal(SIGSEGV, inthandler); */
 	signal(SIGUSR1, savehandler);
 	signal(SIGUSR2, loadhandler);
+	signal(SIGHUP, tracehandler);
 
 	if (audiomain.debuglevel)
 		printf("parent going into idle loop\n");
@@ -724,7 +880,13 @@ main(int argc, char **argv)
 
 				if (audiomain.debuglevel)
 					printf("spawning audio thread\n");
-				audiothread = spawnThread(audioThread, audiomain.priority);
+				/*
+				 * Freewheeling never waits on the device, at realtime
+				 * priority it would lock out the MIDI and control threads.
+				 */
+				audiothread = spawnThread(audioThread,
+					(audiomain.flags & BRISTOL_FREEWHEEL)?
+						0:audiomain.priority);
 
 				while (audiomain.atStatus != BRISTOL_OK)
 				{
@@ -810,7 +972,7 @@ main(int argc, char **argv)
 			 * daemon flag then we should consider failing and stopping the
 			 * process.
 			 */
-			if ((watchdog -= exitdecr) <= 0) 
+			if ((watchdog -= exitdecr * slept) <= 0) 
 			{
 				printf("init watchdog exception\n");
 				audiomain.atStatus = BRISTOL_FAIL;
@@ -840,18 +1002,37 @@ main(int argc, char **argv)
 			 * actual forwarding.
 			 */
 #ifndef BRISTOL_SEMAPHORE
-			while (jack_ringbuffer_read_space(audiomain.rbfp)
-				>= sizeof(bristolMidiMsg))
+			/*
+			 * Whatever built up since the last pass goes out with one write
+			 * per destination rather than several per message.
+			 */
+			while (jack_ringbuffer_read(audiomain.rbfp, (char *) &fwdhdr,
+				sizeof(bristolMidiFwdHdr)) == sizeof(bristolMidiFwdHdr))
 			{
-				jack_ringbuffer_read(audiomain.rbfp, (char *) &msg,
-					sizeof(bristolMidiMsg));
+				/* The record is written whole, the message is there */
+				jack_ringbuffer_read(audiomain.rbfp, (char *) fwdraw,
+					fwdhdr.count);
 
-				bristolMidiRawWrite(msg.mychannel, &msg,
-					msg.params.bristol.msgLen);
+				bristolMidiBatchRaw(&fwdbatch, fwdhdr.dev, fwdraw,
+					fwdhdr.count);
 			}
 
-			usleep(25000);
+			bristolMidiBatchFlush(&fwdbatch);
+
+			/*
+			 * The echo is held in the sequencer output buffer, it goes with
+			 * one drain and a pass each period keeps it close to the input.
+			 */
+			if (audiomain.midiecho)
+			{
+				bristolMidiFlush(audiomain.midiHandle);
+				slept = audiomain.samplecount * 1000000.0 / audiomain.samplerate;
+			} else
+				slept = 25000;
+
+			usleep(slept);
 #else
+			slept = 1000000;
 			sleep(1);
 #endif
 		}
@@ -871,7 +1052,19 @@ main(int argc, char **argv)
 			midiThreadLoadReq(&audiomain);
 		}
 
-		if (bImport && (--jsmd < 0))
+		if ((audiomain.telemetry.file != NULL) && (time(NULL) >= metrics))
+		{
+			bristolTelemetryDump(&audiomain);
+			metrics = time(NULL) + BRISTOL_METRICS_PERIOD;
+		}
+
+		if (traceRequest)
+		{
+			traceRequest = 0;
+			bristolTraceDump(tracefile);
+		}
+
+		if (bImport && ((jsmd -= slept) < 0))
 		{
 			audiomain.sessionfile = bImport;
 			midiThreadLoadReq(&audiomain);
@@ -945,6 +1138,10 @@ main(int argc, char **argv)
 	else
 		printf("midithread exited\n");
 
+	bristolArenaStats();
+	bristolTraceDump(tracefile);
+	bristolTelemetryDump(&audiomain);
+
 	printf("bristol parent exiting\n");
 	printf("terminating logging thread\n");
 
@@ -960,103 +1157,5 @@ main(int argc, char **argv)
 
 pthread_t spawnThread(void * (*threadcode)(void *), int priority)
 {
-	int retcode;
-	pthread_t thread;
-	int policy;
-
-#if defined(linux)
-	struct sched_param schedparam;
-#endif
-
-	/*
-	 * Create thread, detach it.
-	 */
-	retcode = pthread_create(&thread, NULL, threadcode, &audiomain);
-	if (retcode != 0)
-		fprintf(stderr, "create a failed %d\n", retcode);
-
-//	retcode = pthread_detach(thread);
-//	if (retcode != 0)
-//		fprintf(stderr, "detach failed %d\n", retcode);
-
-#if defined(linux)
-	if (pthread_getschedparam(thread, &policy, &schedparam) != 0)
-	{
-		printf("could not get thread schedule\n");
-
-		return(thread);
-	}
-#endif
-
-	/*
-	 * This may have to go into a subroutine as the MIDI thread may need to 
-	 * reuse it to ensure we do not get priority inversion. At the moment both
-	 * threads are RT FIFO though.
-	 */
-#if defined(linux)
-	if (priority != 0)
-	{
-		policy = SCHED_FIFO;
-		schedparam.__sched_priority = priority;
-
-		if (pthread_setschedparam(thread, policy, &schedparam) == 0)
-			printf("rescheduled thread: %i\n", schedparam.__sched_priority);
-		else
-			printf("could not reschedule thread\n");
-	} else
-		printf("no requested to reschedule thread\n");
-#else
-	printf("will not reschedule thread\n");
-#endif
-
-	return(thread);
-}
-
-void
-midithreadexit()
-{
-	printf("Null palette\n");
-	audiomain.atReq = BRISTOL_REQSTOP;
-	audiomain.mtStatus = BRISTOL_EXIT;
-
-	bristolMidiTerminate();
-
-	pthread_exit(0);
-}
-
-void
-inthandler()
-{
-	int i = 50;
-
-	if (audiomain.debuglevel)
-		printf("inthandler\n");
-
-	bristolMidiOption(0, BRISTOL_NRP_MIDI_GO, 0);
-
-	audiomain.atReq = BRISTOL_REQSTOP;
-	exitReq = 1;
-
-	for (; i > 0; i--)
-	{
-		if (audiomain.atStatus != BRISTOL_EXIT)
-			usleep(100000);
-	}
-
-	bristolMidiTerminate();
+	return(spawnThreadOn(threadcode, &audiomain, priority, -1));
 }
-
-void
-alterAllNotes(Baudio *baudio)
-{
-	bristolVoice *voice = audiomain.playlist;
-
-	while (voice != NULL)
-	{
-		if (voice->baudio == baudio)
-			doNoteChanges(voice);
-
-		voice = voice->next;
-	}
-}
-
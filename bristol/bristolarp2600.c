@@ -834,6 +834,7 @@ bristolVoice *voice, register float *startbuf)
 	 */
 	audiomain->palette[(*baudio->sound[12]).index]->specs->io[0].buf
 		= abufs.inputs[vindex][ARP_I_LAG];
+	audiomain->palette[(*baudio->sound[12]).index]->specs->io[1].buf = zerobuf;
 	audiomain->palette[(*baudio->sound[12]).index]->specs->io[2].buf
 		= abufs.outputs[vindex][ARP_O_LAG];
 	(*baudio->sound[12]).operate(
@@ -1245,7 +1246,8 @@ bristolArp2600Init(audioMain *audiomain, Baudio *baudio)
 	 * since it should roll on passed note-off events to sound correct.
 	 */
 /*	initSoundAlgo(	12,	0, baudio, audiomain, baudio->effect); */
-	initSoundAlgo(	22,	0, baudio, audiomain, baudio->effect);
+	initSoundAlgo(B_REVERB_ALGO(audiomain), 0, baudio, audiomain,
+		baudio->effect);
 
 	/*
 	 * We will need to add
@@ -1499,7 +1501,7 @@ bristolArp2600Init(audioMain *audiomain, Baudio *baudio)
 				abufs.defaults[47] + audiomain->samplecount * i * ARP_OUTCNT];
 			abufs.inputs[i][48] = &abufs.buf[
 				abufs.defaults[48] + audiomain->samplecount * i * ARP_OUTCNT];
-			abufs.inputs[i][40] = &abufs.buf[
+			abufs.inputs[i][49] = &abufs.buf[
 				abufs.defaults[49] + audiomain->samplecount * i * ARP_OUTCNT];
 			abufs.inputs[i][50] = &abufs.buf[
 				abufs.defaults[50] + audiomain->samplecount * i * ARP_OUTCNT];
@@ -0,0 +1,936 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * The parameters the GUI sends to the engine when it starts with its default
+ * memory, for the engine library where there is no GUI. Without them most of
+ * the emulations are silent until a host has set every parameter.
+ *
+ * The tables are the operator, controller and 14 bit value of each parameter
+ * message in the order the daemon received them from 'brighton -cli' with
+ * memory 0, the requests to operator 127 left out. Dual manual GUIs give the
+ * messages for the layer that runs the algorithm. They have to be taken again
+ * if a GUI changes its default memory or how it maps its controls.
+ *
+ * The bitone, cs80, aks and granular do not have tables, their GUIs do not
+ * start without a display.
+ */
+
+#include <stdio.h>
+
+#include "bristolengine.h"
+
+typedef struct BristolDefault {
+	unsigned char operator;
+	unsigned char controller;
+	unsigned short value;
+} bristolDefault;
+
+/* mini */
+static bristolDefault algo0[] = {
+	{0, 2, 8192}, {3, 4, 16383}, {4, 4, 4}, {7, 2, 4096},
+	{124, 0, 16383}, {10, 0, 8252}, {9, 0, 1664}, {11, 1, 0},
+	{0, 1, 2}, {1, 1, 2}, {2, 1, 4}, {1, 2, 7896},
+	{2, 2, 8621}, {0, 0, 3}, {1, 0, 3}, {2, 0, 0},
+	{0, 3, 11024}, {8, 0, 0}, {1, 3, 13316}, {7, 0, 0},
+	{2, 3, 9325}, {4, 0, 7846}, {4, 1, 4448}, {4, 2, 15784},
+	{3, 0, 0}, {3, 1, 1625}, {3, 3, 1024}, {3, 2, 0},
+	{5, 0, 211}, {5, 1, 6403}, {5, 3, 1024}, {5, 2, 1999},
+	{5, 4, 8310}, {12, 7, 16383}, {12, 6, 0}, {12, 10, 16383},
+	{12, 13, 0}, {12, 11, 16383}, {12, 14, 0}, {12, 12, 0},
+	{7, 1, 0}, {12, 1, 0}, {12, 4, 0}, {12, 0, 0},
+	{5, 1, 6403}, {5, 3, 1024}, {12, 15, 0}, {12, 2, 16383},
+	{4, 3, 16383}, {5, 5, 0}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* hammondB3 */
+static bristolDefault algo1[] = {
+	{1, 0, 0}, {1, 1, 3}, {1, 2, 16383}, {1, 3, 400},
+	{1, 4, 13000}, {1, 5, 0}, {12, 7, 1}, {10, 0, 4},
+	{3, 0, 0}, {3, 1, 10}, {3, 2, 13000}, {3, 3, 400},
+	{3, 4, 13000}, {3, 5, 0}, {4, 0, 2}, {4, 1, 1200},
+	{4, 2, 0}, {4, 3, 20}, {4, 4, 15500}, {4, 5, 0},
+	{124, 0, 16383}, {0, 2, 8}, {0, 2, 17}, {0, 2, 26},
+	{0, 2, 27}, {0, 2, 44}, {0, 2, 45}, {0, 2, 54},
+	{0, 2, 63}, {0, 2, 76}, {100, 4, 13322}, {100, 7, 1},
+	{100, 0, 16020}, {100, 3, 6809}, {100, 2, 5043}, {100, 6, 5345},
+	{100, 1, 0}, {101, 3, 1832}, {0, 6, 0}, {126, 0, 1},
+	{6, 2, 3}, {6, 4, 1}, {126, 1, 0}, {0, 0, 0},
+	{0, 0, 8}, {0, 0, 16}, {0, 0, 24}, {0, 0, 32},
+	{0, 0, 40}, {0, 0, 48}, {0, 0, 56}, {0, 0, 64},
+	{0, 3, 25}, {0, 3, 33}, {4, 1, 1023}, {0, 3, 25},
+	{0, 3, 33}, {4, 1, 1023}, {0, 3, 25}, {0, 3, 33},
+	{4, 1, 1023}, {1, 0, 255}, {100, 7, 1}, {100, 1, 0},
+	{100, 7, 4}, {100, 4, 13322}, {100, 7, 1}, {100, 0, 16020},
+	{100, 3, 6809}, {100, 2, 5043}, {100, 6, 5345}, {100, 1, 0},
+	{100, 4, 13322}, {100, 7, 1}, {100, 0, 16020}, {100, 3, 6809},
+	{100, 2, 5043}, {100, 6, 5345}, {100, 1, 0}, {100, 4, 13322},
+	{100, 7, 1}, {100, 0, 16020}, {100, 3, 6809}, {100, 2, 5043},
+	{100, 6, 5345}, {100, 1, 0}, {100, 4, 13322}, {100, 7, 1},
+	{100, 0, 16020}, {100, 3, 6809}, {100, 2, 5043}, {100, 6, 5345},
+	{100, 1, 0}, {100, 4, 13322}, {100, 7, 1}, {100, 0, 16020},
+	{100, 3, 6809}, {100, 2, 5043}, {100, 6, 5345}, {100, 1, 0},
+	{100, 5, 236}, {100, 4, 13322}, {100, 7, 1}, {100, 0, 16020},
+	{100, 3, 6809}, {100, 2, 5043}, {100, 6, 5345}, {100, 1, 0},
+	{100, 4, 13322}, {100, 7, 1}, {100, 0, 16020}, {100, 3, 6809},
+	{100, 2, 5043}, {100, 6, 5345}, {100, 1, 0}, {100, 4, 13322},
+	{100, 7, 1}, {100, 0, 16020}, {100, 3, 6809}, {100, 2, 5043},
+	{100, 6, 5345}, {100, 1, 0}, {6, 0, 6138}, {6, 1, 15441},
+	{6, 3, 6305}, {0, 3, 25}, {0, 3, 33}, {4, 1, 1023},
+	{0, 3, 25}, {0, 3, 33}, {4, 1, 1023}, {1, 0, 255},
+	{1, 0, 255}, {126, 3, 1}, {0, 7, 1}, {126, 2, 0},
+	{126, 1, 0}, {0, 0, 0}, {0, 0, 8}, {0, 0, 16},
+	{0, 0, 24}, {0, 0, 32}, {0, 0, 40}, {0, 0, 48},
+	{0, 0, 56}, {0, 0, 64}, {0, 6, 0}, {100, 4, 13322},
+	{100, 7, 1}, {100, 0, 16020}, {100, 3, 6809}, {100, 2, 5043},
+	{100, 6, 5345}, {100, 1, 0}, {0, 1, 10861}, {6, 5, 3335},
+	{101, 0, 9801}, {101, 1, 13501}, {101, 2, 13911}, {101, 3, 1832},
+	{101, 5, 13894}, {101, 4, 13894}, {0, 4, 8005}, {100, 4, 13322},
+	{100, 7, 1}, {100, 0, 16020}, {100, 3, 6809}, {100, 2, 5043},
+	{100, 6, 5345}, {100, 1, 0}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* prophet */
+static bristolDefault algo2[] = {
+	{0, 2, 8192}, {3, 4, 16383}, {4, 4, 4}, {126, 36, 16383},
+	{124, 0, 16383}, {126, 6, 16281}, {126, 7, 15993}, {126, 8, 0},
+	{126, 9, 16383}, {126, 10, 16383}, {2, 0, 2922}, {126, 24, 0},
+	{126, 25, 16383}, {126, 26, 0}, {126, 11, 179}, {126, 12, 0},
+	{126, 13, 0}, {126, 14, 16383}, {126, 15, 0}, {126, 16, 16383},
+	{0, 1, 1}, {0, 4, 0}, {0, 6, 16383}, {0, 0, 14929},
+	{0, 7, 0}, {1, 1, 2}, {1, 2, 7953}, {1, 4, 16383},
+	{1, 5, 0}, {1, 6, 16383}, {1, 0, 2022}, {126, 18, 0},
+	{126, 19, 16383}, {126, 0, 0}, {126, 1, 0}, {126, 20, 11969},
+	{126, 21, 15679}, {126, 22, 0}, {4, 0, 0}, {4, 1, 13932},
+	{126, 23, 4469}, {4, 3, 8191}, {3, 0, 1170}, {3, 1, 2453},
+	{3, 2, 0}, {3, 3, 1662}, {5, 0, 0}, {5, 1, 11610},
+	{5, 2, 13761}, {5, 3, 1526}, {126, 2, 8191}, {5, 4, 16256},
+	{124, 0, 15000}, {124, 0, 15000},
+};
+
+/* dx */
+static bristolDefault algo3[] = {
+	{124, 0, 16383}, {126, 102, 0}, {126, 0, 0}, {0, 6, 0},
+	{126, 10, 0}, {1, 6, 0}, {126, 20, 0}, {2, 6, 0},
+	{126, 30, 0}, {3, 6, 0}, {126, 40, 0}, {4, 6, 0},
+	{126, 50, 0}, {5, 6, 0}, {126, 0, 0}, {0, 1, 8141},
+	{0, 0, 3}, {0, 6, 10039}, {126, 1, 0}, {0, 2, 19},
+	{0, 3, 16383}, {0, 4, 12380}, {0, 5, 15495}, {0, 7, 9213},
+	{126, 2, 5851}, {126, 3, 0}, {0, 8, 1}, {0, 9, 0},
+	{0, 10, 0}, {0, 11, 8111}, {126, 10, 8115}, {1, 1, 8181},
+	{1, 0, 1}, {1, 6, 16383}, {126, 11, 0}, {1, 2, 1},
+	{1, 3, 16315}, {1, 4, 16383}, {1, 5, 2}, {1, 7, 16383},
+	{126, 12, 10261}, {126, 13, 0}, {1, 8, 0}, {1, 9, 1},
+	{1, 10, 16383}, {1, 11, 9573}, {126, 20, 7783}, {2, 1, 8201},
+	{2, 0, 2}, {2, 6, 16383}, {126, 21, 0}, {2, 2, 1},
+	{2, 3, 16383}, {2, 4, 16383}, {2, 5, 696}, {2, 7, 16383},
+	{126, 22, 10986}, {126, 23, 0}, {2, 8, 0}, {2, 9, 0},
+	{2, 11, 11982}, {126, 30, 7835}, {3, 1, 8181}, {3, 0, 3},
+	{3, 6, 16383}, {126, 31, 0}, {3, 2, 1}, {3, 3, 16383},
+	{3, 4, 16238}, {3, 5, 2}, {3, 7, 9765}, {126, 32, 8067},
+	{126, 33, 0}, {3, 8, 0}, {3, 9, 0}, {3, 10, 0},
+	{3, 11, 19}, {126, 40, 7832}, {4, 1, 8199}, {4, 0, 4},
+	{4, 6, 16383}, {126, 41, 0}, {4, 2, 1}, {4, 3, 16293},
+	{4, 4, 16383}, {4, 5, 29}, {4, 7, 16383}, {126, 42, 9230},
+	{126, 43, 0}, {4, 8, 0}, {4, 9, 0}, {4, 10, 0},
+	{4, 11, 0}, {126, 50, 7884}, {5, 1, 8186}, {5, 0, 5},
+	{5, 6, 16383}, {126, 51, 0}, {5, 2, 1}, {5, 3, 16383},
+	{5, 4, 16383}, {5, 5, 840}, {5, 7, 16383}, {126, 52, 7015},
+	{126, 53, 0}, {5, 8, 0}, {5, 9, 0}, {5, 10, 0},
+	{5, 11, 0}, {126, 101, 22}, {126, 99, 0}, {126, 100, 0},
+	{126, 102, 1636}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* juno */
+static bristolDefault algo4[] = {
+	{3, 4, 4}, {126, 17, 1}, {7, 1, 12000}, {7, 2, 16383},
+	{7, 3, 0}, {7, 4, 16383}, {7, 5, 0}, {64, 5, 1},
+	{124, 0, 16383}, {126, 17, 16383}, {126, 9, 7709}, {126, 16, 0},
+	{126, 1, 8191}, {126, 0, 0}, {126, 3, 0}, {0, 2, 10081},
+	{7, 0, 0}, {126, 4, 16383}, {126, 5, 1890}, {126, 7, 16383},
+	{126, 6, 2}, {1, 7, 16383}, {1, 4, 0}, {1, 6, 16383},
+	{1, 6, 16383}, {6, 0, 0}, {2, 0, 0}, {3, 0, 0},
+	{3, 1, 15752}, {126, 11, 0}, {126, 12, 8191}, {126, 13, 5355},
+	{3, 3, 4095}, {126, 8, 16383}, {126, 15, 16383}, {4, 0, 3150},
+	{4, 1, 8506}, {4, 2, 630}, {4, 3, 1260}, {100, 0, 5},
+	{100, 0, 5}, {100, 0, 5}, {64, 0, 0}, {64, 1, 0},
+	{64, 2, 0}, {64, 3, 0}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* explorer */
+static bristolDefault algo5[] = {
+	{7, 0, 16000}, {3, 5, 0}, {3, 4, 16383}, {124, 0, 16383},
+	{8, 0, 3240}, {8, 1, 3}, {10, 0, 8034}, {11, 0, 13831},
+	{15, 0, 0}, {15, 1, 0}, {15, 2, 1}, {15, 3, 512},
+	{16, 0, 0}, {16, 1, 0}, {16, 2, 3}, {16, 3, 0},
+	{0, 1, 3}, {0, 0, 10421}, {1, 2, 8191}, {1, 1, 3},
+	{1, 0, 3381}, {2, 2, 8065}, {2, 1, 2}, {2, 0, 5914},
+	{12, 9, 0}, {12, 10, 0}, {12, 0, 16383}, {12, 8, 0},
+	{14, 0, 13730}, {0, 3, 16102}, {1, 3, 15083}, {2, 3, 12254},
+	{12, 13, 16383}, {12, 5, 0}, {12, 2, 16383}, {12, 3, 16383},
+	{12, 4, 16383}, {12, 6, 0}, {9, 0, 581}, {4, 0, 0},
+	{9, 0, 581}, {4, 0, 0}, {4, 1, 13142}, {9, 1, 13142},
+	{4, 3, 840}, {9, 3, 840}, {4, 4, 4}, {4, 6, 0},
+	{12, 12, 0}, {3, 0, 767}, {3, 1, 399}, {3, 2, 1241},
+	{3, 3, 1368}, {12, 11, 15888}, {5, 0, 0}, {5, 1, 4002},
+	{5, 2, 9325}, {3, 3, 1326}, {5, 5, 16383}, {5, 4, 12388},
+	{12, 1, 16383}, {12, 7, 0}, {11, 0, 13831}, {3, 3, 1368},
+	{5, 3, 1326}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* hammondB3 */
+static bristolDefault algo6[] = {
+	{1, 0, 2}, {1, 1, 3}, {1, 2, 16383}, {1, 3, 1000},
+	{1, 4, 13000}, {1, 5, 0}, {124, 0, 16383}, {0, 2, 8},
+	{0, 2, 13}, {0, 2, 26}, {0, 2, 27}, {0, 2, 40},
+	{0, 2, 45}, {0, 2, 54}, {0, 2, 63}, {0, 2, 76},
+	{0, 6, 0}, {0, 6, 0}, {126, 1, 0}, {0, 0, 0},
+	{0, 0, 8}, {0, 0, 16}, {0, 0, 24}, {0, 0, 32},
+	{0, 0, 40}, {0, 0, 48}, {0, 0, 56}, {0, 0, 64},
+	{1, 0, 255}, {3, 2, 5}, {3, 2, 17}, {1, 0, 255},
+	{1, 0, 255}, {126, 3, 1}, {0, 7, 1}, {0, 7, 1},
+	{3, 7, 1}, {126, 2, 0}, {126, 1, 0}, {0, 0, 0},
+	{0, 0, 8}, {0, 0, 16}, {0, 0, 24}, {0, 0, 32},
+	{0, 0, 40}, {0, 0, 48}, {0, 0, 56}, {0, 0, 64},
+	{0, 6, 0}, {0, 6, 0}, {0, 1, 10861}, {0, 4, 8005},
+	{0, 4, 8005}, {3, 4, 8005}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* vox */
+static bristolDefault algo7[] = {
+	{1, 0, 550}, {1, 1, 1600}, {1, 2, 0}, {124, 0, 16383},
+	{0, 1, 7712}, {1, 0, 597}, {1, 1, 1846}, {0, 5, 0},
+	{0, 0, 8}, {0, 0, 16}, {0, 0, 32}, {0, 0, 56},
+	{0, 0, 72}, {0, 0, 81}, {126, 0, 0}, {124, 0, 15000},
+	{124, 0, 15000},
+};
+
+/* rhodes */
+static bristolDefault algo8[] = {
+	{124, 0, 16383}, {126, 0, 19}, {0, 1, 8049}, {0, 0, 2},
+	{0, 6, 8984}, {126, 1, 0}, {0, 2, 0}, {0, 3, 15989},
+	{0, 4, 255}, {0, 5, 518}, {0, 7, 16383}, {126, 2, 0},
+	{126, 3, 0}, {0, 9, 0}, {0, 10, 0}, {0, 11, 0},
+	{0, 12, 8111}, {126, 10, 0}, {1, 1, 7955}, {1, 0, 2},
+	{1, 6, 8488}, {126, 11, 0}, {1, 2, 0}, {1, 3, 9348},
+	{1, 4, 2859}, {1, 5, 724}, {1, 7, 16383}, {126, 12, 16383},
+	{126, 13, 0}, {1, 9, 0}, {1, 10, 1}, {1, 11, 16383},
+	{1, 12, 9573}, {126, 20, 8191}, {2, 1, 8241}, {2, 0, 1},
+	{2, 6, 16216}, {126, 21, 0}, {2, 2, 2}, {2, 3, 16383},
+	{2, 4, 255}, {2, 5, 634}, {2, 7, 16383}, {126, 22, 5851},
+	{126, 23, 0}, {2, 9, 0}, {2, 10, 0}, {2, 11, 162},
+	{2, 12, 11982}, {126, 30, 0}, {3, 1, 7912}, {3, 0, 2},
+	{3, 6, 9150}, {126, 31, 0}, {3, 2, 2}, {3, 3, 16383},
+	{3, 4, 255}, {3, 5, 2881}, {3, 7, 16234}, {126, 32, 12643},
+	{126, 33, 0}, {3, 9, 0}, {3, 10, 0}, {3, 11, 0},
+	{3, 12, 19}, {126, 40, 317}, {4, 1, 8189}, {4, 0, 0},
+	{4, 6, 9826}, {126, 41, 0}, {4, 2, 2}, {4, 3, 9150},
+	{4, 4, 3018}, {4, 5, 1662}, {4, 7, 16383}, {126, 42, 0},
+	{126, 43, 0}, {4, 9, 162}, {4, 10, 0}, {4, 11, 0},
+	{4, 12, 0}, {126, 50, 7943}, {5, 1, 8186}, {5, 0, 1},
+	{5, 6, 16383}, {126, 51, 0}, {5, 2, 2}, {5, 3, 16383},
+	{5, 4, 255}, {5, 5, 775}, {5, 7, 16383}, {126, 52, 8921},
+	{126, 53, 0}, {5, 9, 0}, {5, 10, 0}, {5, 11, 0},
+	{5, 12, 0}, {126, 101, 3}, {126, 99, 0}, {126, 100, 0},
+	{126, 102, 16383}, {126, 0, 19}, {0, 1, 8049}, {0, 0, 2},
+	{0, 6, 8984}, {126, 1, 0}, {0, 2, 0}, {0, 3, 15989},
+	{0, 4, 255}, {0, 5, 518}, {0, 7, 16383}, {126, 2, 0},
+	{126, 3, 0}, {0, 9, 0}, {0, 10, 0}, {0, 11, 0},
+	{0, 12, 8111}, {126, 10, 0}, {1, 1, 7955}, {1, 0, 2},
+	{1, 6, 8488}, {126, 11, 0}, {1, 2, 0}, {1, 3, 9348},
+	{1, 4, 2859}, {1, 5, 724}, {1, 7, 16383}, {126, 12, 16383},
+	{126, 13, 0}, {1, 9, 0}, {1, 10, 1}, {1, 11, 16383},
+	{1, 12, 9573}, {126, 20, 8191}, {2, 1, 8241}, {2, 0, 1},
+	{2, 6, 16216}, {126, 21, 0}, {2, 2, 2}, {2, 3, 16383},
+	{2, 4, 255}, {2, 5, 634}, {2, 7, 16383}, {126, 22, 5851},
+	{126, 23, 0}, {2, 9, 0}, {2, 10, 0}, {2, 11, 162},
+	{2, 12, 11982}, {126, 30, 0}, {3, 1, 7912}, {3, 0, 2},
+	{3, 6, 9150}, {126, 31, 0}, {3, 2, 2}, {3, 3, 16383},
+	{3, 4, 255}, {3, 5, 2881}, {3, 7, 16234}, {126, 32, 12643},
+	{126, 33, 0}, {3, 9, 0}, {3, 10, 0}, {3, 11, 0},
+	{3, 12, 19}, {126, 40, 317}, {4, 1, 8189}, {4, 0, 0},
+	{4, 6, 9826}, {126, 41, 0}, {4, 2, 2}, {4, 3, 9150},
+	{4, 4, 3018}, {4, 5, 1662}, {4, 7, 16383}, {126, 42, 0},
+	{126, 43, 0}, {4, 9, 162}, {4, 10, 0}, {4, 11, 0},
+	{4, 12, 0}, {126, 50, 7943}, {5, 1, 8186}, {5, 0, 1},
+	{5, 6, 16383}, {126, 51, 0}, {5, 2, 2}, {5, 3, 16383},
+	{5, 4, 255}, {5, 5, 775}, {5, 7, 16383}, {126, 52, 8921},
+	{126, 53, 0}, {5, 9, 0}, {5, 10, 0}, {5, 11, 0},
+	{5, 12, 0}, {126, 101, 3}, {126, 99, 0}, {126, 100, 0},
+	{126, 102, 16383}, {123, 0, 1638}, {123, 1, 1638}, {123, 2, 1638},
+	{123, 3, 8191}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* prophet52 */
+static bristolDefault algo14[] = {
+	{0, 2, 8192}, {3, 4, 16383}, {4, 4, 4}, {124, 0, 16383},
+	{126, 6, 16383}, {126, 7, 0}, {126, 8, 0}, {126, 9, 16383},
+	{126, 10, 16383}, {2, 0, 3612}, {126, 24, 0}, {126, 25, 16383},
+	{126, 26, 0}, {126, 11, 179}, {126, 12, 0}, {126, 13, 16383},
+	{126, 14, 0}, {126, 15, 16383}, {126, 16, 16383}, {0, 1, 1},
+	{0, 4, 0}, {0, 6, 16383}, {0, 0, 5145}, {0, 7, 0},
+	{1, 1, 1}, {1, 2, 16268}, {1, 4, 0}, {1, 5, 16383},
+	{1, 6, 16383}, {1, 0, 10861}, {126, 18, 0}, {126, 19, 16383},
+	{126, 0, 0}, {126, 1, 0}, {126, 20, 16383}, {126, 21, 12624},
+	{126, 22, 0}, {4, 0, 0}, {4, 1, 15480}, {126, 23, 16383},
+	{4, 3, 8191}, {3, 0, 0}, {3, 1, 13339}, {3, 2, 0},
+	{3, 3, 1674}, {5, 0, 9}, {5, 1, 16383}, {5, 2, 8016},
+	{5, 3, 1758}, {126, 2, 8191}, {5, 4, 15635}, {126, 32, 903},
+	{126, 31, 8845}, {126, 30, 903}, {126, 33, 9159}, {124, 0, 15000},
+	{124, 0, 15000},
+};
+
+/* obx */
+static bristolDefault algo15[] = {
+	{0, 2, 8192}, {1, 2, 8192}, {0, 3, 16383}, {1, 3, 16383},
+	{3, 4, 16383}, {4, 4, 4}, {4, 7, 4096}, {124, 0, 16383},
+	{1, 10, 8191}, {126, 2, 8191}, {126, 0, 0}, {126, 1, 0},
+	{1, 10, 8991}, {2, 0, 211}, {126, 19, 16383}, {126, 20, 0},
+	{126, 21, 0}, {126, 4, 15495}, {126, 5, 0}, {126, 6, 0},
+	{126, 7, 16383}, {126, 8, 13831}, {126, 9, 16383}, {126, 10, 16383},
+	{0, 1, 1}, {1, 9, 24}, {0, 4, 16383}, {0, 5, 0},
+	{0, 6, 16383}, {0, 5, 0}, {126, 11, 0}, {1, 7, 0},
+	{1, 4, 0}, {1, 6, 16383}, {1, 5, 0}, {4, 0, 2426},
+	{4, 1, 12673}, {4, 2, 3115}, {126, 12, 16383}, {4, 3, 16383},
+	{126, 14, 0}, {126, 15, 16383}, {126, 16, 0}, {126, 17, 0},
+	{3, 0, 1499}, {3, 1, 3510}, {3, 2, 1289}, {3, 3, 2834},
+	{5, 0, 0}, {5, 1, 3312}, {5, 2, 4031}, {5, 3, 3510},
+	{5, 4, 16383}, {3, 3, 2834}, {5, 3, 3510}, {0, 0, 12311},
+	{1, 0, 11361}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* monopoly */
+static bristolDefault algo18[] = {
+	{0, 7, 8192}, {1, 7, 8192}, {2, 7, 8192}, {8, 7, 8192},
+	{4, 4, 4}, {0, 3, 16383}, {1, 3, 16383}, {2, 3, 16383},
+	{8, 3, 16383}, {3, 4, 16383}, {10, 2, 8192}, {124, 0, 16383},
+	{126, 19, 16383}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* poly */
+static bristolDefault algo19[] = {
+	{4, 4, 16383}, {3, 4, 4}, {1, 0, 16383}, {1, 6, 16383},
+	{8, 1, 12000}, {8, 2, 16383}, {8, 3, 0}, {8, 4, 16383},
+	{8, 5, 0}, {124, 0, 16383}, {126, 8, 1}, {6, 4, 13304},
+	{126, 1, 8191}, {126, 2, 8256}, {0, 1, 2}, {0, 4, 0},
+	{0, 5, 0}, {0, 6, 1}, {126, 5, 0}, {0, 0, 15679},
+	{126, 4, 15679}, {10, 0, 5694}, {1, 1, 0}, {1, 6, 1},
+	{7, 0, 0}, {2, 0, 12284}, {8, 0, 995}, {8, 4, 3018},
+	{126, 6, 1}, {3, 0, 7796}, {3, 1, 7097}, {3, 2, 10261},
+	{3, 3, 2376}, {4, 0, 0}, {4, 1, 995}, {4, 2, 2129},
+	{4, 3, 3225}, {6, 0, 0}, {8, 3, 0}, {6, 1, 9675},
+	{8, 3, 9675}, {6, 2, 5480}, {8, 3, 5480}, {6, 3, 3225},
+	{8, 3, 3225}, {6, 0, 0}, {6, 1, 9675}, {6, 2, 5480},
+	{6, 3, 3225}, {6, 4, 13304}, {100, 0, 1}, {100, 1, 1060},
+	{126, 0, 0}, {126, 8, 1}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* axxe */
+static bristolDefault algo20[] = {
+	{7, 0, 20}, {7, 1, 1000}, {7, 2, 16383}, {7, 3, 50},
+	{7, 4, 16383}, {7, 5, 0}, {7, 6, 0}, {4, 4, 16383},
+	{3, 2, 16383}, {3, 4, 4}, {0, 4, 16383}, {1, 6, 16383},
+	{2, 1, 16383}, {124, 0, 16383}, {126, 0, 0}, {126, 2, 1191},
+	{126, 3, 0}, {126, 4, 0}, {126, 5, 0}, {1, 0, 6579},
+	{126, 6, 14964}, {126, 7, 1787}, {126, 19, 0}, {2, 0, 1290},
+	{126, 8, 0}, {126, 9, 4765}, {126, 10, 13702}, {3, 0, 0},
+	{3, 1, 14061}, {3, 3, 1191}, {126, 11, 2978}, {126, 12, 16383},
+	{126, 13, 11775}, {126, 14, 6851}, {4, 0, 1806}, {4, 1, 8643},
+	{4, 2, 3574}, {4, 3, 515}, {6, 1, 0}, {126, 15, 16383},
+	{126, 19, 0}, {2, 0, 1290}, {126, 16, 0}, {126, 17, 0},
+	{126, 18, 0}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* odyssey */
+static bristolDefault algo21[] = {
+	{4, 4, 16383}, {3, 2, 16383}, {3, 4, 4}, {126, 49, 0},
+	{2, 1, 0}, {8, 3, 16383}, {8, 1, 5}, {8, 8, 16383},
+	{7, 1, 16383}, {7, 2, 16383}, {7, 4, 16383}, {8, 0, 16383},
+	{8, 1, 128}, {8, 2, 16383}, {10, 0, 20}, {10, 1, 1000},
+	{10, 2, 16383}, {10, 3, 50}, {10, 4, 16383}, {10, 5, 0},
+	{10, 6, 0}, {124, 0, 16383}, {126, 0, 1170}, {126, 2, 1170},
+	{126, 3, 0}, {0, 0, 16383}, {126, 4, 13457}, {0, 2, 8074},
+	{0, 10, 8074}, {126, 5, 16383}, {126, 6, 16383}, {126, 7, 16383},
+	{0, 1, 2}, {126, 8, 0}, {126, 9, 0}, {1, 0, 12287},
+	{126, 10, 5851}, {1, 2, 8191}, {1, 10, 9186}, {126, 11, 16383},
+	{126, 12, 16383}, {126, 13, 0}, {1, 7, 0}, {126, 14, 11117},
+	{126, 15, 0}, {126, 16, 0}, {2, 0, 10531}, {126, 17, 16383},
+	{126, 18, 0}, {126, 19, 0}, {126, 20, 0}, {126, 21, 12287},
+	{126, 22, 14042}, {3, 3, 0}, {126, 24, 0}, {126, 25, 3510},
+	{126, 26, 16383}, {3, 0, 1170}, {3, 1, 11409}, {9, 0, 0},
+	{126, 27, 0}, {126, 28, 0}, {126, 29, 0}, {126, 30, 0},
+	{126, 31, 1}, {126, 23, 0}, {3, 3, 0}, {126, 32, 16383},
+	{126, 33, 0}, {126, 34, 0}, {4, 0, 585}, {4, 1, 10707},
+	{4, 2, 4095}, {4, 3, 2064}, {7, 0, 1170}, {7, 1, 1462},
+	{7, 3, 1462}, {126, 53, 16383}, {126, 55, 0}, {7, 2, 16383},
+	{6, 1, 16383}, {126, 57, 0}, {126, 58, 0}, {126, 59, 16383},
+	{126, 60, 0}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* memoryMoog */
+static bristolDefault algo22[] = {
+	{7, 0, 16383}, {0, 2, 8192}, {3, 4, 4}, {3, 2, 16383},
+	{4, 4, 16383}, {4, 5, 0}, {124, 0, 16383}, {1, 7, 0},
+	{0, 0, 15942}, {0, 6, 16383}, {0, 4, 0}, {0, 5, 0},
+	{1, 2, 8196}, {1, 0, 9635}, {1, 6, 0}, {1, 4, 0},
+	{1, 5, 16383}, {2, 2, 8186}, {2, 0, 13831}, {2, 6, 0},
+	{2, 4, 0}, {2, 5, 16383}, {2, 1, 0}, {126, 7, 0},
+	{126, 30, 13392}, {126, 31, 4128}, {126, 32, 16223}, {126, 33, 0},
+	{3, 0, 0}, {3, 1, 13740}, {126, 17, 16383}, {4, 0, 9},
+	{4, 1, 11261}, {4, 2, 1999}, {4, 3, 5262}, {3, 3, 5461},
+	{3, 3, 5461}, {6, 0, 0}, {6, 1, 15942}, {6, 2, 494},
+	{6, 3, 3758}, {6, 6, 0}, {6, 7, 0}, {6, 8, 0},
+	{6, 3, 3758}, {6, 4, 14536}, {100, 0, 7780}, {8, 0, 1289},
+	{126, 8, 0}, {126, 9, 16383}, {126, 10, 0}, {126, 11, 16383},
+	{126, 12, 0}, {126, 13, 0}, {126, 14, 16383}, {126, 20, 8191},
+	{126, 21, 3281}, {126, 27, 16383}, {126, 28, 0}, {126, 22, 0},
+	{126, 23, 0}, {126, 24, 16383}, {126, 25, 0}, {126, 26, 16383},
+	{126, 40, 3510}, {126, 41, 16383}, {126, 42, 0}, {126, 43, 16383},
+	{126, 44, 3823}, {126, 45, 16383}, {126, 46, 0}, {126, 2, 0},
+	{126, 6, 0}, {126, 0, 42}, {126, 0, 42}, {126, 47, 3739},
+	{126, 3, 5521}, {0, 1, 1}, {1, 1, 0}, {2, 1, 0},
+	{0, 1, 0}, {126, 4, 0}, {0, 1, 0}, {126, 16, 16383},
+	{126, 40, 16383}, {126, 44, 16383}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* arp2600 */
+static bristolDefault algo23[] = {
+	{102, 0, 0}, {3, 2, 16383}, {3, 3, 0}, {3, 4, 4},
+	{3, 7, 4096}, {3, 8, 100}, {6, 1, 1}, {4, 4, 16383},
+	{7, 1, 16383}, {7, 2, 16383}, {7, 4, 16383}, {12, 4, 3},
+	{124, 0, 16383}, {102, 0, 0}, {11, 0, 0}, {8, 0, 16383},
+	{8, 1, 5734}, {0, 1, 1}, {126, 3, 0}, {103, 4, 0},
+	{103, 5, 37}, {103, 6, 0}, {1, 7, 0}, {0, 2, 8191},
+	{0, 10, 7811}, {1, 1, 2}, {126, 4, 0}, {103, 8, 0},
+	{103, 9, 0}, {103, 10, 0}, {103, 11, 0}, {1, 2, 8191},
+	{1, 10, 12132}, {1, 0, 12584}, {2, 1, 3}, {126, 5, 0},
+	{103, 13, 16383}, {103, 14, 0}, {103, 15, 0}, {103, 16, 0},
+	{2, 2, 8191}, {2, 10, 12845}, {2, 0, 7835}, {103, 17, 12833},
+	{103, 18, 7918}, {103, 19, 0}, {103, 20, 0}, {103, 21, 4095},
+	{103, 22, 6553}, {103, 23, 16383}, {103, 24, 0}, {3, 0, 474},
+	{3, 1, 14483}, {4, 0, 1280}, {4, 1, 15290}, {4, 2, 0},
+	{4, 3, 9010}, {7, 0, 4}, {7, 3, 3003}, {126, 7, 16383},
+	{103, 29, 16383}, {103, 30, 0}, {103, 31, 16383}, {103, 32, 0},
+	{103, 33, 0}, {103, 34, 16383}, {99, 4, 13379}, {99, 5, 14198},
+	{13, 0, 4095}, {13, 1, 3003}, {13, 2, 5734}, {13, 3, 13379},
+	{99, 0, 3822}, {99, 1, 16383}, {99, 2, 11741}, {99, 3, 12560},
+	{6, 2, 13379}, {6, 0, 10375}, {126, 6, 10239}, {9, 0, 1023},
+	{9, 1, 16383}, {126, 11, 0}, {126, 2, 8191}, {126, 10, 0},
+	{126, 0, 511}, {103, 44, 2611}, {103, 45, 16383}, {103, 46, 16383},
+	{12, 0, 511}, {126, 12, 0}, {0, 0, 0}, {0, 0, 0},
+	{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {100, 1, 13},
+	{100, 4, 18}, {100, 7, 1}, {100, 10, 17}, {100, 14, 45},
+	{100, 24, 46}, {100, 25, 2}, {100, 26, 23}, {0, 0, 16383},
+	{126, 11, 6078}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* solina */
+static bristolDefault algo26[] = {
+	{3, 1, 10}, {3, 2, 16382}, {0, 3, 16383}, {1, 3, 16383},
+	{1, 1, 3}, {2, 1, 1}, {124, 0, 16383}, {126, 14, 0},
+	{126, 15, 16383}, {2, 3, 16383}, {126, 1, 8191}, {3, 0, 2815},
+	{3, 3, 2482}, {126, 10, 16383}, {126, 11, 16383}, {126, 12, 0},
+	{126, 13, 16383}, {3, 4, 14789}, {98, 0, 16383}, {98, 1, 16383},
+	{98, 2, 16383}, {98, 3, 16383}, {99, 3, 16383}, {98, 3, 16383},
+	{99, 3, 16383}, {0, 2, 8192}, {1, 2, 1}, {2, 2, 16383},
+	{0, 0, 8191}, {1, 0, 12287}, {2, 0, 16383}, {3, 1, 16383},
+	{3, 2, 16383}, {126, 3, 16383}, {5, 0, 16383}, {99, 0, 16383},
+	{99, 1, 16383}, {99, 2, 16383}, {126, 7, 16383}, {126, 8, 16383},
+	{0, 0, 8192}, {1, 0, 4096}, {0, 2, 8192}, {1, 2, 8292},
+	{2, 2, 8092}, {3, 5, 0}, {126, 5, 47}, {126, 6, 35},
+	{126, 14, 0}, {126, 15, 16383}, {126, 10, 16383}, {126, 11, 16383},
+	{126, 12, 0}, {126, 13, 16383}, {3, 4, 14789}, {98, 3, 7781},
+	{99, 3, 7781}, {98, 0, 1228}, {98, 1, 6553}, {98, 2, 1228},
+	{98, 3, 7781}, {99, 3, 7781}, {98, 3, 7781}, {99, 3, 7781},
+	{0, 2, 8192}, {1, 2, 8193}, {2, 2, 8191}, {0, 0, 2252},
+	{1, 0, 3378}, {2, 0, 4505}, {3, 1, 16383}, {3, 2, 16383},
+	{126, 3, 14335}, {5, 0, 6143}, {99, 0, 11058}, {99, 1, 12696},
+	{99, 2, 3686}, {126, 7, 255}, {126, 8, 511}, {124, 0, 15000},
+	{124, 0, 15000},
+};
+
+/* roadrunner */
+static bristolDefault algo27[] = {
+	{3, 1, 10}, {3, 2, 16382}, {0, 3, 16383}, {1, 3, 16383},
+	{1, 1, 3}, {2, 1, 1}, {124, 0, 16383}, {3, 0, 2},
+	{3, 2, 0}, {0, 0, 8192}, {1, 0, 4096}, {0, 2, 8192},
+	{1, 2, 8292}, {2, 2, 8092}, {5, 1, 8092}, {126, 5, 127},
+	{126, 6, 0}, {0, 2, 8192}, {1, 2, 16383}, {2, 2, 1},
+	{0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {126, 3, 0},
+	{126, 30, 0}, {126, 31, 0}, {126, 32, 1}, {126, 30, 0},
+	{126, 31, 0}, {126, 32, 1}, {126, 10, 0}, {126, 11, 0},
+	{126, 12, 0}, {126, 10, 0}, {126, 11, 0}, {126, 12, 0},
+	{126, 20, 0}, {126, 21, 0}, {126, 22, 1}, {126, 20, 0},
+	{126, 21, 0}, {126, 22, 1}, {3, 1, 0}, {3, 3, 0},
+	{3, 5, 0}, {126, 8, 0}, {98, 0, 0}, {98, 1, 0},
+	{98, 2, 0}, {98, 3, 0}, {99, 0, 0}, {99, 2, 0},
+	{99, 3, 0}, {126, 4, 0}, {2, 3, 0}, {126, 1, 8191},
+	{5, 0, 1365}, {126, 7, 1365}, {3, 4, 12969}, {0, 2, 8192},
+	{1, 2, 8151}, {2, 2, 8233}, {0, 0, 8191}, {1, 0, 12287},
+	{2, 0, 16383}, {126, 3, 12516}, {126, 30, 1}, {126, 31, 0},
+	{126, 32, 0}, {126, 30, 1}, {126, 31, 0}, {126, 32, 0},
+	{126, 10, 0}, {126, 11, 1}, {126, 12, 0}, {126, 10, 0},
+	{126, 11, 1}, {126, 12, 0}, {126, 20, 1}, {126, 21, 1},
+	{126, 22, 0}, {126, 20, 1}, {126, 21, 1}, {126, 22, 0},
+	{3, 1, 10125}, {3, 3, 699}, {3, 5, 0}, {126, 8, 345},
+	{98, 0, 15212}, {98, 1, 1578}, {98, 2, 13295}, {98, 3, 5043},
+	{99, 0, 8191}, {99, 2, 12723}, {99, 3, 8521}, {126, 4, 16383},
+	{2, 3, 16331}, {1, 3, 16383}, {0, 2, 8192}, {1, 2, 8193},
+	{2, 2, 8191}, {0, 0, 682}, {1, 0, 1023}, {2, 0, 1365},
+	{126, 3, 1365}, {126, 30, 0}, {126, 31, 0}, {126, 32, 1},
+	{126, 30, 0}, {126, 31, 1}, {126, 32, 0}, {126, 10, 0},
+	{126, 11, 1}, {126, 12, 0}, {126, 10, 0}, {126, 11, 1},
+	{126, 12, 0}, {126, 20, 0}, {126, 21, 1}, {126, 22, 0},
+	{126, 20, 0}, {126, 21, 1}, {126, 22, 0}, {3, 1, 1365},
+	{3, 3, 1365}, {3, 5, 12969}, {126, 8, 8191}, {98, 0, 1365},
+	{98, 1, 1365}, {98, 2, 12969}, {98, 3, 8191}, {99, 0, 1365},
+	{99, 2, 12969}, {99, 3, 8191}, {126, 4, 1365}, {124, 0, 15000},
+	{124, 0, 15000},
+};
+
+/* realistic */
+static bristolDefault algo29[] = {
+	{8, 0, 10}, {8, 1, 10}, {8, 2, 8192}, {8, 3, 10},
+	{8, 4, 16383}, {7, 0, 16383}, {7, 6, 1}, {126, 1, 8192},
+	{0, 0, 16383}, {0, 3, 16383}, {1, 3, 16383}, {0, 7, 0},
+	{1, 0, 8192}, {9, 0, 16383}, {9, 1, 16383}, {9, 2, 16383},
+	{6, 0, 16383}, {4, 2, 16383}, {4, 4, 16383}, {2, 1, 1},
+	{3, 4, 4}, {124, 0, 16383}, {0, 10, 8191}, {1, 10, 8191},
+	{7, 10, 7390}, {126, 4, 992}, {126, 5, 992}, {126, 0, 0},
+	{2, 0, 12411}, {126, 6, 2}, {126, 9, 16383}, {1, 7, 0},
+	{0, 1, 0}, {0, 5, 0}, {0, 6, 1}, {1, 2, 9780},
+	{1, 1, 1}, {1, 5, 0}, {1, 6, 1}, {4, 1, 2482},
+	{4, 3, 2482}, {4, 2, 0}, {126, 10, 0}, {4, 0, 496},
+	{4, 1, 2482}, {4, 3, 2482}, {4, 2, 0}, {3, 3, 4096},
+	{3, 0, 0}, {3, 1, 15390}, {126, 11, 6950}, {126, 2, 6950},
+	{126, 3, 16383}, {126, 7, 0}, {9, 2, 0}, {7, 3, 0},
+	{126, 8, 13070}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* voxM2 */
+static bristolDefault algo30[] = {
+	{0, 4, 1}, {1, 0, 500}, {1, 1, 2000}, {1, 2, 0},
+	{2, 0, 5}, {2, 1, 2048}, {2, 2, 0}, {2, 3, 0},
+	{2, 4, 16383}, {124, 0, 16383}, {0, 0, 8}, {0, 0, 20},
+	{0, 0, 40}, {0, 0, 96}, {0, 0, 113}, {0, 0, 72},
+	{0, 0, 85}, {0, 2, 16383}, {0, 0, 40}, {0, 3, 0},
+	{0, 0, 96}, {2, 1, 3250}, {2, 4, 12686}, {126, 0, 16383},
+	{0, 1, 10861}, {2, 1, 10861}, {1, 0, 511}, {1, 1, 914},
+	{1, 2, 0}, {3, 1, 6500}, {3, 4, 12686}, {124, 0, 15000},
+	{124, 0, 15000},
+};
+
+/* jupiter8 */
+static bristolDefault algo31[] = {
+	{11, 0, 1024}, {2, 1, 12000}, {2, 2, 16000}, {2, 3, 1000},
+	{2, 4, 16000}, {2, 5, 0}, {2, 9, 0}, {3, 1, 12000},
+	{3, 2, 16000}, {3, 3, 1000}, {3, 4, 16000}, {3, 5, 0},
+	{3, 8, 0}, {4, 7, 8192}, {5, 7, 8192}, {7, 4, 16383},
+	{9, 4, 16383}, {6, 2, 16383}, {6, 4, 4}, {126, 3, 16383},
+	{126, 4, 16383}, {126, 5, 16383}, {126, 6, 16383}, {10, 2, 4096},
+	{124, 0, 16383}, {64, 34, 0}, {64, 2, 0}, {0, 0, 0},
+	{64, 33, 2}, {64, 1, 2}, {64, 0, 1}, {64, 6, 0},
+	{126, 2, 2}, {126, 7, 0}, {126, 2, 1}, {64, 6, 0},
+	{126, 2, 2}, {126, 7, 0}, {0, 0, 10618}, {2, 0, 4247},
+	{126, 12, 1}, {126, 9, 0}, {126, 10, 0}, {126, 11, 2},
+	{126, 16, 16383}, {126, 8, 0}, {4, 3, 16383}, {4, 2, 0},
+	{4, 1, 0}, {4, 0, 0}, {4, 4, 16383}, {4, 5, 0},
+	{4, 6, 16383}, {4, 11, 0}, {126, 38, 1}, {5, 12, 0},
+	{5, 3, 0}, {5, 2, 16383}, {5, 1, 0}, {5, 0, 0},
+	{5, 9, 6928}, {5, 4, 0}, {5, 5, 16383}, {5, 6, 16383},
+	{126, 5, 0}, {126, 6, 8152}, {11, 0, 0}, {6, 0, 6371},
+	{6, 1, 9405}, {6, 4, 4}, {6, 6, 0}, {126, 18, 4247},
+	{126, 19, 0}, {126, 20, 0}, {6, 3, 10011}, {126, 21, 16383},
+	{126, 22, 0}, {7, 0, 910}, {7, 1, 3944}, {7, 2, 4550},
+	{7, 3, 2427}, {7, 5, 16383}, {126, 39, 0}, {9, 0, 27},
+	{9, 1, 6674}, {9, 2, 6371}, {9, 3, 3944}, {9, 5, 16383},
+	{4, 7, 9708}, {5, 7, 9708}, {126, 30, 0}, {126, 4, 8051},
+	{64, 34, 0}, {64, 2, 0}, {64, 34, 2}, {64, 2, 2},
+	{64, 6, 0}, {126, 2, 2}, {126, 7, 0}, {64, 6, 0},
+	{126, 2, 1}, {126, 7, 0}, {126, 101, 1}, {126, 101, 1},
+	{126, 101, 0}, {126, 101, 0}, {126, 12, 1}, {126, 11, 2},
+	{4, 3, 16383}, {4, 2, 0}, {4, 1, 0}, {4, 0, 0},
+	{4, 4, 16383}, {4, 5, 0}, {4, 6, 16383}, {4, 11, 0},
+	{126, 38, 1}, {5, 12, 0}, {5, 3, 0}, {5, 2, 16383},
+	{5, 1, 0}, {5, 0, 0}, {5, 9, 6928}, {5, 4, 0},
+	{5, 5, 16383}, {5, 6, 16383}, {126, 5, 0}, {126, 6, 8152},
+	{6, 4, 4}, {6, 6, 0}, {126, 19, 0}, {126, 39, 0},
+	{126, 30, 0}, {126, 4, 8051}, {64, 34, 2}, {64, 2, 2},
+	{64, 0, 0}, {64, 6, 0}, {126, 2, 0}, {126, 7, 0},
+	{126, 23, 5733}, {126, 24, 0}, {126, 25, 7371}, {126, 26, 818},
+	{126, 27, 8190}, {126, 23, 5733}, {126, 24, 0}, {126, 23, 5733},
+	{126, 24, 0}, {126, 25, 7371}, {126, 26, 818}, {126, 27, 8190},
+	{3, 0, 8941}, {126, 0, 255}, {126, 0, 255}, {126, 101, 0},
+	{126, 101, 0}, {126, 101, 0}, {126, 101, 0}, {126, 101, 0},
+	{126, 101, 16383}, {126, 101, 0}, {126, 101, 0}, {64, 16, 0},
+	{64, 16, 0}, {126, 40, 16383}, {126, 2, 0}, {64, 6, 0},
+	{126, 2, 0}, {126, 7, 0}, {64, 35, 11225}, {64, 3, 11225},
+	{126, 101, 0}, {126, 23, 5733}, {126, 24, 0}, {126, 25, 7371},
+	{126, 26, 818}, {126, 27, 8190}, {126, 23, 5733}, {126, 24, 0},
+	{126, 23, 5733}, {126, 24, 0}, {126, 25, 7371}, {126, 26, 818},
+	{126, 27, 8190}, {3, 0, 8941}, {126, 0, 255}, {126, 0, 255},
+	{7, 6, 0}, {7, 7, 0}, {7, 8, 0}, {9, 6, 0},
+	{9, 7, 0}, {9, 8, 0}, {126, 31, 0}, {10, 1, 0},
+	{126, 29, 0}, {0, 1, 0}, {2, 5, 0}, {64, 5, 8},
+	{1, 1, 0}, {1, 2, 0}, {3, 5, 0}, {126, 3, 14744},
+	{126, 3, 7372}, {126, 1, 8191}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* pro1 */
+static bristolDefault algo35[] = {
+	{3, 5, 0}, {2, 1, 1}, {4, 4, 4}, {124, 0, 16383},
+	{3, 4, 13602}, {126, 3, 1}, {126, 4, 0}, {126, 5, 0},
+	{126, 6, 14942}, {126, 7, 0}, {126, 10, 1}, {126, 11, 0},
+	{126, 12, 1}, {126, 13, 0}, {126, 14, 2}, {0, 2, 8191},
+	{0, 1, 1}, {0, 4, 1}, {0, 6, 1}, {0, 0, 3361},
+	{0, 7, 0}, {1, 2, 8191}, {1, 1, 2}, {1, 4, 1},
+	{1, 5, 0}, {1, 6, 1}, {1, 0, 10429}, {126, 18, 0},
+	{126, 19, 1}, {64, 3, 4469}, {64, 35, 4469}, {2, 0, 4469},
+	{126, 24, 0}, {126, 25, 1}, {126, 26, 0}, {64, 38, 0},
+	{64, 17, 0}, {64, 32, 0}, {64, 38, 0}, {64, 32, 0},
+	{64, 0, 0}, {64, 5, 1}, {64, 2, 2}, {126, 27, 0},
+	{126, 9, 0}, {126, 20, 11913}, {126, 21, 15996}, {126, 22, 0},
+	{126, 0, 767}, {126, 8, 0}, {4, 0, 440}, {4, 1, 10744},
+	{126, 23, 7993}, {4, 3, 297}, {3, 0, 2209}, {3, 1, 3353},
+	{3, 2, 3140}, {3, 3, 1556}, {5, 0, 291}, {5, 1, 5428},
+	{5, 2, 12320}, {5, 3, 1467}, {64, 38, 0}, {64, 17, 0},
+	{126, 2, 8191}, {5, 4, 14744}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* voyager */
+static bristolDefault algo36[] = {
+	{7, 0, 16000}, {3, 5, 0}, {3, 4, 16383}, {124, 0, 16383},
+	{8, 0, 3240}, {8, 1, 3}, {10, 0, 8034}, {11, 0, 13831},
+	{15, 0, 0}, {15, 1, 0}, {15, 2, 1}, {15, 3, 512},
+	{16, 0, 0}, {16, 1, 0}, {16, 2, 3}, {16, 3, 0},
+	{0, 1, 3}, {0, 0, 10421}, {1, 2, 8191}, {1, 1, 3},
+	{1, 0, 3381}, {2, 2, 8065}, {2, 1, 2}, {2, 0, 5914},
+	{12, 9, 0}, {12, 10, 0}, {12, 0, 16383}, {12, 8, 0},
+	{14, 0, 13730}, {0, 3, 16102}, {1, 3, 15083}, {2, 3, 12254},
+	{12, 13, 16383}, {12, 5, 0}, {12, 2, 16383}, {12, 3, 16383},
+	{12, 4, 16383}, {12, 6, 0}, {9, 0, 581}, {4, 0, 0},
+	{9, 0, 581}, {4, 0, 0}, {4, 1, 13142}, {9, 1, 13142},
+	{4, 3, 840}, {9, 3, 840}, {4, 4, 4}, {4, 6, 0},
+	{12, 12, 0}, {3, 0, 767}, {3, 1, 399}, {3, 2, 1241},
+	{3, 3, 1368}, {12, 11, 15888}, {5, 0, 0}, {5, 1, 4002},
+	{5, 2, 9325}, {3, 3, 1326}, {5, 5, 16383}, {5, 4, 12388},
+	{12, 1, 16383}, {12, 7, 0}, {11, 0, 13831}, {3, 3, 1368},
+	{5, 3, 1326}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* sonic6 */
+static bristolDefault algo37[] = {
+	{0, 0, 8192}, {0, 1, 2}, {0, 2, 8192}, {0, 3, 16383},
+	{0, 5, 16383}, {1, 0, 8192}, {1, 1, 2}, {1, 2, 8192},
+	{1, 3, 16383}, {1, 4, 16383}, {7, 1, 16383}, {8, 1, 16383},
+	{3, 3, 16383}, {6, 0, 10024}, {6, 2, 4096}, {2, 0, 8192},
+	{2, 1, 8192}, {2, 2, 8192}, {4, 2, 8192}, {4, 3, 4096},
+	{4, 4, 4}, {4, 5, 16383}, {4, 6, 0}, {126, 2, 8192},
+	{124, 0, 16383}, {7, 0, 0}, {8, 0, 16381}, {126, 15, 0},
+	{7, 0, 0}, {126, 17, 1}, {126, 18, 0}, {126, 14, 8439},
+	{0, 4, 0}, {0, 5, 0}, {0, 6, 1}, {126, 101, 0},
+	{126, 101, 12058}, {126, 21, 0}, {126, 22, 15948}, {126, 32, 0},
+	{1, 2, 339}, {1, 0, 16383}, {1, 1, 3}, {1, 4, 0},
+	{1, 5, 0}, {1, 6, 1}, {126, 101, 9109}, {126, 101, 0},
+	{126, 23, 3262}, {126, 24, 14550}, {126, 25, 16383}, {126, 13, 16383},
+	{126, 26, 0}, {126, 27, 16383}, {6, 1, 0}, {126, 28, 16383},
+	{126, 29, 16383}, {126, 30, 16383}, {126, 31, 0}, {126, 35, 0},
+	{3, 0, 0}, {3, 3, 16383}, {3, 2, 16383}, {3, 1, 16383},
+	{3, 3, 16383}, {3, 5, 0}, {4, 0, 0}, {4, 1, 0},
+	{126, 10, 0}, {126, 11, 0}, {126, 12, 0}, {3, 6, 0},
+	{126, 36, 0}, {126, 37, 0}, {126, 33, 0}, {4, 3, 0},
+	{126, 34, 0}, {126, 19, 0}, {126, 20, 0}, {126, 101, 0},
+	{101, 0, 0}, {101, 1, 0}, {101, 2, 0}, {101, 3, 0},
+	{126, 101, 0}, {126, 2, 8191}, {126, 1, 8191}, {126, 0, 1638},
+	{124, 0, 15000}, {124, 0, 15000},
+};
+
+/* trilogy */
+static bristolDefault algo38[] = {
+	{3, 2, 8192}, {3, 3, 16383}, {3, 4, 4}, {2, 4, 16383},
+	{2, 5, 0}, {0, 1, 8192}, {1, 1, 8192}, {124, 0, 16383},
+	{126, 10, 12872}, {3, 0, 1450}, {3, 1, 14360}, {126, 26, 0},
+	{126, 22, 4410}, {126, 23, 1758}, {126, 24, 1}, {126, 25, 1},
+	{0, 9, 8191}, {126, 11, 0}, {0, 8, 0}, {126, 12, 0},
+	{1, 8, 12}, {1, 9, 6977}, {126, 15, 8191}, {126, 16, 1},
+	{5, 1, 1}, {126, 17, 0}, {126, 9, 12673}, {0, 5, 2882},
+	{0, 6, 13501}, {1, 5, 2882}, {1, 6, 13501}, {126, 13, 0},
+	{126, 14, 1}, {5, 0, 8614}, {126, 18, 2209}, {126, 19, 2780},
+	{126, 20, 12872}, {126, 101, 0}, {126, 101, 0}, {126, 101, 0},
+	{126, 101, 0}, {126, 101, 0}, {126, 101, 0}, {126, 101, 0},
+	{126, 101, 0}, {126, 101, 0}, {126, 101, 0}, {126, 101, 0},
+	{126, 101, 0}, {2, 0, 0}, {2, 1, 3510}, {2, 2, 3897},
+	{2, 3, 979}, {2, 0, 0}, {2, 0, 0}, {2, 1, 3510},
+	{2, 1, 3510}, {2, 2, 3897}, {2, 2, 3897}, {2, 3, 979},
+	{2, 3, 979}, {126, 1, 3195}, {0, 0, 11491}, {0, 2, 2446},
+	{0, 3, 4892}, {126, 21, 8191}, {126, 2, 8191}, {1, 0, 16383},
+	{1, 2, 0}, {1, 3, 0}, {2, 5, 16383}, {126, 27, 16383},
+	{3, 4, 4}, {3, 0, 1450}, {3, 1, 14360}, {3, 3, 3510},
+	{124, 0, 15000}, {124, 0, 15000},
+};
+
+/* trilogy */
+static bristolDefault algo39[] = {
+	{0, 0, 16383}, {0, 1, 16383}, {0, 2, 16383}, {0, 3, 16383},
+	{0, 4, 0}, {0, 5, 0}, {0, 7, 0}, {0, 8, 0},
+	{0, 9, 8192}, {0, 11, 16383}, {1, 0, 0}, {1, 1, 100},
+	{1, 2, 6000}, {1, 3, 500}, {1, 4, 16383}, {1, 5, 0},
+	{2, 0, 16383}, {2, 1, 16383}, {2, 2, 16383}, {2, 3, 16383},
+	{2, 4, 16383}, {2, 5, 0}, {2, 7, 1}, {2, 8, 12},
+	{2, 9, 8192}, {2, 11, 16383}, {3, 1, 8192}, {3, 2, 16383},
+	{3, 4, 16383}, {3, 5, 1}, {0, 3, 16383}, {0, 2, 1516},
+	{0, 1, 8494}, {0, 0, 16383}, {126, 5, 0}, {126, 8, 0},
+	{2, 0, 2860}, {2, 1, 13523}, {2, 12, 9573}, {3, 0, 767},
+	{3, 3, 2038}, {5, 0, 8614}, {126, 18, 2209}, {126, 19, 2780},
+	{126, 20, 12872}, {126, 1, 3195}, {126, 3, 8191}, {0, 4, 4931},
+	{126, 4, 10375}, {0, 5, 7122}, {0, 6, 7122}, {1, 0, 20},
+	{1, 1, 2000}, {1, 2, 2000}, {1, 3, 10}, {126, 2, 8191},
+	{126, 6, 7362}, {2, 0, 15474}, {2, 2, 454}, {2, 3, 909},
+	{126, 7, 5154}, {2, 5, 5709}, {2, 6, 5709}, {2, 4, 6049},
+	{124, 0, 16383}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* poly800 */
+static bristolDefault algo41[] = {
+	{0, 0, 8192}, {0, 1, 8192}, {0, 2, 0}, {0, 8, 0},
+	{0, 11, 0}, {0, 12, 0}, {0, 15, 0}, {1, 1, 8192},
+	{1, 8, 0}, {1, 11, 0}, {1, 12, 0}, {1, 15, 0},
+	{4, 0, 0}, {4, 2, 16383}, {4, 8, 0}, {4, 11, 0},
+	{4, 12, 1}, {5, 0, 0}, {5, 2, 16383}, {5, 8, 0},
+	{5, 11, 0}, {5, 12, 1}, {6, 0, 0}, {6, 2, 16383},
+	{6, 8, 0}, {6, 9, 16383}, {6, 11, 1}, {2, 2, 16383},
+	{2, 4, 4}, {2, 5, 16383}, {2, 6, 0}, {124, 0, 16383},
+	{126, 2, 13477}, {126, 1, 8191}, {126, 6, 0}, {0, 2, 12},
+	{0, 9, 13243}, {0, 10, 3140}, {0, 4, 3659}, {0, 5, 10412},
+	{0, 6, 6607}, {0, 7, 13701}, {4, 9, 10284}, {126, 10, 1},
+	{1, 2, 12}, {1, 9, 6440}, {1, 10, 9943}, {1, 4, 15523},
+	{1, 5, 5898}, {1, 6, 10402}, {1, 7, 16383}, {5, 9, 4199},
+	{126, 13, 0}, {1, 2, 12}, {1, 0, 8955}, {3, 0, 0},
+	{0, 13, 8385}, {126, 4, 0}, {1, 13, 8118}, {126, 5, 8835},
+	{0, 3, 2239}, {1, 3, 2239}, {2, 0, 2743}, {2, 1, 1799},
+	{2, 3, 0}, {126, 20, 1}, {126, 21, 7747}, {126, 12, 1},
+	{6, 12, 1}, {100, 3, 7038}, {100, 3, 7038}, {4, 1, 0},
+	{4, 3, 3510}, {4, 4, 9043}, {4, 5, 8614}, {4, 6, 4162},
+	{4, 7, 3510}, {4, 10, 0}, {5, 10, 0}, {6, 10, 0},
+	{100, 0, 1706}, {5, 1, 0}, {5, 3, 1625}, {5, 4, 3933},
+	{5, 5, 3510}, {5, 6, 8885}, {5, 7, 2129}, {126, 0, 0},
+	{100, 1, 11689}, {6, 1, 7122}, {6, 3, 8521}, {6, 4, 7232},
+	{6, 5, 10998}, {6, 6, 1662}, {6, 7, 3324}, {6, 10, 0},
+	{100, 2, 2613}, {8, 0, 14395}, {126, 24, 1900}, {126, 22, 0},
+	{126, 23, 0}, {8, 1, 0}, {126, 11, 0}, {126, 126, 0},
+	{0, 2, 12}, {126, 6, 2730}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+/* BME700 */
+static bristolDefault algo42[] = {
+	{0, 4, 819}, {0, 5, 8191}, {1, 4, 819}, {1, 5, 8191},
+	{2, 0, 8192}, {2, 1, 8192}, {2, 15, 1}, {2, 3, 0},
+	{2, 4, 0}, {2, 5, 16383}, {2, 6, 0}, {2, 9, 16383},
+	{6, 4, 16383}, {7, 4, 16383}, {3, 7, 12000}, {3, 5, 16383},
+	{4, 7, 12000}, {4, 4, 3}, {4, 5, 16383}, {124, 0, 16383},
+	{126, 11, 1}, {0, 0, 2335}, {1, 0, 3841}, {126, 12, 1},
+	{126, 10, 1}, {126, 27, 0}, {126, 14, 0}, {126, 13, 1},
+	{126, 0, 1551}, {2, 13, 8191}, {126, 29, 8431}, {126, 16, 0},
+	{126, 17, 0}, {126, 28, 863}, {2, 14, 0}, {126, 15, 0},
+	{2, 13, 8191}, {126, 29, 8431}, {126, 16, 0}, {126, 17, 0},
+	{2, 13, 8191}, {126, 29, 8431}, {126, 16, 0}, {126, 17, 0},
+	{2, 2, 12}, {2, 3, 177}, {2, 4, 16383}, {2, 5, 16383},
+	{2, 6, 0}, {2, 2, 12}, {2, 3, 177}, {2, 4, 16383},
+	{2, 5, 16383}, {2, 6, 0}, {126, 3, 16383}, {3, 4, 4},
+	{3, 0, 4505}, {3, 1, 15151}, {3, 7, 13783}, {3, 4, 4},
+	{3, 0, 4505}, {3, 1, 15151}, {3, 7, 13783}, {3, 4, 4},
+	{3, 0, 4505}, {3, 1, 15151}, {3, 7, 13783}, {3, 4, 4},
+	{3, 0, 4505}, {3, 1, 15151}, {3, 7, 13783}, {3, 4, 4},
+	{3, 0, 4505}, {3, 1, 15151}, {3, 7, 13783}, {3, 4, 4},
+	{3, 0, 4505}, {3, 1, 15151}, {3, 7, 13783}, {6, 2, 0},
+	{6, 0, 0}, {6, 1, 6581}, {6, 3, 6581}, {7, 2, 16383},
+	{7, 0, 1900}, {7, 1, 3281}, {7, 3, 3281}, {126, 5, 3510},
+	{126, 6, 1799}, {4, 1, 3780}, {4, 0, 2129}, {4, 2, 8921},
+	{126, 25, 7015}, {126, 20, 1}, {126, 21, 1}, {4, 3, 0},
+	{126, 22, 0}, {126, 4, 4469}, {126, 26, 15667}, {126, 23, 1},
+	{126, 24, 1}, {126, 7, 0}, {0, 1, 16383}, {126, 8, 0},
+	{1, 1, 16383}, {0, 4, 0}, {2, 2, 12}, {2, 3, 177},
+	{2, 4, 16383}, {2, 5, 16383}, {2, 6, 0}, {2, 2, 12},
+	{2, 3, 177}, {2, 4, 16383}, {2, 5, 16383}, {2, 6, 0},
+	{5, 1, 0}, {5, 2, 0}, {3, 4, 4}, {3, 0, 4505},
+	{3, 1, 15151}, {3, 7, 13783}, {3, 4, 4}, {3, 0, 4505},
+	{3, 1, 15151}, {3, 7, 13783}, {3, 4, 4}, {3, 0, 4505},
+	{3, 1, 15151}, {3, 7, 13783}, {3, 4, 4}, {3, 0, 4505},
+	{3, 1, 15151}, {3, 7, 13783}, {6, 5, 16383}, {6, 6, 0},
+	{6, 4, 16383}, {7, 5, 16383}, {7, 6, 0}, {7, 4, 16383},
+	{4, 3, 7861}, {126, 22, 7861}, {4, 7, 11412}, {126, 9, 0},
+	{126, 101, 0}, {126, 101, 0}, {126, 101, 0}, {126, 101, 0},
+	{126, 101, 0}, {126, 101, 0}, {126, 101, 0}, {126, 101, 0},
+	{126, 101, 0}, {126, 101, 0}, {126, 1, 8191}, {126, 2, 11468},
+	{124, 0, 15000}, {124, 0, 15000},
+};
+
+/* bassmaker */
+static bristolDefault algo43[] = {
+	{124, 0, 16383}, {0, 0, 0}, {0, 0, 0}, {126, 1, 11424},
+	{126, 1, 11424}, {126, 1, 11424}, {126, 1, 10671}, {126, 1, 10671},
+	{126, 1, 10671}, {126, 1, 10473}, {126, 1, 10473}, {126, 1, 10473},
+	{126, 1, 10671}, {126, 1, 10671}, {126, 1, 10671}, {126, 1, 10327},
+	{126, 1, 10327}, {126, 1, 10327}, {126, 1, 10671}, {126, 1, 10671},
+	{126, 1, 10671}, {126, 1, 10429}, {126, 1, 10429}, {126, 1, 10429},
+	{126, 1, 9812}, {126, 1, 9812}, {126, 1, 9812}, {126, 1, 9465},
+	{126, 1, 9465}, {126, 1, 9465}, {126, 1, 9522}, {126, 1, 9522},
+	{126, 1, 9522}, {126, 1, 10025}, {126, 1, 10025}, {126, 1, 10025},
+	{126, 1, 10633}, {126, 1, 10633}, {126, 1, 10633}, {126, 1, 10248},
+	{126, 1, 10248}, {126, 1, 10248}, {126, 1, 9560}, {126, 1, 9560},
+	{126, 1, 9560}, {126, 1, 9442}, {126, 1, 9442}, {126, 1, 9442},
+	{126, 1, 9102}, {126, 1, 9102}, {126, 1, 9102}, {126, 1, 12053},
+	{126, 1, 12053}, {126, 1, 12053}, {126, 1, 0}, {126, 1, 0},
+	{126, 1, 0}, {126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191},
+	{126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191},
+	{126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191},
+	{126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191},
+	{126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191},
+	{126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191},
+	{126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191},
+	{126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191}, {126, 1, 5711},
+	{126, 1, 5711}, {126, 1, 5711}, {126, 1, 8191}, {126, 1, 8191},
+	{126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191},
+	{126, 1, 8191}, {126, 1, 8191}, {126, 1, 8191}, {126, 1, 11424},
+	{126, 1, 11424}, {126, 1, 11424}, {126, 1, 10671}, {126, 1, 10671},
+	{126, 1, 10671}, {126, 1, 10473}, {126, 1, 10473}, {126, 1, 10473},
+	{126, 1, 10671}, {126, 1, 10671}, {126, 1, 10671}, {126, 1, 10327},
+	{126, 1, 10327}, {126, 1, 10327}, {126, 1, 10671}, {126, 1, 10671},
+	{126, 1, 10671}, {126, 1, 10429}, {126, 1, 10429}, {126, 1, 10429},
+	{126, 1, 9812}, {126, 1, 9812}, {126, 1, 9812}, {126, 1, 9465},
+	{126, 1, 9465}, {126, 1, 9465}, {126, 1, 9522}, {126, 1, 9522},
+	{126, 1, 9522}, {126, 1, 10025}, {126, 1, 10025}, {126, 1, 10025},
+	{126, 1, 10633}, {126, 1, 10633}, {126, 1, 10633}, {126, 1, 10248},
+	{126, 1, 10248}, {126, 1, 10248}, {126, 1, 9560}, {126, 1, 9560},
+	{126, 1, 9560}, {126, 1, 9442}, {126, 1, 9442}, {126, 1, 9442},
+	{126, 1, 9102}, {126, 1, 9102}, {126, 1, 9102}, {126, 1, 0},
+	{126, 1, 0}, {126, 1, 0}, {126, 1, 0}, {126, 1, 0},
+	{126, 1, 0}, {126, 1, 0}, {126, 1, 0}, {126, 1, 0},
+	{126, 1, 0}, {126, 1, 0}, {126, 1, 0}, {126, 1, 0},
+	{126, 1, 0}, {126, 1, 0}, {126, 1, 0}, {126, 1, 0},
+	{126, 1, 0}, {126, 1, 0}, {126, 1, 0}, {126, 1, 0},
+	{126, 1, 0}, {126, 1, 0}, {126, 1, 0}, {126, 1, 0},
+	{126, 1, 0}, {126, 1, 0}, {126, 1, 0}, {126, 1, 0},
+	{126, 1, 0}, {126, 1, 0}, {126, 1, 0}, {126, 1, 0},
+	{126, 1, 0}, {126, 1, 0}, {126, 1, 0}, {126, 1, 0},
+	{126, 1, 0}, {126, 1, 0}, {126, 1, 0}, {126, 1, 0},
+	{126, 1, 0}, {126, 1, 0}, {126, 1, 0}, {126, 1, 0},
+	{126, 1, 0}, {126, 1, 0}, {126, 1, 0}, {124, 0, 15000},
+	{124, 0, 15000},
+};
+
+/* sidney */
+static bristolDefault algo44[] = {
+	{124, 0, 16383}, {126, 100, 1}, {126, 98, 1}, {126, 5, 0},
+	{126, 66, 0}, {126, 66, 1}, {126, 10, 0}, {126, 11, 16383},
+	{126, 12, 0}, {126, 13, 16383}, {126, 14, 4318}, {126, 15, 8191},
+	{126, 16, 0}, {126, 17, 0}, {126, 18, 0}, {126, 19, 0},
+	{126, 20, 0}, {126, 21, 16383}, {126, 22, 0}, {126, 23, 10},
+	{126, 24, 12}, {126, 25, 10}, {126, 30, 0}, {126, 31, 0},
+	{126, 32, 16383}, {126, 33, 0}, {126, 34, 4318}, {126, 35, 8191},
+	{126, 36, 12}, {126, 37, 0}, {126, 38, 0}, {126, 39, 0},
+	{126, 40, 0}, {126, 41, 16383}, {126, 42, 1}, {126, 43, 10},
+	{126, 44, 12}, {126, 45, 2}, {126, 50, 0}, {126, 51, 0},
+	{126, 52, 0}, {126, 53, 16383}, {126, 54, 4318}, {126, 55, 8191},
+	{126, 56, 0}, {126, 57, 0}, {126, 58, 0}, {126, 59, 0},
+	{126, 60, 0}, {126, 61, 16383}, {126, 62, 0}, {126, 63, 10},
+	{126, 64, 12}, {126, 65, 10}, {126, 70, 16383}, {126, 71, 0},
+	{126, 72, 16383}, {126, 73, 1499}, {126, 74, 1}, {126, 75, 9480},
+	{126, 76, 16383}, {126, 2, 16383}, {126, 3, 9}, {126, 77, 7603},
+	{126, 78, 3345}, {126, 79, 16383}, {126, 80, 0}, {126, 81, 0},
+	{126, 82, 0}, {126, 83, 0}, {126, 84, 0}, {126, 85, 0},
+	{126, 101, 0}, {126, 102, 0}, {126, 89, 0}, {126, 90, 0},
+	{126, 91, 0}, {126, 92, 16383}, {126, 86, 0}, {126, 87, 0},
+	{126, 88, 0}, {126, 93, 10}, {126, 94, 3}, {126, 95, 2},
+	{126, 96, 2}, {126, 97, 16383}, {126, 103, 0}, {126, 100, 0},
+	{126, 98, 1}, {126, 99, 0}, {126, 6, 8191}, {126, 7, 16383},
+	{126, 8, 0}, {126, 5, 3}, {126, 100, 0}, {126, 98, 1},
+	{126, 99, 0}, {126, 66, 0}, {126, 67, 1}, {126, 68, 0},
+	{126, 69, 0}, {124, 0, 15000}, {124, 0, 15000},
+};
+
+static struct {
+	int algo;
+	int count;
+	bristolDefault *param;
+} defaults[] = {
+	{0, sizeof(algo0) / sizeof(bristolDefault), algo0},
+	{1, sizeof(algo1) / sizeof(bristolDefault), algo1},
+	{2, sizeof(algo2) / sizeof(bristolDefault), algo2},
+	{3, sizeof(algo3) / sizeof(bristolDefault), algo3},
+	{4, sizeof(algo4) / sizeof(bristolDefault), algo4},
+	{5, sizeof(algo5) / sizeof(bristolDefault), algo5},
+	{6, sizeof(algo6) / sizeof(bristolDefault), algo6},
+	{7, sizeof(algo7) / sizeof(bristolDefault), algo7},
+	{8, sizeof(algo8) / sizeof(bristolDefault), algo8},
+	{14, sizeof(algo14) / sizeof(bristolDefault), algo14},
+	{15, sizeof(algo15) / sizeof(bristolDefault), algo15},
+	{18, sizeof(algo18) / sizeof(bristolDefault), algo18},
+	{19, sizeof(algo19) / sizeof(bristolDefault), algo19},
+	{20, sizeof(algo20) / sizeof(bristolDefault), algo20},
+	{21, sizeof(algo21) / sizeof(bristolDefault), algo21},
+	{22, sizeof(algo22) / sizeof(bristolDefault), algo22},
+	{23, sizeof(algo23) / sizeof(bristolDefault), algo23},
+	{26, sizeof(algo26) / sizeof(bristolDefault), algo26},
+	{27, sizeof(algo27) / sizeof(bristolDefault), algo27},
+	{29, sizeof(algo29) / sizeof(bristolDefault), algo29},
+	{30, sizeof(algo30) / sizeof(bristolDefault), algo30},
+	{31, sizeof(algo31) / sizeof(bristolDefault), algo31},
+	{35, sizeof(algo35) / sizeof(bristolDefault), algo35},
+	{36, sizeof(algo36) / sizeof(bristolDefault), algo36},
+	{37, sizeof(algo37) / sizeof(bristolDefault), algo37},
+	{38, sizeof(algo38) / sizeof(bristolDefault), algo38},
+	{39, sizeof(algo39) / sizeof(bristolDefault), algo39},
+	{41, sizeof(algo41) / sizeof(bristolDefault), algo41},
+	{42, sizeof(algo42) / sizeof(bristolDefault), algo42},
+	{43, sizeof(algo43) / sizeof(bristolDefault), algo43},
+	{44, sizeof(algo44) / sizeof(bristolDefault), algo44},
+	{-1, 0, NULL}
+};
+
+/*
+ * The index'th default parameter of an algorithm with its value from 0.0 to
+ * 1.0 for bristolEngineParam(). Returns -1 past the last one, an algorithm
+ * without defaults has none.
+ */
+int
+bristolEngineDefault(int algo, int index, int *operator, int *controller,
+float *value)
+{
+	int i;
+
+	for (i = 0; defaults[i].algo >= 0; i++)
+	{
+		if (defaults[i].algo != algo)
+			continue;
+
+		if ((index < 0) || (index >= defaults[i].count))
+			return(-1);
+
+		*operator = defaults[i].param[index].operator;
+		*controller = defaults[i].param[index].controller;
+		*value = defaults[i].param[index].value / 16383.0f;
+
+		return(0);
+	}
+
+	return(-1);
+}
@@ -26,8 +26,6 @@
 
 extern int bristolGlobalController(struct BAudio *, u_char, u_char, float);
 
-float *lfobuf, *op0buf, *op1buf, *op2buf, *op3buf, *op4buf, *modbuf;
-
 int
 DXGlobalController(Baudio *baudio, u_char controller,
 u_char operator, float value)
@@ -134,616 +132,105 @@ u_char operator, float value)
 	return(0);
 }
 
-void
-dxOpOne(int ind, float *kbuf, float *opbuf, float *obuf, int count,
-dxmix *mix, audioMain *am, Baudio *ba, bristolVoice *v)
-{
-	float igain = mix[ind].igain;
-	int flags = v->flags & BRISTOL_KEYDONE;
-
-	bufmerge(opbuf, 1.0, modbuf, 0.0, count);
-/*printf("dxOpOne(%i)\n", ind); */
-
-	if (mix[ind].flags & DX_IGC)
-		igain *= ba->contcontroller[1];
-		
-	/*
-	 * Check on our mods,
-	 */
-	if (mix[ind].flags & DX_KEY)
-		bufmerge(kbuf, 1.0, modbuf, igain, count);
-	else
-		bufmerge(lfobuf, 1.0, modbuf, igain, count);
-
-	/*
-	 * Push in our pointers. Note that if we move the pointers into the
-	 * params structure we could avoid doing this for each op.
-	 */
-	am->palette[(*ba->sound[0]).index]->specs->io[0].buf = modbuf;
-	am->palette[(*ba->sound[0]).index]->specs->io[1].buf = obuf;
-
-	/*
-	 * Call the operator.
-	 */
-	(*ba->sound[ind]).operate(
-		(am->palette)[9],
-		v,
-		(*ba->sound[ind]).param,
-		v->locals[v->index][ind]);
-
-	v->flags = v->flags & flags? v->flags: v->flags & ~BRISTOL_KEYDONE;
-}
+/*
+ * The operator graphs for the algorithms, taken from the original per
+ * algorithm buffer routing. 11, 18, 19 and 20 are duplicates of 4, 7, 2 and
+ * 2 respectively. Every carrier is panned with its own operator pan.
+ */
+static dxalgo dxalgos[DX_ALGO_COUNT] = {
+	{{0, 3, 1, 4, 2, 5}, /* 0 */
+		{0, 0, 0, DX_OP(0), DX_OP(1), DX_OP(2)},
+		DX_OP(3)|DX_OP(4)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 1 */
+		{0, DX_OP(0), DX_OP(1), 0, DX_OP(3), DX_OP(4)},
+		DX_OP(2)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 2 */
+		{0, DX_OP(0), DX_OP(0), 0, DX_OP(3), DX_OP(3)},
+		DX_OP(1)|DX_OP(2)|DX_OP(4)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 3 */
+		{0, 0, DX_OP(0)|DX_OP(1), 0, 0, DX_OP(3)|DX_OP(4)},
+		DX_OP(2)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 4 */
+		{0, DX_OP(0), DX_OP(1), DX_OP(0), DX_OP(0), DX_OP(3)|DX_OP(4)},
+		DX_OP(2)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 5 */
+		{0, DX_OP(0), DX_OP(1), DX_OP(0), DX_OP(3), DX_OP(3)},
+		DX_OP(2)|DX_OP(4)|DX_OP(5)},
+	{{0, 3, 1, 2, 4, 5}, /* 6 */
+		{0, DX_OP(3), DX_OP(3), DX_OP(0), DX_OP(3), DX_OP(3)},
+		DX_OP(1)|DX_OP(2)|DX_OP(4)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 7 */
+		{0, 0, DX_OP(0)|DX_OP(1), 0, DX_OP(3), DX_OP(3)},
+		DX_OP(2)|DX_OP(4)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 8 */
+		{0, DX_OP(0), 0, DX_OP(2), DX_OP(3), DX_OP(4)},
+		DX_OP(1)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 9 */
+		{0, 0, 0, DX_OP(2), DX_OP(3), DX_OP(0)|DX_OP(1)|DX_OP(4)},
+		DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 10 */
+		{0, DX_OP(0), 0, 0, DX_OP(3), DX_OP(2)|DX_OP(4)},
+		DX_OP(1)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 11 */
+		{0, DX_OP(0), DX_OP(1), DX_OP(0), DX_OP(0), DX_OP(3)|DX_OP(4)},
+		DX_OP(2)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 12 */
+		{0, DX_OP(0), 0, 0, DX_OP(2)|DX_OP(3), DX_OP(4)},
+		DX_OP(1)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 13 */
+		{0, 0, DX_OP(1), 0, DX_OP(3), DX_OP(0)|DX_OP(2)|DX_OP(4)},
+		DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 14 */
+		{0, DX_OP(0), DX_OP(1), 0, DX_OP(3), 0},
+		DX_OP(2)|DX_OP(4)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 15 */
+		{0, DX_OP(0), DX_OP(1), DX_OP(1), DX_OP(1), DX_OP(1)},
+		DX_OP(2)|DX_OP(3)|DX_OP(4)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 16 */
+		{0, DX_OP(0), 0, 0, 0, DX_OP(2)|DX_OP(3)|DX_OP(4)},
+		DX_OP(1)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 17 */
+		{0, DX_OP(0), 0, DX_OP(2), DX_OP(2), DX_OP(2)},
+		DX_OP(1)|DX_OP(3)|DX_OP(4)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 18 */
+		{0, 0, DX_OP(0)|DX_OP(1), 0, DX_OP(3), DX_OP(3)},
+		DX_OP(2)|DX_OP(4)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 19 */
+		{0, DX_OP(0), DX_OP(0), 0, DX_OP(3), DX_OP(3)},
+		DX_OP(1)|DX_OP(2)|DX_OP(4)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 20 */
+		{0, DX_OP(0), DX_OP(0), 0, DX_OP(3), DX_OP(3)},
+		DX_OP(1)|DX_OP(2)|DX_OP(4)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 21 */
+		{0, DX_OP(0), DX_OP(0), DX_OP(0), DX_OP(0), DX_OP(0)},
+		DX_OP(1)|DX_OP(2)|DX_OP(3)|DX_OP(4)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 22 */
+		{0, DX_OP(0), DX_OP(0), DX_OP(0), DX_OP(0), DX_OP(0)},
+		DX_OP(1)|DX_OP(2)|DX_OP(3)|DX_OP(4)|DX_OP(5)},
+	{{0, 1, 2, 3, 4, 5}, /* 23 */
+		{0, 0, 0, 0, 0, 0},
+		DX_OP(0)|DX_OP(1)|DX_OP(2)|DX_OP(3)|DX_OP(4)|DX_OP(5)},
+};
 
 int
 DXalgoN(audioMain *am, register Baudio *ba, bristolVoice *voice, float *kb)
 {
-	register int i, sc = am->samplecount;
-	register float *bufptr = lfobuf;
-	dxmix *mix = (dxmix *) ba->mixlocals;
+	int algo = ba->mixflags & DX_ALGO_M;
 
 	/*
 	 * Fill the wavetable with the correct note value
 	 */
-	fillFreqTable(ba, voice, kb, sc, 1);
-	/*
-	 * Build a LFO frequency table
-	 */
-	for (i = 0; i < sc ; i+=8)
-	{
-		*bufptr++ = 0.001 + ba->contcontroller[1] / 2;
-		*bufptr++ = 0.001 + ba->contcontroller[1] / 2;
-		*bufptr++ = 0.001 + ba->contcontroller[1] / 2;
-		*bufptr++ = 0.001 + ba->contcontroller[1] / 2;
-		*bufptr++ = 0.001 + ba->contcontroller[1] / 2;
-		*bufptr++ = 0.001 + ba->contcontroller[1] / 2;
-		*bufptr++ = 0.001 + ba->contcontroller[1] / 2;
-		*bufptr++ = 0.001 + ba->contcontroller[1] / 2;
-	}
-
-	bzero(op0buf, am->segmentsize);
-	bzero(op1buf, am->segmentsize);
-	bzero(op2buf, am->segmentsize);
-
-	switch (ba->mixflags & DX_ALGO_M) {
-		case 0:
-			/*
-			 * Op0 feeds op1, op2 feeds op3, op4 feeds op5.
-			 */
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(3, kb, op1buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[3].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[3].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op1buf, am->segmentsize);
-			bzero(op2buf, am->segmentsize);
-			dxOpOne(1, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(4, kb, op1buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[4].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[4].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op1buf, am->segmentsize);
-			bzero(op2buf, am->segmentsize);
-			dxOpOne(2, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(5, kb, op1buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			break;
-		case 1:
-			/*
-			 * Op0 feeds op1 into op2, then op3 feeds op4 into op5.
-			 */
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(1, kb, op1buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(2, kb, op2buf, op0buf, sc, mix, am, ba, voice);
-			bufmerge(op0buf, mix[0].vol * mix[2].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op0buf, mix[0].vol * (1.0 - mix[2].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op0buf, am->segmentsize);
-			bzero(op1buf, am->segmentsize);
-			bzero(op2buf, am->segmentsize);
-			dxOpOne(3, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(4, kb, op1buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(5, kb, op2buf, op0buf, sc, mix, am, ba, voice);
-			bufmerge(op0buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op0buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			break;
-		case 2:
-		case 19:
-		case 20:
-			/*
-			 * Op0 feeds op1 and op2, then op3 feeds op4 and op5.
-			 */
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(1, kb, op1buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(2, kb, op1buf, op0buf, sc, mix, am, ba, voice);
-
-			bufmerge(op2buf, mix[0].vol * mix[1].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[1].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-			bufmerge(op0buf, mix[0].vol * mix[2].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op0buf, mix[0].vol * (1.0 - mix[2].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op0buf, am->segmentsize);
-			bzero(op1buf, am->segmentsize);
-			bzero(op2buf, am->segmentsize);
-			dxOpOne(3, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(4, kb, op1buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(5, kb, op1buf, op0buf, sc, mix, am, ba, voice);
-
-			bufmerge(op2buf, mix[0].vol * mix[4].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[4].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-			bufmerge(op0buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op0buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			break;
-		case 3:
-			/*
-			 * Op0 and op1 feed op2, then op3 and op4 feed op5.
-			 * These then need a crossover between the L and R channels.
-			 */
-			bzero(op3buf, am->segmentsize);
-			bzero(op4buf, am->segmentsize);
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(1, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(2, kb, op1buf, op3buf, sc, mix, am, ba, voice);
-
-			bzero(op0buf, am->segmentsize);
-			dxOpOne(3, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(4, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(5, kb, op2buf, op4buf, sc, mix, am, ba, voice);
-
-			bufmerge(op3buf, mix[0].vol * mix[2].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * (1.0 - mix[2].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-			bufmerge(op4buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op4buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-			break;
-		case 4:
-		case 11: /* Same algo, just 4 and 5 take no input from 1. */
-			/*
-			 * Op0 feeds op1, op2 into op3. It also feeds op4 and op5 into op6.
-			 */
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(1, kb, op1buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(2, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			bufmerge(op3buf, mix[0].vol * mix[2].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * (1.0 - mix[2].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op2buf, am->segmentsize);
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(3, kb, op1buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(4, kb, op1buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(5, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			bufmerge(op3buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-			break;
-		case 5:
-			/*
-			 * op1 feeds op2 into op3, and op4 into op5 and op6.
-			 */
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(1, kb, op1buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(2, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			bufmerge(op3buf, mix[0].vol * mix[2].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * (1.0 - mix[2].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op2buf, am->segmentsize);
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(3, kb, op1buf, op0buf, sc, mix, am, ba, voice);
-			dxOpOne(4, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(5, kb, op0buf, op3buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[4].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[4].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-			break;
-		case 6:
-			/*
-			 * Op0 feeds op4. Op4 feeds op2, op3, op5 and op6.
-			 */
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(3, kb, op1buf, op2buf, sc, mix, am, ba, voice);
-
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(1, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			bufmerge(op3buf, mix[0].vol * mix[1].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * (1.0 - mix[1].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(2, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			bufmerge(op3buf, mix[0].vol * mix[2].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * (1.0 - mix[2].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(4, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			bufmerge(op3buf, mix[0].vol * mix[4].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * (1.0 - mix[4].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(5, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			bufmerge(op3buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
+	fillFreqTable(ba, voice, kb, am->samplecount, 1);
 
-			break;
-		case 7:
-		case 18:
-			/*
-			 * Op0 and op1 feed op2, then op3 feeds op4 and op5.
-			 */
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(1, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(2, kb, op1buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[2].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[2].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op2buf, am->segmentsize);
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(3, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(4, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			bufmerge(op3buf, mix[0].vol * mix[4].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * (1.0 - mix[4].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(5, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			bufmerge(op3buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			break;
-		case 8:
-			/*
-			 * Op0 and op1 feed op2, and ops 3 to 6 feed each other.
-			 */
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(1, kb, op1buf, op0buf, sc, mix, am, ba, voice);
-			bufmerge(op0buf, mix[0].vol * mix[1].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op0buf, mix[0].vol * (1.0 - mix[1].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op0buf, am->segmentsize);
-			bzero(op1buf, am->segmentsize);
-			bzero(op3buf, am->segmentsize);
-			bzero(op4buf, am->segmentsize);
-			dxOpOne(2, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(3, kb, op1buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(4, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			dxOpOne(5, kb, op3buf, op4buf, sc, mix, am, ba, voice);
-			bufmerge(op4buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op4buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			break;
-		case 9:
-			/*
-			 * Op2 feeds op3 into op4. Then 0, 1 and  op4 feed 5.
-			 */
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(1, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-
-			dxOpOne(2, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(3, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			dxOpOne(4, kb, op3buf, op1buf, sc, mix, am, ba, voice);
-
-			dxOpOne(5, kb, op1buf, op0buf, sc, mix, am, ba, voice);
-			bufmerge(op0buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op0buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			break;
-		case 10:
-			/*
-			 * Op0 feeds op1, op 3 feed op4, then 4 and 2 feed 5.
-			 */
-			dxOpOne(0, kb, op1buf, op0buf, sc, mix, am, ba, voice);
-			dxOpOne(1, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			bufmerge(op1buf, mix[0].vol * mix[1].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op1buf, mix[0].vol * (1.0 - mix[1].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op3buf, am->segmentsize);
-			bzero(op4buf, am->segmentsize);
-			dxOpOne(2, kb, op3buf, op4buf, sc, mix, am, ba, voice);
-
-			dxOpOne(3, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			dxOpOne(4, kb, op3buf, op4buf, sc, mix, am, ba, voice);
-
-			dxOpOne(5, kb, op4buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			break;
-		/*case 11: // offloaded into algo 4 - good as the same. */
-		case 12:
-			/*
-			 * Op0 feeds op1, and 2, 3 and 4 feed op 5.
-			 */
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(1, kb, op1buf, op0buf, sc, mix, am, ba, voice);
-			bufmerge(op0buf, mix[0].vol * mix[1].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op0buf, mix[0].vol * (1.0 - mix[1].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op3buf, am->segmentsize);
-			bzero(op4buf, am->segmentsize);
-			dxOpOne(2, kb, op3buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(3, kb, op3buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(4, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			dxOpOne(5, kb, op3buf, op4buf, sc, mix, am, ba, voice);
-			bufmerge(op4buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op4buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			break;
-		case 13:
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(0, kb, op3buf, op0buf, sc, mix, am, ba, voice);
-
-			dxOpOne(1, kb, op3buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(2, kb, op1buf, op0buf, sc, mix, am, ba, voice);
-
-			dxOpOne(3, kb, op3buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(4, kb, op2buf, op0buf, sc, mix, am, ba, voice);
-
-			dxOpOne(5, kb, op0buf, op3buf, sc, mix, am, ba, voice);
-			bufmerge(op4buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op4buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			break;
-		case 14:
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(1, kb, op1buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(2, kb, op2buf, op0buf, sc, mix, am, ba, voice);
-			bufmerge(op0buf, mix[0].vol * mix[2].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op4buf, mix[0].vol * (1.0 - mix[2].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op0buf, am->segmentsize);
-			bzero(op1buf, am->segmentsize);
-			dxOpOne(3, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(4, kb, op1buf, op0buf, sc, mix, am, ba, voice);
-			bufmerge(op0buf, mix[0].vol * mix[4].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op4buf, mix[0].vol * (1.0 - mix[4].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op0buf, am->segmentsize);
-			bzero(op1buf, am->segmentsize);
-			dxOpOne(5, kb, op1buf, op0buf, sc, mix, am, ba, voice);
-			bufmerge(op0buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op4buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			break;
-
-		case 15:
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(1, kb, op1buf, op0buf, sc, mix, am, ba, voice);
-
-			bzero(op2buf, am->segmentsize);
-			dxOpOne(2, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[2].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[2].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op2buf, am->segmentsize);
-			dxOpOne(3, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[3].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[3].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op2buf, am->segmentsize);
-			dxOpOne(4, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[4].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[4].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op2buf, am->segmentsize);
-			dxOpOne(5, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			break;
-		case 16:
-			/*
-			 * Op0 feeds op1, and 2, 3 and 4 feed op 5.
-			 */
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(1, kb, op1buf, op0buf, sc, mix, am, ba, voice);
-			bufmerge(op0buf, mix[0].vol * mix[1].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op0buf, mix[0].vol * (1.0 - mix[1].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(2, kb, op3buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(3, kb, op3buf, op2buf, sc, mix, am, ba, voice);
-			dxOpOne(4, kb, op3buf, op2buf, sc, mix, am, ba, voice);
-
-			dxOpOne(5, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			bufmerge(op3buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			break;
-		case 17:
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			dxOpOne(1, kb, op1buf, op0buf, sc, mix, am, ba, voice);
-			bufmerge(op0buf, mix[0].vol * mix[1].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op0buf, mix[0].vol * (1.0 - mix[1].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(2, kb, op3buf, op2buf, sc, mix, am, ba, voice);
-
-			dxOpOne(3, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			bufmerge(op3buf, mix[0].vol * mix[3].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * (1.0 - mix[3].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(4, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			bufmerge(op3buf, mix[0].vol * mix[4].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * (1.0 - mix[4].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op3buf, am->segmentsize);
-			dxOpOne(5, kb, op2buf, op3buf, sc, mix, am, ba, voice);
-			bufmerge(op3buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op3buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			break;
-		case 21:
-		case 22:
-			dxOpOne(0, kb, op1buf, op0buf, sc, mix, am, ba, voice);
-
-			dxOpOne(1, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			bufmerge(op1buf, mix[0].vol * mix[1].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op1buf, mix[0].vol * (1.0 - mix[1].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			dxOpOne(2, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[2].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[2].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op2buf, am->segmentsize);
-			dxOpOne(3, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[3].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[3].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op2buf, am->segmentsize);
-			dxOpOne(4, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[4].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[4].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op2buf, am->segmentsize);
-			dxOpOne(5, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			break;
-		case 23:
-			dxOpOne(0, kb, op0buf, op1buf, sc, mix, am, ba, voice);
-			bufmerge(op1buf, mix[0].vol * mix[0].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op1buf, mix[0].vol * (1.0 - mix[0].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			dxOpOne(1, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[1].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[1].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op2buf, am->segmentsize);
-			dxOpOne(2, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[2].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[2].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op2buf, am->segmentsize);
-			dxOpOne(3, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[3].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[3].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op2buf, am->segmentsize);
-			dxOpOne(4, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[4].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[4].pan), ba->leftbuf, 1.0,
-				am->samplecount);
-
-			bzero(op2buf, am->segmentsize);
-			dxOpOne(5, kb, op0buf, op2buf, sc, mix, am, ba, voice);
-			bufmerge(op2buf, mix[0].vol * mix[5].pan, ba->rightbuf, 1.0,
-				am->samplecount);
-			bufmerge(op2buf, mix[0].vol * (1.0 - mix[5].pan), ba->leftbuf, 1.0,
-				am->samplecount);
+	if (algo >= DX_ALGO_COUNT)
+		return(0);
 
-			break;
-	}
+	/*
+	 * Render all six operators and mix the carriers in one pass.
+	 */
+	dxopfused(am->palette[B_FMOSC], voice, ba->sound,
+		&dxalgos[algo], (dxmix *) ba->mixlocals, kb,
+		ba->leftbuf, ba->rightbuf, am->samplecount);
 
 	return(0);
 }
@@ -762,10 +249,6 @@ destroyOneDXVoice(audioMain *audiomain, Baudio *baudio)
 {
 	printf("destroy DX sound\n");
 	return(0);
-	bristolfree(lfobuf);
-	bristolfree(op0buf);
-	bristolfree(op1buf);
-	bristolfree(op2buf);
 }
 
 int
@@ -798,21 +281,6 @@ printf("initialising one DX sound\n");
 	baudio->operate = DXalgoN;
 	baudio->postops = DXalgoNpostops;
 
-	if (lfobuf == 0)
-		lfobuf = (float *) bristolmalloc0(audiomain->segmentsize);
-	if (op0buf == 0)
-		op0buf = (float *) bristolmalloc0(audiomain->segmentsize);
-	if (op1buf == 0)
-		op1buf = (float *) bristolmalloc0(audiomain->segmentsize);
-	if (op2buf == 0)
-		op2buf = (float *) bristolmalloc0(audiomain->segmentsize);
-	if (op3buf == 0)
-		op3buf = (float *) bristolmalloc0(audiomain->segmentsize);
-	if (op4buf == 0)
-		op4buf = (float *) bristolmalloc0(audiomain->segmentsize);
-	if (modbuf == 0)
-		modbuf = (float *) bristolmalloc0(audiomain->segmentsize);
-
 	baudio->mixlocals = (float *) bristolmalloc0(12 * sizeof(dxmix));
 	baudio->mixflags |= BRISTOL_STEREO;
 	return(0);
@@ -853,21 +321,6 @@ printf("initialising one Rhodes sound\n");
 	baudio->operate = DXalgoN;
 	baudio->postops = DXalgoNpostops;
 
-	if (lfobuf == 0)
-		lfobuf = (float *) bristolmalloc0(audiomain->segmentsize);
-	if (op0buf == 0)
-		op0buf = (float *) bristolmalloc0(audiomain->segmentsize);
-	if (op1buf == 0)
-		op1buf = (float *) bristolmalloc0(audiomain->segmentsize);
-	if (op2buf == 0)
-		op2buf = (float *) bristolmalloc0(audiomain->segmentsize);
-	if (op3buf == 0)
-		op3buf = (float *) bristolmalloc0(audiomain->segmentsize);
-	if (op4buf == 0)
-		op4buf = (float *) bristolmalloc0(audiomain->segmentsize);
-	if (modbuf == 0)
-		modbuf = (float *) bristolmalloc0(audiomain->segmentsize);
-
 	baudio->mixlocals = (float *) bristolmalloc0(12 * sizeof(dxmix));
 	baudio->mixflags |= BRISTOL_STEREO;
 	return(0);
@@ -0,0 +1,720 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * The engine without the daemon. The bristol process has a MIDI thread that
+ * owns the sockets and MIDI devices and an audio thread, or JACK, that owns
+ * the audio device and calls doAudioOps() once per period. Here the host does
+ * both: it gives us the MIDI and parameters and pulls the audio, see
+ * bristolengine.h for the interface.
+ *
+ * Each engine has an audioMain of its own, so its own palette, voices and
+ * emulations. The daemon's audiomain is also kept here so that the library
+ * does not need anything from bristol.c.
+ *
+ * What the engines share are the file statics of the operators and the
+ * emulations: tables that depend on the samplerate and scratch buffers that
+ * are sized from the first period and kept for other invocations, as the
+ * daemon keeps them for several emulations of one type. The engines in a
+ * process therefore have one samplerate and one period size and everything
+ * that reaches the operator code holds enginelock, they render in turn.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#if defined(linux)
+#include <sched.h>
+#endif
+
+#include "bristol.h"
+#include "bristolmidi.h"
+#include "bristolblo.h"
+#include "bristolengine.h"
+
+extern int doAudioOps(audioMain *, float *, float *);
+extern void initAudioThread(audioMain *);
+extern void resetAudioThread(audioMain *);
+extern void freeAudioMain(audioMain *);
+extern void initBristolAudio(audioMain *, Baudio *);
+extern Baudio *newBristolAudio(audioMain *, int, int);
+extern int initMidiEngine(audioMain *);
+extern void closeMidiEngine(audioMain *);
+extern int midiMsgHandler(bristolMidiMsg *, audioMain *);
+extern int bristolAlgoIndex(char *);
+extern char *bristolAlgoName(int);
+extern void doNoteChanges();
+extern int bristolMidiTerminate();
+
+audioMain audiomain;
+int exitReq = 0;
+char *outputfile = NULL;
+
+/*
+ * A MIDI event for the next process call, at 'offset' samples from its start.
+ */
+typedef struct BristolEngineEvent {
+	int offset;
+	int count;
+	unsigned char data[4];
+} bristolEngineEvent;
+
+struct BristolEngine {
+	audioMain audiomain;
+	float *outbuf, *startbuf;
+	int ready; /* Samples at the end of outbuf the host has not taken yet */
+	int count;
+	bristolEngineEvent event[BRISTOL_ENGINE_EVENTS];
+};
+
+static pthread_mutex_t enginelock = PTHREAD_MUTEX_INITIALIZER;
+static int enginecount = 0, enginerate = 0, engineperiod = 0;
+
+/*
+ * The engine runs in periods of a fixed size, it is given when the engine is
+ * created since the operators size their buffers from it. The voice count is
+ * the pool the emulations share, zero takes the default.
+ */
+bristolEngine *
+bristolEngineCreate(int samplerate, int period, int voices)
+{
+	bristolEngine *engine;
+	audioMain *audiomain;
+
+	if ((samplerate <= 0) || (period <= 0))
+		return(NULL);
+
+	pthread_mutex_lock(&enginelock);
+
+	if ((enginecount > 0) && (samplerate != enginerate))
+	{
+		printf("bristol engines in one process need one samplerate, %i\n",
+			enginerate);
+		pthread_mutex_unlock(&enginelock);
+		return(NULL);
+	}
+
+	/* The operators unroll their loops up to 16 samples */
+	if (engineperiod == 0)
+		engineperiod = (period + 15) & ~15;
+
+	bristolArenaInit(32);
+
+	engine = (bristolEngine *) bristolmalloc0(sizeof(bristolEngine));
+	audiomain = &engine->audiomain;
+
+	audiomain->samplecount = engineperiod;
+	audiomain->segmentsize = audiomain->samplecount * sizeof(float);
+	audiomain->samplerate = samplerate;
+	audiomain->outgain = 4;
+	audiomain->m_io_ogc = 1.0;
+	audiomain->m_io_igc = 1.0;
+	audiomain->fxbus.send = 1.0;
+	audiomain->arena = 32;
+	audiomain->workerprio = -1;
+	audiomain->SysID = 0x534c6162;
+	audiomain->opCount = BRISTOL_SYNTHCOUNT;
+
+	if ((audiomain->voiceCount = voices) <= 0)
+		audiomain->voiceCount = BRISTOL_VOICECOUNT;
+	if (audiomain->voiceCount > BRISTOL_MAXVOICECOUNT)
+		audiomain->voiceCount = BRISTOL_MAXVOICECOUNT;
+
+	audiomain->atStatus = audiomain->mtStatus = BRISTOL_EXIT;
+	audiomain->atReq = audiomain->mtReq = BRISTOL_OK;
+
+	/* The daemon defaults for the bandwidth limited waves */
+	generateBLOwaveforms(31, BRISTOL_VPO, 84, 1.5, 3, 0.8,
+		audiomain->samplerate);
+
+	if (initMidiEngine(audiomain) < 0)
+	{
+		bristolfree(engine);
+		pthread_mutex_unlock(&enginelock);
+		return(NULL);
+	}
+
+	initAudioThread(audiomain);
+
+	engine->outbuf = (float *) bristolmalloc0(audiomain->segmentsize * 2);
+	engine->startbuf = (float *) bristolmalloc0(audiomain->segmentsize * 2);
+
+	audiomain->atStatus = audiomain->mtStatus = BRISTOL_OK;
+
+	enginecount++;
+	enginerate = samplerate;
+
+	pthread_mutex_unlock(&enginelock);
+
+	return(engine);
+}
+
+void
+bristolEngineDestroy(bristolEngine *engine)
+{
+	if (engine == NULL)
+		return;
+
+	pthread_mutex_lock(&enginelock);
+
+	resetAudioThread(&engine->audiomain);
+	freeAudioMain(&engine->audiomain);
+	closeMidiEngine(&engine->audiomain);
+
+	bristolfree(engine->outbuf);
+	bristolfree(engine->startbuf);
+	bristolfree(engine);
+
+	enginecount--;
+
+	pthread_mutex_unlock(&enginelock);
+}
+
+/*
+ * Algorithm for an emulation name, mini, dx, juno, as given to startBristol.
+ */
+int
+bristolEngineAlgo(char *name)
+{
+	return(bristolAlgoIndex(name));
+}
+
+char *
+bristolEngineName(int algo)
+{
+	return(bristolAlgoName(algo));
+}
+
+/*
+ * Algorithms are numbered from zero up to this, not all of them are in use.
+ */
+int
+bristolEngineAlgoCount()
+{
+	return(BRISTOL_SYNTHCOUNT);
+}
+
+/*
+ * Start an emulation on a MIDI channel with up to 'voices' of the voices. This
+ * is what the daemon does for the hello and init requests from a GUI, it is
+ * then given the parameters the GUI sends for its default memory where they
+ * are known. Returns the emulation's id for bristolEngineParam() or -1.
+ */
+static int bristolEngineSetParam(audioMain *, int, int, int, float);
+
+int
+bristolEngineEmulation(bristolEngine *engine, int algo, int channel,
+int voices)
+{
+	audioMain *audiomain;
+	Baudio *baudio;
+	int i, operator, controller;
+	float value;
+
+	if ((engine == NULL) || (bristolAlgoName(algo) == NULL))
+		return(-1);
+
+	audiomain = &engine->audiomain;
+
+	if (voices <= 0)
+		voices = audiomain->voiceCount;
+
+	pthread_mutex_lock(&enginelock);
+
+	baudio = newBristolAudio(audiomain, channel, voices);
+
+	/*
+	 * There is no GUI to send active sensing or the emulation's gain, the
+	 * host can change the gain with BRISTOL_NRP_GAIN as the GUI does.
+	 */
+	baudio->mixflags &= ~BRISTOL_SENSE;
+	baudio->gain = 1.0;
+
+	audiomain->midiflags = (audiomain->midiflags & ~BRISTOL_PARAMMASK) | algo;
+
+	initBristolAudio(audiomain, baudio);
+
+#ifndef BRISTOL_SEMAPHORE
+	jack_ringbuffer_go(audiomain->rb);
+#endif
+
+	for (i = 0; bristolEngineDefault(algo, i, &operator, &controller, &value)
+		== 0; i++)
+		bristolEngineSetParam(audiomain, baudio->sid, operator, controller,
+			value);
+
+	pthread_mutex_unlock(&enginelock);
+
+	return(baudio->sid);
+}
+
+/*
+ * Queue a MIDI message, status byte first, for the next process call. It will
+ * start at 'offset' samples into that call. SysEx is not taken here, the
+ * parameters go through bristolEngineParam().
+ */
+int
+bristolEngineMidi(bristolEngine *engine, unsigned char *data, int count,
+int offset)
+{
+	bristolEngineEvent *event;
+
+	if ((engine == NULL)
+		|| (count <= 0) || (count > 3) || (~data[0] & MIDI_STATUS_MASK))
+		return(-1);
+
+	if (engine->count >= BRISTOL_ENGINE_EVENTS)
+		return(-1);
+
+	event = &engine->event[engine->count++];
+	event->offset = offset < 0? 0:offset;
+	event->count = count;
+	memcpy(event->data, data, count);
+
+	return(0);
+}
+
+/*
+ * A 14 bit NRP as the controller sequence a MIDI source would send, it takes
+ * the same path and needs the same NRP enable on the emulation.
+ */
+int
+bristolEngineNRP(bristolEngine *engine, int channel, int nrp, int value,
+int offset)
+{
+	unsigned char cc[3];
+
+	if ((engine == NULL) || (engine->count + 4 > BRISTOL_ENGINE_EVENTS))
+		return(-1);
+
+	cc[0] = MIDI_CONTROL | (channel & MIDI_CHAN_MASK);
+
+	cc[1] = MIDI_GM_NRP;
+	cc[2] = (nrp >> 7) & 0x7f;
+	bristolEngineMidi(engine, cc, 3, offset);
+	cc[1] = MIDI_GM_NRP_F;
+	cc[2] = nrp & 0x7f;
+	bristolEngineMidi(engine, cc, 3, offset);
+	cc[1] = MIDI_GM_DATAENTRY;
+	cc[2] = (value >> 7) & 0x7f;
+	bristolEngineMidi(engine, cc, 3, offset);
+	cc[1] = MIDI_GM_DATAENTRY_F;
+	cc[2] = value & 0x7f;
+	bristolEngineMidi(engine, cc, 3, offset);
+
+	return(0);
+}
+
+/*
+ * Set an emulation parameter, operator and controller as the GUI sends them,
+ * the value from 0.0 to 1.0. This goes through the same handler as the SysEx
+ * from the GUI so the workers get it too. It is applied immediately.
+ */
+static int
+bristolEngineSetParam(audioMain *audiomain, int id, int operator,
+int controller, float value)
+{
+	bristolMidiMsg msg;
+	int v;
+
+	if ((v = (int) (value * (CONTROLLER_RANGE - 1) + 0.5f)) < 0)
+		v = 0;
+	else if (v > CONTROLLER_RANGE - 1)
+		v = CONTROLLER_RANGE - 1;
+
+	bzero(&msg, sizeof(bristolMidiMsg));
+
+	msg.command = MIDI_SYSEX;
+	msg.params.bristol.SysID = (audiomain->SysID >> 24) & 0x0ff;
+	msg.params.bristol.L = (audiomain->SysID >> 16) & 0x0ff;
+	msg.params.bristol.a = (audiomain->SysID >> 8) & 0x0ff;
+	msg.params.bristol.b = audiomain->SysID & 0x0ff;
+	msg.params.bristol.msgLen = sizeof(bristolMsg);
+	msg.params.bristol.msgType = MSG_TYPE_PARAM;
+	msg.params.bristol.channel = id;
+	msg.params.bristol.operator = operator;
+	msg.params.bristol.controller = controller;
+	msg.params.bristol.valueLSB = v & 0x7f;
+	msg.params.bristol.valueMSB = (v >> 7) & 0x7f;
+
+	return(midiMsgHandler(&msg, audiomain));
+}
+
+int
+bristolEngineParam(bristolEngine *engine, int id, int operator, int controller,
+float value)
+{
+	int result;
+
+	if ((engine == NULL)
+		|| (operator < 0) || (operator >= BRISTOL_SYSTEM)
+		|| (controller < 0) || (controller > 127))
+		return(-1);
+
+	pthread_mutex_lock(&enginelock);
+	result = bristolEngineSetParam(&engine->audiomain, id, operator,
+		controller, value);
+	pthread_mutex_unlock(&enginelock);
+
+	return(result);
+}
+
+/*
+ * The percent of each period the voices may take before the oldest are stolen,
+ * as -cpubudget gives the daemon. Zero, the default, is no limit.
+ */
+int
+bristolEngineBudget(bristolEngine *engine, float percent)
+{
+	if ((engine == NULL) || (percent < 0) || (percent > 100))
+		return(-1);
+
+	engine->audiomain.vbudget.budget = percent / 100;
+
+	return(0);
+}
+
+/*
+ * Voices that are still sounding, for a host's meter. From the thread that
+ * calls bristolEngineProcess().
+ */
+int
+bristolEngineVoices(bristolEngine *engine)
+{
+	bristolVoice *voice;
+	int count = 0;
+
+	if (engine == NULL)
+		return(-1);
+
+	for (voice = engine->audiomain.playlist; voice != NULL;
+		voice = voice->next)
+		if ((voice->baudio != NULL) && (~voice->flags & BRISTOL_KEYDONE))
+			count++;
+
+	return(count);
+}
+
+/*
+ * Non-zero keeps denormals as -denormals does for the daemon, zero, the
+ * default, flushes them to zero. Taken at the next bristolEngineProcess().
+ */
+int
+bristolEngineDenormals(bristolEngine *engine, int keep)
+{
+	if (engine == NULL)
+		return(-1);
+
+	engine->audiomain.denormals = keep? 1:0;
+
+	return(0);
+}
+
+/*
+ * The period the engine runs, rounded up from the one it was created with.
+ * Every engine in the process runs the period of the first one.
+ */
+int
+bristolEnginePeriod(bristolEngine *engine)
+{
+	if (engine == NULL)
+		return(-1);
+
+	return(engine->audiomain.samplecount);
+}
+
+/*
+ * Build the bristol message for a queued event and hand it to the MIDI
+ * handlers. We are the audio thread so this is flagged as JACK MIDI is in the
+ * single registration: the notes are taken immediately with their offset into
+ * the period rather than going through the ringbuffer.
+ */
+static void
+bristolEngineSend(audioMain *audiomain, bristolEngineEvent *event, int offset)
+{
+	bristolMidiMsg msg;
+	unsigned char status = event->data[0];
+
+	bzero(&msg, sizeof(bristolMidiMsg));
+
+	if (status >= 0xf8) {
+		switch (status) {
+			case 0xf8:
+				msg.command = MIDI_RT_CLOCK;
+				break;
+			case 0xfa:
+			case 0xfb:
+			case 0xfc:
+				msg.command = status;
+				break;
+			default:
+				return;
+		}
+	} else if (status >= MIDI_SYSTEM)
+		return;
+	else {
+		msg.command = status & MIDI_COMMAND_MASK;
+		msg.channel = status & MIDI_CHAN_MASK;
+
+		if ((msg.command == MIDI_PROGRAM) || (msg.command == MIDI_CHAN_PRESS))
+		{
+			if (event->count < 2)
+				return;
+			msg.params.key.key = event->data[1];
+			msg.params.bristol.msgLen = 2;
+		} else {
+			if (event->count < 3)
+				return;
+			msg.params.key.key = event->data[1];
+			msg.params.key.velocity = event->data[2];
+			msg.params.bristol.msgLen = 3;
+		}
+	}
+
+	msg.params.key.flags = BRISTOL_KF_JACK;
+	msg.offset = offset;
+
+	midiMsgHandler(&msg, audiomain);
+}
+
+/*
+ * Send the events that fall in the period starting 'from' samples into this
+ * process call. Any that were due earlier, the host giving us blocks that
+ * do not line up with the periods, go at the start of the period.
+ */
+static void
+bristolEngineDispatch(bristolEngine *engine, int from)
+{
+	int i, j;
+
+	for (i = j = 0; i < engine->count; i++)
+	{
+		if (engine->event[i].offset - from >= engine->audiomain.samplecount)
+		{
+			engine->event[j++] = engine->event[i];
+			continue;
+		}
+
+		bristolEngineSend(&engine->audiomain, &engine->event[i],
+			engine->event[i].offset < from? 0:engine->event[i].offset - from);
+	}
+
+	engine->count = j;
+}
+
+/*
+ * Render 'frames' of stereo into out[0] and out[1]. The engine runs a period
+ * whenever it has nothing left to give, a host whose blocks are the period
+ * size gets every event on its sample, otherwise there is no added latency
+ * but an event can be late by up to a period.
+ *
+ * The thread is the host's. The flush to zero mode and the realtime flag of
+ * the allocator are set for the engine and put back as they were on return.
+ * Another engine rendering in another thread holds us up until it is done.
+ */
+int
+bristolEngineProcess(bristolEngine *engine, float **out, int frames)
+{
+	float gain, *src, *left = out[0], *right = out[1];
+	audioMain *audiomain;
+	int i, n, done, rt;
+	unsigned long fpmode;
+
+	if (engine == NULL)
+		return(-1);
+
+	audiomain = &engine->audiomain;
+
+	pthread_mutex_lock(&enginelock);
+
+	rt = bristolAllocRealtime(1);
+	fpmode = bristolDenormals(audiomain);
+
+	/* As the JACK interface does it, the algorithms output 16 bit range */
+	if ((gain = audiomain->outgain) < 1)
+		gain = 1.0f;
+	gain /= 32768.0;
+
+	for (done = 0; done < frames; done += n)
+	{
+		if (engine->ready == 0)
+		{
+			bristolEngineDispatch(engine, done);
+
+			bristolTelemetryStart(audiomain);
+			doAudioOps(audiomain, engine->outbuf, engine->startbuf);
+			bristolTelemetryEnd(audiomain, engine->outbuf, 1.0f);
+
+			engine->ready = audiomain->samplecount;
+		}
+
+		if ((n = frames - done) > engine->ready)
+			n = engine->ready;
+
+		src = &engine->outbuf[(audiomain->samplecount - engine->ready) * 2];
+
+		for (i = 0; i < n; i++)
+		{
+			*left++ = *src++ * gain;
+			*right++ = *src++ * gain;
+		}
+
+		engine->ready -= n;
+	}
+
+	for (i = 0; i < engine->count; i++)
+		if ((engine->event[i].offset -= frames) < 0)
+			engine->event[i].offset = 0;
+
+	bristolDenormalsRestore(fpmode);
+	bristolAllocRealtime(rt);
+
+	pthread_mutex_unlock(&enginelock);
+
+	return(frames);
+}
+
+/*
+ * As spawnThread() in bristol.c with an argument for the thread and, for the
+ * emulation workers, a CPU to keep it on. A cpu of -1 leaves it to the
+ * scheduler.
+ */
+pthread_t
+spawnThreadOn(void * (*threadcode)(void *), void *arg, int priority, int cpu)
+{
+	int retcode;
+	pthread_t thread;
+	int policy;
+
+#if defined(linux)
+	struct sched_param schedparam;
+	cpu_set_t cpuset;
+#endif
+
+	/*
+	 * Create thread, detach it.
+	 */
+	retcode = pthread_create(&thread, NULL, threadcode, arg);
+	if (retcode != 0)
+		fprintf(stderr, "create a failed %d\n", retcode);
+
+#if defined(linux)
+	if (cpu >= 0)
+	{
+		CPU_ZERO(&cpuset);
+		CPU_SET(cpu, &cpuset);
+
+		if (pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuset) == 0)
+			printf("bound thread to cpu %i\n", cpu);
+		else
+			printf("could not bind thread to cpu %i\n", cpu);
+	}
+#endif
+
+//	retcode = pthread_detach(thread);
+//	if (retcode != 0)
+//		fprintf(stderr, "detach failed %d\n", retcode);
+
+#if defined(linux)
+	if (pthread_getschedparam(thread, &policy, &schedparam) != 0)
+	{
+		printf("could not get thread schedule\n");
+
+		return(thread);
+	}
+#endif
+
+	/*
+	 * This may have to go into a subroutine as the MIDI thread may need to 
+	 * reuse it to ensure we do not get priority inversion. At the moment both
+	 * threads are RT FIFO though.
+	 */
+#if defined(linux)
+	if (priority != 0)
+	{
+		policy = SCHED_FIFO;
+		schedparam.__sched_priority = priority;
+
+		if (pthread_setschedparam(thread, policy, &schedparam) == 0)
+			printf("rescheduled thread: %i\n", schedparam.__sched_priority);
+		else
+			printf("could not reschedule thread\n");
+	} else
+		printf("no requested to reschedule thread\n");
+#else
+	printf("will not reschedule thread\n");
+#endif
+
+	return(thread);
+}
+
+void
+midithreadexit()
+{
+	printf("Null palette\n");
+	audiomain.atReq = BRISTOL_REQSTOP;
+	audiomain.mtStatus = BRISTOL_EXIT;
+
+	bristolMidiTerminate();
+
+	pthread_exit(0);
+}
+
+void
+inthandler()
+{
+	int i = 50;
+
+	if (audiomain.debuglevel)
+		printf("inthandler\n");
+
+	bristolMidiOption(0, BRISTOL_NRP_MIDI_GO, 0);
+
+	audiomain.atReq = BRISTOL_REQSTOP;
+	exitReq = 1;
+
+	for (; i > 0; i--)
+	{
+		if (audiomain.atStatus != BRISTOL_EXIT)
+			usleep(100000);
+	}
+
+	bristolMidiTerminate();
+}
+
+void
+alterAllNotes(Baudio *baudio)
+{
+	bristolVoice *voice = baudio->audiomain->playlist;
+
+	while (voice != NULL)
+	{
+		if (voice->baudio == baudio)
+			doNoteChanges(voice);
+
+		voice = voice->next;
+	}
+}
+
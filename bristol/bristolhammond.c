@@ -638,7 +638,8 @@ printf("initialising one hammond sound\n");
 	 * Put in a reverb and leslie rotary on our effects list. First need to 
 	 * make the engine aware of linked output effects lists.....
 	 */
-	initSoundAlgo(22, 0, baudio, audiomain, baudio->effect);
+	initSoundAlgo(B_REVERB_ALGO(audiomain), 0, baudio, audiomain,
+		baudio->effect);
 	initSoundAlgo(7, 1, baudio, audiomain, baudio->effect);
 
 	samplecount = audiomain->samplecount;
@@ -20,83 +20,606 @@
  */
 /*#define DEBUG */
 
+#include <math.h>
+
 #include "bristol.h"
 #include "bristolmm.h"
 #include "bristolmixer.h"
 
 /*
- * This will control the global values for the mixing operation on request from
- * the mixer GUI.
+ * The mixer works at the engine sample levels, the multi IO ports are
+ * normalised to unity.
  */
-int
-mixerController(Baudio *baudio, u_char operator,
-u_char controller, float value)
+#define MIX_IO_IN 32768.0f
+#define MIX_IO_OUT (1.0f / 32768.0f)
+
+#define MIX_SMOOTH 0.1f /* Per block */
+
+/*
+ * Fader and level taper, unity at 0.8 with a little in hand above that.
+ */
+static float
+mixLevel(float v)
 {
-#ifdef DEBUG
-	printf("bristolMixerControl(%i, %i, %f)\n", operator, controller, value);
-#endif
+	return(v * v * 1.5625f);
+}
 
-	/*
-	 * Should have loads of operators here, for the tracks, busses and groups.
-	 */
+/*
+ * Trim and EQ band gain, +/-12dB with unity at the centre.
+ */
+static float
+mixTrim(float v)
+{
+	return(expf((v * 2.0f - 1.0f) * 1.3862944f));
+}
 
-	if (operator != 126)
-		return(0);
+static void
+mixBalance(float pan, float *left, float *right)
+{
+	*left = (pan < 0.5f)? 1.0f:(1.0f - pan) * 2.0f;
+	*right = (pan > 0.5f)? 1.0f:pan * 2.0f;
+}
 
-	switch (controller) {
-		case 0:
-			break;
-		case 1:
-			break;
-		case 2:
-			break;
-		case 3:
-			break;
-		case 4:
-			break;
-		case 5:
-			break;
-		case 6:
-			break;
-		case 7:
-			break;
-		case 8:
+/*
+ * Radio buttons: the GUI clears the previous selection and then sets the new
+ * one, that is not guaranteed to arrive in that order though.
+ */
+static void
+mixRadio(int *current, int index, float value)
+{
+	if (value != 0)
+		*current = index;
+	else if (*current == index)
+		*current = -1;
+}
+
+static int
+mixerTrack(bristolMixerTrack *track, int param, float value)
+{
+	if (param < MIX_T_PRESEND)
+		mixRadio(&track->input, param - MIX_T_INPUT, value);
+	else if (param < MIX_T_DYNAMICS)
+		track->presend[param - MIX_T_PRESEND] = (value != 0);
+	else if (param < MIX_T_FILTER)
+		mixRadio(&track->dynamics, param - MIX_T_DYNAMICS, value);
+	else if (param < MIX_T_POSTSEND)
+		mixRadio(&track->filter, param - MIX_T_FILTER, value);
+	else if (param < MIX_T_FX)
+		track->postsend[param - MIX_T_POSTSEND] = (value != 0);
+	else if (param < MIX_T_GAIN)
+		mixRadio(&track->fx, param - MIX_T_FX, value);
+	else if ((param >= MIX_T_OUTPUT) && (param < MIX_T_GROUP))
+		track->output[param - MIX_T_OUTPUT] = (value != 0);
+	else if ((param >= MIX_T_GROUP) && (param < MIX_T_FADER))
+		mixRadio(&track->group, param - MIX_T_GROUP, value);
+	else switch (param) {
+		case MIX_T_GAIN:
+			track->gain = value;
 			break;
-		case 9:
+		case MIX_T_PRESENDLVL:
+			track->presendlvl = value;
 			break;
-		case 10:
+		case MIX_T_TREBLE:
+			track->treble = value;
 			break;
-		case 11:
+		case MIX_T_TFREQ:
+			track->tfreq = value;
 			break;
-		case 12:
+		case MIX_T_MID:
+			track->mid = value;
 			break;
-		case 13:
+		case MIX_T_BASS:
+			track->bass = value;
 			break;
-		case 14:
+		case MIX_T_BFREQ:
+			track->bfreq = value;
 			break;
-		case 15:
+		case MIX_T_POSTSENDLVL:
+			track->postsendlvl = value;
 			break;
-		case 16:
+		case MIX_T_PAN:
+			track->pan = value;
 			break;
-		case 17:
+		case MIX_T_MUTE:
+			track->mute = (value != 0);
 			break;
-		case 18:
+		case MIX_T_SOLO:
+			track->solo = (value != 0);
 			break;
-		case 19:
+		case MIX_T_BOOST:
+			track->boost = (value != 0);
 			break;
-		case 20:
+		case MIX_T_FADER:
+			track->fader = value;
 			break;
-		case 21:
+		default:
+			/* Dynamics and effects parameters, display */
+			return(0);
+	}
+	return(1);
+}
+
+static int
+mixerBus(bristolMixerBus *bus, int param, float value)
+{
+	if (param >= MIX_B_COUNT)
+		return(0);
+
+	if (param >= MIX_B_OUTPUT)
+		bus->output[param - MIX_B_OUTPUT] = (value != 0);
+	else if (param >= MIX_B_ALGO)
+		mixRadio(&bus->algo, param - MIX_B_ALGO, value);
+	else switch (param) {
+		case MIX_B_IGAIN:
+			bus->igain = value;
 			break;
-		case 22:
+		case MIX_B_PAN:
+			bus->pan = value;
 			break;
-		case 23:
+		case MIX_B_GAIN:
+			bus->gain = value;
 			break;
+		default:
+			return(0);
 	}
+	return(1);
+}
+
+/*
+ * This will control the global values for the mixing operation on request from
+ * the mixer GUI. Operators are the tracks, 64 onwards the busses and 80 the
+ * subgroups. This runs on the MIDI thread, it only stores the values and the
+ * audio thread works out what they mean at the start of its next period.
+ */
+int
+mixerController(Baudio *baudio, u_char operator,
+u_char controller, float value)
+{
+	bristolMixer *m = (bristolMixer *) baudio->mixlocals;
+	int changed = 0;
+
+#ifdef DEBUG
+	printf("bristolMixerControl(%i, %i, %f)\n", operator, controller, value);
+#endif
+
+	if (m == NULL)
+		return(0);
+
+	if (operator < MIX_TRACKS)
+		changed = mixerTrack(&m->track[operator], controller, value);
+	else if ((operator >= MIX_B_OPERATOR)
+		&& (operator < MIX_B_OPERATOR + MIX_BUSSES))
+		changed = mixerBus(&m->bus[operator - MIX_B_OPERATOR],
+			controller, value);
+	else if ((operator == MIX_G_OPERATOR)
+		&& (controller < MIX_GROUPS * 3))
+	{
+		bristolMixerGroup *group = &m->group[controller / 3];
+
+		switch (controller % 3) {
+			case MIX_G_VOL:
+				group->vol = value;
+				break;
+			case MIX_G_LEFT:
+				group->left = value;
+				break;
+			case MIX_G_RIGHT:
+				group->right = value;
+				break;
+		}
+		changed = 1;
+	}
+
+	if (changed)
+		m->generation++;
 
 	return(0);
 }
 
+/*
+ * Work the parameters through to the per lane coefficients and the routing
+ * matrix. Every destination of a strip is a row of the matrix with trim,
+ * fader, pan and send level folded into the one gain.
+ */
+static void
+mixerRebuild(audioMain *audiomain, bristolMixer *m)
+{
+	bristolMixerTrack *track;
+	float trim, fader, lp, rp, post[2], send, w;
+	int t, k, d, l, solo = 0;
+
+	w = 2.0f * M_PI / audiomain->samplerate;
+
+	for (t = 0; t < MIX_TRACKS; t++)
+	{
+		solo |= m->track[t].solo;
+		m->claimed[t] = 0;
+	}
+
+	bristolbzero(m->route, sizeof(m->route));
+	bristolbzero(m->strip, sizeof(m->strip));
+
+	for (t = 0; t < MIX_TRACKS; t++)
+	{
+		track = &m->track[t];
+		l = t * 2;
+
+		/* Bass crossover 40Hz to 800Hz, treble 1kHz to 16kHz */
+		m->ta[0][l] = m->ta[0][l + 1]
+			= 1.0f - expf(-w * 40.0f * powf(20.0f, track->bfreq));
+		m->ta[1][l] = m->ta[1][l + 1]
+			= 1.0f - expf(-w * 1000.0f * powf(16.0f, track->tfreq));
+		m->tg[0][l] = m->tg[0][l + 1] = mixTrim(track->bass);
+		m->tg[1][l] = m->tg[1][l + 1] = mixTrim(track->mid);
+		m->tg[2][l] = m->tg[2][l + 1] = mixTrim(track->treble);
+
+		if ((track->input < 0) || (track->input >= MIX_TRACKS))
+			continue;
+
+		/* Muted inputs are still taken so that they do go quiet */
+		m->claimed[track->input] = 1;
+
+		if (track->mute || (solo && (track->solo == 0)))
+			continue;
+
+		trim = mixTrim(track->gain);
+		if (track->boost)
+			trim *= 2.0f;
+		fader = mixLevel(track->fader);
+		mixBalance(track->pan, &lp, &rp);
+
+		post[0] = trim * fader * lp;
+		post[1] = trim * fader * rp;
+
+		d = (track->group >= 0)? MIX_D_GROUP + track->group * 2:MIX_D_MAIN;
+		m->route[d][l] = post[0];
+		m->route[d + 1][l + 1] = post[1];
+
+		/* Busses are mono */
+		send = trim * mixLevel(track->presendlvl) * 0.5f;
+		for (k = 0; k < 4; k++)
+			if (track->presend[k])
+				m->route[MIX_D_BUS + k][l] = m->route[MIX_D_BUS + k][l + 1]
+					= send;
+
+		send = mixLevel(track->postsendlvl) * 0.5f;
+		for (k = 0; k < 4; k++)
+			if (track->postsend[k])
+			{
+				m->route[MIX_D_BUS + 4 + k][l] = post[0] * send;
+				m->route[MIX_D_BUS + 4 + k][l + 1] = post[1] * send;
+			}
+
+		/* Direct outputs are in pairs, left on the even ones */
+		for (k = 0; k < MIX_OUTS; k++)
+			if (track->output[k])
+				m->route[MIX_D_OUT + k][l + (k & 1)] = post[k & 1];
+	}
+
+	for (k = 0; k < MIX_BUSSES; k++)
+	{
+		m->bus[k].out = mixTrim(m->bus[k].igain) * mixLevel(m->bus[k].gain);
+		mixBalance(m->bus[k].pan, &m->bus[k].left, &m->bus[k].right);
+	}
+
+	for (k = 0; k < MIX_GROUPS; k++)
+	{
+		m->group[k].lgain = mixTrim(m->group[k].vol)
+			* mixLevel(m->group[k].left);
+		m->group[k].rgain = mixTrim(m->group[k].vol)
+			* mixLevel(m->group[k].right);
+	}
+
+	/*
+	 * Rows that are going quiet stay in the list until they have faded out.
+	 */
+	m->acount = 0;
+	for (d = 0; d < MIX_DESTS; d++)
+	{
+		for (l = 0; l < MIX_LANES; l++)
+			if (m->route[d][l] != 0.0f)
+				m->live[d] = 1;
+
+		if (m->live[d])
+			m->active[m->acount++] = d;
+	}
+
+	m->fade = MIX_FADE;
+}
+
+/*
+ * Glide the coefficients towards their targets a block at a time. Once they
+ * have settled the rows that have gone quiet are dropped.
+ */
+static void
+mixerSmooth(bristolMixer *m)
+{
+	float *s, *t;
+	int i, k, d;
+
+	if (m->fade == 0)
+		return;
+
+	if (--m->fade == 0)
+	{
+		bcopy(m->ta, m->a, sizeof(m->a));
+		bcopy(m->tg, m->g, sizeof(m->g));
+		bcopy(m->route, m->matrix, sizeof(m->matrix));
+
+		m->acount = 0;
+		for (d = 0; d < MIX_DESTS; d++)
+		{
+			m->live[d] = 0;
+			for (i = 0; i < MIX_LANES; i++)
+				if (m->route[d][i] != 0.0f)
+					m->live[d] = 1;
+
+			if (m->live[d])
+				m->active[m->acount++] = d;
+		}
+		return;
+	}
+
+	for (s = &m->a[0][0], t = &m->ta[0][0], i = 0; i < 2 * MIX_LANES; i++)
+		s[i] += (t[i] - s[i]) * MIX_SMOOTH;
+	for (s = &m->g[0][0], t = &m->tg[0][0], i = 0; i < 3 * MIX_LANES; i++)
+		s[i] += (t[i] - s[i]) * MIX_SMOOTH;
+
+	for (k = 0; k < m->acount; k++)
+	{
+		s = m->matrix[m->active[k]];
+		t = m->route[m->active[k]];
+
+		for (i = 0; i < MIX_LANES; i++)
+			s[i] += (t[i] - s[i]) * MIX_SMOOTH;
+	}
+}
+
+/*
+ * Each track takes the emulations on the MIDI channel it has selected and the
+ * multi IO input of the same number.
+ */
+static void
+mixerGather(audioMain *audiomain, bristolMixer *m, int offset, int count)
+{
+	float *left, *right, *io;
+	int t, f, s;
+
+	for (t = 0; t < MIX_TRACKS; t++)
+	{
+		if ((s = m->track[t].input) < 0)
+			continue;
+
+		if (m->used[s])
+		{
+			left = m->srcl[s] + offset;
+			right = m->srcr[s] + offset;
+
+			for (f = 0; f < count; f++)
+			{
+				m->strip[f][t * 2] = left[f];
+				m->strip[f][t * 2 + 1] = right[f];
+			}
+		} else
+			for (f = 0; f < count; f++)
+				m->strip[f][t * 2] = m->strip[f][t * 2 + 1] = 0.0f;
+
+		if ((s < audiomain->iocount) && ((io = audiomain->io_i[s]) != NULL))
+		{
+			io += offset;
+
+			for (f = 0; f < count; f++)
+			{
+				m->strip[f][t * 2] += io[f] * MIX_IO_IN;
+				m->strip[f][t * 2 + 1] += io[f] * MIX_IO_IN;
+			}
+		}
+	}
+}
+
+/*
+ * The strips, a frame at a time across all the lanes. The EQ is a pair of
+ * one pole crossovers giving bass, mid and treble bands which sum back to the
+ * input when they are flat. The lanes are independent so the inner loop is
+ * what the compiler vectorises, the recursion is only along the frames.
+ */
+static void
+mixerStrips(bristolMixer *m, int count)
+{
+	float in;
+	int f, l;
+
+	for (f = 0; f < count; f++)
+		for (l = 0; l < MIX_LANES; l++)
+		{
+			in = m->strip[f][l];
+			m->lpb[l] += m->a[0][l] * (in - m->lpb[l]);
+			m->lpt[l] += m->a[1][l] * (in - m->lpt[l]);
+			m->strip[f][l] = m->lpb[l] * m->g[0][l]
+				+ (m->lpt[l] - m->lpb[l]) * m->g[1][l]
+				+ (in - m->lpt[l]) * m->g[2][l];
+		}
+}
+
+static void
+mixerRoute(bristolMixer *m, int count)
+{
+	float *row, *dest, sum;
+	int k, f, l;
+
+	for (k = 0; k < m->acount; k++)
+	{
+		row = m->matrix[m->active[k]];
+		dest = m->dest[m->active[k]];
+
+		for (f = 0; f < count; f++)
+		{
+			sum = 0.0f;
+			for (l = 0; l < MIX_LANES; l++)
+				sum += m->strip[f][l] * row[l];
+			dest[f] = sum;
+		}
+	}
+}
+
+static void
+mixerOutput(audioMain *audiomain, bristolMixer *m, float *outbuf,
+int offset, int count)
+{
+	float *out = outbuf + offset * 2, *l, *r, *io, lg, rg, g;
+	int f, k, o;
+
+	if (m->live[MIX_D_MAIN] || m->live[MIX_D_MAIN + 1])
+	{
+		l = m->dest[MIX_D_MAIN];
+		r = m->dest[MIX_D_MAIN + 1];
+
+		for (f = 0; f < count; f++)
+		{
+			out[f * 2] += l[f];
+			out[f * 2 + 1] += r[f];
+		}
+	}
+
+	for (k = 0; k < MIX_GROUPS; k++)
+	{
+		if ((m->live[MIX_D_GROUP + k * 2] | m->live[MIX_D_GROUP + k * 2 + 1])
+			== 0)
+			continue;
+
+		l = m->dest[MIX_D_GROUP + k * 2];
+		r = m->dest[MIX_D_GROUP + k * 2 + 1];
+		lg = m->group[k].lgain;
+		rg = m->group[k].rgain;
+
+		for (f = 0; f < count; f++)
+		{
+			out[f * 2] += l[f] * lg;
+			out[f * 2 + 1] += r[f] * rg;
+		}
+	}
+
+	/* Bus returns, the effects are not yet implemented */
+	for (k = 0; k < MIX_BUSSES; k++)
+	{
+		if (m->live[MIX_D_BUS + k] == 0)
+			continue;
+
+		l = m->dest[MIX_D_BUS + k];
+		g = m->bus[k].out;
+		lg = g * m->bus[k].left;
+		rg = g * m->bus[k].right;
+
+		for (f = 0; f < count; f++)
+		{
+			out[f * 2] += l[f] * lg;
+			out[f * 2 + 1] += l[f] * rg;
+		}
+
+		for (o = 0; o < audiomain->iocount; o++)
+		{
+			if ((m->bus[k].output[o] == 0)
+				|| ((io = audiomain->io_o[o]) == NULL))
+				continue;
+
+			io += offset;
+			for (f = 0; f < count; f++)
+				io[f] += l[f] * g * MIX_IO_OUT;
+		}
+	}
+
+	for (o = 0; o < audiomain->iocount; o++)
+	{
+		if ((m->live[MIX_D_OUT + o] == 0)
+			|| ((io = audiomain->io_o[o]) == NULL))
+			continue;
+
+		l = m->dest[MIX_D_OUT + o];
+		io += offset;
+
+		for (f = 0; f < count; f++)
+			io[f] += l[f] * MIX_IO_OUT;
+	}
+}
+
+/*
+ * Called from doAudioOps() with the output of each emulation. If a track has
+ * its MIDI channel selected it is taken into that input and not mixed into
+ * the main output directly.
+ */
+int
+bristolMixerInput(audioMain *audiomain, Baudio *baudio, float *left,
+float *right, float gain)
+{
+	bristolMixer *m = (bristolMixer *) audiomain->mixer;
+	float *l, *r;
+	int i, ch = baudio->midichannel;
+
+	if (m == NULL)
+		return(0);
+
+	/* Ourselves, we have no output of our own */
+	if ((void *) baudio->mixlocals == (void *) m)
+		return(1);
+
+	if ((ch < 0) || (ch >= MIX_TRACKS) || (m->claimed[ch] == 0))
+		return(0);
+
+	l = m->srcl[ch];
+	r = m->srcr[ch];
+
+	if (m->used[ch])
+		for (i = 0; i < audiomain->samplecount; i++)
+		{
+			l[i] += left[i] * gain;
+			r[i] += right[i] * gain;
+		}
+	else
+		for (i = 0; i < audiomain->samplecount; i++)
+		{
+			l[i] = left[i] * gain;
+			r[i] = right[i] * gain;
+		}
+
+	m->used[ch] = 1;
+
+	return(1);
+}
+
+/*
+ * Mix the inputs gathered this period onto the main output and the multi IO
+ * outputs, a block of frames at a time so the strips stay in cache.
+ */
+void
+bristolMixerRender(audioMain *audiomain, float *outbuf)
+{
+	bristolMixer *m = (bristolMixer *) audiomain->mixer;
+	int offset, count;
+
+	if (m == NULL)
+		return;
+
+	if (m->seen != m->generation)
+	{
+		m->seen = m->generation;
+		mixerRebuild(audiomain, m);
+	}
+
+	for (offset = 0; offset < audiomain->samplecount; offset += MIX_BLOCK)
+	{
+		if ((count = audiomain->samplecount - offset) > MIX_BLOCK)
+			count = MIX_BLOCK;
+
+		mixerSmooth(m);
+		mixerGather(audiomain, m, offset, count);
+		mixerStrips(m, count);
+		mixerRoute(m, count);
+		mixerOutput(audiomain, m, outbuf, offset, count);
+	}
+
+	bristolbzero(m->used, sizeof(m->used));
+}
+
 int
 operateMixerPreops(audioMain *audiomain, Baudio *baudio,
 bristolVoice *voice, register float *startbuf)
@@ -109,21 +632,36 @@ bristolVoice *voice, register float *startbuf)
 	return(0);
 }
 
+/*
+ * The mixing is not done per voice, see bristolMixerRender().
+ */
 int
 operateOneMixer(audioMain *audiomain, Baudio *baudio,
 bristolVoice *voice, register float *startbuf)
 {
-/*
-printf("operateOneMixer(%x, %x, %x) %i\n",
-	baudio, voice, startbuf, baudio->cvoices);
-*/
 	return(0);
 }
 
 static int
 bristolMixerDestroy(audioMain *audiomain, Baudio *baudio)
 {
-printf("removing one mixer\n");
+	bristolMixer *m = (bristolMixer *) baudio->mixlocals;
+	int i;
+
+	printf("removing one mixer\n");
+
+	if (m == NULL)
+		return(0);
+
+	if (audiomain->mixer == (void *) m)
+		audiomain->mixer = NULL;
+
+	for (i = 0; i < MIX_TRACKS; i++)
+	{
+		bristolfree(m->srcl[i]);
+		bristolfree(m->srcr[i]);
+	}
+
 	return(0);
 }
 
@@ -133,43 +671,71 @@ printf("removing one mixer\n");
  * to control that mixing function but the actual mixing should be skipped until
  * the mixer GUI has linked up, otherwise it does not make a lot of sense.
  *
- * Should consider the implications of multithreading here such that we can
- * allow for contention for certain tracks? That might be quite hard and as
- * such we may end up with a mixing thread and multiple synth threads.
+ * The mixer has no operators, its operator numbers are all the tracks and
+ * busses and go straight to mixerController(). There is only one mixer, a
+ * second one takes over from the first.
  */
 int
 bristolMixerInit(audioMain *audiomain, Baudio *baudio)
 {
-printf("initialising one mixer\n");
-	/*
-	 * Number of operators in this voice. The mixer does not actually need 
-	 * these operators, but we may want to have pre and post ops for any given
-	 * audio frame, and that fits well here and as such we need a dummy operator.
-	 */
-	baudio->soundCount = 1;
+	bristolMixer *m;
+	int i;
 
-	/*
-	 * Assign an array of sound pointers.
-	 */
-	baudio->sound = (bristolSound **)
-		bristolmalloc0(sizeof(bristolOP *) * baudio->soundCount);
-	baudio->effect = (bristolSound **)
-		bristolmalloc0(sizeof(bristolOP *) * baudio->soundCount);
+	printf("initialising one mixer\n");
 
-	/*
-	 * This should be the dummy.
-	 */
-	initSoundAlgo(8, 0, baudio, audiomain, baudio->sound);
+	baudio->soundCount = 0;
+	baudio->sound = (bristolSound **) bristolmalloc0(sizeof(bristolOP *));
+	baudio->effect = NULL;
 
-/*
-	if ((audiomain->debuglevel & BRISTOL_DEBUG_MASK) > BRISTOL_DEBUG3)
-		printf("malloced sound: %x\n", baudio->sound);
-*/
+	m = (bristolMixer *) bristolmalloc0(sizeof(bristolMixer));
+
+	for (i = 0; i < MIX_TRACKS; i++)
+	{
+		m->track[i].input = -1;
+		m->track[i].group = -1;
+		m->track[i].dynamics = -1;
+		m->track[i].filter = -1;
+		m->track[i].fx = -1;
+		m->track[i].gain = 0.5;
+		m->track[i].treble = 0.5;
+		m->track[i].tfreq = 0.5;
+		m->track[i].mid = 0.5;
+		m->track[i].bass = 0.5;
+		m->track[i].bfreq = 0.5;
+		m->track[i].pan = 0.5;
+		m->track[i].fader = 0.8;
+
+		m->srcl[i] = (float *) bristolmalloc0(audiomain->segmentsize);
+		m->srcr[i] = (float *) bristolmalloc0(audiomain->segmentsize);
+	}
+
+	for (i = 0; i < MIX_BUSSES; i++)
+	{
+		m->bus[i].algo = -1;
+		m->bus[i].igain = 0.5;
+		m->bus[i].pan = 0.5;
+		m->bus[i].gain = 0.8;
+	}
 
+	for (i = 0; i < MIX_GROUPS; i++)
+	{
+		m->group[i].vol = 0.5;
+		m->group[i].left = 0.8;
+		m->group[i].right = 0.8;
+	}
+
+	mixerRebuild(audiomain, m);
+	bcopy(m->ta, m->a, sizeof(m->a));
+	bcopy(m->tg, m->g, sizeof(m->g));
+	m->fade = 0;
+
+	baudio->mixlocals = (float *) m;
 	baudio->param = mixerController;
 	baudio->destroy = bristolMixerDestroy;
 	baudio->operate = operateOneMixer;
 	baudio->preops = operateMixerPreops;
+
+	audiomain->mixer = m;
+
 	return(0);
 }
-
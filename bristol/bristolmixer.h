@@ -19,3 +19,149 @@
  *
  */
 
+
+#ifndef __BRISTOL_MIXER_H
+#define __BRISTOL_MIXER_H
+
+/*
+ * Engine side of the mixer GUI. Each strip is a stereo pair of lanes and the
+ * strips are processed together, a frame at a time across all the lanes, so
+ * that the recursive EQ can still be done in SIMD registers. Everything a
+ * strip sends anywhere, main mix, subgroups, busses or the multi IO outputs,
+ * is then a row of the routing matrix applied to the EQ output.
+ */
+#define MIX_TRACKS 16
+#define MIX_LANES (MIX_TRACKS * 2)
+#define MIX_BUSSES 8
+#define MIX_GROUPS 4
+#define MIX_OUTS BRISTOL_JACK_MULTI
+#define MIX_BLOCK 32 /* Frames per pass through the strips */
+#define MIX_FADE 64 /* Blocks for the coefficients to settle after a change */
+
+/* Routing matrix rows */
+#define MIX_D_MAIN 0 /* Left and right */
+#define MIX_D_GROUP 2 /* Left and right of each subgroup */
+#define MIX_D_BUS (MIX_D_GROUP + MIX_GROUPS * 2) /* Mono */
+#define MIX_D_OUT (MIX_D_BUS + MIX_BUSSES)
+#define MIX_DESTS (MIX_D_OUT + MIX_OUTS)
+
+/*
+ * Track parameters as the GUI numbers them, see brightonMixerMemory.c. The
+ * dynamics, filter and insert effect selections are held but not rendered.
+ */
+#define MIX_T_INPUT 0
+#define MIX_T_PRESEND 16
+#define MIX_T_DYNAMICS 20
+#define MIX_T_FILTER 23
+#define MIX_T_POSTSEND 27
+#define MIX_T_FX 31
+#define MIX_T_GAIN 38
+#define MIX_T_PRESENDLVL 39
+#define MIX_T_TREBLE 45
+#define MIX_T_TFREQ 46
+#define MIX_T_MID 47
+#define MIX_T_BASS 48
+#define MIX_T_BFREQ 49
+#define MIX_T_POSTSENDLVL 50
+#define MIX_T_PAN 54
+#define MIX_T_MUTE 55
+#define MIX_T_SOLO 56
+#define MIX_T_BOOST 57
+#define MIX_T_OUTPUT 58
+#define MIX_T_GROUP 74
+#define MIX_T_FADER 78
+
+/* Bus parameters, operator 64 + bus */
+#define MIX_B_OPERATOR 64
+#define MIX_B_IGAIN 0
+#define MIX_B_PAN 4
+#define MIX_B_GAIN 5
+#define MIX_B_ALGO 6
+#define MIX_B_OUTPUT 14
+#define MIX_B_COUNT 30
+
+/* Subgroup parameters, operator 80, three per group */
+#define MIX_G_OPERATOR 80
+#define MIX_G_VOL 0
+#define MIX_G_LEFT 1
+#define MIX_G_RIGHT 2
+
+typedef struct BristolMixerTrack {
+	int input; /* MIDI channel and multi IO input, -1 for none */
+	int group; /* Subgroup, -1 for the main mix */
+	int presend[4]; /* Busses 0 to 3 */
+	int postsend[4]; /* Busses 4 to 7 */
+	int output[MIX_OUTS];
+	int mute;
+	int solo;
+	int boost;
+	int dynamics;
+	int filter;
+	int fx;
+	float gain;
+	float presendlvl;
+	float postsendlvl;
+	float treble;
+	float tfreq;
+	float mid;
+	float bass;
+	float bfreq;
+	float pan;
+	float fader;
+} bristolMixerTrack;
+
+typedef struct BristolMixerBus {
+	int algo;
+	int output[MIX_OUTS];
+	float igain;
+	float pan;
+	float gain;
+	/* Derived */
+	float left;
+	float right;
+	float out;
+} bristolMixerBus;
+
+typedef struct BristolMixerGroup {
+	float vol;
+	float left;
+	float right;
+	/* Derived */
+	float lgain;
+	float rgain;
+} bristolMixerGroup;
+
+/*
+ * The parameters above are written by the MIDI thread which then bumps the
+ * generation, everything below is only touched by the audio thread which
+ * rebuilds its coefficients when it sees the generation change.
+ */
+typedef struct BristolMixer {
+	bristolMixerTrack track[MIX_TRACKS];
+	bristolMixerBus bus[MIX_BUSSES];
+	bristolMixerGroup group[MIX_GROUPS];
+	volatile int generation;
+	int seen;
+	int samplerate;
+	int fade;
+	int claimed[MIX_TRACKS]; /* Inputs selected by a track */
+	int used[MIX_TRACKS]; /* Inputs that an emulation wrote this period */
+	float *srcl[MIX_TRACKS];
+	float *srcr[MIX_TRACKS];
+	int acount;
+	int active[MIX_DESTS]; /* Rows of the matrix that are in use */
+	int live[MIX_DESTS];
+	/* Per lane EQ crossovers and band gains, target and smoothed */
+	float ta[2][MIX_LANES];
+	float tg[3][MIX_LANES];
+	float a[2][MIX_LANES];
+	float g[3][MIX_LANES];
+	float lpb[MIX_LANES]; /* EQ state */
+	float lpt[MIX_LANES];
+	float route[MIX_DESTS][MIX_LANES];
+	float matrix[MIX_DESTS][MIX_LANES];
+	float strip[MIX_BLOCK][MIX_LANES];
+	float dest[MIX_DESTS][MIX_BLOCK];
+} bristolMixer;
+
+#endif /* __BRISTOL_MIXER_H */
@@ -409,7 +409,8 @@ printf("initialising one roadrunner sound\n");
 	 * Add in a flanger. We could add in a reverb before or after, or even
 	 * a second flanger to space the sound out a little more.
 	 */
-	initSoundAlgo(	22, 0, baudio, audiomain, baudio->effect);
+	initSoundAlgo(B_REVERB_ALGO(audiomain), 0, baudio, audiomain,
+		baudio->effect);
 	initSoundAlgo(	12,	1, baudio, audiomain, baudio->effect);
 
 	baudio->param = roadrunnerGlobalController;
@@ -816,7 +816,8 @@ bristolSonic6Init(audioMain *audiomain, Baudio *baudio)
 	/*
 	 * Put in a reverb on our effects list.
 	 */
-	initSoundAlgo(22, 0, baudio, audiomain, baudio->effect);
+	initSoundAlgo(B_REVERB_ALGO(audiomain), 0, baudio, audiomain,
+		baudio->effect);
 
 	if (SONICLOCAL->oscabuf == (float *) NULL)
 		SONICLOCAL->oscabuf = (float *) bristolmalloc0(audiomain->segmentsize);
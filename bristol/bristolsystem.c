@@ -58,6 +58,73 @@ bristolgetsid(Baudio *baudio, int sid)
 	return(tsid);
 }
 
+/*
+ * A new emulation for the given MIDI channel, linked into the audiolist but
+ * held down until initBristolAudio() has set up its algorithm. The first one
+ * also decides how many voices the engine will have.
+ */
+Baudio *
+newBristolAudio(audioMain *audiomain, int channel, int voices)
+{
+	Baudio *baudio = (Baudio *) bristolmalloc0(sizeof(Baudio));
+
+	baudio->maps = (baudioMaps *) bristolmalloc0(sizeof(baudioMaps));
+	baudio->ctab = baudio->maps->ctab;
+	baudio->microtonalmap = baudio->maps->microtonalmap;
+	baudio->velocitymap = baudio->maps->velocitymap;
+	baudio->midimap = baudio->maps->midimap;
+	baudio->GM2values = baudio->maps->GM2values;
+	baudio->valuemap = baudio->maps->valuemap;
+
+	baudio->mixflags = (BRISTOL_HOLDDOWN|BRISTOL_SENSE);
+	/* Turn on sensing with a long timer, GUI can disable it later */
+	baudio->sensecount = 15 * audiomain->samplerate;
+
+	baudio->audiomain = audiomain;
+	baudio->midichannel = channel;
+	baudio->samplerate = audiomain->samplerate;
+	baudio->samplecount = audiomain->samplecount;
+	baudio->oversampling = audiomain->oversampling;
+	baudio->reserved = audiomain->reserved;
+
+	/*
+	 * Put in some default arpeggio values
+	 */
+	bristolArpeggiatorInit(baudio);
+
+	baudio->sid = bristolgetsid(audiomain->audiolist, 0);
+
+	if (baudio->sid == -1)
+		printf("SID failure....\n");
+	else if (audiomain->debuglevel > 2)
+		printf("	alloc SID %i\n", baudio->sid);
+
+	baudio->voicecount = voices;
+	if (audiomain->voiceCount <= 0)
+	{
+		if ((audiomain->voiceCount = voices) < BRISTOL_VOICECOUNT)
+			audiomain->voiceCount = BRISTOL_VOICECOUNT;
+	}
+	if (audiomain->voiceCount > BRISTOL_MAXVOICECOUNT)
+		audiomain->voiceCount = BRISTOL_MAXVOICECOUNT;
+	if (baudio->voicecount > BRISTOL_MAXVOICECOUNT)
+		baudio->voicecount = BRISTOL_MAXVOICECOUNT;
+
+	if (audiomain->debuglevel)
+		printf("created %i voices: allocated %i to synth\n",
+			audiomain->voiceCount, baudio->voicecount);
+
+	if (audiomain->voiceCount <= 1)
+		audiomain->voiceCount = 1;
+
+	baudio->next = audiomain->audiolist;
+	if (audiomain->audiolist != NULL)
+		audiomain->audiolist->last = baudio;
+	audiomain->audiolist = baudio;
+
+	return(baudio);
+}
+
 int
 bristolSystem(audioMain *audiomain, bristolMidiMsg *msg)
 {
@@ -88,6 +155,30 @@ bristolSystem(audioMain *audiomain, bristolMidiMsg *msg)
 		int flags = (msg->params.bristol.valueMSB << 7) +
 			msg->params.bristol.valueLSB;
 
+		/*
+		 * Statistics requests do not need a hello, the reply only has room
+		 * for 14 bits so the low bit of the request selects the high half.
+		 */
+		if ((flags & BRISTOL_COMMASK) == BRISTOL_REQ_STATS)
+		{
+			result = bristolTelemetryRead(audiomain,
+				(flags & BRISTOL_PARAMMASK) >> 1);
+			if (flags & 0x01)
+				result >>= 14;
+			bristolMidiSendMsg(msg->params.bristol.from, 0, 127, 0,
+				result & 0x3fff);
+			return(0);
+		}
+
+		/* Picked up by the audio and worker threads on their next period */
+		if ((flags & BRISTOL_COMMASK) == BRISTOL_REQ_DENORMALS)
+		{
+			audiomain->denormals = flags & 0x01;
+			printf("denormals %s\n", audiomain->denormals? "kept":"flushed");
+			bristolMidiSendMsg(msg->params.bristol.from, 0, 127, 0, 0);
+			return(0);
+		}
+
 		/*
 		 * See if we can activate message connections
 		 */
@@ -101,12 +192,6 @@ bristolSystem(audioMain *audiomain, bristolMidiMsg *msg)
 			 */
 			bristolMidiOption(0, BRISTOL_NRP_MIDI_GO, 0);
 
-			Baudio *baudio = (Baudio *) bristolmalloc0(sizeof(Baudio));
-
-			baudio->mixflags = (BRISTOL_HOLDDOWN|BRISTOL_SENSE);
-			/* Turn on sensing with a long timer, GUI can disable it later */
-			baudio->sensecount = 15 * audiomain->samplerate;
-
 			if (audiomain->atStatus == BRISTOL_EXIT)
 				audiomain->midiflags |= BRISTOL_HELLO;
 
@@ -116,48 +201,12 @@ bristolSystem(audioMain *audiomain, bristolMidiMsg *msg)
 			 * it an ID for the connection. This ID is returned in an ack back
 			 * to the source.
 			 */
-			baudio->midichannel = msg->params.bristol.channel;
-			baudio->samplerate = audiomain->samplerate;
-			baudio->samplecount = audiomain->samplecount;
-
-			/*
-			 * Put in some default arpeggio values
-			 */
-			bristolArpeggiatorInit(baudio);
-
-			baudio->sid = result = bristolgetsid(audiomain->audiolist, 0);
-
-			if (baudio->sid == -1)
-				printf("SID failure....\n");
-			else if (audiomain->debuglevel > 2)
-				printf("	alloc SID %i\n", baudio->sid);
-
-			baudio->voicecount = (BRISTOL_PARAMMASK & flags);
-			if (audiomain->voiceCount <= 0)
-			{
-				if ((audiomain->voiceCount = (BRISTOL_PARAMMASK & flags))
-					< BRISTOL_VOICECOUNT)
-					audiomain->voiceCount = BRISTOL_VOICECOUNT;
-			}
-			if (audiomain->voiceCount > BRISTOL_MAXVOICECOUNT)
-				audiomain->voiceCount = BRISTOL_MAXVOICECOUNT;
-			if (baudio->voicecount > BRISTOL_MAXVOICECOUNT)
-				baudio->voicecount = BRISTOL_MAXVOICECOUNT;
-
-			if (audiomain->debuglevel)
-				printf("created %i voices: allocated %i to synth\n",
-					audiomain->voiceCount, baudio->voicecount);
-
-			if (audiomain->voiceCount <= 1)
-				audiomain->voiceCount = 1;
+			Baudio *baudio = newBristolAudio(audiomain,
+				msg->params.bristol.channel, BRISTOL_PARAMMASK & flags);
 
+			result = baudio->sid;
 			baudio->controlid = msg->params.bristol.from;
 
-			baudio->next = audiomain->audiolist;
-			if (audiomain->audiolist != NULL)
-				audiomain->audiolist->last = baudio;
-			audiomain->audiolist = baudio;
-
 #ifndef BRISTOL_SEMAPHORE
 			jack_ringbuffer_go(audiomain->rb);
 #endif
@@ -356,6 +405,7 @@ bristolSystem(audioMain *audiomain, bristolMidiMsg *msg)
 
 				hclose = msg->params.bristol.from;
 
+				bristolfree(baudio->maps);
 				bristolfree(baudio);
 
 				bristolMidiOption(0, BRISTOL_NRP_MIDI_GO, 1);
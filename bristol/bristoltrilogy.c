@@ -1027,7 +1027,8 @@ bristolTrilogyODCInit(audioMain *audiomain, Baudio *baudio)
 
 	/*
 	 * Put effects in here if needed
-	initSoundAlgo(22, 0, baudio, audiomain, baudio->effect);
+	initSoundAlgo(B_REVERB_ALGO(audiomain), 0, baudio, audiomain,
+		baudio->effect);
 	 */
 
 	TRILOGYLCL->oscabuf = (float *) bristolmalloc0(audiomain->segmentsize);
@@ -1096,7 +1097,8 @@ bristolTrilogyInit(audioMain *audiomain, Baudio *baudio)
 
 	/*
 	 * Put in a vibrachorus on our effects list.
-	initSoundAlgo(22, 0, baudio, audiomain, baudio->effect);
+	initSoundAlgo(B_REVERB_ALGO(audiomain), 0, baudio, audiomain,
+		baudio->effect);
 	 */
 
 	TRILOGYLCL->mastervolume = 12;
@@ -609,7 +609,8 @@ printf("initialising vox upper manual\n");
 	initSoundAlgo(2,  3, baudio, audiomain, baudio->sound);
 
 	/* (Don't) Put in a reverb
-	initSoundAlgo(	22, 0, baudio, audiomain, baudio->effect);
+	initSoundAlgo(B_REVERB_ALGO(audiomain), 0, baudio, audiomain,
+		baudio->effect);
 	*/
 
 	/*
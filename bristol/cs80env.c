@@ -35,6 +35,7 @@
 
 #include "bristol.h"
 #include "envelope.h"
+#include "envrun.h"
 
 static float sr;
 
@@ -147,7 +148,7 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 {
 	register bristolENVlocal *local = lcl;
 	register float cgain, attack, al, decay, il, release, *ob;
-	register int count;
+	register int count, run;
 	bristolENV *specs;
 
 	specs = (bristolENV *) operator->specs;
@@ -211,7 +212,8 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 	/*
 	 * We should only need a state and consequent target gain. We then trend
 	 * the current gain towards the target until we meet it at which point we
-	 * change the state.
+	 * change the state. Each segment is rendered straight through for as
+	 * long as envLinRun() says it cannot reach the target.
 	 */
 	while (count > 0)
 	{
@@ -222,6 +224,9 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 printf("State release %f %f\n", cgain, 0.0);
 				 * Assume key off - start releasing gain.
 				 */
+				count -= (run = envLinRun(cgain, -release, 0.0f, count));
+				while (run-- > 0)
+					*ob++ = (cgain -= release);
 				while (cgain > 0.0)
 				{
 					if (count-- > 0)
@@ -243,6 +248,9 @@ printf("State attack %f %f\n", cgain, al);
 				 * Just triggered - start attack ramp from current gain level.
 				 */
 				if (cgain < al) {
+					count -= (run = envLinRun(cgain, attack, al, count));
+					while (run-- > 0)
+						*ob++ = (cgain += attack);
 					while (cgain < al)
 					{
 						if (count-- > 0)
@@ -252,6 +260,9 @@ printf("State attack %f %f\n", cgain, al);
 					}
 					if (cgain >= al) local->cstate = STATE_DECAY;
 				} else {
+					count -= (run = envLinRun(cgain, -attack, al, count));
+					while (run-- > 0)
+						*ob++ = (cgain -= attack);
 					while (cgain > al)
 					{
 						if (count-- > 0)
@@ -273,6 +284,9 @@ printf("State decay %f %f\n", cgain, il);
 				 * Decay state. Ramp down to il level.
 				 */
 				if (cgain > il) {
+					count -= (run = envLinRun(cgain, -decay, il, count));
+					while (run-- > 0)
+						*ob++ = (cgain -= decay);
 					while (cgain > il)
 					{
 						if (count-- > 0)
@@ -282,6 +296,9 @@ printf("State decay %f %f\n", cgain, il);
 					}
 					if (cgain <= il) local->cstate = STATE_SUSTAIN;
 				} else {
+					count -= (run = envLinRun(cgain, decay, il, count));
+					while (run-- > 0)
+						*ob++ = (cgain += decay);
 					while (cgain < il)
 					{
 						if (count-- > 0)
@@ -90,14 +90,14 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
-	bristolfree(((bristolCS80 *) operator)->wave[0]);
-	bristolfree(((bristolCS80 *) operator)->wave[1]);
-	bristolfree(((bristolCS80 *) operator)->wave[2]);
-	bristolfree(((bristolCS80 *) operator)->wave[3]);
-	bristolfree(((bristolCS80 *) operator)->wave[4]);
-	bristolfree(((bristolCS80 *) operator)->wave[5]);
-	bristolfree(((bristolCS80 *) operator)->wave[6]);
-	bristolfree(((bristolCS80 *) operator)->wave[7]);
+	bristolfree(((bristolCS80 *) operator->specs)->wave[0]);
+	bristolfree(((bristolCS80 *) operator->specs)->wave[1]);
+	bristolfree(((bristolCS80 *) operator->specs)->wave[2]);
+	bristolfree(((bristolCS80 *) operator->specs)->wave[3]);
+	bristolfree(((bristolCS80 *) operator->specs)->wave[4]);
+	bristolfree(((bristolCS80 *) operator->specs)->wave[5]);
+	bristolfree(((bristolCS80 *) operator->specs)->wave[6]);
+	bristolfree(((bristolCS80 *) operator->specs)->wave[7]);
 
 	bristolfree(operator->specs);
 
@@ -69,14 +69,14 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
-	bristolfree(((bristolDCO *) operator)->wave[0]);
-	bristolfree(((bristolDCO *) operator)->wave[1]);
-	bristolfree(((bristolDCO *) operator)->wave[2]);
-	bristolfree(((bristolDCO *) operator)->wave[3]);
-	bristolfree(((bristolDCO *) operator)->wave[4]);
-	bristolfree(((bristolDCO *) operator)->wave[5]);
-	bristolfree(((bristolDCO *) operator)->wave[6]);
-	bristolfree(((bristolDCO *) operator)->wave[7]);
+	bristolfree(((bristolDCO *) operator->specs)->wave[0]);
+	bristolfree(((bristolDCO *) operator->specs)->wave[1]);
+	bristolfree(((bristolDCO *) operator->specs)->wave[2]);
+	bristolfree(((bristolDCO *) operator->specs)->wave[3]);
+	bristolfree(((bristolDCO *) operator->specs)->wave[4]);
+	bristolfree(((bristolDCO *) operator->specs)->wave[5]);
+	bristolfree(((bristolDCO *) operator->specs)->wave[6]);
+	bristolfree(((bristolDCO *) operator->specs)->wave[7]);
 
 	bristolfree(operator->specs);
 
@@ -215,8 +215,9 @@ static int operate(bristolOP *operator,
 	void *lcl)
 {
 	bristolDCOlocal *local = lcl;
-	register int obp, count;
-	register float *ib, *ob, *wt, wtp, gain, transp;
+	register int obp, count, block, shift;
+	register float *ib, *ob, *wt, gain, dgain, transp;
+	bristolPhase phase;
 	bristolDCO *specs;
 
 	specs = (bristolDCO *) operator->specs;
@@ -228,13 +229,34 @@ static int operate(bristolOP *operator,
 	count = specs->spec.io[DCO_OUT_IND].samplecount;
 	ib = specs->spec.io[DCO_IN_IND].buf;
 	ob = specs->spec.io[DCO_OUT_IND].buf;
-	wtp = local->wtp;
-	gain = param->param[3].float_val;
 	transp = param->param[1].float_val * param->param[2].float_val;
-	wtp = local->wtp;
+	shift = waveCoreShift(DCO_WAVE_SZE);
+	phase = local->phase;
 
- 	if (bristolBLOcheck(voice->cFreq*transp)) {
-		wt = param->param[0].mem;
+	/*
+	 * Gain is chased at control rate to stop it zippering
+	 */
+	if (voice->flags & BRISTOL_KEYON)
+		bristolSmoothInit(&local->gain, param->param[3].float_val);
+	else
+		bristolSmoothTarget(&local->gain, param->param[3].float_val,
+			bristolSmoothBlocks(specs->spec.io[DCO_OUT_IND].samplerate,
+				BRISTOL_SMOOTH_MS));
+	gain = local->gain.value;
+
+	if (!bristolBLOcheck(voice->cFreq*transp))
+		wt = specs->wave[param->param[0].int_val];
+	else if ((local->bfreq == voice->cFreq*transp)
+		&& (local->bwave == param->param[0].int_val))
+		wt = local->blo;
+	else {
+		/*
+		 * The band limited tables are expensive to build so they are kept
+		 * in the voice rather than rebuilt every period.
+		 */
+		wt = local->blo;
+		local->bfreq = voice->cFreq*transp;
+		local->bwave = param->param[0].int_val;
 		memset(wt, 0, DCO_WAVE_SZE * sizeof(float));
 		switch (param->param[0].int_val) {
 			case 0:
@@ -272,41 +294,30 @@ static int operate(bristolOP *operator,
 				generateBLOwaveformF(voice->cFreq*transp, wt, BLO_RAMP);
 				break;
 		}
-	} else
-		wt = specs->wave[param->param[0].int_val];
+		waveCoreGuard(wt, DCO_WAVE_SZE);
+	}
 
 /*printf("%i, %f, %i: %x %x %x\n", count, gain, param->param[0].int_val, wt, ib, ob); */
 	/*
 	 * Go jumping through the wavetable, with each jump defined by the value
-	 * given on our input line, making sure we fill one output buffer.
+	 * given on our input line, making sure we fill one output buffer. The
+	 * gain is ramped across each control block.
 	 */
-	for (obp = 0; obp < count; obp++)
+	for (obp = 0; obp < count; obp += block)
 	{
-		if (wtp >= DCO_WAVE_SZE_M)
-			ob[obp] += (wt[0] * (wtp - ((float) ((int) wtp)))
-				+ wt[(int) wtp] * (1.0 - (wtp - ((float) ((int) wtp))))) * gain;
-		else
-			ob[obp] += (wt[(int) wtp + 1] * (wtp - ((float) ((int) wtp)))
-				+ wt[(int) wtp] * (1.0 - (wtp - ((float) ((int) wtp))))) * gain;
+		if ((block = count - obp) > BRISTOL_SMOOTH_BLOCK)
+			block = BRISTOL_SMOOTH_BLOCK;
 
-		/*
-		 * Move the wavetable pointer forward by amount indicated in input 
-		 * buffer for this sample.
-		 */
-		if ((wtp += ib[obp] * transp) >= DCO_WAVE_SZE)
-		{
-			while (wtp >= DCO_WAVE_SZE)
-				wtp -= DCO_WAVE_SZE;
-		}
-		/*
-		 * If we have gone negative, round back up. Allows us to run the 
-		 * oscillator backwards.
-		 */
-		while (wtp < 0)
-			wtp += DCO_WAVE_SZE;
+		dgain = (bristolSmoothStep(&local->gain) - gain)
+			/ BRISTOL_SMOOTH_BLOCK;
+
+		phase = waveCoreRun(&ob[obp], block, wt, shift, phase, &ib[obp],
+			transp * (float) (1u << shift), gain + dgain, dgain);
+
+		gain += dgain * block;
 	}
 
-	local->wtp = wtp;
+	local->phase = phase;
 	return(0);
 }
 
@@ -355,27 +366,43 @@ dcoinit(bristolOP **operator, int index, int samplerate, int samplecount)
 	 * We are going to assign multiple waves to this oscillator.
 	 * sine, ramp, square, triangle?
 	 */
-	specs->wave[0] = (float *) bristolmalloc(DCO_WAVE_SZE * sizeof(float));
-	specs->wave[1] = (float *) bristolmalloc(DCO_WAVE_SZE * sizeof(float));
-	specs->wave[2] = (float *) bristolmalloc(DCO_WAVE_SZE * sizeof(float));
-	specs->wave[3] = (float *) bristolmalloc(DCO_WAVE_SZE * sizeof(float));
-	specs->wave[4] = (float *) bristolmalloc(DCO_WAVE_SZE * sizeof(float));
-	specs->wave[5] = (float *) bristolmalloc(DCO_WAVE_SZE * sizeof(float));
-	specs->wave[6] = (float *) bristolmalloc(DCO_WAVE_SZE * sizeof(float));
-	specs->wave[7] = (float *) bristolmalloc(DCO_WAVE_SZE * sizeof(float));
+	specs->wave[0] = (float *) bristolmalloc(sizeof(float)
+		* (DCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[1] = (float *) bristolmalloc(sizeof(float)
+		* (DCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[2] = (float *) bristolmalloc(sizeof(float)
+		* (DCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[3] = (float *) bristolmalloc(sizeof(float)
+		* (DCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[4] = (float *) bristolmalloc(sizeof(float)
+		* (DCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[5] = (float *) bristolmalloc(sizeof(float)
+		* (DCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[6] = (float *) bristolmalloc(sizeof(float)
+		* (DCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[7] = (float *) bristolmalloc(sizeof(float)
+		* (DCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
 
 	/*
 	 * FillWave is something that should be called as a parameter change, but
 	 * for testing will load it here.
 	 */
 	fillWave(specs->wave[0], DCO_WAVE_SZE, 0);
+	waveCoreGuard(specs->wave[0], DCO_WAVE_SZE);
 	fillWave(specs->wave[1], DCO_WAVE_SZE, 1);
+	waveCoreGuard(specs->wave[1], DCO_WAVE_SZE);
 	fillWave(specs->wave[2], DCO_WAVE_SZE, 2);
+	waveCoreGuard(specs->wave[2], DCO_WAVE_SZE);
 	fillWave(specs->wave[3], DCO_WAVE_SZE, 3);
+	waveCoreGuard(specs->wave[3], DCO_WAVE_SZE);
 	fillWave(specs->wave[4], DCO_WAVE_SZE, 4);
+	waveCoreGuard(specs->wave[4], DCO_WAVE_SZE);
 	fillWave(specs->wave[5], DCO_WAVE_SZE, 5);
+	waveCoreGuard(specs->wave[5], DCO_WAVE_SZE);
 	fillWave(specs->wave[6], DCO_WAVE_SZE, 6);
+	waveCoreGuard(specs->wave[6], DCO_WAVE_SZE);
 	fillWave(specs->wave[7], DCO_WAVE_SZE, 7);
+	waveCoreGuard(specs->wave[7], DCO_WAVE_SZE);
 
 	/*
 	 * Now fill in the dco specs for this operator. These are specific to an
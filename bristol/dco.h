@@ -22,6 +22,8 @@
 #ifndef DCO_H
 #define DCO_H
 
+#include "wavecore.h"
+
 #define DCO_WAVE_SZE 1024
 #define DCO_WAVE_SZE_M 1023
 
@@ -32,9 +34,17 @@ typedef struct BristolDCO {
 
 typedef struct BristolDCOlocal {
 	unsigned int flags;
-	float wtp;
+	bristolPhase phase;
 	float note_diff;
 	int tune_diff;
+	bristolSmooth gain;
+	/*
+	 * Band limited table for this voice, only rebuilt when the frequency or
+	 * waveform change.
+	 */
+	float bfreq;
+	int bwave;
+	float blo[DCO_WAVE_SZE + BRISTOL_WAVE_GUARD];
 } bristolDCOlocal;
 
 #endif /* DCO_H */
@@ -0,0 +1,153 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * The delay line behind the vibrato, chorus and rotary effects. Each of them
+ * used to keep its own history with its own wrap tests, and the vibrato and
+ * rotary read pointers were stepped by a rate that had to be recalculated from
+ * the distance to the write pointer. Here the read is expressed as a delay
+ * behind the write index. The operators work out where the delay should be at
+ * the end of a control step, from their LFO, and the line ramps to it across
+ * the step. Every sample of a block read is independent of the others, there
+ * is no pointer carried from one to the next, so the loops are straight
+ * arithmetic on masked indices.
+ *
+ * Effects that write their output back into the history go a sample at a time
+ * with the inlines in delayline.h, the interpolation is the same.
+ */
+
+#include <string.h>
+
+#include "delayline.h"
+
+int delayLineInterp = -1;
+
+/*
+ * Attach a history of 'size' floats, a power of two, to the line. The
+ * operators allocate the history in their reset() so it is only attached
+ * again when that memory changes.
+ */
+void
+delayLineInit(bristolDelayLine *dl, float *buf, int size, int mode)
+{
+	dl->buf = buf;
+	dl->mask = size - 1;
+	dl->in = 0;
+	dl->ap = 0;
+	dl->mode = delayLineInterp >= 0? delayLineInterp:mode;
+}
+
+void
+delayLineWrite(bristolDelayLine *dl, float *src, int count)
+{
+	unsigned int start = (dl->in + 1) & dl->mask, n;
+
+	if ((n = dl->mask + 1 - start) > count)
+		n = count;
+
+	memcpy(&dl->buf[start], src, n * sizeof(float));
+	if (n < count)
+		memcpy(dl->buf, &src[n], (count - n) * sizeof(float));
+
+	dl->in += count;
+}
+
+/*
+ * Read the block that was last written, each sample from the delay given for
+ * it, adding 'dry' times the signal that was written. The operators compute
+ * the delays for a block from their LFO before they read it. The dry signal
+ * comes from the history so dest may be the buffer that was written.
+ *
+ * The samples are taken BRISTOL_DL_BLOCK at a time: the positions and then the
+ * interpolation are loops of a fixed length that the compiler vectorises, only
+ * the loads from the history in between are scalar. The allpass has to go one
+ * sample after another.
+ */
+void
+delayLineRead(bristolDelayLine *dl, float *dest, int count, float *delay,
+float dry)
+{
+	float *buf = dl->buf, max = dl->mask - 2, d;
+	float f[BRISTOL_DL_BLOCK], xm1[BRISTOL_DL_BLOCK], x0[BRISTOL_DL_BLOCK];
+	float x1[BRISTOL_DL_BLOCK], x2[BRISTOL_DL_BLOCK], dr[BRISTOL_DL_BLOCK];
+	unsigned int mask = dl->mask, now = dl->in - count + 1, n;
+	unsigned int idx[BRISTOL_DL_BLOCK];
+	int i, j;
+
+	if (dl->mode == BRISTOL_DL_ALLPASS)
+	{
+		for (i = 0; i < count; i++)
+		{
+			d = delay[i] < BRISTOL_DL_MIN? BRISTOL_DL_MIN:
+				delay[i] > max? max:delay[i];
+			dest[i] = delayLineAllpass(dl, now + i, d)
+				+ buf[(now + i) & mask] * dry;
+		}
+		return;
+	}
+
+	for (j = 0; j + BRISTOL_DL_BLOCK <= count; j += BRISTOL_DL_BLOCK)
+	{
+		for (i = 0; i < BRISTOL_DL_BLOCK; i++)
+		{
+			d = delay[i + j] < BRISTOL_DL_MIN? BRISTOL_DL_MIN:
+				delay[i + j] > max? max:delay[i + j];
+			n = (unsigned int) d;
+			f[i] = d - (float) n;
+			idx[i] = now + i + j - n;
+		}
+
+		if (dl->mode == BRISTOL_DL_CUBIC)
+		{
+			for (i = 0; i < BRISTOL_DL_BLOCK; i++)
+			{
+				xm1[i] = buf[(idx[i] + 1) & mask];
+				x0[i] = buf[idx[i] & mask];
+				x1[i] = buf[(idx[i] - 1) & mask];
+				x2[i] = buf[(idx[i] - 2) & mask];
+				dr[i] = buf[(now + i + j) & mask];
+			}
+			for (i = 0; i < BRISTOL_DL_BLOCK; i++)
+				dest[i + j] = delayLineHermite(xm1[i], x0[i], x1[i], x2[i],
+					f[i]) + dr[i] * dry;
+		} else {
+			for (i = 0; i < BRISTOL_DL_BLOCK; i++)
+			{
+				x0[i] = buf[idx[i] & mask];
+				x1[i] = buf[(idx[i] - 1) & mask];
+				dr[i] = buf[(now + i + j) & mask];
+			}
+			for (i = 0; i < BRISTOL_DL_BLOCK; i++)
+				dest[i + j] = x0[i] + (x1[i] - x0[i]) * f[i] + dr[i] * dry;
+		}
+	}
+
+	for (; j < count; j++)
+	{
+		d = delay[j] < BRISTOL_DL_MIN? BRISTOL_DL_MIN:
+			delay[j] > max? max:delay[j];
+		if (dl->mode == BRISTOL_DL_CUBIC)
+			dest[j] = delayLineCubic(buf, mask, now + j, d);
+		else
+			dest[j] = delayLineLinear(buf, mask, now + j, d);
+		dest[j] += buf[(now + j) & mask] * dry;
+	}
+}
@@ -0,0 +1,153 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DELAYLINE_H
+#define DELAYLINE_H
+
+/*
+ * Modulated delay line shared by the chorus, vibrato and rotary effects. The
+ * history is a power of two so positions are masked rather than tested, the
+ * write index runs free and a delay is counted back from the last sample that
+ * was written: a delay of 1 is the sample before it.
+ */
+#define BRISTOL_DL_LINEAR	0
+#define BRISTOL_DL_ALLPASS	1
+#define BRISTOL_DL_CUBIC	2
+
+/* Shortest fractional delay, cubic needs a sample either side */
+#define BRISTOL_DL_MIN 1.0f
+
+/* Samples per control step for operators that compute their own LFO */
+#define BRISTOL_DL_CONTROL 16
+
+/* Samples interpolated together by the block reads */
+#define BRISTOL_DL_BLOCK 16
+
+typedef struct BristolDelayLine {
+	float *buf;
+	unsigned int mask;
+	unsigned int in;
+	int mode;
+	float ap; /* allpass interpolator state */
+} bristolDelayLine;
+
+/* -interpolate, overrides the operator's choice when not negative */
+extern int delayLineInterp;
+
+extern void delayLineInit(bristolDelayLine *, float *, int, int);
+extern void delayLineWrite(bristolDelayLine *, float *, int);
+extern void delayLineRead(bristolDelayLine *, float *, int, float *, float);
+
+/*
+ * Single sample access for the effects that feed their output back into the
+ * history and so cannot read a block that they have not yet written.
+ */
+static inline void
+delayLinePut(bristolDelayLine *dl, float v)
+{
+	dl->buf[++dl->in & dl->mask] = v;
+}
+
+static inline float
+delayLineAt(bristolDelayLine *dl, int d)
+{
+	return(dl->buf[(dl->in - d) & dl->mask]);
+}
+
+static inline void
+delayLineMix(bristolDelayLine *dl, int d, float v)
+{
+	dl->buf[(dl->in - d) & dl->mask] += v;
+}
+
+/*
+ * Fractional read 'd' samples behind 'now'. The caller has already limited d
+ * to BRISTOL_DL_MIN and the length of the history.
+ */
+static inline float
+delayLineLinear(float *buf, unsigned int mask, unsigned int now, float d)
+{
+	unsigned int n = (unsigned int) d;
+	float f = d - (float) n, x0, x1;
+
+	x0 = buf[(now - n) & mask];
+	x1 = buf[(now - n - 1) & mask];
+
+	return(x0 + (x1 - x0) * f);
+}
+
+/* 4 point Hermite, f runs from x0 towards the older x1 */
+static inline float
+delayLineHermite(float xm1, float x0, float x1, float x2, float f)
+{
+	float c1, c2, c3;
+
+	c1 = 0.5f * (x1 - xm1);
+	c2 = xm1 - 2.5f * x0 + 2.0f * x1 - 0.5f * x2;
+	c3 = 0.5f * (x2 - xm1) + 1.5f * (x0 - x1);
+
+	return(((c3 * f + c2) * f + c1) * f + x0);
+}
+
+static inline float
+delayLineCubic(float *buf, unsigned int mask, unsigned int now, float d)
+{
+	unsigned int n = (unsigned int) d;
+
+	return(delayLineHermite(buf[(now - n + 1) & mask], buf[(now - n) & mask],
+		buf[(now - n - 1) & mask], buf[(now - n - 2) & mask], d - (float) n));
+}
+
+/*
+ * First order allpass, the integer part is taken half a sample short so the
+ * coefficient stays in (-1/5, 1/3] where the group delay is flattest. It has
+ * state so the samples must be read in order.
+ */
+static inline float
+delayLineAllpass(bristolDelayLine *dl, unsigned int now, float d)
+{
+	unsigned int n = (unsigned int) (d - 0.5f);
+	float f = d - (float) n, eta;
+
+	eta = (1.0f - f) / (1.0f + f);
+
+	return(dl->ap = eta * (dl->buf[(now - n) & dl->mask] - dl->ap)
+		+ dl->buf[(now - n - 1) & dl->mask]);
+}
+
+static inline float
+delayLineGet(bristolDelayLine *dl, float d)
+{
+	if (d < BRISTOL_DL_MIN)
+		d = BRISTOL_DL_MIN;
+	else if (d > dl->mask - 2)
+		d = dl->mask - 2;
+
+	switch (dl->mode) {
+		case BRISTOL_DL_CUBIC:
+			return(delayLineCubic(dl->buf, dl->mask, dl->in, d));
+		case BRISTOL_DL_ALLPASS:
+			return(delayLineAllpass(dl, dl->in, d));
+	}
+	return(delayLineLinear(dl->buf, dl->mask, dl->in, d));
+}
+
+#endif /* DELAYLINE_H */
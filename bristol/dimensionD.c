@@ -157,9 +157,9 @@ static int operate(bristolOP *operator,
 	bristolVCHORUSlocal *local = (bristolVCHORUSlocal *) lcl;
 	register float *source, *ldest, *rdest;
 	register int count;
-	register float *history, depth, speed, scan, fdir;
-	register float histout, value, scanp, gain, cg, dir, scanr;
-	register int histin, i;
+	register float depth, speed, scan, fdir;
+	register float delay, step, value, gain, cg, dir, scanr;
+	register int i;
 
 	specs = (bristolVCHORUS *) operator->specs;
 
@@ -184,46 +184,42 @@ static int operate(bristolOP *operator,
 	gain = param->param[GAIN].float_val * 1.5;
 	scan = param->param[SCAN].float_val * 0.0005 * gain;
 
-	history = param->param[0].mem;
-
 #ifdef DEBUG
 	printf("dimensionD()\n");
 #endif
 
-	histin = local->Histin;
-	histout = local->Histout;
+	if (local->dl.buf != param->param[0].mem)
+		delayLineInit(&local->dl, param->param[0].mem, HISTSIZE,
+			BRISTOL_DL_LINEAR);
+
+	delay = local->delay;
+	step = local->step;
 	scanr = local->scanr;
-	scanp = local->scanp;
 	cg = local->cg;
 	dir = local->dir;
 	fdir = local->fdir;
 
 	for (i = 0; i < count; i++) {
 		/*
-		 * Save our current signal into the history buffer.
+		 * The sinewave is taken at the control rate and the delay ramped to
+		 * it, the output is fed back into the history so we cannot read it
+		 * as a block.
 		 */
-		history[histin] = *source;
+		if ((i & (BRISTOL_DL_CONTROL - 1)) == 0)
+		{
+			if ((scanr += speed * BRISTOL_DL_CONTROL) >= 1024)
+				scanr -= 1024;
+			step = (sinewave[(int) scanr] * depth - delay)
+				/ BRISTOL_DL_CONTROL;
+		}
 
 		/*
-		 * Take our sample. Resample the two nearest for the position of our
-		 * current scan through the history.
-		 *
-		 * Resampling is to take the current sample, plus the difference of the
-		 * distance between this and the next sample.
-		 value = history[histout]
-		 	+ (history[histout + 1] - history[histout])
-				* histout - (int) histout)
+		 * Save our current signal into the history buffer and take our
+		 * sample, resampled from the nearest for the current delay.
 		 */
-		if ((histout + 1) >= HISTSIZE)
-		{
-			value = history[(int) histout] +
-				(history[0] - history[(int) histout])
-					* (histout - ((float) ((int) histout)));
-		} else {
-			value = history[(int) histout] +
-				(history[(int) histout + 1] - history[(int) histout])
-					* (histout - ((float) ((int) histout)));
-		}
+		delayLinePut(&local->dl, *source);
+		value = delayLineGet(&local->dl, delay);
+		delay += step;
 
 		/*
 		 * This is wrong. We take our sample and add to one channel and then
@@ -251,40 +247,13 @@ static int operate(bristolOP *operator,
 			*ldest++ = (*source * (1.5 - gain)) + value * cg;
 		}
 
-		history[histin] += value * gain * 0.5;
+		delayLineMix(&local->dl, 0, value * gain * 0.5);
 		source++;
-
-		if (++histin >= HISTSIZE) histin = 0;
-
-		if ((histout = ((float) histin) - scanp) < 0)
-			while (histout < 0)
-				histout += HISTSIZE;
-
-		while (histout >= HISTSIZE)
-			histout -= HISTSIZE;
-
-		/*
-		 * Adjust the scan rate through memory. Initially out is zero, and we
-		 * tend it towards depth by adding the speed increments. When we reach
-		 * depth we change the direction.
-		if (fdir == 0)
-		{
-			if ((scanp += speed) > depth)
-				fdir = 1;
-		} else {
-			if ((scanp -= speed) < speed)
-				fdir = 0;
-		}
-		 */
-		if ((scanr += speed) >= 1024)
-			scanr -= 1024;
-		scanp = sinewave[(int) scanr] * depth;
 	}
 
-	local->Histin = histin;
-	local->Histout = histout;
+	local->delay = delay;
+	local->step = step;
 	local->scanr = scanr;
-	local->scanp = scanp;
 	local->cg = cg;
 	local->dir = dir;
 	local->fdir = fdir;
@@ -80,14 +80,14 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
-	bristolfree(((bristolDXOP *) operator)->wave[0]);
-	bristolfree(((bristolDXOP *) operator)->wave[1]);
-	bristolfree(((bristolDXOP *) operator)->wave[2]);
-	bristolfree(((bristolDXOP *) operator)->wave[3]);
-	bristolfree(((bristolDXOP *) operator)->wave[4]);
-	bristolfree(((bristolDXOP *) operator)->wave[5]);
-	bristolfree(((bristolDXOP *) operator)->wave[6]);
-	bristolfree(((bristolDXOP *) operator)->wave[7]);
+	bristolfree(((bristolDXOP *) operator->specs)->wave[0]);
+	bristolfree(((bristolDXOP *) operator->specs)->wave[1]);
+	bristolfree(((bristolDXOP *) operator->specs)->wave[2]);
+	bristolfree(((bristolDXOP *) operator->specs)->wave[3]);
+	bristolfree(((bristolDXOP *) operator->specs)->wave[4]);
+	bristolfree(((bristolDXOP *) operator->specs)->wave[5]);
+	bristolfree(((bristolDXOP *) operator->specs)->wave[6]);
+	bristolfree(((bristolDXOP *) operator->specs)->wave[7]);
 
 	bristolfree(operator->specs);
 
@@ -277,25 +277,15 @@ static int param(bristolOP *operator, bristolOPParams *param,
 	return(0);
 }
 
-//static float scale = 0.0000000001; // 0.000000001;
-static int dngx1 = 0x67452301;
-static int dngx2 = 0xefcdab89;
-
 static void
 buffermax(float *buf, float max, int count)
 {
 	for (count--; count >= 0; count--)
 	{
-		dngx1 ^= dngx2;
-
 		if (buf[count] > max)
 			buf[count] = max;
 		else if (-buf[count] > max)
 			buf[count] = -max;
-
-//		buf[count] += dngx2 * scale;
-
-		dngx2 += dngx1;
 	}
 }
 
@@ -309,12 +299,13 @@ static int operate(bristolOP *operator,
 	void *lcl)
 {
 	bristolDXOPlocal *local = lcl;
-	register int obp = 0, count, rampup = -1;
-	register float *ib, *ob, *wt, wtp, transp;
+	register int obp = 0, count, rampup = -1, shift;
+	register float *ib, *ob, *wt, transp;
 	register float cgain, attack, decay, sustain, release, gain, egain, delta;
 	/* These are for the 7 stage envelope: */
 	register float L1, attack2, L2;
 	bristolDXOP *specs;
+	bristolPhase phase;
 
 	specs = (bristolDXOP *) operator->specs;
 
@@ -326,10 +317,10 @@ static int operate(bristolOP *operator,
 	ib = specs->spec.io[DXOP_IN_IND].buf;
 	ob = specs->spec.io[DXOP_OUT_IND].buf;
 	wt = specs->wave[0];
-	wtp = local->wtp;
+	shift = waveCoreShift(DXOP_WAVE_SZE);
+	phase = local->phase;
 	transp = param->param[DXOP_TRANSPOSE].float_val
 		* param->param[DXOP_TUNE].float_val;
-	wtp = local->wtp;
 	cgain = local->cgain;
 	egain = local->egain;
 
@@ -410,7 +401,7 @@ static int operate(bristolOP *operator,
 		cgain = 1.0;
 		egain = 1.0;
 		rampup = 1;
-		wtp = 0;
+		phase = 0;
 		local->cstate = STATE_ATTACK;
 
 		if ((~voice->flags & BRISTOL_KEYREON) &&
@@ -519,23 +510,9 @@ static int operate(bristolOP *operator,
 						ob[obp] += wt[(int) wtp] * (((cgain *= release) - 1)
 							* egain);
 						 */
-						if (wtp >= DXOP_WAVE_SZE_M)
-							ob[obp] += (wt[0] * (wtp - ((float) ((int) wtp)))
-								+ wt[(int) wtp]
-								* (1.0 - (wtp - ((float) ((int) wtp)))))
-								* (((cgain *= release) - 1) * egain);
-						else
-							ob[obp] += (wt[(int) wtp + 1]
-								* (wtp - ((float) ((int) wtp)))
-								+ wt[(int) wtp]
-								* (1.0 - (wtp - ((float) ((int) wtp)))))
-								* (((cgain *= release) - 1) * egain);
-
-						if ((wtp += ib[obp++] * transp) >= DXOP_WAVE_SZE)
-							while ((wtp -= DXOP_WAVE_SZE) > DXOP_WAVE_SZE)
-								;
-						while (wtp < 0)
-							wtp += DXOP_WAVE_SZE;
+						ob[obp] += waveCoreLerp(wt, phase, shift)
+							* (((cgain *= release) - 1) * egain);
+						phase += waveCoreStep(ib[obp++] * transp, shift);
 					} else
 						break;
 
@@ -587,24 +564,9 @@ static int operate(bristolOP *operator,
 							ob[obp] += wt[(int) wtp] * (((cgain *= attack) - 1)
 								* egain);
 							 */
-							if (wtp >= DXOP_WAVE_SZE_M)
-								ob[obp] += (wt[0]
-									* (wtp - ((float) ((int) wtp)))
-									+ wt[(int) wtp]
-									* (1.0 - (wtp - ((float) ((int) wtp)))))
-									* (((cgain *= attack) - 1) * egain);
-							else
-								ob[obp] += (wt[(int) wtp + 1]
-									* (wtp - ((float) ((int) wtp)))
-									+ wt[(int) wtp]
-									* (1.0 - (wtp - ((float) ((int) wtp)))))
-									* (((cgain *= attack) - 1) * egain);
-
-							if ((wtp += ib[obp++] * transp) >= DXOP_WAVE_SZE)
-								while ((wtp -= DXOP_WAVE_SZE) > DXOP_WAVE_SZE)
-									;
-							while (wtp < 0)
-								wtp += DXOP_WAVE_SZE;
+							ob[obp] += waveCoreLerp(wt, phase, shift)
+								* (((cgain *= attack) - 1) * egain);
+							phase += waveCoreStep(ib[obp++] * transp, shift);
 						} else
 							break;
 
@@ -637,24 +599,9 @@ static int operate(bristolOP *operator,
 							ob[obp] += wt[(int) wtp] * (((cgain *= delta) - 1)
 								* egain);
 							 */
-							if (wtp >= DXOP_WAVE_SZE_M)
-								ob[obp] += (wt[0]
-									* (wtp - ((float) ((int) wtp)))
-									+ wt[(int) wtp]
-									* (1.0 - (wtp - ((float) ((int) wtp)))))
-									* (((cgain *= delta) - 1) * egain);
-							else
-								ob[obp] += (wt[(int) wtp + 1]
-									* (wtp - ((float) ((int) wtp)))
-									+ wt[(int) wtp]
-									* (1.0 - (wtp - ((float) ((int) wtp)))))
-									* (((cgain *= delta) - 1) * egain);
-
-							if ((wtp += ib[obp++] * transp) >= DXOP_WAVE_SZE)
-								while ((wtp -= DXOP_WAVE_SZE) > DXOP_WAVE_SZE)
-									;
-							while (wtp < 0)
-								wtp += DXOP_WAVE_SZE;
+							ob[obp] += waveCoreLerp(wt, phase, shift)
+								* (((cgain *= delta) - 1) * egain);
+							phase += waveCoreStep(ib[obp++] * transp, shift);
 						} else
 							break;
 
@@ -703,24 +650,9 @@ static int operate(bristolOP *operator,
 							ob[obp] += wt[(int) wtp] * (((cgain *= attack2) - 1)
 								* egain);
 							 */
-							if (wtp >= DXOP_WAVE_SZE_M)
-								ob[obp] += (wt[0]
-									* (wtp - ((float) ((int) wtp)))
-									+ wt[(int) wtp]
-									* (1.0 - (wtp - ((float) ((int) wtp)))))
-									* (((cgain *= attack2) - 1) * egain);
-							else
-								ob[obp] += (wt[(int) wtp + 1]
-									* (wtp - ((float) ((int) wtp)))
-									+ wt[(int) wtp]
-									* (1.0 - (wtp - ((float) ((int) wtp)))))
-									* (((cgain *= attack2) - 1) * egain);
-
-							if ((wtp += ib[obp++] * transp) >= DXOP_WAVE_SZE)
-								while ((wtp -= DXOP_WAVE_SZE) > DXOP_WAVE_SZE)
-									;
-							while (wtp < 0)
-								wtp += DXOP_WAVE_SZE;
+							ob[obp] += waveCoreLerp(wt, phase, shift)
+								* (((cgain *= attack2) - 1) * egain);
+							phase += waveCoreStep(ib[obp++] * transp, shift);
 						} else
 							break;
 
@@ -754,24 +686,9 @@ static int operate(bristolOP *operator,
 								* egain);
 							 */
 
-							if (wtp >= DXOP_WAVE_SZE_M)
-								ob[obp] += (wt[0]
-									* (wtp - ((float) ((int) wtp)))
-									+ wt[(int) wtp]
-									* (1.0 - (wtp - ((float) ((int) wtp)))))
-									* (((cgain *= delta) - 1) * egain);
-							else
-								ob[obp] += (wt[(int) wtp + 1]
-									* (wtp - ((float) ((int) wtp)))
-									+ wt[(int) wtp]
-									* (1.0 - (wtp - ((float) ((int) wtp)))))
-									* (((cgain *= delta) - 1) * egain);
-
-							if ((wtp += ib[obp++] * transp) >= DXOP_WAVE_SZE)
-								while ((wtp -= DXOP_WAVE_SZE) > DXOP_WAVE_SZE)
-									;
-							while (wtp < 0)
-								wtp += DXOP_WAVE_SZE;
+							ob[obp] += waveCoreLerp(wt, phase, shift)
+								* (((cgain *= delta) - 1) * egain);
+							phase += waveCoreStep(ib[obp++] * transp, shift);
 						} else
 							break;
 
@@ -822,24 +739,9 @@ static int operate(bristolOP *operator,
 								* egain);
 							 */
 
-							if (wtp >= DXOP_WAVE_SZE_M)
-								ob[obp] += (wt[0]
-									* (wtp - ((float) ((int) wtp)))
-									+ wt[(int) wtp]
-									* (1.0 - (wtp - ((float) ((int) wtp)))))
-									* (((cgain *= delta) - 1) * egain);
-							else
-								ob[obp] += (wt[(int) wtp + 1]
-									* (wtp - ((float) ((int) wtp)))
-									+ wt[(int) wtp]
-									* (1.0 - (wtp - ((float) ((int) wtp)))))
-									* (((cgain *= delta) - 1) * egain);
-
-							if ((wtp += ib[obp++] * transp) >= DXOP_WAVE_SZE)
-								while ((wtp -= DXOP_WAVE_SZE) > DXOP_WAVE_SZE)
-									;
-							while (wtp < 0)
-								wtp += DXOP_WAVE_SZE;
+							ob[obp] += waveCoreLerp(wt, phase, shift)
+								* (((cgain *= delta) - 1) * egain);
+							phase += waveCoreStep(ib[obp++] * transp, shift);
 						} else
 							break;
 
@@ -872,24 +774,9 @@ static int operate(bristolOP *operator,
 								* egain);
 							 */
 
-							if (wtp >= DXOP_WAVE_SZE_M)
-								ob[obp] += (wt[0]
-									* (wtp - ((float) ((int) wtp)))
-									+ wt[(int) wtp]
-									* (1.0 - (wtp - ((float) ((int) wtp)))))
-									* (((cgain *= decay) - 1) * egain);
-							else
-								ob[obp] += (wt[(int) wtp + 1]
-									* (wtp - ((float) ((int) wtp)))
-									+ wt[(int) wtp]
-									* (1.0 - (wtp - ((float) ((int) wtp)))))
-									* (((cgain *= decay) - 1) * egain);
-
-							if ((wtp += ib[obp++] * transp) >= DXOP_WAVE_SZE)
-								while ((wtp -= DXOP_WAVE_SZE) > DXOP_WAVE_SZE)
-									;
-							while (wtp < 0)
-								wtp += DXOP_WAVE_SZE;
+							ob[obp] += waveCoreLerp(wt, phase, shift)
+								* (((cgain *= decay) - 1) * egain);
+							phase += waveCoreStep(ib[obp++] * transp, shift);
 						} else
 							break;
 
@@ -931,35 +818,9 @@ static int operate(bristolOP *operator,
 					/*
 					ob[obp] += wt[(int) wtp] * (sustain - 1) * egain;
 					 */
-					if (wtp >= DXOP_WAVE_SZE_M)
-						ob[obp] += (wt[0]
-							* (wtp - ((float) ((int) wtp)))
-							+ wt[(int) wtp]
-							* (1.0 - (wtp - ((float) ((int) wtp)))))
-							* (sustain - 1) * egain;
-					else {
-						/*
-						 * We need to do some bounds checking
-						 * And at a few other places probably too.
-						 * Its ugly as it could hang here for quite a long
-						 * time.
-						 */
-						while (wtp >= DXOP_WAVE_SZE_M)
-							wtp -= DXOP_WAVE_SZE_M;
-						while (wtp < 0)
-							wtp += DXOP_WAVE_SZE_M;
-						ob[obp] += (wt[(int) wtp + 1]
-							* (wtp - ((float) ((int) wtp)))
-							+ wt[(int) wtp]
-							* (1.0 - (wtp - ((float) ((int) wtp)))))
-							* (sustain - 1) * egain;
-					}
-
-					if ((wtp += ib[obp++] * transp) >= DXOP_WAVE_SZE)
-						while ((wtp -= DXOP_WAVE_SZE) > DXOP_WAVE_SZE)
-							;
-					while (wtp < 0)
-						wtp += DXOP_WAVE_SZE;
+					ob[obp] += waveCoreLerp(wt, phase, shift)
+						* (sustain - 1) * egain;
+					phase += waveCoreStep(ib[obp++] * transp, shift);
 				}
 				voice->flags &= ~BRISTOL_KEYDONE;
 				break;
@@ -979,12 +840,317 @@ static int operate(bristolOP *operator,
 		}
 	}
 	
-	local->wtp = wtp;
+	local->phase = phase;
 	local->cgain = cgain;
 	local->egain = egain;
 	return(0);
 }
 
+/*
+ * Working state for one operator in the fused kernel. This is the operate()
+ * prologue resolved once per period so the sample loop only has to step the
+ * envelope and the phase.
+ */
+typedef struct DxFusedOp {
+	bristolDXOPlocal *local;
+	int cstate, rampup;
+	bristolPhase phase;
+	float transp, cgain, egain, gain;
+	float attack, attackd, attack2, attack2d, decay, decayd, sustain, release;
+	float L1, L2;
+	float mod[DX_OP_COUNT]; /* input gain from each other operator */
+	float kgain, lfo; /* key or LFO frequency input */
+	float lgain, rgain; /* output mix, zero for modulators */
+} dxfusedop;
+
+/*
+ * One sample of the 7 stage envelope, with exactly the transitions of the
+ * state machine in operate(). Returns zero when the operator has finished
+ * and produces no output, otherwise the envelope gain is given in env.
+ */
+static int
+dxfusedenv(dxfusedop *op, float *env)
+{
+	for (;;)
+	{
+		switch (op->cstate) {
+			case STATE_RELEASE:
+				if (op->cgain <= 1.0)
+				{
+					op->cgain = 1.0;
+					op->cstate = STATE_DONE;
+					return(0);
+				}
+				*env = ((op->cgain *= op->release) - 1) * op->egain;
+				if (op->cgain <= 1.0)
+				{
+					op->cgain = 1.0;
+					op->cstate = STATE_DONE;
+				}
+				break;
+			case STATE_START:
+			case STATE_ATTACK:
+				if (op->cgain < op->L1) {
+					*env = ((op->cgain *= op->attack) - 1) * op->egain;
+					if (op->cgain >= op->L1)
+						op->cstate = STATE_ATTACK2;
+				} else if (op->cgain > op->L1) {
+					*env = ((op->cgain *= op->attackd) - 1) * op->egain;
+					if (op->cgain <= op->L1)
+						op->cstate = STATE_ATTACK2;
+				} else {
+					op->cstate = STATE_ATTACK2;
+					continue;
+				}
+				break;
+			case STATE_ATTACK2:
+				if (op->cgain < op->L2) {
+					*env = ((op->cgain *= op->attack2) - 1) * op->egain;
+					if (op->cgain >= op->L2)
+						op->cstate = STATE_DECAY;
+				} else if (op->cgain > op->L2) {
+					*env = ((op->cgain *= op->attack2d) - 1) * op->egain;
+					if (op->cgain <= op->L2)
+						op->cstate = STATE_DECAY;
+				} else {
+					op->cstate = STATE_DECAY;
+					continue;
+				}
+				break;
+			case STATE_DECAY:
+				if (op->cgain > op->sustain) {
+					*env = ((op->cgain *= op->decayd) - 1) * op->egain;
+					if (op->cgain <= op->sustain)
+						op->cstate = STATE_SUSTAIN;
+				} else if (op->cgain < op->sustain) {
+					*env = ((op->cgain *= op->decay) - 1) * op->egain;
+					if (op->cgain >= op->sustain)
+						op->cstate = STATE_SUSTAIN;
+				} else {
+					op->cstate = STATE_SUSTAIN;
+					continue;
+				}
+				break;
+			case STATE_SUSTAIN:
+				/* Sustain does not ramp the velocity gain */
+				op->cgain = op->sustain;
+				*env = (op->sustain - 1) * op->egain;
+				return(1);
+			case STATE_DONE:
+			default:
+				op->cstate = STATE_DONE;
+				return(0);
+		}
+		break;
+	}
+
+	if (op->rampup >= 0) {
+		if (op->rampup)
+		{
+			if ((op->egain += 0.01) > op->gain)
+			{
+				op->egain = op->gain;
+				op->rampup = -1;
+			}
+		} else {
+			if ((op->egain -= 0.01) < op->gain)
+			{
+				op->egain = op->gain;
+				op->rampup = -1;
+			}
+		}
+	}
+	return(1);
+}
+
+/*
+ * Fused rendering of all six operators of a DX voice for a given algorithm.
+ *
+ * The generic path runs each operator over the whole period through its own
+ * modulation and output buffer and then merges the carriers into the stereo
+ * buffers, that is about a dozen passes over memory per voice. Here the graph
+ * is walked per sample, the modulator outputs stay in a small local array and
+ * the carriers are summed directly into left and right. The per operator
+ * results are the same as operate() with the modulation input built by
+ * dxOpOne(), including the KEYDONE handling.
+ */
+int
+dxopfused(bristolOP *operator, bristolVoice *voice, bristolSound **sound,
+dxalgo *algo, dxmix *mix, float *kbuf, float *left, float *right, int count)
+{
+	dxfusedop ops[DX_OP_COUNT], *op;
+	bristolOPParams *param;
+	register float *wt, in, l, r;
+	float out[DX_OP_COUNT], env, cc1, igain;
+	int i, j, k, obp = 0, done = 1, shift;
+
+	wt = ((bristolDXOP *) operator->specs)->wave[0];
+	shift = waveCoreShift(DXOP_WAVE_SZE);
+	cc1 = voice->baudio->contcontroller[1];
+
+	/*
+	 * Resolve the operator parameters and the graph into gains.
+	 */
+	for (i = 0; i < DX_OP_COUNT; i++)
+	{
+		op = &ops[i];
+		param = sound[i]->param;
+		op->local = (bristolDXOPlocal *) voice->locals[voice->index][i];
+
+		op->transp = param->param[DXOP_TRANSPOSE].float_val
+			* param->param[DXOP_TUNE].float_val;
+
+		op->attack = param->param[DXOP_ATTACK].float_val;
+		op->decay = param->param[DXOP_DECAY].float_val;
+		op->sustain = 1.0 + param->param[DXOP_SUSTAIN].float_val;
+		op->release = param->param[DXOP_RELEASE].float_val;
+		op->L1 = param->param[DXOP_L1].float_val;
+		op->attack2 = param->param[DXOP_ATTACK2].float_val;
+		op->L2 = param->param[DXOP_L2].float_val;
+
+		if (op->L1 == 0.0)
+		{
+			op->L1 = BRISTOL_VPO;
+			op->attack2 = op->decay;
+			op->L2 = op->sustain;
+		}
+
+		op->attackd = 1/op->attack;
+		op->attack2d = 1/op->attack2;
+		op->decayd = 1/op->decay;
+
+		op->gain =
+			param->param[DXOP_VELOCITY].float_val
+				* voice->velocity * param->param[DXOP_GAIN].float_val
+			+ (1 - param->param[DXOP_VELOCITY].float_val)
+				* param->param[DXOP_GAIN].float_val;
+
+		if (param->param[DXOP_OGC].int_val)
+			op->gain *= cc1;
+
+		op->phase = op->local->phase;
+		op->cgain = op->local->cgain;
+		op->egain = op->local->egain;
+
+		if (op->egain < op->gain)
+			op->rampup = 1;
+		else if (op->egain > op->gain)
+			op->rampup = 0;
+		else
+			op->rampup = -1;
+
+		if (voice->flags & BRISTOL_KEYOFF)
+			op->local->cstate = STATE_RELEASE;
+
+		if (voice->flags & BRISTOL_KEYON)
+		{
+			op->cgain = 1.0;
+			op->egain = 1.0;
+			op->rampup = 1;
+			op->phase = 0;
+			op->local->cstate = STATE_ATTACK;
+		} else if (voice->flags & BRISTOL_KEYREON)
+			op->local->cstate = STATE_ATTACK;
+
+		op->cstate = op->local->cstate;
+
+		/*
+		 * Modulation index, optionally under control of the mod wheel.
+		 */
+		igain = mix[i].igain;
+		if (mix[i].flags & DX_IGC)
+			igain *= cc1;
+
+		for (j = 0; j < DX_OP_COUNT; j++)
+			op->mod[j] = (algo->mods[i] & DX_OP(j))? igain: 0.0;
+
+		if (mix[i].flags & DX_KEY) {
+			op->kgain = 1.0;
+			op->lfo = 0.0;
+		} else {
+			op->kgain = 0.0;
+			op->lfo = 0.001 + cc1 / 2;
+		}
+
+		if (algo->carriers & DX_OP(i)) {
+			op->lgain = mix[0].vol * (1.0 - mix[i].pan);
+			op->rgain = mix[0].vol * mix[i].pan;
+		} else
+			op->lgain = op->rgain = 0.0;
+
+		out[i] = 0.0;
+	}
+
+	/*
+	 * All operators share the voice trigger offset.
+	 */
+	if ((voice->flags & BRISTOL_KEYON) && (~voice->flags & BRISTOL_KEYREON)
+		&& (voice->offset > 0) && (voice->offset < count))
+	{
+		if (voice->baudio->midiflags & BRISTOL_MIDI_DEBUG1)
+			printf("envelope trigger offset %i frames\n", voice->offset);
+		obp = voice->offset;
+	}
+
+	for (; obp < count; obp++)
+	{
+		l = r = 0.0;
+
+		for (k = 0; k < DX_OP_COUNT; k++)
+		{
+			i = algo->order[k];
+			op = &ops[i];
+
+			if (dxfusedenv(op, &env) == 0)
+			{
+				out[i] = 0.0;
+				continue;
+			}
+
+			in = out[0] * op->mod[0] + out[1] * op->mod[1]
+				+ out[2] * op->mod[2] + out[3] * op->mod[3]
+				+ out[4] * op->mod[4] + out[5] * op->mod[5]
+				+ kbuf[obp] * op->kgain + op->lfo;
+
+			if (in > DXOP_WAVE_SZE * 4)
+				in = DXOP_WAVE_SZE * 4;
+			else if (in < -DXOP_WAVE_SZE * 4)
+				in = -DXOP_WAVE_SZE * 4;
+
+			out[i] = waveCoreLerp(wt, op->phase, shift) * env;
+			op->phase += waveCoreStep(in * op->transp, shift);
+
+			l += out[i] * op->lgain;
+			r += out[i] * op->rgain;
+		}
+
+		left[obp] += l;
+		right[obp] += r;
+	}
+
+	for (i = 0; i < DX_OP_COUNT; i++)
+	{
+		op = &ops[i];
+
+		op->local->cstate = op->cstate;
+		op->local->phase = op->phase;
+		op->local->cgain = op->cgain;
+		op->local->egain = op->egain;
+
+		if (op->cstate != STATE_DONE)
+			done = 0;
+	}
+
+	/*
+	 * The voice is only done if it was flagged as such and all six operators
+	 * have finished their release.
+	 */
+	if (done == 0)
+		voice->flags &= ~BRISTOL_KEYDONE;
+
+	return(0);
+}
+
 /*
  * Setup any variables in our OP structure, in our IO structures, and malloc
  * any memory we need.
@@ -993,6 +1159,7 @@ bristolOP *
 dxopinit(bristolOP **operator, int index, int samplerate, int samplecount)
 {
 	bristolDXOP *specs;
+	int i;
 
 	*operator = bristolOPinit(operator, index, samplecount);
 
@@ -1029,15 +1196,13 @@ dxopinit(bristolOP **operator, int index, int samplerate, int samplecount)
 	/*
 	 * We are going to assign multiple waves to this oscillator.
 	 * sine, ramp, square, triangle?
+	 *
+	 * Each wave has one guard sample, a copy of the first, so that the
+	 * interpolation never has to wrap.
 	 */
-	specs->wave[0] = (float *) bristolmalloc(DXOP_WAVE_SZE * sizeof(float));
-	specs->wave[1] = (float *) bristolmalloc(DXOP_WAVE_SZE * sizeof(float));
-	specs->wave[2] = (float *) bristolmalloc(DXOP_WAVE_SZE * sizeof(float));
-	specs->wave[3] = (float *) bristolmalloc(DXOP_WAVE_SZE * sizeof(float));
-	specs->wave[4] = (float *) bristolmalloc(DXOP_WAVE_SZE * sizeof(float));
-	specs->wave[5] = (float *) bristolmalloc(DXOP_WAVE_SZE * sizeof(float));
-	specs->wave[6] = (float *) bristolmalloc(DXOP_WAVE_SZE * sizeof(float));
-	specs->wave[7] = (float *) bristolmalloc(DXOP_WAVE_SZE * sizeof(float));
+	for (i = 0; i < 8; i++)
+		specs->wave[i] = (float *) bristolmalloc(sizeof(float)
+			* (DXOP_WAVE_SZE + BRISTOL_WAVE_GUARD));
 
 	/*
 	 * FillWave is something that should be called as a parameter change, but
@@ -1052,6 +1217,9 @@ dxopinit(bristolOP **operator, int index, int samplerate, int samplecount)
 	fillWave(specs->wave[6], DXOP_WAVE_SZE, 6);
 	fillWave(specs->wave[7], DXOP_WAVE_SZE, 7);
 
+	for (i = 0; i < 8; i++)
+		waveCoreGuard(specs->wave[i], DXOP_WAVE_SZE);
+
 	/*
 	 * Now fill in the dxop specs for this operator. These are specific to an
 	 * oscillator.
@@ -22,6 +22,8 @@
 #ifndef DXOP_H
 #define DXOP_H
 
+#include "wavecore.h"
+
 #define DXOP_WAVE_SZE 1024
 #define DXOP_WAVE_SZE_M 1023
 
@@ -43,7 +45,7 @@ typedef struct BristolDXOP {
 typedef struct BristolDXOPlocal {
 	unsigned int flags;
 	int cstate;
-	float wtp;
+	bristolPhase phase;
 	float note_diff;
 	int tune_diff;
 	float cgain;
@@ -65,9 +67,29 @@ typedef struct Dxmix {
 #define DX_ALGO_7	6
 #define DX_ALGO_8	7
 
+#define DX_ALGO_COUNT 24
+
 #define DX_LFO 1
 #define DX_KEY 2
 #define DX_IGC 4
 
+#define DX_OP_COUNT 6
+#define DX_OP(n) (1 << (n))
+
+/*
+ * Operator graph for one algorithm. Each operator is modulated by the sum of
+ * the operators in its mods mask, the operators in the carrier mask are mixed
+ * to the output with their own pan. Order lists the operators such that all
+ * modulators are evaluated before the operators they feed.
+ */
+typedef struct DxAlgo {
+	int order[DX_OP_COUNT];
+	unsigned int mods[DX_OP_COUNT];
+	unsigned int carriers;
+} dxalgo;
+
+extern int dxopfused(bristolOP *, bristolVoice *, bristolSound **, dxalgo *,
+	dxmix *, float *, float *, float *, int);
+
 #endif /* DXOP_H */
 
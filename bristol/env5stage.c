@@ -50,6 +50,7 @@
 
 #include "bristol.h"
 #include "env5stage.h"
+#include "envrun.h"
 
 static float samplerate = 0;
 
@@ -200,8 +201,8 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 	bristolOPParams *param, void *lcl)
 {
 	register bristolENVlocal *local = lcl;
-	register float *ob, current, cgain, gain;
-	register int count;
+	register float *ob, current, cgain, gain, release, level, rate;
+	register int count, run;
 	bristolENV *specs;
 
 	specs = (bristolENV *) operator->specs;
@@ -222,6 +223,14 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 	cgain = local->cgain;
 	current = local->current;
 
+	/*
+	 * Stolen voices release from full level in BRISTOL_STEAL_TIME or faster.
+	 */
+	release = param->param[RATE_3].float_val;
+	if ((voice->flags & BRISTOL_KEYSTEAL)
+		&& (release < 1.0f / (BRISTOL_STEAL_TIME * samplerate)))
+		release = 1.0f / (BRISTOL_STEAL_TIME * samplerate);
+
 	if (param->param[VELOCITY].int_val)
 		gain = param->param[GAIN].float_val
 			* (voice->velocity + voice->press + voice->chanpressure);
@@ -264,8 +273,54 @@ param->param[LEVEL_4].float_val);
 		}
 	}
 
-	while (count-- > 0)
+	while (count > 0)
 	{
+		/*
+		 * Unless the velocity gain is still moving, run the current stage
+		 * straight through for as long as envLinRun() says it cannot reach its
+		 * level. The switch below then steps over the boundary.
+		 */
+		if ((cgain == gain) && (local->state < END_STAGE))
+		{
+			switch (local->state) {
+				case STAGE_0:
+					level = param->param[LEVEL_1].float_val;
+					rate = param->param[RATE_0].float_val;
+					break;
+				case STAGE_1:
+					level = param->param[LEVEL_2].float_val;
+					rate = param->param[RATE_1].float_val;
+					break;
+				case STAGE_2:
+				case STAGE_3:
+					level = param->param[LEVEL_3].float_val;
+					rate = param->param[RATE_2].float_val;
+					break;
+				default:
+					level = param->param[LEVEL_4].float_val;
+					rate = release;
+					break;
+			}
+
+			if (current > level) {
+				count -= (run = envLinRun(current, -rate, level, count));
+				while (run-- > 0)
+					*ob++ = (current -= rate) * (cgain * BRISTOL_VPO);
+			} else if (current < level) {
+				count -= (run = envLinRun(current, rate, level, count));
+				while (run-- > 0)
+					*ob++ = (current += rate) * (cgain * BRISTOL_VPO);
+			} else if (local->state == SUSTAIN_STAGE) {
+				for (; count > 0; count--)
+					*ob++ = current * (cgain * BRISTOL_VPO);
+			}
+
+			if (count <= 0)
+				break;
+		}
+
+		count--;
+
 		switch (local->state) {
 			case STAGE_0:
 				if (current > param->param[LEVEL_1].float_val)
@@ -320,11 +375,11 @@ param->param[LEVEL_4].float_val);
 			case STAGE_4:
 				if (current > param->param[LEVEL_4].float_val)
 				{
-					if ((*ob = (current -= param->param[RATE_3].float_val))
+					if ((*ob = (current -= release))
 						< param->param[LEVEL_4].float_val)
 						local->state++;
 				} else {
-					if ((*ob = (current += param->param[RATE_3].float_val))
+					if ((*ob = (current += release))
 						>= param->param[LEVEL_4].float_val)
 						local->state++;
 				}
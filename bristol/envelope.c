@@ -36,6 +36,7 @@
 #include <math.h>
 #include "bristol.h"
 #include "envelope.h"
+#include "envrun.h"
 
 /*
  * The name of this operator, IO count, and IO names.
@@ -204,7 +205,7 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 {
 	register bristolENVlocal *local = lcl;
 	register float cgain, attack, decay, sustain, release, *ob, gain, egain;
-	register int count, rampup = -1;
+	register int count, rampup = -1, retrigger = 0, run;
 	bristolENV *specs;
 
 	specs = (bristolENV *) operator->specs;
@@ -257,6 +258,12 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 	sustain = 1.0 + param->param[2].float_val;
 	release = param->param[3].float_val;
 
+	/*
+	 * Stolen voices halve cgain in BRISTOL_STEAL_TIME or faster.
+	 */
+	if ((voice->flags & BRISTOL_KEYSTEAL) && (release > specs->steal))
+		release = specs->steal;
+
 	/*
 	 * Adjust the gain depending on the key velocity, and include both channel
 	 * and polypressure - we will typically have one or the other, but both
@@ -347,10 +354,21 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 			ob += voice->offset;
 			count -= voice->offset;
 		}
-	} else if (voice->flags & BRISTOL_KEYREON)
-		local->cstate = STATE_ATTACK;
+	} else if (voice->flags & BRISTOL_KEYREON) {
+		/*
+		 * A retrigger with an offset, typically an arpeggiator step inside
+		 * the period. Let the current stage run up to the offset and then go
+		 * into the attack from there.
+		 */
+		if ((voice->offset > 0) && (voice->offset < count))
+		{
+			retrigger = count - voice->offset;
+			count = voice->offset;
+		} else
+			local->cstate = STATE_ATTACK;
+	}
 
-	if (voice->flags & (BRISTOL_KEYON|BRISTOL_KEYREON))
+	if ((voice->flags & (BRISTOL_KEYON|BRISTOL_KEYREON)) && (retrigger == 0))
 	{
 		/*
 		 * This accepts note on offsets from Jack. Note off offsets will be
@@ -369,15 +387,37 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 	 * We need some state indicator to say when we are leading into the attack.
 	 * This is actually in the MIDI voice structure, but we do not have access
 	 * to this. We should assume that a MIDI event sets our cstate as necessary?
+	 *
+	 * Each segment is first rendered for as many samples as envExpRun() or
+	 * envLinRun() say cannot reach its end, the per sample loops then take it
+	 * over the boundary. They also do any egain ramp.
 	 */
-	while (count > 0)
+	while ((count > 0) || (retrigger > 0))
 	{
+		if (count <= 0)
+		{
+			count = retrigger;
+			retrigger = 0;
+
+			if (param->param[6].float_val != 0)
+				cgain = 1.0;
+
+			local->cstate = STATE_ATTACK;
+			voice->flags &= ~(BRISTOL_KEYDONE|BRISTOL_KEYOFFING);
+		}
+
 		switch (local->cstate)
 		{
 			case STATE_RELEASE:
 				/*
 				 * Assume key off - start releasing gain.
 				 */
+				if (rampup < 0)
+				{
+					count -= (run = envExpRun(cgain, release, 1.0f, count));
+					while (run-- > 0)
+						*ob++ = ((cgain *= release) - 1) * egain;
+				}
 				while (cgain > 1.0)
 				{
 					if (count-- > 0)
@@ -418,6 +458,13 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 				 * Just triggered - start attack ramp from current gain level.
 				 */
 				if (specs->flags & LINEAR_ATTACK) {
+					if (rampup < 0)
+					{
+						count -= (run = envLinRun(cgain, attack,
+							BRISTOL_VPO, count));
+						while (run-- > 0)
+							*ob++ = ((cgain += attack) - 1) * egain;
+					}
 					while (cgain < BRISTOL_VPO)
 					{
 						if (count-- > 0)
@@ -442,6 +489,13 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 						}
 					}
 				} else {
+					if (rampup < 0)
+					{
+						count -= (run = envExpRun(cgain, attack,
+							BRISTOL_VPO, count));
+						while (run-- > 0)
+							*ob++ = ((cgain *= attack) - 1) * egain;
+					}
 					while (cgain < BRISTOL_VPO)
 					{
 						if (count-- > 0)
@@ -479,6 +533,12 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 				/*
 				 * Decay state. Ramp down to sustain level.
 				 */
+				if (rampup < 0)
+				{
+					count -= (run = envExpRun(cgain, decay, sustain, count));
+					while (run-- > 0)
+						*ob++ = ((cgain *= decay) - 1) * egain;
+				}
 				while (cgain > sustain)
 				{
 					if (count-- > 0)
@@ -511,6 +571,13 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 				 * Sustain - fixed output signal.
 				 */
 				cgain = sustain;
+				if (rampup < 0)
+				{
+					for (; count > 0; count--)
+						*ob++ = (sustain - 1) * egain;
+					voice->flags &= ~(BRISTOL_KEYDONE);
+					break;
+				}
 				while (count-- > 0)
 				{
 					*ob++ = (sustain - 1) * egain;
@@ -582,6 +649,7 @@ envinit(bristolOP **operator, int index, int samplerate, int samplecount)
 
 	specs = (bristolENV *) bristolmalloc0(sizeof(bristolENV));
 	specs->samplerate = samplerate;
+	specs->steal = powf(0.5f, 1.0f / (BRISTOL_STEAL_TIME * samplerate));
 	specs->duration = BRISTOL_RAMP_RATE;
 #ifdef BRISTOL_LIN_ATTACK
 	specs->flags |= LINEAR_ATTACK;
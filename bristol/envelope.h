@@ -36,6 +36,7 @@ typedef struct BristolENV {
 	float samplerate;
 	float duration;
 	unsigned int flags;
+	float steal; /* Release rate for stolen voices */
 } bristolENV;
 
 typedef struct BristolENVlocal {
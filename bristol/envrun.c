@@ -0,0 +1,93 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Segment lengths for the envelopes. An envelope normally spends the whole
+ * period in one segment, so rather than test the state, the target and the
+ * sample count on every sample the operators ask how many steps remain before
+ * the segment could end, render that many with nothing but the step, and only
+ * go back to their per sample code for the last few samples of a segment.
+ *
+ * The steps are still taken one after another with the same float arithmetic,
+ * the curves are exactly what the state machines always produced. The counts
+ * are therefore conservative: they allow for the rounding that accumulates
+ * over the run so that no step they cover could have crossed the target.
+ */
+
+#include <math.h>
+
+/* Relative rounding error of one float operation */
+#define ENV_ROUNDING (1.0 / 16777216.0)
+
+/*
+ * Number of steps, up to count, that 'c *= rate' can take with every result
+ * still strictly on the starting side of target.
+ */
+int
+envExpRun(float c, float rate, float target, int count)
+{
+	double steps, lrate;
+
+	if ((c <= 0) || (target <= 0) || (rate <= 0) || (rate == 1.0f))
+		return(0);
+
+	if ((rate < 1.0f)? (c <= target):(c >= target))
+		return(0);
+
+	lrate = fabs(log((double) rate));
+	steps = fabs(log((double) target / c)) / lrate;
+
+	/* Each multiply may be off by a rounding in the log domain */
+	steps -= steps * 2 * ENV_ROUNDING / lrate + 2;
+
+	if (!(steps > 0))
+		return(0);
+	if (steps < count)
+		return((int) steps);
+	return(count);
+}
+
+/*
+ * Number of steps, up to count, that 'c += step' can take with every result
+ * still strictly on the starting side of target. Use a negative step for
+ * segments that fall.
+ */
+int
+envLinRun(float c, float step, float target, int count)
+{
+	double steps, scale;
+
+	if ((step == 0) || ((step > 0)? (c >= target):(c <= target)))
+		return(0);
+
+	/* Each add may be off by half a unit at the largest value we pass */
+	scale = fabs(c) > fabs(target)? fabs(c):fabs(target);
+	steps = (target - (double) c) / step;
+
+	steps -= steps * 2 * scale * ENV_ROUNDING / fabs(step) + 2;
+
+	if (!(steps > 0))
+		return(0);
+	if (steps < count)
+		return((int) steps);
+	return(count);
+}
+
@@ -59,7 +59,6 @@ static float note_diff;
 #define DCO_WAVE_COUNT 6
 
 static void fillWave();
-static float *sbuf = NULL;
 
 /*
  * Reset any local memory information.
@@ -73,17 +72,18 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
-	bristolfree(((bristolEXPDCO *) operator)->wave[0]);
-	bristolfree(((bristolEXPDCO *) operator)->wave[1]);
-	bristolfree(((bristolEXPDCO *) operator)->wave[2]);
-	bristolfree(((bristolEXPDCO *) operator)->wave[3]);
-	bristolfree(((bristolEXPDCO *) operator)->wave[4]);
-	bristolfree(((bristolEXPDCO *) operator)->wave[5]);
-	bristolfree(((bristolEXPDCO *) operator)->wave[6]);
-	bristolfree(((bristolEXPDCO *) operator)->wave[7]);
-
-	bristolfree(((bristolEXPDCO *) operator)->null);
-
+	bristolfree(((bristolEXPDCO *) operator->specs)->wave[0]);
+	bristolfree(((bristolEXPDCO *) operator->specs)->wave[1]);
+	bristolfree(((bristolEXPDCO *) operator->specs)->wave[2]);
+	bristolfree(((bristolEXPDCO *) operator->specs)->wave[3]);
+	bristolfree(((bristolEXPDCO *) operator->specs)->wave[4]);
+	bristolfree(((bristolEXPDCO *) operator->specs)->wave[5]);
+	bristolfree(((bristolEXPDCO *) operator->specs)->wave[6]);
+	bristolfree(((bristolEXPDCO *) operator->specs)->wave[7]);
+
+	bristolfree(((bristolEXPDCO *) operator->specs)->null);
+
+	bristolfree(((bristolEXPDCO *) operator->specs)->sbuf);
 	bristolfree(operator->specs);
 
 	/*
@@ -106,13 +106,16 @@ static int reset(bristolOP *operator, bristolOPParams *param)
 	/* The use of 1, 3 and 4 may make things clear later */
 	if (param->param[1].mem != NULL)
 		bristolfree(param->param[1].mem);
-	param->param[1].mem = bristolmalloc0(sizeof(float) * EXPDCO_WAVE_SZE);
+	param->param[1].mem = bristolmalloc0(sizeof(float)
+		* (EXPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
 	if (param->param[3].mem != NULL)
 		bristolfree(param->param[3].mem);
-	param->param[3].mem = bristolmalloc0(sizeof(float) * EXPDCO_WAVE_SZE);
+	param->param[3].mem = bristolmalloc0(sizeof(float)
+		* (EXPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
 	if (param->param[4].mem != NULL)
 		bristolfree(param->param[4].mem);
-	param->param[4].mem = bristolmalloc0(sizeof(float) * EXPDCO_WAVE_SZE);
+	param->param[4].mem = bristolmalloc0(sizeof(float)
+		* (EXPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
 
 	param->param[0].float_val = 0;
 	param->param[1].float_val = 0.5;
@@ -255,13 +258,16 @@ static int operate(bristolOP *operator,
 	void *lcl)
 {
 	bristolEXPDCOlocal *local = lcl;
-	register int obp, count, cpwm, wdelta;
-	register float *ib, *ob, *sb, *mb, *wt1, *wt2, wtp, gdelta, ssg, *sob, *wt3;
+	register int obp, count, cpwm, wdelta, shift;
+	register float *ib, *ob, *sb, *mb, *wt1, *wt2, gdelta, ssg, *sob, *wt3;
 	register float gain, gain1, gain2, transp;
 	register float wave, wform, lsv;
 	bristolEXPDCO *specs;
+	bristolPhase phase;
+	float *sbuf;
 
 	specs = (bristolEXPDCO *) operator->specs;
+	sbuf = specs->sbuf;
 
 #ifdef BRISTOL_DBG
 	printf("dco(%x, %x, %x)\n", operator, param, local);
@@ -284,7 +290,8 @@ static int operate(bristolOP *operator,
 	gain = param->param[3].float_val;
 
 	transp = param->param[1].float_val * param->param[2].float_val;
-	wtp = local->wtp;
+	shift = waveCoreShift(EXPDCO_WAVE_SZE);
+	phase = local->phase;
 	cpwm = local->cpwm;
 	ssg = local->ssg >= 0? gain:-gain;
 
@@ -311,6 +318,9 @@ static int operate(bristolOP *operator,
 		bcopy(specs->wave[4], param->param[4].mem,
 			EXPDCO_WAVE_SZE * sizeof(float));
 	}
+	waveCoreGuard(param->param[1].mem, EXPDCO_WAVE_SZE);
+	waveCoreGuard(param->param[3].mem, EXPDCO_WAVE_SZE);
+	waveCoreGuard(param->param[4].mem, EXPDCO_WAVE_SZE);
 
 	/*
 	 * Go jumping through the wavetable, with each jump defined by the value
@@ -333,8 +343,8 @@ static int operate(bristolOP *operator,
 		 * May extend this to include the jagged edged ramp? Good for stringy
 		 * sounds.
 		 */
-		wdelta = (int) wtp;
-		gdelta = wtp - ((float) wdelta);
+		wdelta = phase >> shift;
+		gdelta = waveCoreFrac(phase, shift);
 
 		/*
 		 * If we do not have a modbuf, don't even bother doing this.
@@ -343,10 +353,7 @@ static int operate(bristolOP *operator,
 			wform = 0;
 
 		/* This generates the sync buffer */
-		if (wtp >= EXPDCO_WAVE_SZE_M)
-			sob[obp] = (wt3[wdelta] + (wt3[0] - wt3[wdelta]) * gdelta);
-		else
-			sob[obp] = (wt3[wdelta] + (wt3[wdelta + 1] - wt3[wdelta]) * gdelta);
+		sob[obp] = (wt3[wdelta] + (wt3[wdelta + 1] - wt3[wdelta]) * gdelta);
 
 		if (wform <= 0.33)
 		{
@@ -359,19 +366,12 @@ static int operate(bristolOP *operator,
 			gain1 = (1.0 - gain2) * gain;
 			gain2 *= gain;
 
-			if (wtp >= EXPDCO_WAVE_SZE_M)
-				ob[obp] += (wt1[wdelta]
-					+ (wt1[0] - wt1[wdelta]) * gdelta)
-						* gain1
-					+ (wt2[wdelta] + (wt2[0] - wt2[wdelta]) * gdelta)
-						* gain2;
-			else
-				ob[obp] += (wt1[wdelta]
-					+ (wt1[wdelta + 1] - wt1[wdelta]) * gdelta)
-						* gain1
-					+ (wt2[wdelta]
-						+ (wt2[wdelta + 1] - wt2[wdelta]) * gdelta)
-						* gain2;
+			ob[obp] += (wt1[wdelta]
+				+ (wt1[wdelta + 1] - wt1[wdelta]) * gdelta)
+					* gain1
+				+ (wt2[wdelta]
+					+ (wt2[wdelta + 1] - wt2[wdelta]) * gdelta)
+					* gain2;
 		} else if (wform <= 0.66) {
 			/*
 			 * Crossfade ramp into square, however I want the square to be
@@ -383,26 +383,19 @@ static int operate(bristolOP *operator,
 			gain1 = (1.0 - gain2) * gain;
 			gain2 *= ssg;
 
-			if (wtp >= EXPDCO_WAVE_SZE_M)
-				ob[obp] += (wt1[wdelta]
-					+ (wt1[0] - wt1[wdelta]) * gdelta)
-						* gain1
-					+ (wt2[wdelta] + (wt2[0] - wt2[wdelta]) * gdelta)
-						* gain2;
-			else
-				ob[obp] += (wt1[wdelta]
-					+ (wt1[wdelta + 1] - wt1[wdelta]) * gdelta)
-						* gain1
-					+ (wt2[wdelta]
-						+ (wt2[wdelta + 1] - wt2[wdelta]) * gdelta)
-						* gain2;
+			ob[obp] += (wt1[wdelta]
+				+ (wt1[wdelta + 1] - wt1[wdelta]) * gdelta)
+					* gain1
+				+ (wt2[wdelta]
+					+ (wt2[wdelta + 1] - wt2[wdelta]) * gdelta)
+					* gain2;
 		} else {
 			/*
 			 * This is for a variable pulse width, reuse gain1 as width.
 			 */
 			gain1 = EXPDCO_WAVE_SZE_2 - (wform - 0.66) * EXPDCO_WAVE_SZE_3;
 
-			if (wtp >= gain1)
+			if (waveCorePos(phase, shift) >= gain1)
 			{
 				/*
 				 * This creates a pulse width modulated square wave, with a
@@ -422,26 +415,19 @@ static int operate(bristolOP *operator,
 		if (sb && (sb[obp] != 0))
 		{
 			ssg = -ssg;
-			wtp = sb[obp];
+			phase = waveCorePhase(sb[obp], shift);
 			continue;
 		}
 
 		/*
 		 * Move the wavetable pointer forward by amount indicated in input 
-		 * buffer for this sample.
+		 * buffer for this sample, it wraps by itself in either direction.
 		 */
-		if ((wtp += ib[obp] * transp) >= EXPDCO_WAVE_SZE)
-			wtp -= EXPDCO_WAVE_SZE;
-		/*
-		 * If we have gone negative, round back up. Allows us to run the 
-		 * oscillator backwards.
-		 */
-		if (wtp < 0)
-			wtp += EXPDCO_WAVE_SZE;
+		phase += waveCoreStep(ib[obp] * transp, shift);
 	}
 
 /*printf("%f\n", gain1); */
-	local->wtp = wtp;
+	local->phase = phase;
 	local->cpwm = cpwm;
 	local->ssg = ssg;
 
@@ -466,9 +452,6 @@ expdcoinit(bristolOP **operator, int index, int samplerate, int samplecount)
 
 	note_diff = pow(2, ((double) 1)/12);
 
-	if (sbuf == NULL)
-		sbuf = bristolmalloc(sizeof(float) * samplecount);
-
 	/*
 	 * Then the local parameters specific to this operator. These will be
 	 * the same for each operator, but must be init'ed in the local code.
@@ -482,6 +465,8 @@ expdcoinit(bristolOP **operator, int index, int samplerate, int samplecount)
 	(*operator)->specs = (bristolOPSpec *) specs;
 	(*operator)->size = sizeof(bristolEXPDCO);
 
+	specs->sbuf = bristolmalloc(sizeof(float) * samplecount);
+
 	specs->null = bristolmalloc(sizeof(float) * samplecount);
 
 	/*
@@ -498,27 +483,43 @@ expdcoinit(bristolOP **operator, int index, int samplerate, int samplecount)
 	 * We are going to assign multiple waves to this oscillator.
 	 * sine, ramp, square, triangle?
 	 */
-	specs->wave[0] = (float *) bristolmalloc(EXPDCO_WAVE_SZE * sizeof(float));
-	specs->wave[1] = (float *) bristolmalloc(EXPDCO_WAVE_SZE * sizeof(float));
-	specs->wave[2] = (float *) bristolmalloc(EXPDCO_WAVE_SZE * sizeof(float));
-	specs->wave[3] = (float *) bristolmalloc(EXPDCO_WAVE_SZE * sizeof(float));
-	specs->wave[4] = (float *) bristolmalloc(EXPDCO_WAVE_SZE * sizeof(float));
-	specs->wave[5] = (float *) bristolmalloc(EXPDCO_WAVE_SZE * sizeof(float));
-	specs->wave[6] = (float *) bristolmalloc(EXPDCO_WAVE_SZE * sizeof(float));
-	specs->wave[7] = (float *) bristolmalloc(EXPDCO_WAVE_SZE * sizeof(float));
+	specs->wave[0] = (float *) bristolmalloc(sizeof(float)
+		* (EXPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[1] = (float *) bristolmalloc(sizeof(float)
+		* (EXPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[2] = (float *) bristolmalloc(sizeof(float)
+		* (EXPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[3] = (float *) bristolmalloc(sizeof(float)
+		* (EXPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[4] = (float *) bristolmalloc(sizeof(float)
+		* (EXPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[5] = (float *) bristolmalloc(sizeof(float)
+		* (EXPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[6] = (float *) bristolmalloc(sizeof(float)
+		* (EXPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[7] = (float *) bristolmalloc(sizeof(float)
+		* (EXPDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
 
 	/*
 	 * FillWave is something that should be called as a parameter change, but
 	 * for testing will load it here.
 	 */
 	fillWave(specs->wave[0], EXPDCO_WAVE_SZE, 0);
+	waveCoreGuard(specs->wave[0], EXPDCO_WAVE_SZE);
 	fillWave(specs->wave[1], EXPDCO_WAVE_SZE, 1);
+	waveCoreGuard(specs->wave[1], EXPDCO_WAVE_SZE);
 	fillWave(specs->wave[2], EXPDCO_WAVE_SZE, 2);
+	waveCoreGuard(specs->wave[2], EXPDCO_WAVE_SZE);
 	fillWave(specs->wave[3], EXPDCO_WAVE_SZE, 3);
+	waveCoreGuard(specs->wave[3], EXPDCO_WAVE_SZE);
 	fillWave(specs->wave[4], EXPDCO_WAVE_SZE, 4);
+	waveCoreGuard(specs->wave[4], EXPDCO_WAVE_SZE);
 	fillWave(specs->wave[5], EXPDCO_WAVE_SZE, 5);
+	waveCoreGuard(specs->wave[5], EXPDCO_WAVE_SZE);
 	fillWave(specs->wave[6], EXPDCO_WAVE_SZE, 6);
+	waveCoreGuard(specs->wave[6], EXPDCO_WAVE_SZE);
 	fillWave(specs->wave[7], EXPDCO_WAVE_SZE, 7);
+	waveCoreGuard(specs->wave[7], EXPDCO_WAVE_SZE);
 
 	/*
 	 * Now fill in the dco specs for this operator. These are specific to an
@@ -22,6 +22,8 @@
 #ifndef EXPDCO_H
 #define EXPDCO_H
 
+#include "wavecore.h"
+
 #define EXPDCO_WAVE_SZE 1024
 #define EXPDCO_WAVE_SZE_M 1023
 #define EXPDCO_WAVE_SZE_2 512
@@ -32,12 +34,13 @@
 typedef struct BristolEXPDCO {
 	bristolOPSpec spec;
 	float *wave[8];
+	float *sbuf;
 	float *null;
 } bristolEXPDCO;
 
 typedef struct BristolEXPDCOlocal {
 	unsigned int flags;
-	float wtp;
+	bristolPhase phase;
 	float note_diff;
 	int tune_diff;
 	float cpwm;
@@ -0,0 +1,518 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Feedback delay network reverb. The older reverb.c runs six prime length
+ * lines with a hand wired feedback/crossover arrangement, this one runs 4, 8
+ * or 16 lines through a Hadamard matrix so that every line feeds every other
+ * line with equal energy. The matrix is orthogonal so the loop is lossless
+ * and the decay time is set by the per line gains alone. Each line has a one
+ * pole damping filter and a slowly modulated read tap which breaks up the
+ * metallic ringing that fixed length lines give.
+ *
+ * The parameters 0 to 5 follow reverb.c so that the emulations can use either
+ * operator with the same controller code, setting param[0].int_val flags the
+ * line lengths for recalculation.
+ */
+
+/*#define DEBUG */
+
+#include <math.h>
+
+#include "bristol.h"
+#include "fdnreverb.h"
+
+#define DELAY		0
+#define FEEDBACK	1
+#define CROSSOVER	2
+#define WET			3
+#define RIGHT		4
+#define LEFT		5
+#define QUALITY		6
+#define MODULATION	7
+#define DAMPING		8
+
+#define OPNAME "FDN Reverb"
+#define OPDESCRIPTION "Stereo feedback delay network reverb"
+#define PCOUNT 9
+#define IOCOUNT 4
+
+#define FDNREVERB_IN 0
+#define FDNREVERB_IN2 1
+#define FDNREVERB_OUT 2
+#define FDNREVERB_OUT2 3
+
+#define FDN_DENORMAL 1e-20f
+
+/*
+ * Line lengths in samples at 44.1kHz, all prime. The smaller networks take
+ * every second or fourth entry so they still cover the whole range.
+ */
+static int fdnprimes[FDN_LINES] = {
+	1031, 1153, 1277, 1399, 1523, 1663, 1801, 1949,
+	2099, 2251, 2411, 2579, 2749, 2927, 3109, 3301
+};
+
+static float srate = 44100;
+
+/* Modulation phasor rotation per control block, one rate per line */
+static float mrc[FDN_LINES], mrs[FDN_LINES];
+
+static int destroy(bristolOP *operator)
+{
+#ifdef BRISTOL_DBG
+	printf("destroy(%x)\n", operator);
+#endif
+
+	bristolfree(operator->specs);
+
+	cleanup(operator);
+	return(0);
+}
+
+static int param(bristolOP *operator, bristolOPParams *param,
+	unsigned char index, float value)
+{
+#ifdef DEBUG
+	printf("checkParams(%i, %f)\n", index, value);
+#endif
+
+	switch (index) {
+		case DELAY:
+			param->param[index].float_val = value;
+			param->param[index].int_val = 1;
+			break;
+		case QUALITY:
+			if ((param->param[index].int_val = value * CONTROLLER_RANGE) > 2)
+				param->param[index].int_val = 2;
+			param->param[DELAY].int_val = 1;
+			break;
+		default:
+			param->param[index].float_val = value;
+			break;
+	}
+
+	return(0);
+}
+
+static int reset(bristolOP *operator, bristolOPParams *param)
+{
+#ifdef BRISTOL_DBG
+	printf("reset(%x)\n", operator);
+#endif
+
+	if (param->param[0].mem)
+		bristolfree(param->param[0].mem);
+
+	param->param[0].mem = bristolmalloc0(sizeof(float) * FDN_DMAX * FDN_LINES);
+
+	param->param[DELAY].float_val = 0.3;
+	param->param[DELAY].int_val = 1;
+	param->param[FEEDBACK].float_val = 0.6;
+	param->param[CROSSOVER].float_val = 0.5;
+	param->param[WET].float_val = 0.5;
+	param->param[RIGHT].float_val = 1.0;
+	param->param[LEFT].float_val = 1.0;
+	param->param[QUALITY].int_val = 0; /* 4 lines, emulations can ask for more */
+	param->param[MODULATION].float_val = 0.3;
+	param->param[DAMPING].float_val = 0.3;
+	return(0);
+}
+
+/*
+ * Line lengths from the size parameter and the quality. If the line count
+ * changed then the old history is of no use and gets cleared.
+ */
+static void
+fdnconfigure(bristolFDNREVERBlocal *local, bristolOPParams *param,
+float *history)
+{
+	int i, lines = 4 << param->param[QUALITY].int_val;
+	float size = 0.3 + 1.7 * param->param[DELAY].float_val;
+
+	param->param[DELAY].int_val = 0;
+
+	if ((lines != local->lines) || (~local->flags & FDN_INIT))
+	{
+		bristolbzero(history, sizeof(float) * FDN_DMAX * FDN_LINES);
+
+		for (i = 0; i < FDN_LINES; i++)
+		{
+			local->lp[i] = local->mod[i] = local->dmod[i] = 0;
+			local->mc[i] = cosf(i * 2.0f * M_PI / FDN_LINES);
+			local->ms[i] = sinf(i * 2.0f * M_PI / FDN_LINES);
+		}
+
+		local->lines = lines;
+		local->wp = 0;
+		local->flags |= FDN_INIT;
+	}
+
+	for (i = 0; i < lines; i++)
+	{
+		local->length[i] = fdnprimes[i * FDN_LINES / lines]
+			* size * srate / 44100.0f;
+		if (local->length[i] > FDN_DMAX - FDN_MODMAX - 2)
+			local->length[i] = FDN_DMAX - FDN_MODMAX - 2;
+	}
+
+	/* Force the gains to follow the new lengths */
+	local->decay = -1;
+
+#ifdef DEBUG
+	printf("fdn %i lines size %f: %f to %f\n", lines, size,
+		local->length[0], local->length[lines - 1]);
+#endif
+}
+
+/*
+ * Hadamard butterflies across the lines, each row is a control block of
+ * samples so the inner loop is a plain vector add/subtract. Not normalised,
+ * the 1/sqrt(lines) is folded into the line gains.
+ */
+static void
+fdnhadamard(float x[FDN_LINES][BRISTOL_SMOOTH_BLOCK], int lines, int n)
+{
+	int h, i, j, k;
+	float a, b;
+
+	for (h = 1; h < lines; h <<= 1)
+		for (i = 0; i < lines; i += h << 1)
+			for (j = i; j < i + h; j++)
+				for (k = 0; k < n; k++)
+				{
+					a = x[j][k];
+					b = x[j + h][k];
+					x[j][k] = a + b;
+					x[j + h][k] = a - b;
+				}
+}
+
+/*
+ * The shortest line is well over a control block long so a whole block can be
+ * read out of the lines before any of it is written back. That lets the work
+ * go line by line and then sample by sample across the lines rather than
+ * dealing with every line for each sample.
+ */
+static int operate(bristolOP *operator,
+	bristolVoice *voice,
+	bristolOPParams *param,
+	void *lcl)
+{
+	bristolFDNREVERB *specs;
+	bristolFDNREVERBlocal *local = (bristolFDNREVERBlocal *) lcl;
+	float *lin, *rin, *lout, *rout, *history, *line;
+	float x[FDN_LINES][BRISTOL_SMOOTH_BLOCK];
+	float wl[BRISTOL_SMOOTH_BLOCK], wr[BRISTOL_SMOOTH_BLOCK];
+	float al[BRISTOL_SMOOTH_BLOCK], ar[BRISTOL_SMOOTH_BLOCK];
+	float send, spread, lgain, rgain, depth, damp, undamp, decay, norm;
+	float t[BRISTOL_SMOOTH_BLOCK], a, b, d, m, dm, g;
+	int count, lines, i, k, n, id, wp;
+
+	specs = (bristolFDNREVERB *) operator->specs;
+	history = param->param[0].mem;
+
+	if ((param->param[DELAY].int_val) || (~local->flags & FDN_INIT))
+		fdnconfigure(local, param, history);
+
+	count = specs->spec.io[FDNREVERB_IN].samplecount;
+	lin = specs->spec.io[FDNREVERB_IN].buf;
+	rin = specs->spec.io[FDNREVERB_IN2].buf;
+	lout = specs->spec.io[FDNREVERB_OUT].buf;
+	rout = specs->spec.io[FDNREVERB_OUT2].buf;
+
+	lines = local->lines;
+	norm = 1.0f / sqrtf(lines);
+
+	/*
+	 * Feedback maps to a decay time of 0.1 to 5 seconds. Each line loses
+	 * 60dB in that time whatever its length.
+	 */
+	decay = 0.1f + param->param[FEEDBACK].float_val
+		* param->param[FEEDBACK].float_val * 4.9f;
+	if (decay != local->decay)
+	{
+		for (i = 0; i < lines; i++)
+			local->gain[i] = norm
+				* powf(10.0f, -3.0f * local->length[i] / (decay * srate));
+		local->decay = decay;
+	}
+
+	send = param->param[WET].float_val;
+	spread = param->param[CROSSOVER].float_val * 0.5f;
+	lgain = param->param[LEFT].float_val * norm;
+	rgain = param->param[RIGHT].float_val * norm;
+	depth = param->param[MODULATION].float_val * FDN_MODMAX * 0.5f;
+	damp = 1.0f - param->param[DAMPING].float_val * 0.9f;
+	undamp = 1.0f - damp;
+
+	wp = local->wp;
+
+	for (; count > 0; count -= n)
+	{
+		if ((n = count) > BRISTOL_SMOOTH_BLOCK)
+			n = BRISTOL_SMOOTH_BLOCK;
+
+		/*
+		 * Read taps with linear interpolation, decay and damping. The tap
+		 * modulation is evaluated once per block and ramped across it.
+		 */
+		for (i = 0; i < lines; i++)
+		{
+			a = local->mc[i] * mrc[i] - local->ms[i] * mrs[i];
+			b = local->ms[i] * mrc[i] + local->mc[i] * mrs[i];
+			/* Keep the phasor on the unit circle */
+			d = 1.5f - 0.5f * (a * a + b * b);
+			local->mc[i] = a * d;
+			local->ms[i] = b * d;
+
+			/*
+			 * The tap moves by a small fraction of a sample over a block so
+			 * the integer part is taken once at the start of the block and
+			 * the fraction ramps from there, it may stray just outside 0..1.
+			 * The taps are then contiguous and the interpolation vectorises.
+			 */
+			line = &history[i * FDN_DMAX];
+			m = local->mod[i];
+			dm = ((1.0f + local->ms[i]) * depth - m) / n;
+			d = local->length[i] + m + dm;
+			id = (int) d;
+			d -= id;
+			id = (wp - id) & FDN_MASK;
+
+			if ((id > 0) && (id + n <= FDN_DMAX))
+			{
+				line += id;
+				for (k = 0; k < n; k++)
+					t[k] = line[k] + (line[k - 1] - line[k]) * (d + dm * k);
+			} else {
+				for (k = 0; k < n; k++)
+				{
+					a = line[(id + k) & FDN_MASK];
+					b = line[(id + k - 1) & FDN_MASK];
+					t[k] = a + (b - a) * (d + dm * k);
+				}
+			}
+
+			g = local->gain[i] * damp;
+			for (k = 0; k < n; k++)
+				x[i][k] = t[k] * g;
+
+			local->mod[i] = m + dm * n;
+		}
+
+		/*
+		 * Damping is a one pole per line, that is a serial dependency through
+		 * the block so it is run across the lines for each sample instead.
+		 */
+		for (k = 0; k < n; k++)
+			for (i = 0; i < lines; i++)
+				x[i][k] = (local->lp[i] = x[i][k] + local->lp[i] * undamp);
+
+		/* Even lines go left, odd ones right, alternating sign */
+		for (k = 0; k < n; k++)
+		{
+			wl[k] = x[0][k] - x[2][k];
+			wr[k] = x[1][k] - x[3][k];
+		}
+		for (i = 4; i < lines; i += 4)
+			for (k = 0; k < n; k++)
+			{
+				wl[k] += x[i][k] - x[i + 2][k];
+				wr[k] += x[i + 1][k] - x[i + 3][k];
+			}
+
+		fdnhadamard(x, lines, n);
+
+		for (k = 0; k < n; k++)
+		{
+			al[k] = (lin[k] + (rin[k] - lin[k]) * spread) * send + FDN_DENORMAL;
+			ar[k] = (rin[k] + (lin[k] - rin[k]) * spread) * send + FDN_DENORMAL;
+		}
+
+		if (wp + n <= FDN_DMAX)
+		{
+			for (i = 0; i < lines; i += 2)
+			{
+				line = &history[i * FDN_DMAX + wp];
+				for (k = 0; k < n; k++)
+				{
+					line[k] = x[i][k] + al[k];
+					line[k + FDN_DMAX] = x[i + 1][k] + ar[k];
+				}
+			}
+		} else {
+			for (i = 0; i < lines; i += 2)
+			{
+				line = &history[i * FDN_DMAX];
+				for (k = 0; k < n; k++)
+				{
+					line[(wp + k) & FDN_MASK] = x[i][k] + al[k];
+					line[((wp + k) & FDN_MASK) + FDN_DMAX] = x[i + 1][k] + ar[k];
+				}
+			}
+		}
+
+		wp = (wp + n) & FDN_MASK;
+
+		/* Same dry level as reverb.c */
+		for (k = 0; k < n; k++)
+		{
+			*lout++ = *lin++ * 0.5f + wl[k] * lgain;
+			*rout++ = *rin++ * 0.5f + wr[k] * rgain;
+		}
+	}
+
+	local->wp = wp;
+
+	return(0);
+}
+
+bristolOP *
+fdnreverbinit(bristolOP **operator, int index, int samplerate, int samplecount)
+{
+	bristolFDNREVERB *specs;
+	int i;
+
+	*operator = bristolOPinit(operator, index, samplecount);
+
+#ifdef BRISTOL_DBG
+	printf("fdnreverbinit(%x(%x), %i, %i, %i)\n",
+		operator, *operator, index, samplerate, samplecount);
+#endif
+
+	srate = samplerate;
+
+	/* Rates from 0.5 to 1.3Hz */
+	for (i = 0; i < FDN_LINES; i++)
+	{
+		mrc[i] = cosf(2.0f * M_PI * (0.5f + 0.8f * i / FDN_LINES)
+			* BRISTOL_SMOOTH_BLOCK / srate);
+		mrs[i] = sinf(2.0f * M_PI * (0.5f + 0.8f * i / FDN_LINES)
+			* BRISTOL_SMOOTH_BLOCK / srate);
+	}
+
+	(*operator)->operate = operate;
+	(*operator)->destroy = destroy;
+	(*operator)->reset = reset;
+	(*operator)->param = param;
+	(*operator)->flags |= BRISTOL_FX_STEREO;
+
+	specs = (bristolFDNREVERB *) bristolmalloc0(sizeof(bristolFDNREVERB));
+	(*operator)->specs = (bristolOPSpec *) specs;
+	(*operator)->size = sizeof(bristolFDNREVERB);
+
+	specs->spec.opname = OPNAME;
+	specs->spec.description = OPDESCRIPTION;
+	specs->spec.pcount = PCOUNT;
+	specs->spec.iocount = IOCOUNT;
+	specs->spec.localsize = sizeof(bristolFDNREVERBlocal);
+
+	specs->spec.param[DELAY].pname = "size";
+	specs->spec.param[DELAY].description= "delay line lengths";
+	specs->spec.param[DELAY].type = BRISTOL_FLOAT;
+	specs->spec.param[DELAY].low = 0;
+	specs->spec.param[DELAY].high = 1;
+	specs->spec.param[DELAY].flags = BRISTOL_ROTARY|BRISTOL_SLIDER;
+
+	specs->spec.param[FEEDBACK].pname = "feedback";
+	specs->spec.param[FEEDBACK].description = "decay time";
+	specs->spec.param[FEEDBACK].type = BRISTOL_FLOAT;
+	specs->spec.param[FEEDBACK].low = 0;
+	specs->spec.param[FEEDBACK].high = 1;
+	specs->spec.param[FEEDBACK].flags = BRISTOL_ROTARY|BRISTOL_SLIDER;
+
+	specs->spec.param[CROSSOVER].pname = "crossfade";
+	specs->spec.param[CROSSOVER].description = "stereo input spread";
+	specs->spec.param[CROSSOVER].type = BRISTOL_FLOAT;
+	specs->spec.param[CROSSOVER].low = 0;
+	specs->spec.param[CROSSOVER].high = 1;
+	specs->spec.param[CROSSOVER].flags = BRISTOL_ROTARY|BRISTOL_SLIDER;
+
+	specs->spec.param[WET].pname = "depth";
+	specs->spec.param[WET].description = "wet/dry mix";
+	specs->spec.param[WET].type = BRISTOL_FLOAT;
+	specs->spec.param[WET].low = 0;
+	specs->spec.param[WET].high = 1;
+	specs->spec.param[WET].flags = BRISTOL_ROTARY|BRISTOL_SLIDER;
+
+	specs->spec.param[RIGHT].pname = "right";
+	specs->spec.param[RIGHT].description = "mix";
+	specs->spec.param[RIGHT].type = BRISTOL_FLOAT;
+	specs->spec.param[RIGHT].low = 0;
+	specs->spec.param[RIGHT].high = 1;
+	specs->spec.param[RIGHT].flags = BRISTOL_ROTARY|BRISTOL_SLIDER;
+
+	specs->spec.param[LEFT].pname = "left";
+	specs->spec.param[LEFT].description = "mix";
+	specs->spec.param[LEFT].type = BRISTOL_FLOAT;
+	specs->spec.param[LEFT].low = 0;
+	specs->spec.param[LEFT].high = 1;
+	specs->spec.param[LEFT].flags = BRISTOL_ROTARY|BRISTOL_SLIDER;
+
+	specs->spec.param[QUALITY].pname = "quality";
+	specs->spec.param[QUALITY].description = "4, 8 or 16 delay lines";
+	specs->spec.param[QUALITY].type = BRISTOL_INT;
+	specs->spec.param[QUALITY].low = 0;
+	specs->spec.param[QUALITY].high = 2;
+	specs->spec.param[QUALITY].flags = BRISTOL_ROTARY|BRISTOL_SLIDER;
+
+	specs->spec.param[MODULATION].pname = "modulation";
+	specs->spec.param[MODULATION].description = "delay modulation depth";
+	specs->spec.param[MODULATION].type = BRISTOL_FLOAT;
+	specs->spec.param[MODULATION].low = 0;
+	specs->spec.param[MODULATION].high = 1;
+	specs->spec.param[MODULATION].flags = BRISTOL_ROTARY|BRISTOL_SLIDER;
+
+	specs->spec.param[DAMPING].pname = "damping";
+	specs->spec.param[DAMPING].description = "high frequency decay";
+	specs->spec.param[DAMPING].type = BRISTOL_FLOAT;
+	specs->spec.param[DAMPING].low = 0;
+	specs->spec.param[DAMPING].high = 1;
+	specs->spec.param[DAMPING].flags = BRISTOL_ROTARY|BRISTOL_SLIDER;
+
+	specs->spec.io[FDNREVERB_IN].ioname = "left input buffer";
+	specs->spec.io[FDNREVERB_IN].description = "input signal";
+	specs->spec.io[FDNREVERB_IN].samplerate = samplerate;
+	specs->spec.io[FDNREVERB_IN].samplecount = samplecount;
+	specs->spec.io[FDNREVERB_IN].flags = BRISTOL_AC|BRISTOL_INPUT;
+
+	specs->spec.io[FDNREVERB_IN2].ioname = "right input buffer";
+	specs->spec.io[FDNREVERB_IN2].description = "input signal";
+	specs->spec.io[FDNREVERB_IN2].samplerate = samplerate;
+	specs->spec.io[FDNREVERB_IN2].samplecount = samplecount;
+	specs->spec.io[FDNREVERB_IN2].flags = BRISTOL_AC|BRISTOL_INPUT;
+
+	specs->spec.io[FDNREVERB_OUT].ioname = "left output";
+	specs->spec.io[FDNREVERB_OUT].description = "output signal";
+	specs->spec.io[FDNREVERB_OUT].samplerate = samplerate;
+	specs->spec.io[FDNREVERB_OUT].samplecount = samplecount;
+	specs->spec.io[FDNREVERB_OUT].flags = BRISTOL_AC|BRISTOL_OUTPUT;
+
+	specs->spec.io[FDNREVERB_OUT2].ioname = "right output";
+	specs->spec.io[FDNREVERB_OUT2].description = "output signal";
+	specs->spec.io[FDNREVERB_OUT2].samplerate = samplerate;
+	specs->spec.io[FDNREVERB_OUT2].samplecount = samplecount;
+	specs->spec.io[FDNREVERB_OUT2].flags = BRISTOL_AC|BRISTOL_OUTPUT;
+
+	return(*operator);
+}
+
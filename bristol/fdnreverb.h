@@ -0,0 +1,49 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FDNREVERB_H
+#define FDNREVERB_H
+
+#define FDN_LINES 16 /* Maximum, quality selects 4, 8 or 16 */
+#define FDN_DMAX 16384 /* Per line, power of two */
+#define FDN_MASK (FDN_DMAX - 1)
+#define FDN_MODMAX 12.0f /* Samples of delay modulation at full depth */
+
+#define FDN_INIT 0x01
+
+typedef struct BristolFDNREVERB {
+	bristolOPSpec spec;
+} bristolFDNREVERB;
+
+typedef struct BristolFDNREVERBlocal {
+	unsigned int flags;
+	int lines;
+	int wp; /* All the lines share one write index */
+	float decay; /* RT60 the gains were calculated for */
+	float length[FDN_LINES];
+	float gain[FDN_LINES];
+	float lp[FDN_LINES]; /* HF damping */
+	float mc[FDN_LINES], ms[FDN_LINES]; /* Delay modulation phasors */
+	float mod[FDN_LINES], dmod[FDN_LINES];
+} bristolFDNREVERBlocal;
+
+#endif /* FDNREVERB_H */
+
@@ -48,6 +48,7 @@
 #include "bristol.h"
 #include "bristolblo.h"
 #include "filter.h"
+#include "noisecore.h"
 
 /*
  * The name of this operator, IO count, and IO names.
@@ -337,14 +338,11 @@ register float gain, register int count) /* Filter loop */
 }
 
 /*
- * This looks odd being global however it is for denormal reduction, we inject
- * a stupidly small amount of noise into the huovilainen filter to give is some
- * constant signal. The noise algorithm will work over multiple voices with no
- * detrimental effect.
+ * This is for denormal reduction, we inject a stupidly small amount of noise
+ * into the huovilainen filter to give is some constant signal. The noise is
+ * the engine's shared white noise, the same the voices hear.
  */
-static float scale = 0.00000000001f;
-static int dngx1 = 0x67452301;
-static int dngx2 = 0xefcdab89;
+static float scale = 0.00000000001f * NOISECORE_INT;
 
 /*
  * filter - takes input signal and filters it according to the mod level.
@@ -355,7 +353,7 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 {
 	bristolFILTERlocal *local = lcl;
 	register int count, mode;
-	register float *ib, *ob, *mb;
+	register float *ib, *ob, *mb, *dn;
 	bristolFILTER *specs;
 	register float BLim, Res, Mod, gain;
 	register float Bout = local->Bout;
@@ -636,6 +634,8 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 
 		float lim = _f_lim;
 
+		dn = noiseCoreWhite(voice->index, count);
+
 		for (; count > 0; count--)
 		{
 			/*
@@ -658,10 +658,8 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 			k2vg = (1 - expf(-2.0 * M_PI * kfcr * kfc));
 
 			// cascade of 4 1st order sections
-			dngx1 ^= dngx2;
-			ay1  = az1 + k2vg * (TANHFEED((*ib + dngx2 * scale) * OV2
+			ay1  = az1 + k2vg * (TANHFEED((*ib + *dn++ * scale) * OV2
 				- 4*resonance*amf*kacr) - TANHF(az1));
-			dngx2 += dngx1;
 			az1  = ay1;
 
 			ay2  = az2 + k2vg *(TANHF(ay1) -TANHF(az2));
@@ -761,6 +759,8 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 //			* voice->cfreq * param->param[3].float_val / srate;
 //printf("%f %f %f\n", voice->cfreq, coff, param->param[3].float_val);
 
+		dn = noiseCoreWhite(voice->index, count);
+
 		for (; count > 0; count--)
 		{
 			/*
@@ -802,10 +802,8 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 			az5  = ay4;
 
 			// oversampling (repeat same block) and inject noise for denormals
-			dngx1 ^= dngx2;
-			ay1  = az1 + k2vg * (TANHFEED((*ib +dngx2 * scale) * OV2
+			ay1  = az1 + k2vg * (TANHFEED((*ib +*dn++ * scale) * OV2
 				- 4*resonance*amf*kacr) - TANHF(az1));
-			dngx2 += dngx1;
 			az1  = ay1;
 
 			ay2  = az2 + k2vg * (TANHF(ay1) - TANHF(az2));
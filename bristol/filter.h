@@ -26,6 +26,9 @@
 
 typedef struct BristolFILTER {
 	bristolOPSpec spec;
+	float *osin; /* Oversampled work buffers, filter2 only */
+	float *osout;
+	float *tune; /* Huovilainen tuning by cutoff, filter2 only */
 } bristolFILTER;
 
 typedef struct BristolFILTERlocal {
@@ -54,6 +57,16 @@ typedef struct BristolFILTERlocal {
 	float ay3;
 	float ay4;
 	float amf;
+
+	/* Control rate cutoff and emphasis, filter2 only */
+	bristolSmooth fcutoff;
+	bristolSmooth fresonance;
+	float coff, res; /* as used by the filter at the last sample */
+	float dcoff, dres; /* per sample ramp through this block */
+	float k2vg, kacr, dk2vg, dkacr; /* Huovilainen tuning for coff, ramped */
+	float kcoff, k2vgend, kacrend; /* Tuning cached for the block end cutoff */
+	int kfactor;
+	bristolOversample os;
 } bristolFILTERlocal;
 
 #endif /* FILTER_H */
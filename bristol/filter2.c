@@ -51,14 +51,16 @@
  *
  * 	4 Huovilainen 24dB LPF oversampling (4 is for interfunctioning with filter.c)
  *
- * 	Others will implement Huovilainen without oversampling, the oversampling
- * 	will be integrated into the engine.
+ * 	The Huovilainen filters run at baudio->oversampling times the sample
+ * 	rate through the libbristol half band resampler, see -oversample. By
+ * 	default that is 2x unless the samplerate is over 80kHz.
  */
 #include <math.h>
 
 #include "bristol.h"
 #include "bristolblo.h"
 #include "filter.h"
+#include "noisecore.h"
 
 /*
  * The name of this operator, IO count, and IO names.
@@ -74,8 +76,8 @@
 
 /* This is ugly, we should correctly pull it out of the operator template */
 static float srate;
+static int sblocks = 1;
 
-#define _f_lim_r (20000 / (sr * 2)) /* Upper limit with resampling */
 #define _f_lim (20000 / sr)
 
 #define getcoff(c, k) ((c*c)*(1.0f-k)*20000 + k*4*voice->cfreq) / srate
@@ -136,6 +138,9 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
+	bristolfree(((bristolFILTER *) operator->specs)->osin);
+	bristolfree(((bristolFILTER *) operator->specs)->osout);
+	bristolfree(((bristolFILTER *) operator->specs)->tune);
 	bristolfree(operator->specs);
 
 	/*
@@ -271,626 +276,285 @@ param(bristolOP *operator, bristolOPParams *param,
 }
 
 /*
- * This should perhaps be re-implemented. The HPF and BPF components really do
- * not seem to respond that well and better versions are required for some of
- * the emulators.
+ * Cutoff and emphasis are chased at control rate so that sweeps from the GUI
+ * or MIDI do not zipper. New notes jump straight to the current settings,
+ * returns 1 if that happened.
  */
 static int
-chamberlin(float *ib, float *mb, float *ob, bristolOPParams *param, bristolFILTERlocal *local, bristolVoice *voice, int count)
+filtertargets(bristolOPParams *param, bristolFILTERlocal *local,
+bristolVoice *voice)
 {
-	register float Mod, gain, cutoff;
-
-	/* The chamberlin */
-	register float freqcut, highpass, qres,
-		delay1 = local->delay1,
-		delay2 = local->delay2, 
-		delay3 = local->delay3,
-		delay4 = local->delay4;
-	register int hp = param->param[6].int_val;
-
-	Mod = param->param[2].float_val;
-
-	if (voice->flags & BRISTOL_KEYON)
+	if ((voice->flags & BRISTOL_KEYON)
+		|| (~local->fcutoff.flags & BRISTOL_SMOOTH_SET))
 	{
-		delay1 = 0;
-		delay2 = 0;
-		delay3 = 0;
-		delay4 = 0;
-	}
-
-	qres = 2.0f - param->param[1].float_val * 1.97f;
-	/* This needs to be 'f-sr(v/constant) */
-	gain = param->param[5].float_val * 0.01565;
-
-	/*
-	 * The following was for on/off keytracking, needs to be continuous.
-	if (param->param[3].int_val)
-		cutoff += voice->dFreq / 128.0f;
-	cutoff = param->param[0].float_val * 20000 / srate;
-	cutoff += param->param[3].float_val * voice->key.key / 512.0f;
-	 */
-	if (param->param[3].float_val == 0)
-		cutoff = param->param[0].float_val * param->param[0].float_val
-			* 20000 / srate;
-	else
-		cutoff = param->param[3].float_val * param->param[0].float_val
-			* 4 * voice->cfreq / srate;
-
-	for (; count > 0; count-=1)
-	{
-		/*
-		 * Hal Chamberlin's state variable filter. These are cascaded low
-		 * pass (rooney type) filters with feedback. They are not bad - 
-		 * they are resonant with a reasonable dB/octave, but the
-		 * resonance is not as warm as an analogue equivalent.
-		 */
-		freqcut = cutoff * 2.0f + *mb++ * Mod / 12.0f;
-
-		if (freqcut > VCF_FREQ_MAX)
-			freqcut = VCF_FREQ_MAX;
-		else if (freqcut <= 0.000001)
-			freqcut = 0.000001;
-
-		/* delay2/4 = lowpass output */
-		delay2 = delay2 + freqcut * delay1;
-
-		highpass = *ib++ * 16 - delay2 - qres * delay1;
-
-		/* delay1/3 = bandpass output */
-		delay1 = freqcut * highpass + delay1;
-
-		delay4 = delay4 + freqcut * delay3;
-		highpass = delay2 - delay4 - qres * delay3;
-		delay3 = freqcut * highpass + delay3;
-
-		/* mix filter output into output buffer */
-		switch (hp) {
-			default: /* LP */
-				*ob++ += delay4 * gain;
-				break;
-			case 1: /* BP */
-				*ob++ += delay3 * gain;
-				break;
-			case 2: /* HP */
-				*ob++ += highpass * gain;
-				break;
-		}
+		bristolSmoothInit(&local->fcutoff, param->param[0].float_val);
+		bristolSmoothInit(&local->fresonance, param->param[1].float_val);
+		return(1);
 	}
 
-	local->delay1 = delay1;
-	local->delay2 = delay2;
-	local->delay3 = delay3;
-	local->delay4 = delay4;
+	bristolSmoothTarget(&local->fcutoff, param->param[0].float_val, sblocks);
+	bristolSmoothTarget(&local->fresonance, param->param[1].float_val, sblocks);
 
 	return(0);
 }
 
-static float scale = 0.0000001; // 0.000000001;
-static int dngx1 = 0x67452301;
-static int dngx2 = 0xefcdab89;
-
-static int
-huovilainen24(float *ib, float *mb, float *ob, bristolOPParams *param, bristolFILTERlocal *local, bristolVoice *voice, int count)
+/*
+ * Start the next control block, the smoothed cutoff and emphasis are ramped
+ * per sample from where the last block left them to the given values. Both
+ * are as the filter uses them, after any scaling.
+ */
+static void
+filterblock(bristolFILTERlocal *local, float coff, float res, int snap)
 {
-	int mode = bfiltertype(voice->baudio->mixflags);
-	/*
-	 * This is an implementation of Antti Huovilainen's non-linear Moog
-	 * emulation, tweaked just slightly to align with the sometimes rather
-	 * dubious bristol signal levels (its not that they are bad, just that
-	 * historically they have used 1.0 per octave rather than +/-1.0).
-	 */
-	float az1 = local->az1;
-	float az2 = local->az2;
-	float az3 = local->az3;
-	float az4 = local->az4;
-	float ay1 = local->ay1;
-	float ay2 = local->ay2;
-	float ay3 = local->ay3;
-	float ay4 = local->ay4;
-	float amf = local->amf;
-
-	float kfc;
-	float kfcr;
-	float kacr;
-	float k2vg;
-	float coff;
-	float dng = param->param[8].float_val * scale;
-
-	float sr = srate;
-
-	float resonance = param->param[1].float_val;
-	float Mod = param->param[2].float_val * param->param[2].float_val * 0.02;
-	float mix =  param->param[7].float_val * 0.5;
-
-	/*
-	 * Cutoff is a power curve for better control at lower frequencies and
-	 * the key is used for tracking purposes, it should be possible to make
-	 * it reasonably linear at somewhere under unity
-	 *
-	 * Cutoff goes from 0 to 1.0 = Nyquist. Key tracking should be reviewed,
-	 * the value should be quite linear for the filter, 0..Nyquist
-	 *
-	 * If we take MIDI key 0 = 8Hz and 127 = 12658.22 Hz then using
-	 * our samplerate we should be able to fix some tuning:
-	 *
-	 * (voice->key.key * 12650.22 + 8) / (127 * srate)
-	 *
-	 * We want to position param[3] such that it tunes at 0.5 and can then
-	 * be notched in the GUI, hence srate/4 rather than /2.
-	 *
-	 * This still needs some work.
-	if (param->param[3].float_val == 0)
-		coff = param->param[0].float_val * param->param[0].float_val
-			* 20000 / srate;
-	else
-		coff = param->param[0].float_val * param->param[3].float_val * 4 *
-			voice->cfreq / srate;
-	 */
-	coff = getcoff(param->param[0].float_val, param->param[3].float_val);
-
-	for (; count > 0; count--)
-	{
-		/*
-		 * We should really interpret coff (the configured frequency) as
-		 * a function up to about 20kHz whatever the resampling rate.
-		 */
-		if ((kfc = coff + *mb++ * Mod) > _f_lim)
-			kfc = _f_lim;
-		else if (kfc < 0)
-			kfc = 0;
-
-		// frequency & amplitude correction
-		kfcr = kfc * ( kfc * (1.8730 * kfc + 0.4955) - 0.6490) + 0.9988;
-		kacr = kfc * (-3.9364 * kfc + 1.8409) + 0.9968;
-
-		k2vg = (1 - expf(-2.0 * M_PI * kfcr * kfc));
-
-		// cascade of 4 1st order sections
-		dngx1 ^= dngx2;
-		ay1  = az1 + k2vg * (TANHFEED((*ib + dngx2 * dng) * OV2
-			- 4*resonance*amf*kacr) - TANH(az1));
-		dngx2 += dngx1;
-		az1  = ay1;
-
-		ay2  = az2 + k2vg * (TANH(ay1) - TANH(az2));
-		az2  = ay2;
-
-		ay3  = az3 + k2vg * (TANH(ay2) - TANH(az3));
-		az3  = ay3;
-
-		ay4  = az4 + k2vg * (TANH(ay3) - TANH(az4));
-		az4  = ay4;
-
-		amf  = ay4;
-
-		/*
-		 * This remixes the different poles to give a fatter, warmer sound. The
-		 * other algorithms do a premixing of this however that prevents the
-		 * filter from resonating.
-		 */
-		*ob++ += (amf + (-ay3-az4 + ay2+az3 - ay1-az2) * mix) * V2;
-		ib++;
+	if (snap) {
+		local->coff = coff;
+		local->res = res;
+		local->dcoff = local->dres = 0;
+	} else {
+		local->dcoff = (coff - local->coff) / BRISTOL_SMOOTH_BLOCK;
+		local->dres = (res - local->res) / BRISTOL_SMOOTH_BLOCK;
 	}
-
-	local->az1 = az1;
-	local->az2 = az2;
-	local->az3 = az3;
-	local->az4 = az4;
-	local->ay1 = ay1;
-	local->ay2 = ay2;
-	local->ay3 = ay3;
-	local->ay4 = ay4;
-	local->amf = amf;
-
-	return(0);
 }
 
-static int
-huovilainen24R(float *ib, float *mb, float *ob, bristolOPParams *param, bristolFILTERlocal *local, bristolVoice *voice, int count)
+/*
+ * Huovilainen tuning for a cutoff. kfc is relative to the base samplerate and
+ * limited there, the corrections and tuning are then for the rate the filter
+ * actually runs at.
+ */
+static void
+huovtune(float kfc, float lim, int factor, float *k2vg, float *kacr)
 {
-	int mode = bfiltertype(voice->baudio->mixflags);
-	/*
-	 * This is an implementation of Antti Huovilainen's non-linear Moog
-	 * emulation, tweaked just slightly to align with the sometimes rather
-	 * dubious bristol signal levels (its not that they are bad, just that
-	 * historically they have used 1.0 per octave rather than +/-1.0).
-	 */
-	float az1 = local->az1;
-	float az2 = local->az2;
-	float az3 = local->az3;
-	float az4 = local->az4;
-	float az5 = local->az5;
-	float ay1 = local->ay1;
-	float ay2 = local->ay2;
-	float ay3 = local->ay3;
-	float ay4 = local->ay4;
-	float amf = local->amf;
-
-	float dng = param->param[8].float_val * scale;
-	float kfc;
 	float kfcr;
-	float kacr;
-	float k2vg;
-	float coff;
-
-	float sr = srate;
-
-	float resonance = param->param[1].float_val;
-	float Mod = param->param[2].float_val * param->param[2].float_val * 0.02;
-	float mix =  param->param[7].float_val * 0.5;
-
-	/*
-	 * Cutoff is a power curve for better control at lower frequencies and
-	 * the key is used for tracking purposes, it should be possible to make
-	 * it reasonably linear at somewhere under unity
-	 *
-	 * Cutoff goes from 0 to 1.0 = Nyquist. Key tracking should be reviewed,
-	 * the value should be quite linear for the filter, 0..Nyquist
-	 *
-	 * If we take MIDI key 0 = 8Hz and 127 = 12658.22 Hz then using
-	 * our samplerate we should be able to fix some tuning:
-	 *
-	 * (voice->key.key * 12650.22 + 8) / (127 * srate)
-	 *
-	 * We want to position param[3] such that it tunes at 0.5 and can then
-	 * be notched in the GUI, hence srate/4 rather than /2.
-	 *
-	 * This still needs some work.
-	if (param->param[3].float_val == 0)
-		coff = param->param[0].float_val * param->param[0].float_val
-			* 20000 / srate;
-	else
-		coff = param->param[0].float_val * param->param[3].float_val * 4 *
-			voice->cfreq / srate;
-	 */
-	coff = getcoff(param->param[0].float_val, param->param[3].float_val);
-
-	for (; count > 0; count--)
-	{
-		/*
-		 * We should really interpret coff (the configured frequency) as
-		 * a function up to about 20kHz whatever the resampling rate.
-		 */
-		if ((kfc = coff + *mb++ * Mod) > _f_lim_r)
-			kfc = _f_lim_r;
-		else if (kfc < 0)
-			kfc = 0;
-
-		// frequency & amplitude correction
-		kfcr = kfc * ( kfc * (1.8730 * kfc + 0.4955) - 0.6490) + 0.9988;
-		kacr = kfc * (-3.9364 * kfc + 1.8409)  + 0.9968;
-
-		k2vg = (1 - expf(-2.0 * M_PI * kfcr * kfc * 0.5));
-
-		ay1  = az1 + k2vg * (TANHFEED((*ib*OV2 - 4*resonance*amf*kacr))
-			- TANH(az1));
-		az1  = ay1;
-
-		ay2  = az2 + k2vg * (TANH(ay1) - TANH(az2));
-		az2  = ay2;
-
-		ay3  = az3 + k2vg * (TANH(ay2) - TANH(az3));
-		az3  = ay3;
-
-		ay4  = az4 + k2vg * (TANH(ay3) - TANH(az4));
-		az4  = ay4;
-
-		// 1/2-sample delay for phase compensation
-		amf  = (ay4+az5)*0.5;
-		az5  = ay4;
-
-		// oversampling (repeat same block) and inject some noise
-		dngx1 ^= dngx2;
-		ay1  = az1 + k2vg * (TANHFEED((*ib +dngx2 * dng) * OV2
-			- 4*resonance*amf*kacr) - TANH(az1));
-		dngx2 += dngx1;
-		az1  = ay1;
-
-		ay2  = az2 + k2vg * (TANH(ay1) - TANH(az2));
-		az2  = ay2;
 
-		ay3  = az3 + k2vg * (TANH(ay2) - TANH(az3));
-		az3  = ay3;
+	if (kfc > lim)
+		kfc = lim;
+	else if (kfc < 0)
+		kfc = 0;
 
-		ay4  = az4 + k2vg * (TANH(ay3) - TANH(az4));
-		az4  = ay4;
+	kfc /= factor;
 
-		// 1/2-sample delay for phase compensation
-		amf  = (ay4+az5)*0.5;
-		az5  = ay4;
+	// frequency & amplitude correction
+	kfcr = kfc * (kfc * (1.8730 * kfc + 0.4955) - 0.6490) + 0.9988;
+	*kacr = kfc * (-3.9364 * kfc + 1.8409) + 0.9968;
 
-		/*
-		 * This remixes the different poles to give a fatter, warmer sound. The
-		 * other algorithms do a premixing of this however that prevents the
-		 * filter from resonating.
-		 */
-		*ob++ += V2 * (amf + (-ay3-az4 + ay2+az3 - ay1-az2) * mix) * 0.5;
-		ib++;
-	}
-
-	local->az1 = az1;
-	local->az2 = az2;
-	local->az3 = az3;
-	local->az4 = az4;
-	local->az5 = az5;
-	local->ay1 = ay1;
-	local->ay2 = ay2;
-	local->ay3 = ay3;
-	local->ay4 = ay4;
-	local->amf = amf;
-
-	return(0);
+	// filter tuning
+	*k2vg = (1 - expf(-2.0 * M_PI * kfcr * kfc));
 }
 
-static int
-huovilainen12R(float *ib, float *mb, float *ob, bristolOPParams *param, bristolFILTERlocal *local, bristolVoice *voice, int count)
+/*
+ * The parameter part of the cutoff only changes when it is swept, or with
+ * keytracking and glide, so its tuning is worked out for where each control
+ * block ends and ramped per sample through the block. A cutoff that has not
+ * moved keeps the last tuning without the expf().
+ */
+static void
+huovblock(bristolFILTERlocal *local, float lim, int factor, int snap)
 {
-	int mode = bfiltertype(voice->baudio->mixflags);
-	/*
-	 * This is actually the same code as 24R just the 12dB and 18dB taps are
-	 * mixed back into the final output. This was an Oberheim filter mod that
-	 * did not actually go into any of their products due to the added 
-	 * complexity of an analogue implementation. It should be generally richer
-	 * due to more phase differences and content.
-	 */
-	float az1 = local->az1;
-	float az2 = local->az2;
-	float az3 = local->az3;
-	float az4 = local->az4;
-	float az5 = local->az5;
-	float ay1 = local->ay1;
-	float ay2 = local->ay2;
-	float ay3 = local->ay3;
-	float ay4 = local->ay4;
-	float amf = local->amf;
-
-	float dng = param->param[8].float_val * scale;
-	float kfc;
-	float kfcr;
-	float kacr;
-	float k2vg;
-	float coff;
+	float coff = local->coff + local->dcoff * BRISTOL_SMOOTH_BLOCK;
 
-	float sr = srate;
-
-	float resonance = param->param[1].float_val;
-	float Mod = param->param[2].float_val * param->param[2].float_val * 0.02;
-
-	float mix =  param->param[7].float_val;
+	if (snap || (coff != local->kcoff) || (factor != local->kfactor))
+	{
+		huovtune(coff, lim, factor, &local->k2vgend, &local->kacrend);
+		local->kcoff = coff;
+		local->kfactor = factor;
+	}
 
-	/*
-	 * Cutoff is a power curve for better control at lower frequencies and
-	 * the key is used for tracking purposes, it should be possible to make
-	 * it reasonably linear at somewhere under unity
-	 *
-	 * Cutoff goes from 0 to 1.0 = Nyquist. Key tracking should be reviewed,
-	 * the value should be quite linear for the filter, 0..Nyquist
-	 *
-	 * If we take MIDI key 0 = 8Hz and 127 = 12658.22 Hz then using
-	 * our samplerate we should be able to fix some tuning:
-	 *
-	 * (voice->key.key * 12650.22 + 8) / (127 * srate)
-	 *
-	 * We want to position param[3] such that it tunes at 0.5 and can then
-	 * be notched in the GUI, hence srate/4 rather than /2.
-	 *
-	 * This still needs some work.
-	if (param->param[3].float_val == 0)
-		coff = param->param[0].float_val * param->param[0].float_val
-			* 20000 / srate;
-	else
-		coff = param->param[0].float_val * param->param[3].float_val * 4 *
-			voice->cfreq / srate;
-	 */
-	coff = getcoff(param->param[0].float_val, param->param[3].float_val);
+	if (snap) {
+		local->k2vg = local->k2vgend;
+		local->kacr = local->kacrend;
+		local->dk2vg = local->dkacr = 0;
+	} else {
+		local->dk2vg = (local->k2vgend - local->k2vg) / BRISTOL_SMOOTH_BLOCK;
+		local->dkacr = (local->kacrend - local->kacr) / BRISTOL_SMOOTH_BLOCK;
+	}
+}
 
-	for (; count > 0; count--)
-	{
-		/*
-		 * We should really interpret coff (the configured frequency) as
-		 * a function up to about 20kHz whatever the resampling rate.
-		 */
-		if ((kfc = coff + *mb++ * Mod) > _f_lim_r)
-			kfc = _f_lim_r;
-		else if (kfc < 0)
-			kfc = 0;
+/*
+ * Modulation is added per sample. The tuning for the modulated cutoff comes
+ * from a table of the expf() over kfc from 0 to 1, interpolated, rather than
+ * being evaluated for each sample.
+ */
+#define HUOV_TUNE_SIZE 2048
 
-		// frequency & amplitude correction
-		kfcr = kfc * (kfc * (1.8730 * kfc + 0.4955) - 0.6490) + 0.9988;
-		kacr = kfc * (-3.9364* kfc + 1.8409) + 0.9968;
+static void
+huovtable(float *tune, float kfc, float lim, int factor, float *k2vg,
+float *kacr)
+{
+	float frac;
+	int i;
 
-		// filter tuning
-		k2vg = (1 - expf(-2.0 * M_PI * kfcr * kfc * 0.5));
+	if (kfc > lim)
+		kfc = lim;
+	else if (kfc < 0)
+		kfc = 0;
 
-		// cascade of 4 1st order sections
-		ay1  = az1 + k2vg * (TANHFEED(*ib*OV2 - 4*resonance*amf*kacr)- TANH(az1));
-		az1  = ay1;
+	kfc /= factor;
 
-		ay2  = az2 + k2vg * (TANH(ay1) - TANH(az2));
-		az2  = ay2;
-		/*
-		 * This is the end of the 12dB cycle
-		 *	amf  = (ay4+az5)*0.5;
-		 */
-		amf  = (ay2+az3) * 0.5;
-		az3  = ay2;
+	*kacr = kfc * (-3.9364 * kfc + 1.8409) + 0.9968;
 
-		// oversampling (repeat same block) and inject some noise (denormal)
-		dngx1 ^= dngx2;
-		ay1  = az1 + k2vg * (TANHFEED((*ib + dngx2 * dng) * OV2
-			- 4*resonance*amf*kacr) - TANH(az1));
-		dngx2 += dngx1;
-		az1  = ay1;
+	if ((frac = kfc * HUOV_TUNE_SIZE) >= HUOV_TUNE_SIZE)
+		frac = HUOV_TUNE_SIZE;
+	i = (int) frac;
+	frac -= i;
 
-		ay2  = az2 + k2vg * (TANH(ay1) - TANH(az2));
-		az2  = ay2;
-		// 1/2-sample delay for phase compensation
-		amf  = (ay2+az3) *0.5;
-		az3  = ay2;
+	*k2vg = tune[i] + (tune[i + 1] - tune[i]) * frac;
+}
 
-		/* Oberheim modified pole mixing */
-		*ob++ += (amf + (ay1 + az2) * mix) * OV2;
-		ib++;
-	}
+static void
+huovtableinit(float *tune)
+{
+	float kfc, kfcr;
+	int i;
 
-	local->az1 = az1;
-	local->az2 = az2;
-	local->az3 = az3;
-	local->az4 = az4;
-	local->az5 = az5;
-	local->ay1 = ay1;
-	local->ay2 = ay2;
-	local->ay3 = ay3;
-	local->ay4 = ay4;
-	local->amf = amf;
-	return(0);
+	for (i = 0; i <= HUOV_TUNE_SIZE + 1; i++)
+	{
+		kfc = ((float) i) / HUOV_TUNE_SIZE;
+		kfcr = kfc * (kfc * (1.8730 * kfc + 0.4955) - 0.6490) + 0.9988;
+		tune[i] = (1 - expf(-2.0 * M_PI * kfcr * kfc));
+	}
 }
 
+/*
+ * This should perhaps be re-implemented. The HPF and BPF components really do
+ * not seem to respond that well and better versions are required for some of
+ * the emulators.
+ */
 static int
-huovilainen12(float *ib, float *mb, float *ob, bristolOPParams *param, bristolFILTERlocal *local, bristolVoice *voice, int count)
+chamberlin(float *ib, float *mb, float *ob, bristolOPParams *param, bristolFILTERlocal *local, bristolVoice *voice, int count)
 {
-	int mode = bfiltertype(voice->baudio->mixflags);
-	/*
-	 * This is actually the same code as 24R just the 12dB and 18dB taps are
-	 * mixed back into the final output. This was an Oberheim filter mod that
-	 * did not actually go into any of their products due to the added 
-	 * complexity of an analogue implementation. It should be generally richer
-	 * due to more phase differences and content.
-	 */
-	float az1 = local->az1;
-	float az2 = local->az2;
-	float az3 = local->az3;
-	float az4 = local->az4;
-	float az5 = local->az5;
-	float ay1 = local->ay1;
-	float ay2 = local->ay2;
-	float ay3 = local->ay3;
-	float ay4 = local->ay4;
-	float amf = local->amf;
+	register float Mod, gain, cutoff = 0;
 
-	float dng = param->param[8].float_val * scale;
-	float kfc;
-	float kfcr;
-	float kacr;
-	float k2vg;
-	float coff;
+	/* The chamberlin */
+	register float freqcut, highpass, qres = 0,
+		delay1 = local->delay1,
+		delay2 = local->delay2, 
+		delay3 = local->delay3,
+		delay4 = local->delay4;
+	register int hp = param->param[6].int_val, block = 0, snap;
 
-	float sr = srate;
+	Mod = param->param[2].float_val;
 
-	float resonance = param->param[1].float_val;
-	float Mod = param->param[2].float_val * param->param[2].float_val * 0.02;
+	snap = filtertargets(param, local, voice);
 
-	float mix =  param->param[7].float_val;
+	if (voice->flags & BRISTOL_KEYON)
+	{
+		delay1 = 0;
+		delay2 = 0;
+		delay3 = 0;
+		delay4 = 0;
+	}
 
-	/*
-	 * Cutoff is a power curve for better control at lower frequencies and
-	 * the key is used for tracking purposes, it should be possible to make
-	 * it reasonably linear at somewhere under unity
-	 *
-	 * Cutoff goes from 0 to 1.0 = Nyquist. Key tracking should be reviewed,
-	 * the value should be quite linear for the filter, 0..Nyquist
-	 *
-	 * If we take MIDI key 0 = 8Hz and 127 = 12658.22 Hz then using
-	 * our samplerate we should be able to fix some tuning:
-	 *
-	 * (voice->key.key * 12650.22 + 8) / (127 * srate)
-	 *
-	 * We want to position param[3] such that it tunes at 0.5 and can then
-	 * be notched in the GUI, hence srate/4 rather than /2.
-	 *
-	 * This still needs some work.
-	if (param->param[3].float_val == 0)
-		coff = param->param[0].float_val * param->param[0].float_val
-			* 20000 / srate;
-	else
-		coff = param->param[0].float_val * param->param[3].float_val * 4 *
-			voice->cfreq / srate;
-	 */
-	coff = getcoff(param->param[0].float_val, param->param[3].float_val);
+	/* This needs to be 'f-sr(v/constant) */
+	gain = param->param[5].float_val * 0.01565;
 
-	for (; count > 0; count--)
+	for (; count > 0; count-=1)
 	{
+		if (--block < 0)
+		{
+			/*
+			 * The following was for on/off keytracking, needs to be
+			 * continuous.
+			if (param->param[3].int_val)
+				cutoff += voice->dFreq / 128.0f;
+			cutoff = param->param[0].float_val * 20000 / srate;
+			cutoff += param->param[3].float_val * voice->key.key / 512.0f;
+			 */
+			cutoff = bristolSmoothStep(&local->fcutoff);
+			if (param->param[3].float_val == 0)
+				cutoff = cutoff * cutoff * 20000 / srate;
+			else
+				cutoff = param->param[3].float_val * cutoff
+					* 4 * voice->cfreq / srate;
+
+			filterblock(local, cutoff,
+				2.0f - bristolSmoothStep(&local->fresonance) * 1.97f, snap);
+			block = BRISTOL_SMOOTH_BLOCK - 1;
+			snap = 0;
+		}
+		cutoff = (local->coff += local->dcoff);
+		qres = (local->res += local->dres);
+
 		/*
-		 * We should really interpret coff (the configured frequency) as
-		 * a function up to about 20kHz whatever the resampling rate.
+		 * Hal Chamberlin's state variable filter. These are cascaded low
+		 * pass (rooney type) filters with feedback. They are not bad - 
+		 * they are resonant with a reasonable dB/octave, but the
+		 * resonance is not as warm as an analogue equivalent.
 		 */
-		if ((kfc = coff + *mb++ * Mod) > _f_lim_r)
-			kfc = _f_lim_r;
-		else if (kfc < 0)
-			kfc = 0;
+		freqcut = cutoff * 2.0f + *mb++ * Mod / 12.0f;
 
-		// frequency & amplitude correction
-		kfcr = kfc * (kfc * (1.8730 * kfc + 0.4955) - 0.6490) + 0.9988;
-		kacr = kfc * (-3.9364* kfc + 1.8409) + 0.9968;
+		if (freqcut > VCF_FREQ_MAX)
+			freqcut = VCF_FREQ_MAX;
+		else if (freqcut <= 0.000001)
+			freqcut = 0.000001;
 
-		k2vg = (1 - expf(-2.0 * M_PI * kfcr * kfc));
+		/* delay2/4 = lowpass output */
+		delay2 = delay2 + freqcut * delay1;
 
-		// cascade of 4 1st order sections
-		dngx1 ^= dngx2;
-		ay1  = az1 + k2vg * (TANHFEED((*ib +dngx2 * dng) * OV2
-			- 4*resonance*amf*kacr) - TANH(az1));
-		dngx2 += dngx1;
-		az1  = ay1;
+		highpass = *ib++ * 16 - delay2 - qres * delay1;
 
-		ay2  = az2 + k2vg * (TANH(ay1) - TANH(az2));
-		az2  = ay2;
-		// 1/2-sample delay for phase compensation
-		amf  = (ay2+az3) *0.5;
-		az3  = ay2;
+		/* delay1/3 = bandpass output */
+		delay1 = freqcut * highpass + delay1;
 
-		/* Oberheim modified pole mixing */
-		*ob++ += (amf + (ay1 + az2) * mix) * V2;
-		ib++;
+		delay4 = delay4 + freqcut * delay3;
+		highpass = delay2 - delay4 - qres * delay3;
+		delay3 = freqcut * highpass + delay3;
+
+		/* mix filter output into output buffer */
+		switch (hp) {
+			default: /* LP */
+				*ob++ += delay4 * gain;
+				break;
+			case 1: /* BP */
+				*ob++ += delay3 * gain;
+				break;
+			case 2: /* HP */
+				*ob++ += highpass * gain;
+				break;
+		}
 	}
 
-	local->az1 = az1;
-	local->az2 = az2;
-	local->az3 = az3;
-	local->az4 = az4;
-	local->az5 = az5;
-	local->ay1 = ay1;
-	local->ay2 = ay2;
-	local->ay3 = ay3;
-	local->ay4 = ay4;
-	local->amf = amf;
+	local->delay1 = delay1;
+	local->delay2 = delay2;
+	local->delay3 = delay3;
+	local->delay4 = delay4;
+
 	return(0);
 }
 
+/* Dither against denormals, from the shared white noise */
+static float scale = 0.0000001 * NOISECORE_INT; // 0.000000001;
+
 static int
-huovilainen24ROB(float *ib, float *mb, float *ob, bristolOPParams *param, bristolFILTERlocal *local, bristolVoice *voice, int count)
+huovilainen24(float *ib, float *mb, float *ob, bristolOPParams *param, bristolFILTERlocal *local, bristolVoice *voice, int count, int factor, float *tune)
 {
 	int mode = bfiltertype(voice->baudio->mixflags);
 	/*
-	 * This is actually the same code as 24R just the 12dB and 18dB taps are
-	 * mixed back into the final output. This was an Oberheim filter mod that
-	 * did not actually go into any of their products due to the added 
-	 * complexity of an analogue implementation. It should be generally richer
-	 * due to more phase differences and content.
+	 * This is an implementation of Antti Huovilainen's non-linear Moog
+	 * emulation, tweaked just slightly to align with the sometimes rather
+	 * dubious bristol signal levels (its not that they are bad, just that
+	 * historically they have used 1.0 per octave rather than +/-1.0).
 	 */
-	float dng = param->param[8].float_val * scale;
 	float az1 = local->az1;
 	float az2 = local->az2;
 	float az3 = local->az3;
 	float az4 = local->az4;
-	float az5 = local->az5;
 	float ay1 = local->ay1;
 	float ay2 = local->ay2;
 	float ay3 = local->ay3;
 	float ay4 = local->ay4;
 	float amf = local->amf;
 
-	float kfc;
-	float kfcr;
 	float kacr;
 	float k2vg;
-	float coff;
+	float coff, mod;
+	float dng = param->param[8].float_val * scale, *dn;
 
 	float sr = srate;
 
-	float resonance = param->param[1].float_val;
+	float resonance = 0, rscale = 1.0;
+	int block = 0, sub = 0, snap;
 	float Mod = param->param[2].float_val * param->param[2].float_val * 0.02;
-
-	float mix =  param->param[7].float_val;
+	float mix =  param->param[7].float_val * 0.5;
 
 	/*
 	 * Cutoff is a power curve for better control at lower frequencies and
@@ -916,7 +580,9 @@ huovilainen24ROB(float *ib, float *mb, float *ob, bristolOPParams *param, bristo
 		coff = param->param[0].float_val * param->param[3].float_val * 4 *
 			voice->cfreq / srate;
 	 */
-	coff = getcoff(param->param[0].float_val, param->param[3].float_val);
+	snap = filtertargets(param, local, voice);
+
+	dn = noiseCoreWhite(voice->index, count);
 
 	for (; count > 0; count--)
 	{
@@ -924,39 +590,30 @@ huovilainen24ROB(float *ib, float *mb, float *ob, bristolOPParams *param, bristo
 		 * We should really interpret coff (the configured frequency) as
 		 * a function up to about 20kHz whatever the resampling rate.
 		 */
-		if ((kfc = coff + *mb++ * Mod) > _f_lim_r)
-			kfc = _f_lim_r;
-		else if (kfc < 0)
-			kfc = 0;
-
-		// frequency & amplitude correction
-		kfcr = kfc * ( kfc * (1.8730 * kfc + 0.4955) - 0.6490) + 0.9988;
-		kacr = kfc * (-3.9364 * kfc + 1.8409) + 0.9968;
-
-		k2vg = (1 - expf(-2.0 * M_PI * kfcr * kfc * 0.5));
-
-		ay1  = az1 + k2vg * (TANHFEED((*ib*OV2 - 4*resonance*amf*kacr))
-            - TANH(az1));
-		az1  = ay1;
-
-		ay2  = az2 + k2vg * (TANH(ay1) - TANH(az2));
-		az2  = ay2;
-
-		ay3  = az3 + k2vg * (TANH(ay2) - TANH(az3));
-		az3  = ay3;
-
-		ay4  = az4 + k2vg * (TANH(ay3) - TANH(az4));
-		az4  = ay4;
-
-		// 1/2-sample delay for phase compensation
-		amf  = (ay4+az5 + (-ay3-+az4 + ay2+az3) * mix) * 0.5;
-		az5  = ay4;
+		if (--sub < 0)
+		{
+			if (--block < 0)
+			{
+				filterblock(local,
+					getcoff(bristolSmoothStep(&local->fcutoff),
+						param->param[3].float_val),
+					bristolSmoothStep(&local->fresonance) * rscale, snap);
+				huovblock(local, _f_lim, factor, snap);
+				block = BRISTOL_SMOOTH_BLOCK - 1;
+				snap = 0;
+			}
+			coff = (local->coff += local->dcoff);
+			resonance = (local->res += local->dres);
+			k2vg = (local->k2vg += local->dk2vg);
+			kacr = (local->kacr += local->dkacr);
+			if ((mod = *mb++ * Mod) != 0)
+				huovtable(tune, coff + mod, _f_lim, factor, &k2vg, &kacr);
+			sub = factor - 1;
+		}
 
-		// oversampling (repeat same block) and add denormal noise
-		dngx1 ^= dngx2;
-		ay1  = az1 + k2vg * (TANHFEED((*ib +dngx2 * dng) * OV2
+		// cascade of 4 1st order sections
+		ay1  = az1 + k2vg * (TANHFEED((*ib + *dn++ * dng) * OV2
 			- 4*resonance*amf*kacr) - TANH(az1));
-		dngx2 += dngx1;
 		az1  = ay1;
 
 		ay2  = az2 + k2vg * (TANH(ay1) - TANH(az2));
@@ -968,12 +625,14 @@ huovilainen24ROB(float *ib, float *mb, float *ob, bristolOPParams *param, bristo
 		ay4  = az4 + k2vg * (TANH(ay3) - TANH(az4));
 		az4  = ay4;
 
-		// 1/2-sample delay for phase compensation
-		// Added in 12dB and 18dB phases
-		amf  = (ay4+az5 + (-ay3-az4 + ay2+az3) * mix) * 0.5;
-		az5  = ay4;
+		amf  = ay4;
 
-		*ob++ += V2 * amf;
+		/*
+		 * This remixes the different poles to give a fatter, warmer sound. The
+		 * other algorithms do a premixing of this however that prevents the
+		 * filter from resonating.
+		 */
+		*ob++ += (amf + (-ay3-az4 + ay2+az3 - ay1-az2) * mix) * V2;
 		ib++;
 	}
 
@@ -981,7 +640,6 @@ huovilainen24ROB(float *ib, float *mb, float *ob, bristolOPParams *param, bristo
 	local->az2 = az2;
 	local->az3 = az3;
 	local->az4 = az4;
-	local->az5 = az5;
 	local->ay1 = ay1;
 	local->ay2 = ay2;
 	local->ay3 = ay3;
@@ -992,7 +650,7 @@ huovilainen24ROB(float *ib, float *mb, float *ob, bristolOPParams *param, bristo
 }
 
 static int
-huovilainen24OB(float *ib, float *mb, float *ob, bristolOPParams *param, bristolFILTERlocal *local, bristolVoice *voice, int count)
+huovilainen12(float *ib, float *mb, float *ob, bristolOPParams *param, bristolFILTERlocal *local, bristolVoice *voice, int count, int factor, float *tune)
 {
 	int mode = bfiltertype(voice->baudio->mixflags);
 	/*
@@ -1002,7 +660,6 @@ huovilainen24OB(float *ib, float *mb, float *ob, bristolOPParams *param, bristol
 	 * complexity of an analogue implementation. It should be generally richer
 	 * due to more phase differences and content.
 	 */
-	float dng = param->param[8].float_val * scale;
 	float az1 = local->az1;
 	float az2 = local->az2;
 	float az3 = local->az3;
@@ -1014,15 +671,15 @@ huovilainen24OB(float *ib, float *mb, float *ob, bristolOPParams *param, bristol
 	float ay4 = local->ay4;
 	float amf = local->amf;
 
-	float kfc;
-	float kfcr;
+	float dng = param->param[8].float_val * scale, *dn;
 	float kacr;
 	float k2vg;
+	float coff, mod;
 
 	float sr = srate;
-	float coff;
 
-	float resonance = param->param[1].float_val;
+	float resonance = 0, rscale = 1.0;
+	int block = 0, sub = 0, snap;
 	float Mod = param->param[2].float_val * param->param[2].float_val * 0.02;
 
 	float mix =  param->param[7].float_val;
@@ -1051,7 +708,9 @@ huovilainen24OB(float *ib, float *mb, float *ob, bristolOPParams *param, bristol
 		coff = param->param[0].float_val * param->param[3].float_val * 4 *
 			voice->cfreq / srate;
 	 */
-	coff = getcoff(param->param[0].float_val, param->param[3].float_val);
+	snap = filtertargets(param, local, voice);
+
+	dn = noiseCoreWhite(voice->index, count);
 
 	for (; count > 0; count--)
 	{
@@ -1059,39 +718,40 @@ huovilainen24OB(float *ib, float *mb, float *ob, bristolOPParams *param, bristol
 		 * We should really interpret coff (the configured frequency) as
 		 * a function up to about 20kHz whatever the resampling rate.
 		 */
-		if ((kfc = coff + *mb++ * Mod) > _f_lim_r)
-			kfc = _f_lim_r;
-		else if (kfc < 0)
-			kfc = 0;
-
-		// frequency & amplitude correction
-		kfcr = kfc * ( kfc * (1.8730 * kfc + 0.4955) - 0.6490) + 0.9988;
-		kacr = kfc * (-3.9364 * kfc + 1.8409) + 0.9968;
-
-		k2vg = (1 - expf(-2.0 * M_PI * kfcr * kfc));
+		if (--sub < 0)
+		{
+			if (--block < 0)
+			{
+				filterblock(local,
+					getcoff(bristolSmoothStep(&local->fcutoff),
+						param->param[3].float_val),
+					bristolSmoothStep(&local->fresonance) * rscale, snap);
+				huovblock(local, _f_lim, factor, snap);
+				block = BRISTOL_SMOOTH_BLOCK - 1;
+				snap = 0;
+			}
+			coff = (local->coff += local->dcoff);
+			resonance = (local->res += local->dres);
+			k2vg = (local->k2vg += local->dk2vg);
+			kacr = (local->kacr += local->dkacr);
+			if ((mod = *mb++ * Mod) != 0)
+				huovtable(tune, coff + mod, _f_lim, factor, &k2vg, &kacr);
+			sub = factor - 1;
+		}
 
 		// cascade of 4 1st order sections
-		dngx1 ^= dngx2;
-		ay1  = az1 + k2vg * (TANHFEED((*ib +dngx2 * dng) * OV2
+		ay1  = az1 + k2vg * (TANHFEED((*ib +*dn++ * dng) * OV2
 			- 4*resonance*amf*kacr) - TANH(az1));
-		dngx2 += dngx1;
 		az1  = ay1;
 
 		ay2  = az2 + k2vg * (TANH(ay1) - TANH(az2));
 		az2  = ay2;
-
-		ay3  = az3 + k2vg * (TANH(ay2) - TANH(az3));
-		az3  = ay3;
-
-		ay4  = az4 + k2vg * (TANH(ay3) - TANH(az4));
-		az4  = ay4;
-
 		// 1/2-sample delay for phase compensation
-		// Added in 12dB and 18dB phases
-		amf  = (ay4+az5 + (-ay3-az4 + ay2+az3) * mix) *0.5;
-		az5  = ay4;
+		amf  = (ay2+az3) *0.5;
+		az3  = ay2;
 
-		*ob++ += amf * V2;
+		/* Oberheim modified pole mixing */
+		*ob++ += (amf + (ay1 + az2) * mix) * V2;
 		ib++;
 	}
 
@@ -1105,12 +765,11 @@ huovilainen24OB(float *ib, float *mb, float *ob, bristolOPParams *param, bristol
 	local->ay3 = ay3;
 	local->ay4 = ay4;
 	local->amf = amf;
-
 	return(0);
 }
 
 static int
-huovilainen24ROB2(float *ib, float *mb, float *ob, bristolOPParams *param, bristolFILTERlocal *local, bristolVoice *voice, int count)
+huovilainen24OB(float *ib, float *mb, float *ob, bristolOPParams *param, bristolFILTERlocal *local, bristolVoice *voice, int count, int factor, float *tune)
 {
 	int mode = bfiltertype(voice->baudio->mixflags);
 	/*
@@ -1120,7 +779,7 @@ huovilainen24ROB2(float *ib, float *mb, float *ob, bristolOPParams *param, brist
 	 * complexity of an analogue implementation. It should be generally richer
 	 * due to more phase differences and content.
 	 */
-	float dng = param->param[8].float_val * scale;
+	float dng = param->param[8].float_val * scale, *dn;
 	float az1 = local->az1;
 	float az2 = local->az2;
 	float az3 = local->az3;
@@ -1132,15 +791,14 @@ huovilainen24ROB2(float *ib, float *mb, float *ob, bristolOPParams *param, brist
 	float ay4 = local->ay4;
 	float amf = local->amf;
 
-	float kfc;
-	float kfcr;
 	float kacr;
 	float k2vg;
-	float coff;
 
 	float sr = srate;
+	float coff, mod;
 
-	float resonance = param->param[1].float_val * 0.30;
+	float resonance = 0, rscale = 1.0;
+	int block = 0, sub = 0, snap;
 	float Mod = param->param[2].float_val * param->param[2].float_val * 0.02;
 
 	float mix =  param->param[7].float_val;
@@ -1169,7 +827,9 @@ huovilainen24ROB2(float *ib, float *mb, float *ob, bristolOPParams *param, brist
 		coff = param->param[0].float_val * param->param[3].float_val * 4 *
 			voice->cfreq / srate;
 	 */
-	coff = getcoff(param->param[0].float_val, param->param[3].float_val);
+	snap = filtertargets(param, local, voice);
+
+	dn = noiseCoreWhite(voice->index, count);
 
 	for (; count > 0; count--)
 	{
@@ -1177,42 +837,30 @@ huovilainen24ROB2(float *ib, float *mb, float *ob, bristolOPParams *param, brist
 		 * We should really interpret coff (the configured frequency) as
 		 * a function up to about 20kHz whatever the resampling rate.
 		 */
-		if ((kfc = coff + *mb++ * Mod) > _f_lim_r)
-			kfc = _f_lim_r;
-		else if (kfc < 0)
-			kfc = 0;
-
-		// frequency & amplitude correction
-		kfcr = kfc * ( kfc * (1.8730 * kfc + 0.4955) - 0.6490) + 0.9988;
-		kacr = kfc * (-3.9364 * kfc  + 1.8409) + 0.9968;
-
-		k2vg = (1 - expf(-2.0 * M_PI * kfcr * kfc * 0.5));
+		if (--sub < 0)
+		{
+			if (--block < 0)
+			{
+				filterblock(local,
+					getcoff(bristolSmoothStep(&local->fcutoff),
+						param->param[3].float_val),
+					bristolSmoothStep(&local->fresonance) * rscale, snap);
+				huovblock(local, _f_lim, factor, snap);
+				block = BRISTOL_SMOOTH_BLOCK - 1;
+				snap = 0;
+			}
+			coff = (local->coff += local->dcoff);
+			resonance = (local->res += local->dres);
+			k2vg = (local->k2vg += local->dk2vg);
+			kacr = (local->kacr += local->dkacr);
+			if ((mod = *mb++ * Mod) != 0)
+				huovtable(tune, coff + mod, _f_lim, factor, &k2vg, &kacr);
+			sub = factor - 1;
+		}
 
 		// cascade of 4 1st order sections
-		ay1  = az1 + k2vg * (TANHFEED((*ib*OV2 - 4*resonance*amf*kacr))
-            - TANH(az1));
-		az1  = ay1;
-
-		ay2  = az2 + k2vg * (TANH(ay1) - TANH(az2));
-		az2  = ay2;
-
-		ay3  = az3 + k2vg * (TANH(ay2) - TANH(az3));
-		az3  = ay3;
-
-		ay4  = az4 + k2vg * (TANH(ay3) - TANH(az4));
-		az4  = ay4;
-
-		// 1/2-sample delay for phase compensation
-		// amf  = (ay4+az5)*0.5;
-		// Added in 6dB, 12dB and 18dB phases
-		amf  = (ay4+az5 + (-ay1-az2+ay3+az4-ay2-az3) * mix) *0.5;
-		az5  = ay4;
-
-		// oversampling (repeat same block)
-		dngx1 ^= dngx2;
-		ay1  = az1 + k2vg * (TANHFEED((*ib +dngx2 * dng) * OV2
-            - 4*resonance*amf*kacr) - TANH(az1));
-		dngx2 += dngx1;
+		ay1  = az1 + k2vg * (TANHFEED((*ib +*dn++ * dng) * OV2
+			- 4*resonance*amf*kacr) - TANH(az1));
 		az1  = ay1;
 
 		ay2  = az2 + k2vg * (TANH(ay1) - TANH(az2));
@@ -1225,8 +873,8 @@ huovilainen24ROB2(float *ib, float *mb, float *ob, bristolOPParams *param, brist
 		az4  = ay4;
 
 		// 1/2-sample delay for phase compensation
-		// Added in 6dB, 12dB and 18dB phases
-		amf  = (ay4+az5 + (-ay1-az2+ay3+az4-ay2-az3) * mix) *0.5;
+		// Added in 12dB and 18dB phases
+		amf  = (ay4+az5 + (-ay3-az4 + ay2+az3) * mix) *0.5;
 		az5  = ay4;
 
 		*ob++ += amf * V2;
@@ -1248,7 +896,7 @@ huovilainen24ROB2(float *ib, float *mb, float *ob, bristolOPParams *param, brist
 }
 
 static int
-huovilainen24OB2(float *ib, float *mb, float *ob, bristolOPParams *param, bristolFILTERlocal *local, bristolVoice *voice, int count)
+huovilainen24OB2(float *ib, float *mb, float *ob, bristolOPParams *param, bristolFILTERlocal *local, bristolVoice *voice, int count, int factor, float *tune)
 {
 	int mode = bfiltertype(voice->baudio->mixflags);
 	/*
@@ -1258,7 +906,7 @@ huovilainen24OB2(float *ib, float *mb, float *ob, bristolOPParams *param, bristo
 	 * complexity of an analogue implementation. It should be generally richer
 	 * due to more phase differences and content.
 	 */
-	float dng = param->param[8].float_val * scale;
+	float dng = param->param[8].float_val * scale, *dn;
 	float az1 = local->az1;
 	float az2 = local->az2;
 	float az3 = local->az3;
@@ -1269,15 +917,14 @@ huovilainen24OB2(float *ib, float *mb, float *ob, bristolOPParams *param, bristo
 	float ay4 = local->ay4;
 	float amf = local->amf;
 
-	float kfc;
-	float kfcr;
 	float kacr;
 	float k2vg;
-	float coff;
+	float coff, mod;
 
 	float sr = srate;
 
-	float resonance = param->param[1].float_val * 0.30;
+	float resonance = 0, rscale = 0.30;
+	int block = 0, sub = 0, snap;
 	float Mod = param->param[2].float_val * param->param[2].float_val * 0.02;
 
 	float mix =  param->param[7].float_val;
@@ -1306,7 +953,9 @@ huovilainen24OB2(float *ib, float *mb, float *ob, bristolOPParams *param, bristo
 		coff = param->param[0].float_val * param->param[3].float_val * 4 *
 			voice->cfreq / srate;
 	 */
-	coff = getcoff(param->param[0].float_val, param->param[3].float_val);
+	snap = filtertargets(param, local, voice);
+
+	dn = noiseCoreWhite(voice->index, count);
 
 	for (; count > 0; count--)
 	{
@@ -1314,22 +963,30 @@ huovilainen24OB2(float *ib, float *mb, float *ob, bristolOPParams *param, bristo
 		 * We should really interpret coff (the configured frequency) as
 		 * a function up to about 20kHz whatever the resampling rate.
 		 */
-		if ((kfc = coff + *mb++ * Mod) > _f_lim)
-			kfc = _f_lim;
-		else if (kfc < 0)
-			kfc = 0;
-
-		// frequency & amplitude correction
-		kfcr = kfc * ( kfc * (1.8730 * kfc + 0.4955) - 0.6490) + 0.9988;
-		kacr = kfc * (-3.9364 * kfc  + 1.8409) + 0.9968;
-
-		k2vg = (1 - expf(-2.0 * M_PI * kfcr * kfc));
+		if (--sub < 0)
+		{
+			if (--block < 0)
+			{
+				filterblock(local,
+					getcoff(bristolSmoothStep(&local->fcutoff),
+						param->param[3].float_val),
+					bristolSmoothStep(&local->fresonance) * rscale, snap);
+				huovblock(local, _f_lim, factor, snap);
+				block = BRISTOL_SMOOTH_BLOCK - 1;
+				snap = 0;
+			}
+			coff = (local->coff += local->dcoff);
+			resonance = (local->res += local->dres);
+			k2vg = (local->k2vg += local->dk2vg);
+			kacr = (local->kacr += local->dkacr);
+			if ((mod = *mb++ * Mod) != 0)
+				huovtable(tune, coff + mod, _f_lim, factor, &k2vg, &kacr);
+			sub = factor - 1;
+		}
 
 		// cascade of 4 1st order sections
-		dngx1 ^= dngx2;
-		ay1  = az1 + k2vg * (TANHFEED((*ib +dngx2 * dng) * OV2
+		ay1  = az1 + k2vg * (TANHFEED((*ib +*dn++ * dng) * OV2
 			- 4*resonance*amf*kacr) - TANH(az1));
-		dngx2 += dngx1;
 		az1  = ay1;
 
 		ay2  = az2 + k2vg * (TANH(ay1) - TANH(az2));
@@ -1362,6 +1019,28 @@ huovilainen24OB2(float *ib, float *mb, float *ob, bristolOPParams *param, bristo
 	return(0);
 }
 
+/*
+ * Huovilainen filters as an array so that operate() can run any of them at
+ * the oversampled rate. The old resampling versions just ran the pole cascade
+ * twice per input sample, type 4 was 6dB down on the others and that level
+ * is kept here. Type 1 used to scale its output by OV2 rather than V2 and was
+ * essentially silent, it now has the same level as the other types. The gain
+ * is applied at all rates, factor 1 just copies through the work buffers.
+ */
+typedef int (*huovilainen)(float *, float *, float *, bristolOPParams *,
+	bristolFILTERlocal *, bristolVoice *, int, int, float *);
+
+static struct {
+	huovilainen filter;
+	float gain;
+} huovtypes[5] = {
+	{huovilainen24, 1.0}, /* Type 0 is the chamberlin, not used */
+	{huovilainen12, 1.0},
+	{huovilainen24OB, 1.0},
+	{huovilainen24OB2, 1.0},
+	{huovilainen24, 0.5},
+};
+
 /*
  * filter - takes input signal and filters it according to the mod level.
  */
@@ -1370,7 +1049,7 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 	void *lcl)
 {
 	bristolFILTERlocal *local = lcl;
-	register int count, fselect;
+	register int count, fselect, factor;
 	register float *ib, *ob, *mb;
 	bristolFILTER *specs;
 
@@ -1390,48 +1069,29 @@ static int operate(register bristolOP *operator, bristolVoice *voice,
 
 	/* See if we are limited to lightweight filters */
 	if (blo.flags & BRISTOL_LWF)
-		fselect = 0;
-	else {
-		fselect = param->param[4].int_val;
-		if (srate > 80000)
-			fselect += 16;
-	}
+		return(chamberlin(ib, mb, ob, param, local, voice, count));
 
-	/*
-	 * We will eventually have another set here that will be called when the
-	 * samplerate is over 48kHz (88.2, 96, 192 kHz) when we can anticipate the
-	 * filter response to be adequate without resampling internally here.
-	 */
-	switch(fselect) {
-		/* Lightweight Filters */
-		case 0:
-		case 16:
-			return(chamberlin(ib, mb, ob, param, local, voice, count));
+	if ((fselect = param->param[4].int_val) <= 0)
+		return(chamberlin(ib, mb, ob, param, local, voice, count));
+	if (fselect > 4)
+		fselect = 4;
 
-		/* Huovilainen resampling */
-		case 1:
-			return(huovilainen12R(ib, mb, ob, param, local, voice, count));
-		case 2:
-			return(huovilainen24ROB(ib, mb, ob, param, local, voice, count));
-		case 3:
-			return(huovilainen24ROB2(ib, mb, ob, param, local, voice, count));
-		case 4:
-		default:
-			return(huovilainen24R(ib, mb, ob, param, local, voice, count));
+	if ((factor = voice->baudio->oversampling) <= 0)
+		factor = srate > 80000? 1:2;
 
-		/*
-		 * We need non-resampling versions of the other filters too but
-		 * need to review this code first.
-		 */
-		case 17:
-			return(huovilainen12(ib, mb, ob, param, local, voice, count));
-		case 18:
-			return(huovilainen24OB(ib, mb, ob, param, local, voice, count));
-		case 19:
-			return(huovilainen24OB2(ib, mb, ob, param, local, voice, count));
-		case 20:
-			return(huovilainen24(ib, mb, ob, param, local, voice, count));
-	}
+	if (local->os.factor != factor)
+		factor = bristolOversampleInit(&local->os, factor);
+
+	bristolOversampleUp(&local->os, ib, specs->osin, count);
+	bzero(specs->osout, sizeof(float) * count * factor);
+
+	huovtypes[fselect].filter(specs->osin, mb, specs->osout, param, local,
+		voice, count * factor, factor, specs->tune);
+
+	bristolOversampleDown(&local->os, specs->osout, ob,
+		huovtypes[fselect].gain, count);
+
+	return(0);
 }
 
 /*
@@ -1449,6 +1109,7 @@ filter2init(bristolOP **operator, int index, int samplerate, int samplecount)
 #endif
 
 	srate = samplerate;
+	sblocks = bristolSmoothBlocks(samplerate, BRISTOL_SMOOTH_MS);
 
 	*operator = bristolOPinit(operator, index, samplecount);
 
@@ -1465,6 +1126,13 @@ filter2init(bristolOP **operator, int index, int samplerate, int samplecount)
 	(*operator)->specs = (bristolOPSpec *) specs;
 	(*operator)->size = sizeof(bristolFILTER);
 
+	specs->osin = bristolmalloc0(sizeof(float) * samplecount
+		* BRISTOL_OVERSAMPLE_MAX);
+	specs->osout = bristolmalloc0(sizeof(float) * samplecount
+		* BRISTOL_OVERSAMPLE_MAX);
+	specs->tune = bristolmalloc(sizeof(float) * (HUOV_TUNE_SIZE + 2));
+	huovtableinit(specs->tune);
+
 	/*
 	 * These are specific to this operator, and will need to be altered for
 	 * each operator.
@@ -37,6 +37,7 @@
 
 #include "bristol.h"
 #include "granulardco.h"
+#include "noisecore.h"
 
 static float note_diff;
 /* static int init_samplerate; */
@@ -111,14 +112,14 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
-	bristolfree(((bristolGRANULARDCO *) operator)->wave[0]);
-	bristolfree(((bristolGRANULARDCO *) operator)->wave[1]);
-	bristolfree(((bristolGRANULARDCO *) operator)->wave[2]);
-	bristolfree(((bristolGRANULARDCO *) operator)->wave[3]);
-	bristolfree(((bristolGRANULARDCO *) operator)->wave[4]);
-	bristolfree(((bristolGRANULARDCO *) operator)->wave[5]);
-	bristolfree(((bristolGRANULARDCO *) operator)->wave[6]);
-	bristolfree(((bristolGRANULARDCO *) operator)->wave[7]);
+	bristolfree(((bristolGRANULARDCO *) operator->specs)->wave[0]);
+	bristolfree(((bristolGRANULARDCO *) operator->specs)->wave[1]);
+	bristolfree(((bristolGRANULARDCO *) operator->specs)->wave[2]);
+	bristolfree(((bristolGRANULARDCO *) operator->specs)->wave[3]);
+	bristolfree(((bristolGRANULARDCO *) operator->specs)->wave[4]);
+	bristolfree(((bristolGRANULARDCO *) operator->specs)->wave[5]);
+	bristolfree(((bristolGRANULARDCO *) operator->specs)->wave[6]);
+	bristolfree(((bristolGRANULARDCO *) operator->specs)->wave[7]);
 
 	bristolfree(operator->specs);
 
@@ -359,9 +360,8 @@ static float wtr2;
  * value, the parameter 'scatter' which is going to be used to define the
  * depth of separation and 2 busses: one defines modification of the parameter,
  * and one that defines modification of the scatter between the sympathetic
- * grains. Some use a quantumrand[] entry that will adjust the scatter,
- * something which may be dropped in preference for just using noise on the
- * bus.
+ * grains. Some use a hashed grain counter that will adjust the scatter, the
+ * sequence restarts with each note so that a sound is reproducible.
  */
 static float
 regrain(bristolGRANULARDCOlocal *local, bristolGRANULARDCO *specs,
@@ -390,7 +390,7 @@ bristolOPParams *param, int count, int channel)
 	 * wave that is configured when we do not have RAND selected.
 	 */
 	if ((param->param[GDCO_WAVEFORM].int_val & GDCO_WAVE_RAND) != 0)
-		wave = quantumrand[cri] & GDCO_WAVE_MASK;
+		wave = noiseCoreHash(cri) & GDCO_WAVE_MASK;
 	else
 		wave = channel & GDCO_WAVE_MASK;
 
@@ -408,7 +408,7 @@ bristolOPParams *param, int count, int channel)
 		samplerate * 0.1
 		* (1.0 + param->param[DELAY_VALUE].float_val
 			+ specs->spec.io[DELAY_MODBUS].buf[count])
-		* (quantumrand[cri] & 0x01?
+		* (noiseCoreHash(cri) & 0x01?
 			1.0 + param->param[DELAY_SCATTER].float_val
 			* specs->spec.io[DELAY_SCATTERBUS].buf[count]:
 			1.0 - param->param[DELAY_SCATTER].float_val
@@ -424,7 +424,7 @@ bristolOPParams *param, int count, int channel)
 	wtp = local->runtime[channel].wtp = 0;
 	wts = local->runtime[channel].wts = GRANULARDCO_WAVE_SZE;
 	wtr = local->runtime[channel].wtr =
-		(quantumrand[cri] & 0x01) == 0?
+		(noiseCoreHash(cri) & 0x01) == 0?
 		specs->grains[0].frequency
 			* (1.0 + (param->param[FREQUENCY_SCATTER].float_val
 			+ specs->spec.io[FREQ_SCATTERBUS].buf[count]) * 0.1):
@@ -432,7 +432,7 @@ bristolOPParams *param, int count, int channel)
 			* (1.0 - (param->param[FREQUENCY_SCATTER].float_val
 			+ specs->spec.io[FREQ_SCATTERBUS].buf[count]) * 0.1);
 
-	if ((gts = (quantumrand[cri] & 0x01) == 0?
+	if ((gts = (noiseCoreHash(cri) & 0x01) == 0?
 			GRANULARDCO_WAVE_SZE /
 			(88 + (param->param[DURATION_VALUE].float_val
 			+ specs->spec.io[DURATION_MODBUS].buf[count]
@@ -456,7 +456,7 @@ bristolOPParams *param, int count, int channel)
 	 * Sympathetic grain
 	 */
 	gg2 = local->runtime[channel + 1].gain =
-		(quantumrand[cri] & 0x01) == 0?
+		(noiseCoreHash(cri) & 0x01) == 0?
 			1.0 + param->param[GAIN_SCATTER].float_val:
 			1.0 - param->param[GAIN_SCATTER].float_val;
 
@@ -464,7 +464,7 @@ bristolOPParams *param, int count, int channel)
 		samplerate * 0.1
 		* (1.0 + param->param[DELAY_VALUE].float_val
 			+ specs->spec.io[DELAY_MODBUS].buf[count])
-		* (quantumrand[cri] & 0x01?
+		* (noiseCoreHash(cri) & 0x01?
 			1.0 - param->param[DELAY_SCATTER].float_val
 			+ specs->spec.io[DELAY_SCATTERBUS].buf[count]:
 			1.0 + param->param[DELAY_SCATTER].float_val
@@ -476,7 +476,7 @@ bristolOPParams *param, int count, int channel)
 
 	wtp2 = local->runtime[channel + 1].wtp = 0;
 	wtr2 = local->runtime[channel + 1].wtr =
-		(quantumrand[cri] & 0x01) == 0?
+		(noiseCoreHash(cri) & 0x01) == 0?
 		specs->grains[0].frequency
 			* (1.0 + (param->param[FREQUENCY_SCATTER].float_val
 			+ specs->spec.io[FREQ_SCATTERBUS].buf[count]) * 0.1):
@@ -484,7 +484,7 @@ bristolOPParams *param, int count, int channel)
 			* (1.0 - (param->param[FREQUENCY_SCATTER].float_val
 			+ specs->spec.io[FREQ_SCATTERBUS].buf[count]) * 0.1);
 
-	if ((gts2 = ((quantumrand[cri] & 0x01) == 0?
+	if ((gts2 = ((noiseCoreHash(cri) & 0x01) == 0?
 			GRANULARDCO_WAVE_SZE /
 			(88 + (param->param[DURATION_VALUE].float_val
 			+ specs->spec.io[DURATION_MODBUS].buf[count]
@@ -103,14 +103,14 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
-	bristolfree(((bristolHAMMOND *) operator)->wave[0]);
-	bristolfree(((bristolHAMMOND *) operator)->wave[1]);
-	bristolfree(((bristolHAMMOND *) operator)->wave[2]);
-	bristolfree(((bristolHAMMOND *) operator)->wave[3]);
-	bristolfree(((bristolHAMMOND *) operator)->wave[4]);
-	bristolfree(((bristolHAMMOND *) operator)->wave[5]);
-	bristolfree(((bristolHAMMOND *) operator)->wave[6]);
-	bristolfree(((bristolHAMMOND *) operator)->wave[7]);
+	bristolfree(((bristolHAMMOND *) operator->specs)->wave[0]);
+	bristolfree(((bristolHAMMOND *) operator->specs)->wave[1]);
+	bristolfree(((bristolHAMMOND *) operator->specs)->wave[2]);
+	bristolfree(((bristolHAMMOND *) operator->specs)->wave[3]);
+	bristolfree(((bristolHAMMOND *) operator->specs)->wave[4]);
+	bristolfree(((bristolHAMMOND *) operator->specs)->wave[5]);
+	bristolfree(((bristolHAMMOND *) operator->specs)->wave[6]);
+	bristolfree(((bristolHAMMOND *) operator->specs)->wave[7]);
 
 	bristolfree(operator->specs);
 
@@ -319,7 +319,7 @@ static int operate(bristolOP *operator,
 	register float *source, *dest;
 	register int count, i, j;
 	register int rate, chorus, tap, tcount;
-	register float g1, g2, g3, g4, g5, g6, gain, *history, ph, rs, depth;
+	register float g1, g2, g3, g4, g5, g6, gain, ph, rs, depth;
 	register bristolHCTap *phase;
 
 	specs = (bristolHCHORUS *) operator->specs;
@@ -339,7 +339,9 @@ static int operate(bristolOP *operator,
 	gain = param->param[GAIN].float_val;
 	depth = param->param[DEPTH].float_val;
 
-	history = param->param[0].mem;
+	if (local->dl.buf != param->param[0].mem)
+		delayLineInit(&local->dl, param->param[0].mem, MEMSIZE,
+			BRISTOL_DL_LINEAR);
 
 	if (reDelay)
 	{
@@ -348,11 +350,7 @@ static int operate(bristolOP *operator,
 		 */
 		reDelay = 0;
 		for (i = 0; i < TAPS; i++)
-		{
-			local->mcur[i] = local->mstart[i] = (i + 1) * rate;
-			local->mend[i] = local->mstart[i] + rate;
-		}
-		local->mcur[TAPS] = 0;
+			local->tapd[i] = (i + 1) * rate;
 		ph = *source;
 	} else
 		ph = local->ph;
@@ -387,20 +385,16 @@ static int operate(bristolOP *operator,
 	 */
 	for (i = 0; i < count; i++)
 	{
-		for (j = 0; j <= TAPS; j++)
-		{
-			if (--local->mcur[j] < 0)
-				local->mcur[j] = MEMSIZE - 1;
-
-			phase[j].out +=
-				(history[local->mcur[j]] - phase[j].out) * tapfilt[j] * depth;
-		}
 		/*
 		 * This is resampling but it does not currently work
-		history[local->mcur[TAPS]] = *source * rs + ph * (1.0 - rs);
-		history[local->mcur[TAPS]] = rs * (*source - ph) + ph;
+		delayLinePut(&local->dl, *source * rs + ph * (1.0 - rs));
+		delayLinePut(&local->dl, rs * (*source - ph) + ph);
 		 */
-		history[local->mcur[TAPS]] = *source;
+		delayLinePut(&local->dl, *source);
+
+		for (j = 0; j < TAPS; j++)
+			phase[j].out += (delayLineAt(&local->dl, local->tapd[j])
+				- phase[j].out) * tapfilt[j] * depth;
 
 		/*
 		 * See if we need to move the tap forward. We seem to have 32 taps but
@@ -538,8 +532,11 @@ hammondchorusinit(bristolOP **operator, int index, int samplerate, int samplecou
 	(*operator)->specs = (bristolOPSpec *) specs;
 	(*operator)->size = sizeof(bristolHCHORUS);
 
-	upgain = (float *) bristolmalloc0(sizeof(float) * 2048);
-	downgain = (float *) bristolmalloc0(sizeof(float) * 2048);
+	/* The tables are shared, the engine may be started again */
+	if (upgain == NULL)
+		upgain = (float *) bristolmalloc0(sizeof(float) * 2048);
+	if (downgain == NULL)
+		downgain = (float *) bristolmalloc0(sizeof(float) * 2048);
 
 	fillGainTable(upgain, scanrate);
 	fillDrainTable(downgain, scanrate);
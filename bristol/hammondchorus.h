@@ -22,9 +22,11 @@
 #ifndef HCHORUS_H
 #define HCHORUS_H
 
+#include "delayline.h"
+
 #define TAPS 9
 #define HISTSIZE 32
-#define MEMSIZE (HISTSIZE * TAPS)
+#define MEMSIZE 512 /* power of two over HISTSIZE * TAPS */
 
 typedef struct BristolHCHORUS {
 	bristolOPSpec spec;
@@ -50,9 +52,8 @@ typedef struct BristolHCHORUSlocal {
 	float g4;
 	float g5;
 	float g6;
-	int mstart[TAPS+1];
-	int mend[TAPS+1];
-	int mcur[TAPS+1];
+	bristolDelayLine dl;
+	int tapd[TAPS];
 } bristolHCHORUSlocal;
 
 #endif /* HCHORUS_H */
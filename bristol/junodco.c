@@ -72,14 +72,14 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
-	bristolfree(((bristolJUNODCO *) operator)->wave[0]);
-	bristolfree(((bristolJUNODCO *) operator)->wave[1]);
-	bristolfree(((bristolJUNODCO *) operator)->wave[2]);
-	bristolfree(((bristolJUNODCO *) operator)->wave[3]);
-	bristolfree(((bristolJUNODCO *) operator)->wave[4]);
-	bristolfree(((bristolJUNODCO *) operator)->wave[5]);
-	bristolfree(((bristolJUNODCO *) operator)->wave[6]);
-	bristolfree(((bristolJUNODCO *) operator)->wave[7]);
+	bristolfree(((bristolJUNODCO *) operator->specs)->wave[0]);
+	bristolfree(((bristolJUNODCO *) operator->specs)->wave[1]);
+	bristolfree(((bristolJUNODCO *) operator->specs)->wave[2]);
+	bristolfree(((bristolJUNODCO *) operator->specs)->wave[3]);
+	bristolfree(((bristolJUNODCO *) operator->specs)->wave[4]);
+	bristolfree(((bristolJUNODCO *) operator->specs)->wave[5]);
+	bristolfree(((bristolJUNODCO *) operator->specs)->wave[6]);
+	bristolfree(((bristolJUNODCO *) operator->specs)->wave[7]);
 
 	bristolfree(operator->specs);
 
@@ -273,8 +273,9 @@ static int operate(bristolOP *operator,
 	void *lcl)
 {
 	bristolJUNODCOlocal *local = lcl;
-	register int obp, count, dosquare, cpwm;
-	register float *ib, *ob, *mb, *wt, wtp, gain, transp, subgain, subw;
+	register int obp, count, dosquare, cpwm, shift;
+	register float *ib, *ob, *mb, *wt, gain, transp, subgain, subw;
+	bristolPhase phase, step;
 	register float width;
 	bristolJUNODCO *specs;
 
@@ -291,11 +292,11 @@ static int operate(bristolOP *operator,
 	wt = (float *) param->param[0].mem;
 	width = param->param[0].float_val;
 	dosquare = param->param[7].int_val;
-	wtp = local->wtp;
+	shift = waveCoreShift(JUNODCO_WAVE_SZE);
 	gain = param->param[3].float_val * 2;
 	subgain = param->param[6].float_val;
 	transp = param->param[1].float_val * param->param[2].float_val;
-	wtp = local->wtp;
+	phase = local->phase;
 	subw = local->subw;
 	cpwm = local->cpwm;
 
@@ -316,7 +317,7 @@ static int operate(bristolOP *operator,
 		wt = (float *) param->param[0].mem;
 
 	if (voice->flags & BRISTOL_KEYON)
-		wtp = 0;
+		phase = 0;
 
 /*printf("%f, %f, %f\n", mb[0], mb[128], mb[200]); */
 	/*
@@ -329,7 +330,7 @@ static int operate(bristolOP *operator,
 		 * Take a sample from the wavetable into the output buffer. This 
 		 * should also be scaled by gain parameter.
 		 */
-		ob[obp] += (wt[(int) wtp] + subw * subgain) * gain;
+		ob[obp] += (wt[phase >> shift] + subw * subgain) * gain;
 		/*
 		 * The PWM wave should actually be twice the running frequency. It may
 		 * be easier to make the subwave a calculated operation, and make that
@@ -338,7 +339,7 @@ static int operate(bristolOP *operator,
 		 */
 		if (dosquare)
 		{
-			if (wtp > width - *mb++)
+			if (waveCorePos(phase, shift) > width - *mb++)
 			{
 				if (cpwm <= 0)
 					cpwm = BRISTOL_SQR;
@@ -352,11 +353,12 @@ static int operate(bristolOP *operator,
 		subw *= 0.98;
 		/*
 		 * Move the wavetable pointer forward by amount indicated in input 
-		 * buffer for this sample. Toggle the subwave index with each cycle.
+		 * buffer for this sample. Toggle the subwave index with each cycle,
+		 * the phase wraps by itself in either direction.
 		 */
-		if ((wtp += ib[obp++] * transp) >= JUNODCO_WAVE_SZE)
+		step = waveCoreStep(ib[obp++] * transp, shift);
+		if ((phase += step) < step && (int) step > 0)
 		{
-			wtp -= JUNODCO_WAVE_SZE;
 			if (subw == 0)
 				subw = BRISTOL_SQR;
 			else {
@@ -366,15 +368,9 @@ static int operate(bristolOP *operator,
 					subw = BRISTOL_SQR;
 			}
 		}
-		/*
-		 * If we have gone negative, round back up. Allows us to run the 
-		 * oscillator backwards.
-		 */
-		if (wtp < 0)
-			wtp += JUNODCO_WAVE_SZE;
 	}
 
-	local->wtp = wtp;
+	local->phase = phase;
 	local->subw = subw;
 	local->cpwm = cpwm;
 	return(0);
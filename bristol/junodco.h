@@ -22,6 +22,8 @@
 #ifndef JUNODCO_H
 #define JUNODCO_H
 
+#include "wavecore.h"
+
 #define JUNODCO_WAVE_SZE 1024
 
 typedef struct BristolJUNODCO {
@@ -31,7 +33,7 @@ typedef struct BristolJUNODCO {
 
 typedef struct BristolJUNODCOlocal {
 	unsigned int flags;
-	float wtp;
+	bristolPhase phase;
 	float subw;
 	float cpwm;
 	float note_diff;
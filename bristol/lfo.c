@@ -59,7 +59,6 @@ static float note_diff;
 #define LFO_WAVE_COUNT 6
 
 static void fillWave();
-static float *bitbucket = NULL;
 
 /*
  * Reset any local memory information.
@@ -73,15 +72,16 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
-	bristolfree(((bristolLFO *) operator)->wave[0]);
-	bristolfree(((bristolLFO *) operator)->wave[1]);
-	bristolfree(((bristolLFO *) operator)->wave[2]);
-	bristolfree(((bristolLFO *) operator)->wave[3]);
-	bristolfree(((bristolLFO *) operator)->wave[4]);
-	bristolfree(((bristolLFO *) operator)->wave[5]);
-	bristolfree(((bristolLFO *) operator)->wave[6]);
-	bristolfree(((bristolLFO *) operator)->wave[7]);
-
+	bristolfree(((bristolLFO *) operator->specs)->wave[0]);
+	bristolfree(((bristolLFO *) operator->specs)->wave[1]);
+	bristolfree(((bristolLFO *) operator->specs)->wave[2]);
+	bristolfree(((bristolLFO *) operator->specs)->wave[3]);
+	bristolfree(((bristolLFO *) operator->specs)->wave[4]);
+	bristolfree(((bristolLFO *) operator->specs)->wave[5]);
+	bristolfree(((bristolLFO *) operator->specs)->wave[6]);
+	bristolfree(((bristolLFO *) operator->specs)->wave[7]);
+
+	bristolfree(((bristolLFO *) operator->specs)->bitbucket);
 	bristolfree(operator->specs);
 
 	/*
@@ -199,8 +199,9 @@ static int operate(bristolOP *operator,
 	void *lcl)
 {
 	bristolLFOlocal *local = lcl;
-	register int obp = 0, count;
-	register float *ib, *ob, *sb, *shb, *wt, *wt2, wtp, freq, sandh;
+	register int obp = 0, count, shift, i;
+	register float *ib, *ob, *sb, *shb, *wt, *wt2, freq, sandh;
+	bristolPhase phase, step;
 	register float *sine, *wt3, *ramp, *dramp, *wt4, *wt5;
 	bristolLFO *specs;
 
@@ -214,29 +215,31 @@ static int operate(bristolOP *operator,
 
 	ib = specs->spec.io[LFO_IN_IND].buf;
 	if ((ob = specs->spec.io[LFO_TRI_IND].buf) == NULL)
-		ob = bitbucket;
+		ob = specs->bitbucket;
 	if ((sb = specs->spec.io[LFO_SQUARE_IND].buf) == NULL)
-		sb = bitbucket;
+		sb = specs->bitbucket;
 	if ((shb = specs->spec.io[LFO_SH_IND].buf) == NULL)
-		shb = bitbucket;
+		shb = specs->bitbucket;
 	if ((sine = specs->spec.io[LFO_SINE_IND].buf) == NULL)
-		sine = bitbucket;
+		sine = specs->bitbucket;
 	if ((ramp = specs->spec.io[LFO_RAMP_IND].buf) == NULL)
-		ramp = bitbucket;
+		ramp = specs->bitbucket;
 	if ((dramp = specs->spec.io[LFO_DRAMP_IND].buf) == NULL)
-		dramp = bitbucket;
+		dramp = specs->bitbucket;
 
 	wt = specs->wave[4]; /* triwave */
 	wt2 = specs->wave[1]; /* square wave */
 	wt3 = specs->wave[0]; /* sine wave */
 	wt4 = specs->wave[3]; /* ramp wave */
 	wt5 = specs->wave[7]; /* down ramp wave */
-	wtp = local->wtp;
+	shift = waveCoreShift(LFO_WAVE_SZE);
+	phase = local->phase;
 	sandh = local->sandh;
 
 	freq = param->param[0].float_val
 		+ voice->velocity * param->param[2].float_val
 		+ voice->baudio->contcontroller[1] * param->param[3].float_val;
+	step = waveCoreStep(freq, shift);
 
 	/*
 	 * There is some awkward logic here. The sync flags was typically only
@@ -248,7 +251,7 @@ static int operate(bristolOP *operator,
 	if (((voice->flags & BRISTOL_KEYON) || (voice->flags & BRISTOL_KEYREON))
 		&& (param->param[1].int_val != 0))
 	{
-		wtp = 0;
+		phase = 0;
 
 		/* if ((~voice->flags & BRISTOL_KEYREON) && */
 		if ((voice->offset > 0) && (voice->offset < count))
@@ -275,33 +278,24 @@ static int operate(bristolOP *operator,
 		/*
 		 * Take a sample from the wavetable into the output buffer.
 		 */
-		ob[obp] = wt[(int) wtp];
-		sb[obp] = wt2[(int) wtp];
-		sine[obp] = wt3[(int) wtp];
-		ramp[obp] = wt4[(int) wtp];
-		dramp[obp] = wt5[(int) wtp];
+		i = phase >> shift;
+		ob[obp] = wt[i];
+		sb[obp] = wt2[i];
+		sine[obp] = wt3[i];
+		ramp[obp] = wt4[i];
+		dramp[obp] = wt5[i];
 		shb[obp] = sandh;
 
 		/*
-		 * Move the wavetable pointer forward by amount indicated in input 
-		 * buffer for this sample.
-		 */
-		if ((wtp += freq) >= LFO_WAVE_SZE)
-		{
-			wtp -= LFO_WAVE_SZE;
-			if (ib)
-				sandh = ib[obp];
-		}
-
-		/*
-		 * If we have gone negative, round back up. Allows us to run the 
-		 * oscillator backwards.
+		 * Move the wavetable pointer forward by the rate. The phase wraps by
+		 * itself, running backwards included, but only the forward wrap takes
+		 * a new sample and hold value.
 		 */
-		if (wtp < 0)
-			wtp += LFO_WAVE_SZE;
+		if ((phase += step) < step && (int) step > 0 && ib)
+			sandh = ib[obp];
 	}
 
-	local->wtp = wtp;
+	local->phase = phase;
 	local->sandh = sandh;
 	return(0);
 }
@@ -324,10 +318,6 @@ lfoinit(bristolOP **operator, int index, int samplerate, int samplecount)
 
 	note_diff = pow(2, ((double) 1)/12);
 
-	if (bitbucket == NULL)
-		bitbucket = bristolmalloc(sizeof(float) * samplecount);
-		
-
 	/*
 	 * Then the local parameters specific to this operator. These will be
 	 * the same for each operator, but must be init'ed in the local code.
@@ -340,6 +330,8 @@ lfoinit(bristolOP **operator, int index, int samplerate, int samplecount)
 	specs = (bristolLFO *) bristolmalloc0(sizeof(bristolLFO));
 	(*operator)->specs = (bristolOPSpec *) specs;
 	(*operator)->size = sizeof(bristolLFO);
+
+	specs->bitbucket = bristolmalloc(sizeof(float) * samplecount);
 	/*
 	 * These are specific to this operator, and will need to be altered for
 	 * each operator.
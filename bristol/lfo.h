@@ -22,16 +22,19 @@
 #ifndef LFO_H
 #define LFO_H
 
+#include "wavecore.h"
+
 #define LFO_WAVE_SZE 16384
 
 typedef struct BristolLFO {
 	bristolOPSpec spec;
 	float *wave[8];
+	float *bitbucket; /* Outputs nobody reads */
 } bristolLFO;
 
 typedef struct BristolLFOlocal {
 	unsigned int flags;
-	float wtp;
+	bristolPhase phase;
 	float sandh;
 	float note_diff;
 	int tune_diff;
@@ -558,6 +558,10 @@ static int midiSystem(audioMain *audiomain, bristolMidiMsg *msg)
 					baudio->sound[msg->params.bristol.operator]->param,
 					msg->params.bristol.controller,
 					(float) adjusted);
+
+			bristolWorkersParam(audiomain,
+				baudio->sound[msg->params.bristol.operator],
+				msg->params.bristol.controller, (float) adjusted);
 		} else {
 			/*
 			 * Pass the event on to any global controller registered by
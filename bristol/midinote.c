@@ -24,11 +24,15 @@
 #include <stdlib.h>
 #include <math.h>
 #include "bristol.h"
+#include "noisecore.h"
 
 extern bristolMidiHandler bristolMidiRoutines;
 
 int rbMidiNoteOn(audioMain *, bristolMidiMsg *);
 int rbMidiNoteOff(audioMain *, bristolMidiMsg *);
+#ifndef BRISTOL_SEMAPHORE
+static int doRbMidiNoteOn(audioMain *, bristolMidiMsg *, Baudio *);
+#endif
 
 /*
  * Monophonic voice logic
@@ -272,6 +276,94 @@ printPlayList(audioMain *audiomain)
 	}
 }
 
+#ifndef BRISTOL_SEMAPHORE
+/*
+ * Pack a note event into the compact ringbuffer record for the audio thread.
+ * We resolve the first emulation on this channel here in the MIDI thread so
+ * that the audio thread does not have to walk the whole audiolist, and note
+ * on events that nobody is listening to never make it into the ringbuffer.
+ * The audio thread still does all the key range and holddown checks.
+ */
+static int
+rbMidiNoteWrite(audioMain *audiomain, bristolMidiMsg *msg)
+{
+	bristolEventMsg event;
+	Baudio *baudio;
+
+	event.sid = -1;
+
+	for (baudio = audiomain->audiolist; baudio != NULL; baudio = baudio->next)
+	{
+		if (baudio->mixflags & BRISTOL_REMOVE)
+			continue;
+
+		if ((baudio->midichannel == msg->channel)
+			|| (baudio->midichannel == BRISTOL_CHAN_OMNI))
+		{
+			event.sid = baudio->sid;
+			break;
+		}
+	}
+
+	if ((event.sid < 0)
+		&& ((msg->command & MIDI_COMMAND_MASK) == MIDI_NOTE_ON))
+		return(0);
+
+	event.offset = msg->offset;
+	event.command = msg->command;
+	event.channel = msg->channel;
+	event.key = msg->params.key.key;
+	event.velocity = msg->params.key.velocity;
+	event.flags = msg->params.key.flags;
+	event.midiHandle = msg->midiHandle;
+	event.sequence = msg->sequence;
+
+	if (jack_ringbuffer_write_space(audiomain->rb) >= sizeof(bristolEventMsg))
+		jack_ringbuffer_write(audiomain->rb, (char *) &event,
+			sizeof(bristolEventMsg));
+	else
+		printf("ringbuffer exhausted, note %s event dropped\n",
+			((msg->command & MIDI_COMMAND_MASK) == MIDI_NOTE_ON)? "on":"off");
+
+	return(0);
+}
+#endif
+
+/*
+ * System realtime clock and transport for the arpeggiator and sequencer. The
+ * clock filter lives in the audio thread so these go through the ringbuffer
+ * with the notes to keep their order and their frame offsets.
+ */
+int
+midiClock(audioMain *audiomain, bristolMidiMsg *msg)
+{
+#ifdef BRISTOL_SEMAPHORE
+	bristolArpeggiatorClock(audiomain, msg->command, msg->offset);
+#else
+	bristolEventMsg event;
+
+	if ((msg->params.key.flags & BRISTOL_KF_JACK)
+		&& (~audiomain->flags & BRISTOL_JACK_DUAL))
+	{
+		bristolArpeggiatorClock(audiomain, msg->command, msg->offset);
+		return(0);
+	}
+
+	memset(&event, 0, sizeof(bristolEventMsg));
+	event.offset = msg->offset;
+	event.command = msg->command;
+	event.midiHandle = msg->midiHandle;
+	event.sequence = msg->sequence;
+	event.sid = -1;
+
+	if (jack_ringbuffer_write_space(audiomain->rb) >= sizeof(bristolEventMsg))
+		jack_ringbuffer_write(audiomain->rb, (char *) &event,
+			sizeof(bristolEventMsg));
+#endif
+
+	return(0);
+}
+
 /*
  * There will be a lot of processing involved with MIDI note on/off management,
  * so it has been pulled into a separate file.
@@ -308,13 +400,9 @@ printf("midiNoteOff %i\n", msg->params.key.key);
 	    if ((audiomain->debuglevel & BRISTOL_DEBUG_MASK) > BRISTOL_DEBUG2)
 			printf("direct off call\n");
 		return(rbMidiNoteOff(audiomain, msg));
-	} if (jack_ringbuffer_write_space(audiomain->rb) >= sizeof(bristolMidiMsg))
-		jack_ringbuffer_write(audiomain->rb, (char *) msg,
-			sizeof(bristolMidiMsg));
-	else
-		printf("ringbuffer exhausted, note off event dropped\n");
+	}
 
-	return(0);
+	return(rbMidiNoteWrite(audiomain, msg));
 }
 
 int
@@ -467,8 +555,6 @@ msg->offset = 101;
 }
 
 static int arbitrary = 0x12365302;
-static int nx1 = 0x67452301;
-static int nx2 = 0xefcdab89;
 
 /*
  * Find a free voice, or take one off the current playlist.
@@ -599,11 +685,9 @@ doMidiNoteOn(audioMain *audiomain, bristolMidiMsg *msg, Baudio *baudio, int key)
 		 * increase the frequency
 		arbitrary = rand();
 		 *
-		 * This is a noise generator and is cheaper than rand?
+		 * This is the noise service and is cheaper than rand.
 		 */
-		nx1 ^= nx2;
-		arbitrary += nx2;
-		nx2 += nx1;
+		arbitrary = noiseCoreRand();
 
 		if (arbitrary > (RAND_MAX>>1))
 		{
@@ -779,7 +863,8 @@ doMidiNoteOn(audioMain *audiomain, bristolMidiMsg *msg, Baudio *baudio, int key)
 			 */
 			if (baudio->voicecount == 1)
 			{
-				voice->flags &= ~(BRISTOL_KEYON|BRISTOL_KEYDONE|BRISTOL_KEYOFF);
+				voice->flags &= ~(BRISTOL_KEYON|BRISTOL_KEYDONE|BRISTOL_KEYOFF
+					|BRISTOL_KEYSTEAL);
 				//|BRISTOL_KEYOFFING);
 				voice->flags |= BRISTOL_KEYREON;
 
@@ -821,10 +906,22 @@ doMidiNoteOn(audioMain *audiomain, bristolMidiMsg *msg, Baudio *baudio, int key)
 	if (voice == NULL) {
 		if (donevoice != NULL) // Take a voice that is going off
 			voice = donevoice;
-		else if (last != NULL) // Take the last voice for this synth
+		else if (last != NULL) { // Take the last voice for this synth
 			voice = last;
-		else // Steal the oldest note
-			voice = audiomain->playlast;
+			audiomain->telemetry.steals++;
+		} else {
+			/*
+			 * Steal the oldest note from an emulation that is using more
+			 * than its reserved voices.
+			 */
+			for (voice = audiomain->playlast; voice != NULL;
+				voice = voice->last)
+				if ((voice->baudio == NULL) || (voice->baudio->reserved == 0)
+					|| (voice->baudio->lvoices > voice->baudio->reserved))
+					break;
+			if (voice != NULL)
+				audiomain->telemetry.steals++;
+		}
 	}
 
 	if (voice != NULL)
@@ -852,6 +949,11 @@ doMidiNoteOn(audioMain *audiomain, bristolMidiMsg *msg, Baudio *baudio, int key)
 		voice->flags &= ~(BRISTOL_KEYON|BRISTOL_KEYREON);
 		if (voice->baudio == baudio)
 			voice->flags |= BRISTOL_KEYREON;
+		else {
+			/* Taken from another emulation */
+			voice->baudio = baudio;
+			voice->locals = baudio->locals;
+		}
 
 		voice->keyid = key;
 		voice->offset = offset;
@@ -911,19 +1013,25 @@ midiNoteOn(audioMain *audiomain, bristolMidiMsg *msg)
 	    if ((audiomain->debuglevel & BRISTOL_DEBUG_MASK) > BRISTOL_DEBUG2)
 			printf("direct on call\n");
 		return(rbMidiNoteOn(audiomain, msg));
-	} if (jack_ringbuffer_write_space(audiomain->rb) >= sizeof(bristolMidiMsg))
-		jack_ringbuffer_write(audiomain->rb, (char *) msg,
-			sizeof(bristolMidiMsg));
-	else
-		printf("ringbuffer exhausted, note on event dropped\n");
+	}
 
-	return(0);
+	return(rbMidiNoteWrite(audiomain, msg));
 }
 
 int
 rbMidiNoteOn(audioMain *audiomain, bristolMidiMsg *msg)
 {
-	Baudio *baudio = audiomain->audiolist;
+	return(doRbMidiNoteOn(audiomain, msg, audiomain->audiolist));
+}
+
+/*
+ * The baudio is where we start the search for emulations on this channel, it
+ * will be the head of the audiolist unless the MIDI thread already resolved
+ * the first one that matched.
+ */
+static int
+doRbMidiNoteOn(audioMain *audiomain, bristolMidiMsg *msg, Baudio *baudio)
+{
 #endif
 	/*
 	 * Hm, if we have already applied a velocity curve then this value that
@@ -1066,16 +1174,48 @@ allNotesOff(audioMain *audiomain, int channel)
 }
 
 #ifndef BRISTOL_SEMAPHORE
+/*
+ * Unpack the ringbuffer record into a local message for the note handlers,
+ * only the fields they use are filled.
+ */
 void
-rbMidiNote(audioMain *audiomain, bristolMidiMsg *msg)
+rbMidiNote(audioMain *audiomain, bristolEventMsg *event)
 {
-	if ((audiomain->debuglevel & BRISTOL_DEBUG_MASK) > BRISTOL_DEBUG2)
-		printf("rbMidiNote(%x) %x\n", msg->command, msg->params.key.flags);
+	bristolMidiMsg msg;
+	Baudio *baudio = audiomain->audiolist;
 
-	if ((msg->command & MIDI_COMMAND_MASK) == MIDI_NOTE_ON)
-		rbMidiNoteOn(audiomain, msg);
-	else if ((msg->command & MIDI_COMMAND_MASK) == MIDI_NOTE_OFF)
-		rbMidiNoteOff(audiomain, msg);
+	if ((audiomain->debuglevel & BRISTOL_DEBUG_MASK) > BRISTOL_DEBUG2)
+		printf("rbMidiNote(%x) %x\n", event->command, event->flags);
+
+	msg.midiHandle = event->midiHandle;
+	msg.channel = event->channel;
+	msg.mychannel = event->channel;
+	msg.command = event->command;
+	msg.timestamp.tv_sec = msg.timestamp.tv_usec = 0;
+	msg.offset = event->offset;
+	msg.sequence = event->sequence;
+	msg.params.key.key = event->key;
+	msg.params.key.velocity = event->velocity;
+	msg.params.key.flags = event->flags;
+
+	if ((msg.command & MIDI_COMMAND_MASK) == MIDI_NOTE_ON)
+	{
+		/*
+		 * If the emulation the MIDI thread resolved has since gone then fall
+		 * back to the full list.
+		 */
+		while ((baudio != NULL) && (baudio->sid != event->sid))
+			baudio = baudio->next;
+		if (baudio == NULL)
+			baudio = audiomain->audiolist;
+
+		BRISTOL_TRACE_INSTANT("note on", event->key, event->channel);
+		doRbMidiNoteOn(audiomain, &msg, baudio);
+	} else if ((msg.command & MIDI_COMMAND_MASK) == MIDI_NOTE_OFF) {
+		BRISTOL_TRACE_INSTANT("note off", event->key, event->channel);
+		rbMidiNoteOff(audiomain, &msg);
+	} else if ((msg.command >= MIDI_RT_CLOCK) && (msg.command <= MIDI_RT_STOP))
+		bristolArpeggiatorClock(audiomain, msg.command, msg.offset);
 }
 #endif
 
@@ -36,6 +36,7 @@ static char sem_short_name[32];
 extern int midiExitReq;
 
 extern int midiCheck();
+extern int midiClock(audioMain *, bristolMidiMsg *);
 extern void initMidiRoutines();
 extern void checkcallbacks(bristolMidiMsg *);
 
@@ -149,15 +150,27 @@ midiThreadSaveReq(audioMain *audiomain)
 int
 midiMsgForwarder(bristolMidiMsg *msg)
 {
+	unsigned char rec[sizeof(bristolMidiFwdHdr) + BRISTOL_MIDI_RAWSIZE];
+	bristolMidiFwdHdr *hdr = (bristolMidiFwdHdr *) rec;
+	int count;
+
 	/*
 	 * Take bristol MIDI messages, write them into the forwarding path ring
-	 * buffer.
+	 * buffer. They go in as they will go on the wire, a controller is then
+	 * a few bytes rather than a whole bristolMidiMsg and a burst of them
+	 * no longer overflows the ringbuffer between passes of the parent.
 	 */
-	if (jack_ringbuffer_write_space(audiomain.rbfp) >= sizeof(bristolMidiMsg))
-		jack_ringbuffer_write(audiomain.rbfp,
-			(char *) msg,
-			sizeof(bristolMidiMsg));
-	
+	if ((count = bristolMidiRawEncode(msg, msg->params.bristol.msgLen,
+		&rec[sizeof(bristolMidiFwdHdr)], BRISTOL_MIDI_RAWSIZE)) < 0)
+		return(0);
+
+	hdr->dev = msg->mychannel;
+	hdr->count = count;
+	count += sizeof(bristolMidiFwdHdr);
+
+	if (jack_ringbuffer_write_space(audiomain.rbfp) >= count)
+		jack_ringbuffer_write(audiomain.rbfp, (char *) rec, count);
+
 	return(0);
 }
 #endif
@@ -172,6 +185,27 @@ midiMsgHandler(bristolMidiMsg *msg, audioMain *audiomain)
 	printMidiMsg(msg);
 #endif
 
+	/*
+	 * System realtime has no channel and does not go to the handler table
+	 */
+	if ((msg->command >= MIDI_RT_CLOCK) && (msg->command <= MIDI_RT_STOP))
+		return(midiClock(audiomain, msg));
+
+#ifndef BRISTOL_SEMAPHORE
+	/*
+	 * -midiecho: the sequencer input goes back out of our port as it came
+	 * in, before any mapping. It takes the forwarding ring, the parent sends
+	 * each period's worth with one drain.
+	 */
+	if ((audiomain->midiecho)
+		&& (msg->params.bristol.from
+			== bristolGetMidiFD(audiomain->midiHandle)))
+	{
+		msg->mychannel = msg->params.bristol.from;
+		midiMsgForwarder(msg);
+	}
+#endif
+
 	/*
 	 * Depending on the message type, handle the message. If this is a note
 	 * event, channel or poly pressure then we will have to apply the value
@@ -211,21 +245,15 @@ midiMsgHandler(bristolMidiMsg *msg, audioMain *audiomain)
 extern int exitReq;
 static char *bSMD = "128.1";
 
-void *
-midiThread(audioMain *audiomain)
+/*
+ * Everything the MIDI handlers need before the first event, the handler table
+ * and the paths to the audio thread. The embedded engine has no MIDI thread
+ * and calls this itself.
+ */
+int
+initMidiEngine(audioMain *audiomain)
 {
-	int flags = BRISTOL_CONN_MIDI, exitstatus = -1, i;
-#if (BRISTOL_HAS_ALSA == 1)
-	char *device = bAMD;
-#else
-	char *device = bOMD;
-#endif
-
-#ifdef DEBUG
-	printf("starting MIDI thread\n");
-#endif
-
-	audiomain->mtStatus = BRISTOL_WAIT;
+	int i;
 
 	initMidiRoutines(audiomain, bristolMidiRoutines.bmr);
 	/*
@@ -272,10 +300,7 @@ midiThread(audioMain *audiomain)
 	{
 		perror("sem_open");
 		printf("could not get the long semaphore\n");
-		audiomain->atReq = BRISTOL_REQSTOP;
-		exitReq = 1;
-
-		pthread_exit(&exitstatus);
+		return(-1);
 	}
 
 #ifdef BRISTOL_SEM_OPEN
@@ -287,9 +312,7 @@ midiThread(audioMain *audiomain)
 	{
 		perror("sem_open");   
 		printf("could not get the short semaphore\n");
-		audiomain->atReq = BRISTOL_REQSTOP;
-		exitReq = 1;
-		pthread_exit(&exitstatus);
+		return(-1);
 	}
 #else /* BRISTOL_SEMAPHORE */
 	/*
@@ -300,7 +323,11 @@ midiThread(audioMain *audiomain)
 	audiomain->rb = jack_ringbuffer_create(8192);
 	jack_ringbuffer_mlock(audiomain->rb);
 	jack_ringbuffer_reset(audiomain->rb);
-	audiomain->rbfp = jack_ringbuffer_create(8192);
+	/*
+	 * The forwarding thread only drains this every 25ms, it is sized for a
+	 * burst of several thousand encoded events between passes.
+	 */
+	audiomain->rbfp = jack_ringbuffer_create(65536);
 	jack_ringbuffer_mlock(audiomain->rbfp);
 	jack_ringbuffer_reset(audiomain->rbfp);
 
@@ -311,6 +338,55 @@ midiThread(audioMain *audiomain)
 	jack_ringbuffer_go(audiomain->rbfp);
 #endif /* BRISTOL_SEMAPHORE */
 
+	return(0);
+}
+
+void
+closeMidiEngine(audioMain *audiomain)
+{
+#ifdef BRISTOL_SEMAPHORE
+#ifdef BRISTOL_SEM_OPEN
+	sem_close(audiomain->sem_long);
+	sem_close(audiomain->sem_short);
+	sem_unlink(sem_long_name);
+	sem_unlink(sem_short_name);
+#else
+	sem_destroy(audiomain->sem_long);
+	sem_destroy(audiomain->sem_short);
+	bristolfree(audiomain->sem_long);
+	bristolfree(audiomain->sem_short);
+#endif
+#else
+	jack_ringbuffer_free(audiomain->rb);
+	jack_ringbuffer_free(audiomain->rbfp);
+#endif /* SEMAPHORE */
+}
+
+void *
+midiThread(audioMain *audiomain)
+{
+	int flags = BRISTOL_CONN_MIDI, exitstatus = -1;
+#if (BRISTOL_HAS_ALSA == 1)
+	char *device = bAMD;
+#else
+	char *device = bOMD;
+#endif
+
+#ifdef DEBUG
+	printf("starting MIDI thread\n");
+#endif
+
+	audiomain->mtStatus = BRISTOL_WAIT;
+
+	bristolTraceThread("midi");
+
+	if (initMidiEngine(audiomain) < 0)
+	{
+		audiomain->atReq = BRISTOL_REQSTOP;
+		exitReq = 1;
+		pthread_exit(&exitstatus);
+	}
+
 	if ((audiomain->flags & BRISTOL_MIDIMASK) == BRISTOL_MIDI_OSS)
 	{
 		printf("MIDI oss\n");
@@ -367,10 +443,20 @@ midiThread(audioMain *audiomain)
 
 	printf("midiOpen: %i(%x)\n", audiomain->port, flags);
 
+	/* The echo needs an output port, only the sequencer interface has one */
+	if ((audiomain->midiecho)
+		&& ((audiomain->flags & BRISTOL_MIDIMASK) != BRISTOL_MIDI_SEQ))
+	{
+		printf("-midiecho needs -midi seq, ignored\n");
+		audiomain->midiecho = 0;
+	}
+
 	if ((audiomain->flags &
 			(BRISTOL_MIDI_SEQ|BRISTOL_MIDI_ALSA|BRISTOL_MIDI_OSS))
 		&& ((audiomain->midiHandle
-			= bristolMidiOpen(device, flags|BRISTOL_RDONLY, -1, BRISTOL_REQ_NSX,
+			= bristolMidiOpen(device,
+				flags|(audiomain->midiecho? BRISTOL_DUPLEX:BRISTOL_RDONLY),
+				-1, BRISTOL_REQ_NSX,
 				midiMsgHandler, audiomain)) < 0))
 	{
 		printf("Error opening MIDI device %s/%i, exiting MIDI thread\n",
@@ -383,6 +469,15 @@ midiThread(audioMain *audiomain)
 	} else
 		printf("opened MIDI device %s\n", device);
 
+	/* Echoed events are held until the parent flushes them */
+	if ((audiomain->midiecho)
+		&& (bristolMidiOutputBatch(audiomain->midiHandle, 0)
+			!= BRISTOL_MIDI_OK))
+	{
+		printf("Cannot batch MIDI output, no echo\n");
+		audiomain->midiecho = 0;
+	}
+
 #ifdef DEBUG
 	printf("opened MIDI device: %i/%i\n",
 		audiomain->controlHandle, audiomain->midiHandle);
@@ -409,22 +504,7 @@ midiThread(audioMain *audiomain)
 
 	printf("midiThread exiting\n");
 
-#ifdef BRISTOL_SEMAPHORE
-#ifdef BRISTOL_SEM_OPEN
-	sem_close(audiomain->sem_long);
-	sem_close(audiomain->sem_short);
-	sem_unlink(sem_long_name);
-	sem_unlink(sem_short_name);
-#else
-	sem_destroy(audiomain->sem_long);
-	sem_destroy(audiomain->sem_short);
-	bristolfree(audiomain->sem_long);
-	bristolfree(audiomain->sem_short);
-#endif
-#else
-	jack_ringbuffer_free(audiomain->rb);
-	jack_ringbuffer_free(audiomain->rbfp);
-#endif /* SEMAPHORE */
+	closeMidiEngine(audiomain);
 
 	exitstatus = 0;
 	pthread_exit(&exitstatus);
@@ -38,6 +38,7 @@
 
 #include "bristol.h"
 #include "noise.h"
+#include "noisecore.h"
 
 /*
  * The name of this operator, IO count, and IO names.
@@ -47,9 +48,6 @@
 #define PCOUNT 3
 #define IOCOUNT 1
 
-/* Improves with buffer size since smaller sizes are less random */
-#define NOISESIZE 65536
-
 #define NOISE_OUT_IND 0
 
 /*
@@ -120,43 +118,42 @@ static int param(bristolOP *operator, bristolOPParams *param,
 static static float scale = 2.0f / 0xffffffff;
 static float scale = 24.0f / 0xffffffff;
  */
-static float scale = 0.0001;
-int x1 = 0x67452301;
-int x2 = 0xefcdab89;
+static float scale = 0.0001 * NOISECORE_INT;
 
+/*
+ * The noise comes from the shared service, each voice has its own copy of the
+ * period. Pink is that copy through a one pole lowpass.
+ */
 static int
 gennoise(register bristolOP *operator, bristolVoice *voice,
 	bristolOPParams *param,
 	void *lcl)
 {
 	bristolNOISE *specs = (bristolNOISE *) operator->specs;
-	register int i = specs->spec.io[NOISE_OUT_IND].samplecount;
-	register float level, *ob;
+	register int i, count = specs->spec.io[NOISE_OUT_IND].samplecount;
+	register float level, *ob, *nb;
 	bristolNOISElocal * local = lcl;
 	register float lp, lsv;
 
 	ob = specs->spec.io[NOISE_OUT_IND].buf;
 	level = param->param[0].float_val * scale;
 
-	while (i-=4)
+	if (param->param[1].int_val == 0)
 	{
-		x1 ^= x2; *ob++ += x2 * level; x2 += x1;
-		x1 ^= x2; *ob++ += x2 * level; x2 += x1;
-		x1 ^= x2; *ob++ += x2 * level; x2 += x1;
-		x1 ^= x2; *ob++ += x2 * level; x2 += x1;
-	}
+		nb = noiseCoreWhite(voice->index, count);
+
+		for (i = 0; i < count; i++)
+			ob[i] += nb[i] * level;
 
-	if (param->param[1].int_val == 0)
 		return(0);
+	}
 
 	lp = param->param[2].float_val;
+	nb = noiseCoreWhite(voice->index, count);
 	lsv = local->coff;
 
-	for (i = specs->spec.io[NOISE_OUT_IND].samplecount,
-			ob = specs->spec.io[NOISE_OUT_IND].buf;
-			i > 0;
-			i--, ob++)
-		*ob = (lsv += ((*ob - lsv) * lp));
+	for (i = 0; i < count; i++)
+		ob[i] += (lsv += ((nb[i] - lsv) * lp)) * level;
 
 	local->coff = lsv;
 
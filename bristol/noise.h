@@ -27,7 +27,7 @@ typedef struct BristolNOISE {
 } bristolNOISE;
 
 typedef struct BristolNOISElocal {
-	int coff;
+	float coff;
 	unsigned int flags;
 } bristolNOISElocal;
 
@@ -0,0 +1,210 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * The noise service. The noise operator used to step one global generator a
+ * sample at a time for every voice that used it and the filters, the note
+ * detune and the granular oscillator each had their own. Here the white noise
+ * is generated once per period by NOISECORE_LANES xorshift generators that
+ * step together, a loop the compiler vectorises.
+ *
+ * Every voice has to get noise of its own, voices that sum the same noise,
+ * even delayed, comb filter it. Along with the noise the engine generates a
+ * word of sign bits per sample of the period. A voice's copy is the history
+ * read at an offset of its own with the sign of each sample taken from one
+ * bit of those words, which leaves it white and uncorrelated with the copy of
+ * any other voice, and costs a shift and a multiply per sample. The copy is
+ * made into a buffer of the thread rendering the voice, it is good until that
+ * thread asks for noise again.
+ *
+ * A voice can ask more than once a period, the noise operator and the filter
+ * dither of the same voice, and each of its calls gets another stream. The
+ * calls are counted per thread, a voice is always rendered by one thread.
+ */
+
+#include <string.h>
+
+#include "noisecore.h"
+
+static float white[NOISECORE_SIZE * 2];
+static unsigned int signs[NOISECORE_WINDOW];
+static __thread float voicebuf[NOISECORE_WINDOW];
+static __thread int lastvoice = -1;
+static __thread unsigned int lastwp = 0, calls = 0;
+static unsigned int lane[NOISECORE_LANES];
+static unsigned int wp = 0, period = 0, sequence = 0;
+
+static void
+noiseCoreGenerate(float *buf, int count)
+{
+	unsigned int x[NOISECORE_LANES];
+	int i, j;
+
+	for (i = 0; i < NOISECORE_LANES; i++)
+		x[i] = lane[i];
+
+	for (j = 0; j + NOISECORE_LANES <= count; j += NOISECORE_LANES)
+	{
+		for (i = 0; i < NOISECORE_LANES; i++)
+		{
+			x[i] ^= x[i] << 13;
+			x[i] ^= x[i] >> 17;
+			x[i] ^= x[i] << 5;
+			buf[j + i] = (float) (int) x[i] * (1.0f / NOISECORE_INT);
+		}
+	}
+
+	for (i = 0; j < count; i++, j++)
+	{
+		x[i] ^= x[i] << 13;
+		x[i] ^= x[i] >> 17;
+		x[i] ^= x[i] << 5;
+		buf[j] = (float) (int) x[i] * (1.0f / NOISECORE_INT);
+	}
+
+	for (i = 0; i < NOISECORE_LANES; i++)
+		lane[i] = x[i];
+}
+
+static void
+noiseCoreSigns(unsigned int *buf, int count)
+{
+	unsigned int x[NOISECORE_LANES];
+	int i, j;
+
+	for (i = 0; i < NOISECORE_LANES; i++)
+		x[i] = lane[i];
+
+	for (j = 0; j + NOISECORE_LANES <= count; j += NOISECORE_LANES)
+	{
+		for (i = 0; i < NOISECORE_LANES; i++)
+		{
+			x[i] ^= x[i] << 13;
+			x[i] ^= x[i] >> 17;
+			x[i] ^= x[i] << 5;
+			buf[j + i] = x[i];
+		}
+	}
+
+	for (i = 0; j < count; i++, j++)
+	{
+		x[i] ^= x[i] << 13;
+		x[i] ^= x[i] >> 17;
+		x[i] ^= x[i] << 5;
+		buf[j] = x[i];
+	}
+
+	for (i = 0; i < NOISECORE_LANES; i++)
+		lane[i] = x[i];
+}
+
+static void
+noiseCoreWrite(int count)
+{
+	unsigned int start;
+	int n;
+
+	for (; count > 0; count -= n)
+	{
+		start = wp & NOISECORE_MASK;
+		if ((n = NOISECORE_SIZE - start) > count)
+			n = count;
+
+		noiseCoreGenerate(&white[start], n);
+		memcpy(&white[start + NOISECORE_SIZE], &white[start],
+			n * sizeof(float));
+
+		wp += n;
+	}
+}
+
+/*
+ * Called by the engine once a period before it renders any voice. The first
+ * call fills the whole history.
+ */
+void
+noiseCorePeriod(int count)
+{
+	int i;
+
+	if (count > NOISECORE_WINDOW)
+		count = NOISECORE_WINDOW;
+
+	if (period++ == 0)
+	{
+		for (i = 0; i < NOISECORE_LANES; i++)
+			lane[i] = noiseCoreHash(i + 1) | 1;
+		noiseCoreWrite(NOISECORE_SIZE);
+		noiseCoreSigns(signs, NOISECORE_WINDOW);
+	} else {
+		noiseCoreWrite(count);
+		noiseCoreSigns(signs, count);
+	}
+}
+
+/*
+ * The last 'count' samples of white noise as the given voice has them, count
+ * is at most NOISECORE_WINDOW. Each call of a voice in a period is a stream,
+ * the low bits of the stream pick the sign bit and the rest the offset into
+ * the history, so the first NOISECORE_STREAMS streams differ in their signs
+ * and the later ones in what they read as well.
+ */
+float *
+noiseCoreWhite(int voice, int count)
+{
+	unsigned int stream, shift;
+	float *src;
+	int i, j;
+
+	if (count > NOISECORE_WINDOW)
+		count = NOISECORE_WINDOW;
+
+	if ((voice != lastvoice) || (wp != lastwp))
+	{
+		lastvoice = voice;
+		lastwp = wp;
+		calls = 0;
+	}
+
+	stream = voice * NOISECORE_CALLS + (calls++ % NOISECORE_CALLS);
+	shift = 31 - (stream % NOISECORE_STREAMS);
+	src = &white[(wp - count
+		- (stream / NOISECORE_STREAMS) * NOISECORE_STRIDE % NOISECORE_WINDOW)
+		& NOISECORE_MASK];
+
+	for (j = 0; j + NOISECORE_LANES <= count; j += NOISECORE_LANES)
+		for (i = 0; i < NOISECORE_LANES; i++)
+			voicebuf[j + i] = src[j + i] * (float)
+				(((int) (signs[j + i] << shift) >> 31) | 1);
+
+	for (; j < count; j++)
+		voicebuf[j] = src[j]
+			* (float) (((int) (signs[j] << shift) >> 31) | 1);
+
+	return(voicebuf);
+}
+
+/* Random word for anything that needs one now and again, from any thread */
+unsigned int
+noiseCoreRand()
+{
+	return(noiseCoreHash(__sync_fetch_and_add(&sequence, 0x9e3779b9)));
+}
@@ -0,0 +1,70 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef NOISECORE_H
+#define NOISECORE_H
+
+/*
+ * Noise generated once a period for all the voices. The engine writes the
+ * period of white noise into a history ring before any voice is rendered,
+ * along with a word of sign bits per sample, and each voice gets its own copy
+ * read at its own offset with the signs from one bit, so the copies are
+ * uncorrelated. The ring is mirrored, a read of up to NOISECORE_WINDOW
+ * samples is always contiguous.
+ */
+#define NOISECORE_SIZE 32768
+#define NOISECORE_MASK (NOISECORE_SIZE - 1)
+
+/* Longest read */
+#define NOISECORE_WINDOW (NOISECORE_SIZE / 2)
+
+/* Streams per voice, for the calls it makes in one period */
+#define NOISECORE_CALLS 4
+
+/* Streams told apart by their signs alone, one per bit of the sign words */
+#define NOISECORE_STREAMS 32
+
+/* History offset per NOISECORE_STREAMS streams, a prime, about 23ms */
+#define NOISECORE_STRIDE 1031
+
+/* Generators run side by side, one vector of them per step */
+#define NOISECORE_LANES 8
+
+/* The noise runs +/-1.0, this was the range of the old integer generators */
+#define NOISECORE_INT 2147483648.0f
+
+/* Scrambles a counter into a well mixed word, for reproducible sequences */
+static inline unsigned int
+noiseCoreHash(unsigned int x)
+{
+	x ^= x >> 16;
+	x *= 0x7feb352d;
+	x ^= x >> 15;
+	x *= 0x846ca68b;
+	x ^= x >> 16;
+	return(x);
+}
+
+extern void noiseCorePeriod(int);
+extern float *noiseCoreWhite(int, int);
+extern unsigned int noiseCoreRand();
+
+#endif /* NOISECORE_H */
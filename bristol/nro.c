@@ -134,11 +134,11 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
-	bristolfree(((bristolNRO *) operator)->zb);
-	bristolfree(((bristolNRO *) operator)->fb);
-	bristolfree(((bristolNRO *) operator)->fbm);
-	bristolfree(((bristolNRO *) operator)->pwmb);
-	bristolfree(((bristolNRO *) operator)->sb);
+	bristolfree(((bristolNRO *) operator->specs)->zb);
+	bristolfree(((bristolNRO *) operator->specs)->fb);
+	bristolfree(((bristolNRO *) operator->specs)->fbm);
+	bristolfree(((bristolNRO *) operator->specs)->pwmb);
+	bristolfree(((bristolNRO *) operator->specs)->sb);
 
 	bristolfree(operator->specs);
 
@@ -76,6 +76,7 @@ extern bristolOP * cs80envinit();
 extern bristolOP * trilogyoscinit();
 extern bristolOP * env5stageinit();
 extern bristolOP * nroinit();
+extern bristolOP * fdnreverbinit();
 
 struct bristolPalette {
 	bristolOP * (*initialise)();
@@ -116,7 +117,7 @@ struct bristolPalette {
 	{trilogyoscinit},
 	{env5stageinit},
 	{nroinit},
-	{NULL},
+	{fdnreverbinit}, /* 36 */
 	{NULL},
 	{NULL},
 	{NULL},
@@ -73,7 +73,6 @@ static void buildProphetWave(float *, float , float *, float , float *, float ,
  * We should not be doing this however I need a quick resolution to some issues
  * with sync of square waves and this is a scratch buffer for the edge detector
  */
-static float *sbuf = NULL;
 
 /*
  * Reset any local memory information.
@@ -87,15 +86,16 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
-	bristolfree(((bristolPROPHETDCO *) operator)->wave[0]);
-	bristolfree(((bristolPROPHETDCO *) operator)->wave[1]);
-	bristolfree(((bristolPROPHETDCO *) operator)->wave[2]);
-	bristolfree(((bristolPROPHETDCO *) operator)->wave[3]);
-	bristolfree(((bristolPROPHETDCO *) operator)->wave[4]);
-	bristolfree(((bristolPROPHETDCO *) operator)->wave[5]);
-	bristolfree(((bristolPROPHETDCO *) operator)->wave[6]);
-	bristolfree(((bristolPROPHETDCO *) operator)->wave[7]);
-
+	bristolfree(((bristolPROPHETDCO *) operator->specs)->wave[0]);
+	bristolfree(((bristolPROPHETDCO *) operator->specs)->wave[1]);
+	bristolfree(((bristolPROPHETDCO *) operator->specs)->wave[2]);
+	bristolfree(((bristolPROPHETDCO *) operator->specs)->wave[3]);
+	bristolfree(((bristolPROPHETDCO *) operator->specs)->wave[4]);
+	bristolfree(((bristolPROPHETDCO *) operator->specs)->wave[5]);
+	bristolfree(((bristolPROPHETDCO *) operator->specs)->wave[6]);
+	bristolfree(((bristolPROPHETDCO *) operator->specs)->wave[7]);
+
+	bristolfree(((bristolPROPHETDCO *) operator->specs)->sbuf);
 	bristolfree(operator->specs);
 
 	/*
@@ -106,6 +106,20 @@ static int destroy(bristolOP *operator)
 	return(0);
 }
 
+/*
+ * The voice's waves are built on its first note, they go with its locals.
+ */
+static int freelocal(bristolOP *operator, bristolPROPHETDCOlocal *local)
+{
+	bristolfree(local->wave0);
+	bristolfree(local->wave1);
+	bristolfree(local->wave2);
+
+	local->wave0 = local->wave1 = local->wave2 = NULL;
+
+	return(0);
+}
+
 /*
  * Reset any local memory information.
  */
@@ -385,12 +399,15 @@ static int operate(bristolOP *operator,
 	void *lcl)
 {
 	bristolPROPHETDCOlocal *local = lcl;
-	register int obp, count, dosquare;
+	register int obp, count, dosquare, shift, wdelta;
 	register float *ramp, wtpSqr, gdelta, width, ssg, S1, S2 = 0;
-	register float *ib, *ob, *pwmb, *sb, *wt, wtp, gain, transp, lsv;
+	register float *ib, *ob, *pwmb, *sb, *wt, gain, transp, lsv;
 	bristolPROPHETDCO *specs;
+	bristolPhase phase, phSqr;
+	float *sbuf;
 
 	specs = (bristolPROPHETDCO *) operator->specs;
+	sbuf = specs->sbuf;
 
 #ifdef BRISTOL_DBG
 	printf("prophetdco(%p, %p, %p)\n", operator, param, local);
@@ -419,12 +436,16 @@ static int operate(bristolOP *operator,
 
 	if ((wt = local->wave0) == NULL)
 	{
-		local->wave0 =
-			(float *) bristolmalloc(PROPHETDCO_WAVE_SZE * sizeof(float));
-		local->wave1 =
-			(float *) bristolmalloc(PROPHETDCO_WAVE_SZE * sizeof(float));
-		local->wave2 =
-			(float *) bristolmalloc(PROPHETDCO_WAVE_SZE * sizeof(float));
+		local->wave0 = (float *) bristolmalloc(sizeof(float)
+			* (PROPHETDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+		local->wave1 = (float *) bristolmalloc(sizeof(float)
+			* (PROPHETDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+		local->wave2 = (float *) bristolmalloc(sizeof(float)
+			* (PROPHETDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+
+		/* A voice can start without KEYON, a legato note, build its waves */
+		wt = local->wave0;
+		specs->flags |= PROPHETDCO_REWAVE;
 	}
 	width = param->param[0].float_val; /* Pulse width */
 	dosquare = param->param[6].int_val;
@@ -441,7 +462,8 @@ static int operate(bristolOP *operator,
 	transp = param->param[1].float_val * param->param[2].float_val
 		* param->param[9].float_val * param->param[10].float_val
 		* param->param[11].float_val;
-	wtp = local->wtp;
+	shift = waveCoreShift(PROPHETDCO_WAVE_SZE);
+	phase = local->phase;
 	ramp = specs->wave[3];
 
 	/*
@@ -492,6 +514,9 @@ blo.harmonics, voice->key.key * transp < 95?
 			param->param[8].int_val, specs->wave[7],
 			param->param[4].int_val, specs->wave[3],
 			param->param[5].int_val, specs->wave[4]);
+		waveCoreGuard(local->wave0, PROPHETDCO_WAVE_SZE);
+		waveCoreGuard(local->wave1, PROPHETDCO_WAVE_SZE);
+		waveCoreGuard(local->wave2, PROPHETDCO_WAVE_SZE);
 		specs->flags &= ~PROPHETDCO_REWAVE;
 	}
 
@@ -505,14 +530,10 @@ blo.harmonics, voice->key.key * transp < 95?
 		 * Take a sample from the wavetable into the output buffer. This 
 		 * should also be scaled by gain parameter.
 		 */
-		gdelta = wtp - ((float) ((int) wtp));
+		wdelta = phase >> shift;
+		gdelta = waveCoreFrac(phase, shift);
 
-		if (wtp >= PROPHETDCO_WAVE_SZE_M)
-			S1 = (wt[(int) wtp] + (wt[0] - wt[(int) wtp])
-				* gdelta) * gain;
-		else
-			S1 = (wt[(int) wtp] + ((wt[(int) wtp + 1] - wt[(int) wtp])
-				* gdelta)) * gain;
+		S1 = (wt[wdelta] + ((wt[wdelta + 1] - wt[wdelta]) * gdelta)) * gain;
 
 		/*
 		 * The square has to be computed real time as we are going to have
@@ -523,12 +544,8 @@ blo.harmonics, voice->key.key * transp < 95?
 		 */
 		if (dosquare)
 		{
-			if (wtp >= PROPHETDCO_WAVE_SZE_M)
-				S2 = (ramp[(int) wtp] + (ramp[0] - ramp[(int) wtp])
-					* gdelta) * ssg;
-			else
-				S2 = (ramp[(int) wtp] + ((ramp[(int) wtp + 1] - ramp[(int) wtp])
-					* gdelta)) * ssg;
+			S2 = (ramp[wdelta] + ((ramp[wdelta + 1] - ramp[wdelta])
+				* gdelta)) * ssg;
 
 			/*
 			 * Filled in the ramp wave, now subtract the same waveform with a
@@ -539,22 +556,15 @@ blo.harmonics, voice->key.key * transp < 95?
 			else if (wtpSqr > PROPHETDCO_PW_MAX)
 				wtpSqr = PROPHETDCO_PW_MAX;
 
-			if ((wtpSqr = wtp + wtpSqr) > PROPHETDCO_WAVE_SZE_M)
-				wtpSqr -= PROPHETDCO_WAVE_SZE;
-
-			gdelta = wtpSqr - ((float) ((int) wtpSqr));
+			phSqr = phase + waveCoreStep(wtpSqr, shift);
+			gdelta = waveCoreFrac(phSqr, shift);
 
-			if (wtpSqr == PROPHETDCO_WAVE_SZE_M)
-				S2 -= (ramp[(int) wtpSqr] + (ramp[0] - ramp[(int) wtpSqr])
-					* gdelta) * ssg;
-			else
-				S2 -= (ramp[(int) wtpSqr] + ((ramp[(int) wtpSqr + 1]
-					- ramp[(int) wtpSqr]) * gdelta)) * ssg;
+			S2 -= waveCoreLerp(ramp, phSqr, shift) * ssg;
 		}
 
 		if ((sb) && (sbuf[obp] != 0))
 		{
-			float s1, s2;
+			float s1, s2, wtp = sbuf[obp];
 
 			ssg = -ssg;
 
@@ -562,7 +572,7 @@ blo.harmonics, voice->key.key * transp < 95?
 			 * Sync point. Resample our target sample back to the new origin
 			 * which we are going resample as well from the new wtp offset.
 			 */
-			wtp = sbuf[obp];
+			phase = waveCorePhase(wtp, shift);
 
 			if ((wtpSqr = width + *pwmb + wtp) < PROPHETDCO_PW_MIN)
 				wtpSqr = PROPHETDCO_PW_MIN;
@@ -594,23 +604,12 @@ blo.harmonics, voice->key.key * transp < 95?
 
 		/*
 		 * Move the wavetable pointer forward by amount indicated in input 
-		 * buffer for this sample.
+		 * buffer for this sample, it wraps by itself in either direction.
 		 */
-		if ((wtp += ib[obp] * transp) >= PROPHETDCO_WAVE_SZE)
-		{
-			while (wtp >= PROPHETDCO_WAVE_SZE)
-				wtp -= PROPHETDCO_WAVE_SZE;
-		}
-
-		/*
-		 * If we have gone negative, round back up. Allows us to run the 
-		 * oscillator backwards.
-		 */
-		while (wtp < 0)
-			wtp += PROPHETDCO_WAVE_SZE;
+		phase += waveCoreStep(ib[obp] * transp, shift);
 	}
 
-	local->wtp = wtp;
+	local->phase = phase;
 	local->ssg = ssg;
 
 	return(0);
@@ -634,9 +633,6 @@ prophetdcoinit(bristolOP **operator, int index, int samplerate, int samplecount)
 
 	note_diff = pow(2, ((double) 1)/12);
 
-	if (sbuf == NULL)
-		sbuf = bristolmalloc(sizeof(float) * samplecount);
-
 	/*
 	 * Then the local parameters specific to this operator. These will be
 	 * the same for each operator, but must be init'ed in the local code.
@@ -644,12 +640,15 @@ prophetdcoinit(bristolOP **operator, int index, int samplerate, int samplecount)
 	(*operator)->operate = operate;
 	(*operator)->destroy = destroy;
 	(*operator)->reset = reset;
+	(*operator)->freelocal = freelocal;
 	(*operator)->param = pdcoparam;
 
 	specs = (bristolPROPHETDCO *) bristolmalloc0(sizeof(bristolPROPHETDCO));
 	(*operator)->specs = (bristolOPSpec *) specs;
 	(*operator)->size = sizeof(bristolPROPHETDCO);
 
+	specs->sbuf = bristolmalloc(sizeof(float) * samplecount);
+
 	/*
 	 * These are specific to this operator, and will need to be altered for
 	 * each operator.
@@ -664,35 +663,43 @@ prophetdcoinit(bristolOP **operator, int index, int samplerate, int samplecount)
 	 * We are going to assign multiple waves to this oscillator.
 	 * sine, ramp, square, triangle?
 	 */
-	specs->wave[0] =
-		(float *) bristolmalloc(PROPHETDCO_WAVE_SZE * sizeof(float));
-	specs->wave[1] =
-		(float *) bristolmalloc(PROPHETDCO_WAVE_SZE * sizeof(float));
-	specs->wave[2] =
-		(float *) bristolmalloc(PROPHETDCO_WAVE_SZE * sizeof(float));
-	specs->wave[3] =
-		(float *) bristolmalloc(PROPHETDCO_WAVE_SZE * sizeof(float));
-	specs->wave[4] =
-		(float *) bristolmalloc(PROPHETDCO_WAVE_SZE * sizeof(float));
-	specs->wave[5] =
-		(float *) bristolmalloc(PROPHETDCO_WAVE_SZE * sizeof(float));
-	specs->wave[6] =
-		(float *) bristolmalloc(PROPHETDCO_WAVE_SZE * sizeof(float));
-	specs->wave[7] =
-		(float *) bristolmalloc(PROPHETDCO_WAVE_SZE * sizeof(float));
+	specs->wave[0] = (float *) bristolmalloc(sizeof(float)
+		* (PROPHETDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[1] = (float *) bristolmalloc(sizeof(float)
+		* (PROPHETDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[2] = (float *) bristolmalloc(sizeof(float)
+		* (PROPHETDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[3] = (float *) bristolmalloc(sizeof(float)
+		* (PROPHETDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[4] = (float *) bristolmalloc(sizeof(float)
+		* (PROPHETDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[5] = (float *) bristolmalloc(sizeof(float)
+		* (PROPHETDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[6] = (float *) bristolmalloc(sizeof(float)
+		* (PROPHETDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
+	specs->wave[7] = (float *) bristolmalloc(sizeof(float)
+		* (PROPHETDCO_WAVE_SZE + BRISTOL_WAVE_GUARD));
 
 	/*
 	 * FillWave is something that should be called as a parameter change, but
 	 * for testing will load it here.
 	 */
 	fillWave(specs->wave[0], PROPHETDCO_WAVE_SZE, 0);
+	waveCoreGuard(specs->wave[0], PROPHETDCO_WAVE_SZE);
 	fillWave(specs->wave[1], PROPHETDCO_WAVE_SZE, 1);
+	waveCoreGuard(specs->wave[1], PROPHETDCO_WAVE_SZE);
 	fillWave(specs->wave[2], PROPHETDCO_WAVE_SZE, 2);
+	waveCoreGuard(specs->wave[2], PROPHETDCO_WAVE_SZE);
 	fillWave(specs->wave[3], PROPHETDCO_WAVE_SZE, 3);
+	waveCoreGuard(specs->wave[3], PROPHETDCO_WAVE_SZE);
 	fillWave(specs->wave[4], PROPHETDCO_WAVE_SZE, 4);
+	waveCoreGuard(specs->wave[4], PROPHETDCO_WAVE_SZE);
 	fillWave(specs->wave[5], PROPHETDCO_WAVE_SZE, 5);
+	waveCoreGuard(specs->wave[5], PROPHETDCO_WAVE_SZE);
 	fillWave(specs->wave[6], PROPHETDCO_WAVE_SZE, 6);
+	waveCoreGuard(specs->wave[6], PROPHETDCO_WAVE_SZE);
 	fillWave(specs->wave[7], PROPHETDCO_WAVE_SZE, 7);
+	waveCoreGuard(specs->wave[7], PROPHETDCO_WAVE_SZE);
 
 	/*
 	 * Now fill in the dco specs for this operator. These are specific to an
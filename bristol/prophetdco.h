@@ -22,6 +22,8 @@
 #ifndef PROPHETDCO_H
 #define PROPHETDCO_H
 
+#include "wavecore.h"
+
 #define PROPHETDCO_WAVE_SZE		1024
 #define PROPHETDCO_WAVE_SZE_M	1023
 /* These are for PWM extremes */
@@ -36,12 +38,13 @@
 typedef struct BristolPROPHETDCO {
 	bristolOPSpec spec;
 	float *wave[8];
+	float *sbuf;
 	unsigned int flags;
 } bristolPROPHETDCO;
 
 typedef struct BristolPROPHETDCOlocal {
 	unsigned int flags;
-	float wtp;
+	bristolPhase phase;
 	float cpwm;
 	float note_diff;
 	float lsv;
@@ -18,6 +18,12 @@
     
   ISO/POSIX C version of Paul Davis's lock free ringbuffer C++ code.
   This is safe for the case of one read thread and one write thread.
+
+  The indices are free running and each is published with a release store
+  and picked up with an acquire load, the data copy is ordered by those
+  rather than by full barriers. The writer keeps the last read index it saw
+  and the reader the last write index so that the other's cache line is only
+  pulled in when that copy says there is no space or no data.
 */
 
 #include <config.h>
@@ -29,6 +35,12 @@
 #endif /* USE_MLOCK */
 #include <ringbuffer.h>
 
+#if defined(__ATOMIC_ACQUIRE)
+#define LOAD_ACQUIRE(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define FLAGS_SET(p, v) __atomic_fetch_or((p), (v), __ATOMIC_ACQ_REL)
+#define FLAGS_CLEAR(p, v) __atomic_fetch_and((p), ~(v), __ATOMIC_ACQ_REL)
+#else
 #if defined(__APPLE__)
 #include <libkern/OSAtomic.h>
 #define MEMORY_BARRIER() OSMemoryBarrier()
@@ -38,6 +50,18 @@
 #warning SMP Danger: memory barriers are not supported on this system
 #define MEMORY_BARRIER()
 #endif
+static inline size_t
+load_acquire(volatile size_t *p)
+{
+	size_t v = *p;
+	MEMORY_BARRIER();
+	return v;
+}
+#define LOAD_ACQUIRE(p) load_acquire((volatile size_t *) (p))
+#define STORE_RELEASE(p, v) do { MEMORY_BARRIER(); *(p) = (v); } while (0)
+#define FLAGS_SET(p, v) __sync_fetch_and_or((p), (v))
+#define FLAGS_CLEAR(p, v) __sync_fetch_and_and((p), ~(v))
+#endif
 
 /* Create a new ringbuffer to hold at least `sz' bytes of data. The
    actual buffer size is rounded up to the next power of two.  */
@@ -47,44 +71,58 @@ jack_ringbuffer_create (size_t sz)
 {
 	int power_of_two;
 	jack_ringbuffer_t *rb;
+	void *mem;
 	
-	if ((rb = malloc (sizeof (jack_ringbuffer_t))) == NULL) {
+	if (posix_memalign (&mem, JRB_CACHELINE, sizeof (jack_ringbuffer_t))) {
 		return NULL;
 	}
+	rb = (jack_ringbuffer_t *) mem;
+	memset (rb, 0, sizeof (jack_ringbuffer_t));
 	
-	for (power_of_two = 1; 1 << power_of_two < sz; power_of_two++);
+	for (power_of_two = 1; ((size_t) 1) << power_of_two < sz; power_of_two++);
 	
-	rb->size = 1 << power_of_two;
+	rb->size = ((size_t) 1) << power_of_two;
 	rb->size_mask = rb->size;
 	rb->size_mask -= 1;
-	rb->write_ptr = 0;
-	rb->read_ptr = 0;
-	if ((rb->buf = malloc (rb->size)) == NULL) {
+	if (posix_memalign (&mem, JRB_CACHELINE, rb->size)) {
 		free (rb);
 		return NULL;
 	}
-	rb->mlocked = 0;
+	rb->buf = (char *) mem;
 	
 	return rb;
 }
 
+/* Stop the ringbuffer, called by the reader. The flag goes up before the
+   flush so that a writer which missed it can at most leave a few records
+   behind that the next stop or flush from the reader will drop. */
+
 void
 jack_ringbuffer_stop (jack_ringbuffer_t * rb)
 {
-	if (rb)
-		rb->flags |= JRB_STOPPED;
+	size_t w;
+
+	if (rb == NULL)
+		return;
+
+	FLAGS_SET (&rb->flags, JRB_STOPPED);
+
+	w = LOAD_ACQUIRE (&rb->write_ptr);
+	rb->write_cache = w;
+	STORE_RELEASE (&rb->read_ptr, w);
 }
 
 void
 jack_ringbuffer_go (jack_ringbuffer_t * rb)
 {
 	if (rb)
-	{
-		rb->read_ptr = 0;
-		rb->write_ptr = 0;
+		FLAGS_CLEAR (&rb->flags, JRB_STOPPED);
+}
 
-		rb->flags &= ~JRB_STOPPED;
-	}
+int
+jack_ringbuffer_stopped (const jack_ringbuffer_t * rb)
+{
+	return (rb->flags & JRB_STOPPED) != 0;
 }
 
 /* Free all data associated with the ringbuffer `rb'. */
@@ -123,6 +161,8 @@ jack_ringbuffer_reset (jack_ringbuffer_t * rb)
 {
 	rb->read_ptr = 0;
 	rb->write_ptr = 0;
+	rb->read_cache = 0;
+	rb->write_cache = 0;
 }
 
 /* Return the number of bytes available for reading.  This is the
@@ -132,16 +172,7 @@ jack_ringbuffer_reset (jack_ringbuffer_t * rb)
 size_t
 jack_ringbuffer_read_space (const jack_ringbuffer_t * rb)
 {
-	size_t w, r;
-	
-	w = rb->write_ptr;
-	r = rb->read_ptr;
-	
-	if (w > r) {
-		return w - r;
-	} else {
-		return (w - r + rb->size) & rb->size_mask;
-	}
+	return LOAD_ACQUIRE (&rb->write_ptr) - rb->read_ptr;
 }
 
 /* Return the number of bytes available for writing.  This is the
@@ -151,17 +182,53 @@ jack_ringbuffer_read_space (const jack_ringbuffer_t * rb)
 size_t
 jack_ringbuffer_write_space (const jack_ringbuffer_t * rb)
 {
-	size_t w, r;
+	return rb->size - (rb->write_ptr - LOAD_ACQUIRE (&rb->read_ptr));
+}
+
+/* The reader's view of the data available, only loads the write pointer
+   when the cached copy would not satisfy `want'. */
+
+static inline size_t
+rb_readable (jack_ringbuffer_t * rb, size_t want)
+{
+	size_t avail = rb->write_cache - rb->read_ptr;
+
+	if (avail < want) {
+		rb->write_cache = LOAD_ACQUIRE (&rb->write_ptr);
+		avail = rb->write_cache - rb->read_ptr;
+	}
+
+	return avail;
+}
+
+/* As above for the writer and the space available. */
+
+static inline size_t
+rb_writable (jack_ringbuffer_t * rb, size_t want)
+{
+	size_t avail = rb->size - (rb->write_ptr - rb->read_cache);
 
-	w = rb->write_ptr;
-	r = rb->read_ptr;
+	if (avail < want) {
+		rb->read_cache = LOAD_ACQUIRE (&rb->read_ptr);
+		avail = rb->size - (rb->write_ptr - rb->read_cache);
+	}
 
-	if (w > r) {
-		return ((r - w + rb->size) & rb->size_mask) - 1;
-	} else if (w < r) {
-		return (r - w) - 1;
+	return avail;
+}
+
+/* Copy `cnt' bytes out of the buffer from index `from', which may wrap. */
+
+static inline void
+rb_copy_out (const jack_ringbuffer_t * rb, char *dest, size_t from, size_t cnt)
+{
+	size_t r = from & rb->size_mask;
+	size_t n1 = rb->size - r;
+
+	if (n1 >= cnt) {
+		memcpy (dest, &(rb->buf[r]), cnt);
 	} else {
-		return rb->size - 1;
+		memcpy (dest, &(rb->buf[r]), n1);
+		memcpy (dest + n1, rb->buf, cnt - n1);
 	}
 }
 
@@ -172,38 +239,18 @@ size_t
 jack_ringbuffer_read (jack_ringbuffer_t * rb, char *dest, size_t cnt)
 {
 	size_t free_cnt;
-	size_t cnt2;
 	size_t to_read;
-	size_t n1, n2;
-	size_t new_ptr;
 
-	if ((free_cnt = jack_ringbuffer_read_space (rb)) == 0) {
+	if ((free_cnt = rb_readable (rb, cnt)) == 0) {
 		return 0;
 	}
 
 	to_read = cnt > free_cnt ? free_cnt : cnt;
 
-	cnt2 = rb->read_ptr + to_read;
+	rb_copy_out (rb, dest, rb->read_ptr, to_read);
 
-	if (cnt2 > rb->size) {
-		n1 = rb->size - rb->read_ptr;
-		n2 = cnt2 & rb->size_mask;
-	} else {
-		n1 = to_read;
-		n2 = 0;
-	}
-
-	memcpy (dest, &(rb->buf[rb->read_ptr]), n1);
-	new_ptr = (rb->read_ptr + n1) & rb->size_mask;
-
-	if (n2) {
-		memcpy (dest + n1, &(rb->buf[new_ptr]), n2);
-		new_ptr = (new_ptr + n2) & rb->size_mask;
-	}
-
-	/* Ensure that the read pointer gets updated after copying the data */
-	MEMORY_BARRIER();
-	rb->read_ptr = new_ptr;
+	/* Release the space only after the data has been copied out */
+	STORE_RELEASE (&rb->read_ptr, rb->read_ptr + to_read);
 
 	return to_read;
 }
@@ -216,79 +263,72 @@ size_t
 jack_ringbuffer_peek (jack_ringbuffer_t * rb, char *dest, size_t cnt)
 {
 	size_t free_cnt;
-	size_t cnt2;
 	size_t to_read;
-	size_t n1, n2;
-	size_t tmp_read_ptr;
-
-	tmp_read_ptr = rb->read_ptr;
 
-	if ((free_cnt = jack_ringbuffer_read_space (rb)) == 0) {
+	if ((free_cnt = rb_readable (rb, cnt)) == 0) {
 		return 0;
 	}
 
 	to_read = cnt > free_cnt ? free_cnt : cnt;
 
-	cnt2 = tmp_read_ptr + to_read;
+	rb_copy_out (rb, dest, rb->read_ptr, to_read);
 
-	if (cnt2 > rb->size) {
-		n1 = rb->size - tmp_read_ptr;
-		n2 = cnt2 & rb->size_mask;
-	} else {
-		n1 = to_read;
-		n2 = 0;
-	}
+	return to_read;
+}
 
-	memcpy (dest, &(rb->buf[tmp_read_ptr]), n1);
-	tmp_read_ptr = (tmp_read_ptr + n1) & rb->size_mask;
+/* Zero-copy view of the whole records between the read pointer and the
+   end of the buffer or the write pointer, whichever comes first. */
 
-	if (n2) {
-		memcpy (dest + n1, &(rb->buf[tmp_read_ptr]), n2);
+size_t
+jack_ringbuffer_peek_records (jack_ringbuffer_t * rb, size_t recsize,
+			      void **records)
+{
+	size_t r = rb->read_ptr & rb->size_mask;
+	size_t avail = rb_readable (rb, recsize);
+
+	if (avail > rb->size - r) {
+		avail = rb->size - r;
 	}
 
-	return to_read;
+	*records = &(rb->buf[r]);
+
+	return avail / recsize;
 }
 
 
 /* The copying data writer.  Copy at most `cnt' bytes to `rb' from
-   `src'.  Returns the actual number of bytes copied. */
+   `src'.  Returns the actual number of bytes copied, nothing is
+   written while the ringbuffer is stopped. */
 
 size_t
 jack_ringbuffer_write (jack_ringbuffer_t * rb, const char *src, size_t cnt)
 {
 	size_t free_cnt;
-	size_t cnt2;
 	size_t to_write;
-	size_t n1, n2;
-	size_t new_ptr;
+	size_t w, n1;
 
-	if ((free_cnt = jack_ringbuffer_write_space (rb)) == 0) {
+	if (rb->flags & JRB_STOPPED) {
+		return 0;
+	}
+
+	if ((free_cnt = rb_writable (rb, cnt)) == 0) {
 		return 0;
 	}
 
 	to_write = cnt > free_cnt ? free_cnt : cnt;
 
-	cnt2 = rb->write_ptr + to_write;
+	w = rb->write_ptr & rb->size_mask;
+	n1 = rb->size - w;
 
-	if (cnt2 > rb->size) {
-		n1 = rb->size - rb->write_ptr;
-		n2 = cnt2 & rb->size_mask;
+	if (n1 >= to_write) {
+		memcpy (&(rb->buf[w]), src, to_write);
 	} else {
-		n1 = to_write;
-		n2 = 0;
+		memcpy (&(rb->buf[w]), src, n1);
+		memcpy (rb->buf, src + n1, to_write - n1);
 	}
 
-	memcpy (&(rb->buf[rb->write_ptr]), src, n1);
-	new_ptr = (rb->write_ptr + n1) & rb->size_mask;
-
-	if (n2) {
-		memcpy (&(rb->buf[new_ptr]), src + n1, n2);
-		new_ptr = (new_ptr + n2) & rb->size_mask;
-	}
-
-	/* Ensure that the write pointer gets updated after copying the data */
-	MEMORY_BARRIER();
-	rb->write_ptr = new_ptr;
+	/* Publish the write pointer only after the data is in place */
+	STORE_RELEASE (&rb->write_ptr, rb->write_ptr + to_write);
 
 	return to_write;
 }
@@ -298,10 +338,8 @@ jack_ringbuffer_write (jack_ringbuffer_t * rb, const char *src, size_t cnt)
 void
 jack_ringbuffer_read_advance (jack_ringbuffer_t * rb, size_t cnt)
 {
-	size_t tmp = (rb->read_ptr + cnt) & rb->size_mask;
 	/* Ensure that the read pointer gets updated after external data change */
-	MEMORY_BARRIER();
-	rb->read_ptr = tmp;
+	STORE_RELEASE (&rb->read_ptr, rb->read_ptr + cnt);
 }
 
 /* Advance the write pointer `cnt' places. */
@@ -309,10 +347,8 @@ jack_ringbuffer_read_advance (jack_ringbuffer_t * rb, size_t cnt)
 void
 jack_ringbuffer_write_advance (jack_ringbuffer_t * rb, size_t cnt)
 {
-	size_t tmp = (rb->write_ptr + cnt) & rb->size_mask;
 	/* Ensure that the write pointer gets updated after external data change */
-	MEMORY_BARRIER();
-	rb->write_ptr = tmp;
+	STORE_RELEASE (&rb->write_ptr, rb->write_ptr + cnt);
 }
 
 /* The non-copying data reader.  `vec' is an array of two places.  Set
@@ -325,36 +361,28 @@ jack_ringbuffer_get_read_vector (const jack_ringbuffer_t * rb,
 				 jack_ringbuffer_data_t * vec)
 {
 	size_t free_cnt;
-	size_t cnt2;
-	size_t w, r;
+	size_t r;
 
-	w = rb->write_ptr;
-	r = rb->read_ptr;
+	free_cnt = jack_ringbuffer_read_space (rb);
+	r = rb->read_ptr & rb->size_mask;
 
-	if (w > r) {
-		free_cnt = w - r;
-	} else {
-		free_cnt = (w - r + rb->size) & rb->size_mask;
-	}
-
-	cnt2 = r + free_cnt;
+	vec[0].buf = &(rb->buf[r]);
 
-	if (cnt2 > rb->size) {
+	if (r + free_cnt > rb->size) {
 
-		/* Two part vector: the rest of the buffer after the current write
+		/* Two part vector: the rest of the buffer after the current read
 		   ptr, plus some from the start of the buffer. */
 
-		vec[0].buf = &(rb->buf[r]);
 		vec[0].len = rb->size - r;
 		vec[1].buf = rb->buf;
-		vec[1].len = cnt2 & rb->size_mask;
+		vec[1].len = r + free_cnt - rb->size;
 
 	} else {
 
 		/* Single part vector: just the rest of the buffer */
 
-		vec[0].buf = &(rb->buf[r]);
 		vec[0].len = free_cnt;
+		vec[1].buf = rb->buf;
 		vec[1].len = 0;
 	}
 }
@@ -369,34 +397,24 @@ jack_ringbuffer_get_write_vector (const jack_ringbuffer_t * rb,
 				  jack_ringbuffer_data_t * vec)
 {
 	size_t free_cnt;
-	size_t cnt2;
-	size_t w, r;
+	size_t w;
 
-	w = rb->write_ptr;
-	r = rb->read_ptr;
+	free_cnt = jack_ringbuffer_write_space (rb);
+	w = rb->write_ptr & rb->size_mask;
 
-	if (w > r) {
-		free_cnt = ((r - w + rb->size) & rb->size_mask) - 1;
-	} else if (w < r) {
-		free_cnt = (r - w) - 1;
-	} else {
-		free_cnt = rb->size - 1;
-	}
+	vec[0].buf = &(rb->buf[w]);
 
-	cnt2 = w + free_cnt;
-
-	if (cnt2 > rb->size) {
+	if (w + free_cnt > rb->size) {
 
 		/* Two part vector: the rest of the buffer after the current write
 		   ptr, plus some from the start of the buffer. */
 
-		vec[0].buf = &(rb->buf[w]);
 		vec[0].len = rb->size - w;
 		vec[1].buf = rb->buf;
-		vec[1].len = cnt2 & rb->size_mask;
+		vec[1].len = w + free_cnt - rb->size;
 	} else {
-		vec[0].buf = &(rb->buf[w]);
 		vec[0].len = free_cnt;
+		vec[1].buf = rb->buf;
 		vec[1].len = 0;
 	}
 }
@@ -179,79 +179,61 @@ static void
 rotate(bristolLESLIElocal *local, float *history, float *ib, float *obl,
 float *obr, int count, float scan, float feedback, float delay, float reverb)
 {
-	float volleft, volright, freq1, histout, value, depth, scanp, scanr, rev;
-	int histin, i, revout, revout1, revout2, revout3;
+	float volleft, volright, target, value, scanp, scanr, rev, d, step, tap1;
+	bristolDelayLine *dl = &local->dl;
+	int i;
+
+	if (dl->buf != history)
+		delayLineInit(dl, history, HISTSIZE, BRISTOL_DL_LINEAR);
 
 	volleft = local->Vol1;
 	volright = local->Vol2;
-	freq1 = local->Freq1;
-	histin = local->Histin;
-	histout = local->Histout;
+	d = local->delay;
+	step = local->step;
 	scanp = local->scanp;
 	scanr = local->scanr;
-	revout = local->Revout;
 
 	/*
 	 * Reverb should be a function of the rotational speed? We have two totally
 	 * distinct delay lines, one for the treble rotor, and one for the base
-	 * rotor, and should use them. Range is about 300.
+	 * rotor, and should use them. Range is about 300. The reverb taps feed
+	 * back into the history which is why this goes a sample at a time.
 	 */
-	if ((revout = histin - TAP1) < 0) revout = histin - TAP1 + HISTSIZE;
-	if ((revout1 = histin - TAP2) < 0) revout1 = histin - TAP2 + HISTSIZE;
-	if ((revout2 = histin - TAP3) < 0) revout2 = histin - TAP3 + HISTSIZE;
-	if ((revout3 = histin - TAP4) < 0) revout3 = histin - TAP4 + HISTSIZE;
-
 	for (i = 0; i < count; i++) {
-		history[histin] = *ib;
+		delayLinePut(dl, *ib);
 
 		/*
 		 * Some Doppler
 		 */
-		if ((histout + 1) >= HISTSIZE)
-		{
-			value = history[0] * (histout - ((float) ((int) histout)))
-				+ history[(int) histout]
-					* (1.0 - (histout - ((float) ((int) histout))));
-		} else {
-			value = history[(int) histout + 1]
-					* (histout - ((float) ((int) histout)))
-				+ history[(int) histout]
-					* (1.0 - (histout - ((float) ((int) histout))));
-		}
+		value = delayLineGet(dl, d);
+		d += step;
 
 		/*
 		 * Some tremolo, and for now put Doppler in both sides.
 		 */
-		rev = history[revout1] * 0.8
-			+ history[revout2] * 0.36
-			+ history[revout3] * 0.62;
+		rev = delayLineAt(dl, TAP2) * 0.8
+			+ delayLineAt(dl, TAP3) * 0.36
+			+ delayLineAt(dl, TAP4) * 0.62;
+		tap1 = delayLineAt(dl, TAP1);
 
 		obr[i] += *ib * volright + value * reverb
-			+ (history[revout] + rev) * volleft * feedback;
+			+ (tap1 + rev) * volleft * feedback;
 		obl[i] += *ib * volleft + value * reverb
-			+ (history[revout] + rev) * volright * feedback;
+			+ (tap1 + rev) * volright * feedback;
 
-		history[revout] += (value + rev) * feedback;
-		history[histin] += rev * feedback * 0.5;
+		/*
+		 * Four taps with the feedback returned to the first one, could still
+		 * be made dual taps (ie, 8 tap).
+		 */
+		delayLineMix(dl, TAP1, (value + rev) * feedback);
+		delayLineMix(dl, 0, rev * feedback * 0.5);
 
 		++ib;
 
 #ifdef DEBUG2
-		printf("in %i out %f step %f depth %f\n", histin, histout, freq1,
-			histin - histout < 0? histin + HISTSIZE - histout:histin - histout);
+		printf("in %i delay %f step %f\n", dl->in, d, step);
 #endif
 
-		if (++histin >= HISTSIZE) histin = 0;
-		if ((histout += freq1) >= HISTSIZE) histout -= HISTSIZE;
-		/*
-		 * Revout should be made into a 4 tap delay line, potentially with dual
-		 * taps (ie, 8 tap), with feedback returned to first tap.
-		 */
-		if (++revout >= HISTSIZE) revout = 0;
-		if (++revout1 >= HISTSIZE) revout1 = 0;
-		if (++revout2 >= HISTSIZE) revout2 = 0;
-		if (++revout3 >= HISTSIZE) revout3 = 0;
-
 		/*
 		 * The output buffers get a filtered volume fraction, plus a phase 
 		 * component.
@@ -264,29 +246,16 @@ float *obr, int count, float scan, float feedback, float delay, float reverb)
 			volright = (1.0 - table[(int) ((scanp - 80) < 0?
 				scanp - 80 + TABSIZE:scanp - 80)]) * 0.5;
 			/*
-			 * Freq1 will initially define a length of the delay chain. Then
-			 * we interpolate the changes we need to make to histout to move
-			 * to this depth.
+			 * Target defines the length of the delay chain, the delay is
+			 * ramped to it over the next scan.
 			 */
-			freq1 = delay - table[(int) ((scanp + 50) >= TABSIZE?
+			target = delay - table[(int) ((scanp + 50) >= TABSIZE?
 				scanp + 50 - TABSIZE:scanp + 50)] * delay;
 
+			step = (target - d) / scan;
 #ifdef DEBUG2
-			printf("scan %3.0f: ddepth %f, tbl %f", scanp, freq1,
-				table[(int) ((scanp + 50) >= TABSIZE?
-					scanp + 50 - TABSIZE
-					:scanp + 50)]);
-#endif
-			/*
-			 * Get the current depth
-			 */
-			depth = histin + scan - histout < 0?
-				((float) histin) + scan - histout + HISTSIZE
-				:((float) histin) + scan - histout;
-
-			freq1 = (depth - freq1) / scan;
-#ifdef DEBUG2
-			printf(" adepth %f, step %f\n", depth, freq1);
+			printf("scan %3.0f: ddepth %f, adepth %f, step %f\n",
+				scanp, target, d, step);
 #endif
 			if ((scan > 400) && (scanp == (TABSIZE>>1) + local->toff))
 				--scanp;
@@ -297,10 +266,8 @@ float *obr, int count, float scan, float feedback, float delay, float reverb)
 
 	local->Vol1 = volleft;
 	local->Vol2 = volright;
-	local->Freq1 = freq1;
-	local->Histin = histin;
-	local->Histout = histout;
-	local->Revout = revout;
+	local->delay = d;
+	local->step = step;
 	local->scanr = scanr;
 	local->scanp = scanp;
 }
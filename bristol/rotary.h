@@ -22,6 +22,8 @@
 #ifndef ROTARY_H
 #define ROTARY_H
 
+#include "delayline.h"
+
 #define LESLIE_CLICK 0x0001
 #define LESLIE_TBL_SZE 4096
 
@@ -47,10 +49,9 @@ typedef struct BristolLESLIElocal {
 	unsigned int flags;
 	float Vol1;
 	float Vol2;
-	float Freq1;
-	float Histin;
-	float Histout;
-	float Revout;
+	bristolDelayLine dl;
+	float delay;
+	float step;
 	float *tbuf;
 	float scanp;
 	float scanr;
@@ -0,0 +1,231 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Engine health counters. The audio thread calls bristolTelemetryStart() when
+ * it wakes for a period and bristolTelemetryEnd() when the output is ready,
+ * from those we get the DSP load, a histogram of compute time against the
+ * period and the wakeup jitter. The xrun, restart, steal and clip counters
+ * are bumped where they happen.
+ *
+ * The values can be requested over the control port with BRISTOL_REQ_STATS,
+ * see bristolstats, or written to a text file with -metrics in the format
+ * that most monitoring systems will scrape.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+
+#include "bristol.h"
+
+static u_int64_t
+bristolTelemetryClock()
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return(((u_int64_t) now.tv_sec) * 1000000000 + now.tv_nsec);
+}
+
+static float
+bristolTelemetryPeriod(audioMain *audiomain)
+{
+	return(audiomain->samplecount * 1000000000.0f / audiomain->samplerate);
+}
+
+void
+bristolTelemetryStart(audioMain *audiomain)
+{
+	bristolTelemetry *t = &audiomain->telemetry;
+	u_int64_t now = bristolTelemetryClock();
+
+	/*
+	 * The wakeup error is how far the interval since the last period is from
+	 * the nominal period. The first period has nothing to compare with.
+	 */
+	if (t->wake != 0)
+		t->jitter[t->jindex++ & (BRISTOL_JITTER_RING - 1)] =
+			fabsf((now - t->wake) - bristolTelemetryPeriod(audiomain)) / 1000;
+
+	t->last = t->wake;
+	t->wake = now;
+	t->periods++;
+}
+
+/*
+ * Gain is whatever will still be applied to outbuf on its way to the device,
+ * it is used to count clipped periods against the same full scale that the
+ * native drivers use.
+ */
+void
+bristolTelemetryEnd(audioMain *audiomain, float *outbuf, float gain)
+{
+	bristolTelemetry *t = &audiomain->telemetry;
+	float load, limit = 32767.0f / gain;
+	int i;
+
+	load = (bristolTelemetryClock() - t->wake)
+		/ bristolTelemetryPeriod(audiomain);
+
+	t->load += (load - t->load) * 0.05f;
+	if (load > t->peak)
+		t->peak = load;
+
+	if ((i = load * 10) >= BRISTOL_HIST_BUCKETS)
+		i = BRISTOL_HIST_BUCKETS - 1;
+	t->hist[i]++;
+
+	for (i = audiomain->samplecount * 2; i > 0; i--, outbuf++)
+		if ((*outbuf > limit) || (*outbuf < -limit))
+		{
+			t->clips++;
+			break;
+		}
+}
+
+static int
+intcmp(const void *a, const void *b)
+{
+	return(*(int *) a - *(int *) b);
+}
+
+/*
+ * Percentile of the wakeup jitter in microseconds, p from 0 to 100. This
+ * sorts a copy of the ring so it is for the control thread only.
+ */
+static int
+bristolJitter(audioMain *audiomain, int p)
+{
+	int sorted[BRISTOL_JITTER_RING], count;
+
+	if ((count = audiomain->telemetry.jindex) > BRISTOL_JITTER_RING)
+		count = BRISTOL_JITTER_RING;
+	if (count == 0)
+		return(0);
+
+	bcopy(audiomain->telemetry.jitter, sorted, count * sizeof(int));
+	qsort(sorted, count, sizeof(int), intcmp);
+
+	return(sorted[(count - 1) * p / 100]);
+}
+
+int
+bristolTelemetryRead(audioMain *audiomain, int stat)
+{
+	bristolTelemetry *t = &audiomain->telemetry;
+
+	if ((stat >= BRISTOL_STAT_HIST) && (stat < BRISTOL_STAT_COUNT))
+		return(t->hist[stat - BRISTOL_STAT_HIST]);
+
+	switch (stat) {
+		case BRISTOL_STAT_LOAD:
+			return(t->load * 1000);
+		case BRISTOL_STAT_PEAK:
+			return(t->peak * 1000);
+		case BRISTOL_STAT_PERIODS:
+			return(t->periods);
+		case BRISTOL_STAT_XRUNS:
+			return(t->xruns);
+		case BRISTOL_STAT_RESTARTS:
+			return(t->restarts);
+		case BRISTOL_STAT_STEALS:
+			return(t->steals + audiomain->vbudget.stolen);
+		case BRISTOL_STAT_CLIPS:
+			return(t->clips);
+		case BRISTOL_STAT_JITTER50:
+			return(bristolJitter(audiomain, 50));
+		case BRISTOL_STAT_JITTER90:
+			return(bristolJitter(audiomain, 90));
+		case BRISTOL_STAT_JITTER99:
+			return(bristolJitter(audiomain, 99));
+		case BRISTOL_STAT_JITTERMAX:
+			return(bristolJitter(audiomain, 100));
+	}
+
+	return(0);
+}
+
+/*
+ * Write the -metrics file. It goes to a temporary name first so that anything
+ * polling it never sees half a file.
+ */
+int
+bristolTelemetryDump(audioMain *audiomain)
+{
+	bristolTelemetry *t = &audiomain->telemetry;
+	char tmpfile[1024];
+	unsigned int count = 0;
+	FILE *fd;
+	int i;
+
+	if (t->file == NULL)
+		return(0);
+
+	snprintf(tmpfile, 1024, "%s.tmp", t->file);
+
+	if ((fd = fopen(tmpfile, "w")) == NULL)
+	{
+		printf("could not open metrics file %s\n", tmpfile);
+		return(-1);
+	}
+
+	fprintf(fd, "# bristol engine, %i samples at %i Hz\n",
+		audiomain->samplecount, audiomain->samplerate);
+	fprintf(fd, "bristol_dsp_load_percent %.1f\n", t->load * 100);
+	fprintf(fd, "bristol_dsp_load_peak_percent %.1f\n", t->peak * 100);
+	fprintf(fd, "bristol_periods_total %u\n", t->periods);
+	fprintf(fd, "bristol_xruns_total %u\n", t->xruns);
+	fprintf(fd, "bristol_restarts_total %u\n", t->restarts);
+	fprintf(fd, "bristol_steals_total %u\n",
+		t->steals + audiomain->vbudget.stolen);
+	fprintf(fd, "bristol_clips_total %u\n", t->clips);
+
+	fprintf(fd, "bristol_jitter_us{quantile=\"0.5\"} %i\n",
+		bristolJitter(audiomain, 50));
+	fprintf(fd, "bristol_jitter_us{quantile=\"0.9\"} %i\n",
+		bristolJitter(audiomain, 90));
+	fprintf(fd, "bristol_jitter_us{quantile=\"0.99\"} %i\n",
+		bristolJitter(audiomain, 99));
+	fprintf(fd, "bristol_jitter_us{quantile=\"1\"} %i\n",
+		bristolJitter(audiomain, 100));
+
+	/* Cumulative buckets of compute time as a percentage of the period */
+	for (i = 0; i < BRISTOL_HIST_BUCKETS - 1; i++)
+	{
+		count += t->hist[i];
+		fprintf(fd, "bristol_period_load_bucket{le=\"%i\"} %u\n",
+			(i + 1) * 10, count);
+	}
+	fprintf(fd, "bristol_period_load_bucket{le=\"+Inf\"} %u\n",
+		count + t->hist[i]);
+
+	fclose(fd);
+
+	if (rename(tmpfile, t->file) != 0)
+	{
+		printf("could not rename metrics file to %s\n", t->file);
+		return(-1);
+	}
+
+	return(0);
+}
+
@@ -1061,31 +1061,21 @@ parseWheel(char *line, tonewheels *gear)
 static void
 bristolHammondGetGears(char *file, char *match, tonewheels *gearbox, int count)
 {
-	FILE *fd;
-	char path[256], *offset;
+	bristolProfile *profile;
+	char *offset, *line;
 	char param[256];
+	int i;
 
 	/*
-	 * Open and read configuration
+	 * The profile comes back already read with the comments stripped, the
+	 * lines are copied out as the parsers work on them in place.
 	 */
-	sprintf(path, "%s/memory/profiles/%s", getBristolCache(file), file);
+	if ((profile = bristolProfileOpen(file)) == NULL)
+		return;
 
-	/*
-	 * If we can open the file then process it.
-	 */
-	if ((fd = fopen(path, "r")) == NULL)
+	for (i = 0; (line = bristolProfileLine(profile, i)) != NULL; i++)
 	{
-		sprintf(path, "%s/memory/profiles/%s", getenv("BRISTOL"), file);
-		if ((fd = fopen(path, "r")) == NULL)
-			return;
-	}
-
-	while (fgets(param, 256, fd) != NULL)
-	{
-		if (param[0] == '#')
-			continue;
-		if (strlen(param) < 5)
-			continue;
+		snprintf(param, 256, "%s", line);
 
 		if (strncmp(param, "taper", 5) == 0)
 		{
@@ -1131,160 +1121,14 @@ bristolHammondGetGears(char *file, char *match, tonewheels *gearbox, int count)
 		}
 	}
 
-	fclose(fd);
+	bristolProfileClose(profile);
 }
 
 #ifdef NOT_USED
 static void
 bristolHammondGetMap(char *file, char *match, float points[], int count)
 {
-	int i, n = 0;
-	FILE *fd;
-	float from, delta;
-	char path[256];
-	char param[256];
-
-	/*
-	 * Open and read configuration. Should consider searching
-	 * $HOME/.bristol/memory and $BRISTOL_DB/memory.
-	 */
-	sprintf(path, "%s/memory/profiles/%s", getBristolCache(file), file);
-
-	/*
-	 * If we can open the file then clean the array and start again.
-	 */
-	if ((fd = fopen(path, "r")) == NULL)
-	{
-		sprintf(path, "%s/memory/profiles/%s", getenv("BRISTOL"), file);
-		if ((fd = fopen(path, "r")) == NULL)
-			return;
-	}
-
-	for (i = 0; i < count; i++)
-		points[i] = 0;
-
-	while (fgets(param, 256, fd) != NULL)
-	{
-		if (param[0] == '#')
-			continue;
-		if (strlen(param) < 5)
-			continue;
-
-		if (strncmp(param, match, strlen(match)) == 0)
-		{
-			int wheel;
-			float value;
-			char *offset;
-
-			/*
-			 * We should now have a line with something like:
-			 * <match>: wheel value
-			if ((offset = strpbrk(param, " 	")) == NULL)
-			 */
-			if ((offset = index(param, ' ')) == NULL)
-				continue;
-
-			if ((wheel = atoi(offset)) < 0)
-				continue;
-			if (wheel >= count)
-				continue;
-
-			/*if ((offset = strpbrk(param, " 	")) == NULL) */
-			if ((offset = index(++offset, ' ')) == NULL)
-				continue;
-
-			value = atof(offset);
-
-			if (value > 0)
-				points[wheel] = value;
-		}
-	}
-
-	from = points[0];
-
-	for (i = 1; i < count; i++)
-	{
-		if (points[i] != 0.0f)
-		{
-			if (i == (n + 1))
-			{
-				n = i;
-				from = points[n];
-				continue;
-			}
-			
-			/* 
-			 * If a start point was not defined then take the first definition
-			 * and fill from there.
-			 */
-			if (from == 0)
-				from = points[0] = points[i];
-
-			delta = (points[i] - points[n]) / (i - n); 
-
-			for (++n; n < i; n++)
-				points[n] = (from += delta);
-
-			from = points[i];
-		}
-	}
-
-	/*
-	 * If no end point defined then fill from last value.
-	 */
-	for (++n; n < count; n++)
-		points[n] = points[n - 1];
-
-/*
-	i = 0;
-	printf("%s\n", match);
-	printf("%1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f\n",
-		points[i], points[i+1], points[i+2], points[i+3], 
-		points[i+4], points[i+5], points[i+6], points[i+7]);
-	if ((i += 8) < count) 
-		printf("%1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f\n",
-			points[i], points[i+1], points[i+2], points[i+3], 
-			points[i+4], points[i+5], points[i+6], points[i+7]);
-	if ((i += 8) < count) 
-		printf("%1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f\n",
-			points[i], points[i+1], points[i+2], points[i+3], 
-			points[i+4], points[i+5], points[i+6], points[i+7]);
-	if ((i += 8) < count) 
-		printf("%1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f\n",
-			points[i], points[i+1], points[i+2], points[i+3], 
-			points[i+4], points[i+5], points[i+6], points[i+7]);
-	if ((i += 8) < count) 
-		printf("%1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f\n",
-			points[i], points[i+1], points[i+2], points[i+3], 
-			points[i+4], points[i+5], points[i+6], points[i+7]);
-	if ((i += 8) < count) 
-		printf("%1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f\n",
-			points[i], points[i+1], points[i+2], points[i+3], 
-			points[i+4], points[i+5], points[i+6], points[i+7]);
-	if ((i += 8) < count) 
-		printf("%1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f\n",
-			points[i], points[i+1], points[i+2], points[i+3], 
-			points[i+4], points[i+5], points[i+6], points[i+7]);
-	if ((i += 8) < count) 
-		printf("%1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f\n",
-			points[i], points[i+1], points[i+2], points[i+3], 
-			points[i+4], points[i+5], points[i+6], points[i+7]);
-	if ((i += 8) < count) 
-		printf("%1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f\n",
-			points[i], points[i+1], points[i+2], points[i+3], 
-			points[i+4], points[i+5], points[i+6], points[i+7]);
-	if ((i += 8) < count) 
-		printf("%1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f\n",
-			points[i], points[i+1], points[i+2], points[i+3], 
-			points[i+4], points[i+5], points[i+6], points[i+7]);
-	if ((i += 8) < count) 
-		printf("%1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f %1.2f\n",
-			points[i], points[i+1], points[i+2], points[i+3], 
-			points[i+4], points[i+5], points[i+6], points[i+7]);
-	if ((i += 8) < count) 
-		printf("%1.2f %1.2f %1.2f\n",
-			points[i], points[i+1], points[i+2]);
-*/
+	bristolGetMap(file, match, points, count, 0);
 }
 #endif /* NOT_USED */
 
@@ -89,14 +89,14 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
-	bristolfree(((bristolTRILOGY *) operator)->wave[0]);
-	bristolfree(((bristolTRILOGY *) operator)->wave[1]);
-	bristolfree(((bristolTRILOGY *) operator)->wave[2]);
-	bristolfree(((bristolTRILOGY *) operator)->wave[3]);
-	bristolfree(((bristolTRILOGY *) operator)->wave[4]);
-	bristolfree(((bristolTRILOGY *) operator)->wave[5]);
-	bristolfree(((bristolTRILOGY *) operator)->wave[6]);
-	bristolfree(((bristolTRILOGY *) operator)->wave[7]);
+	bristolfree(((bristolTRILOGY *) operator->specs)->wave[0]);
+	bristolfree(((bristolTRILOGY *) operator->specs)->wave[1]);
+	bristolfree(((bristolTRILOGY *) operator->specs)->wave[2]);
+	bristolfree(((bristolTRILOGY *) operator->specs)->wave[3]);
+	bristolfree(((bristolTRILOGY *) operator->specs)->wave[4]);
+	bristolfree(((bristolTRILOGY *) operator->specs)->wave[5]);
+	bristolfree(((bristolTRILOGY *) operator->specs)->wave[6]);
+	bristolfree(((bristolTRILOGY *) operator->specs)->wave[7]);
 
 	bristolfree(operator->specs);
 
@@ -463,7 +463,8 @@ trilogyoscinit(bristolOP **operator, int index, int samplerate, int samplecount)
 	specs->wave[6] = (float *) bristolmalloc(TRILOGY_WAVE_SZE * sizeof(float));
 	specs->wave[7] = (float *) bristolmalloc(TRILOGY_WAVE_SZE * sizeof(float));
 
-	zerobuf = (float *) bristolmalloc(TRILOGY_WAVE_SZE * sizeof(float));
+	if (zerobuf == NULL)
+		zerobuf = (float *) bristolmalloc(TRILOGY_WAVE_SZE * sizeof(float));
 	bristolbzero(zerobuf, TRILOGY_WAVE_SZE * sizeof(float));
 
 	/*
@@ -113,9 +113,10 @@ static int operate(bristolOP *operator,
 	bristolVCHORUS *specs;
 	bristolVCHORUSlocal *local = (bristolVCHORUSlocal *) lcl;
 	register float *source, *dest;
-	register int count, *history, depth, speed;
-	register float freq1, histout, value, scanp, scanr, delay;
-	register int histin, i, chorus;
+	register int count, depth, speed;
+	register float target, scanp, delay, step;
+	register int i, j, n, chorus, scanr;
+	float mod[VCHORUS_BLOCK];
 
 	specs = (bristolVCHORUS *) operator->specs;
 
@@ -129,7 +130,6 @@ static int operate(bristolOP *operator,
 	speed = param->param[SPEED].int_val;
 	depth = param->param[DEPTH].int_val;
 	chorus = param->param[FLAGS].int_val;
-	history = param->param[0].mem;
 
 #ifdef DEBUG
 	printf("vchorus()\n");
@@ -138,80 +138,56 @@ static int operate(bristolOP *operator,
 	if (local == NULL)
 		return(0);
 
-	freq1 = local->Freq1;
-	histin = local->Histin;
-	histout = local->Histout;
+	if (local->dl.buf != param->param[0].mem)
+		delayLineInit(&local->dl, param->param[0].mem, HISTSIZE,
+			BRISTOL_DL_CUBIC);
+
+	delay = local->delay;
+	step = local->step;
 	scanp = local->scanp;
 	scanr = local->scanr;
 
-	for (i = 0; i < count; i++) {
-		history[histin] = *source;
-
-		if ((histout + 1) >= HISTSIZE)
-		{
-			value = history[0] * (histout - ((float) ((int) histout)))
-				+ history[(int) histout]
-					* (1.0 - (histout - ((float) ((int) histout))));
-		} else {
-			value = history[(int) histout + 1]
-					* (histout - ((float) ((int) histout)))
-				+ history[(int) histout]
-					* (1.0 - (histout - ((float) ((int) histout))));
-		}
-
-		if (chorus)
-			*dest++ = *source + value;
-		else
-			*dest++ = value;
-
-		source++;
-
-		if (++histin >= HISTSIZE) histin = 0;
-		if ((histout += freq1) >= HISTSIZE) histout -= HISTSIZE;
-		if (histout < 0) histout = 0;
+	for (i = 0; i < count; i += n)
+	{
+		if ((n = count - i) > VCHORUS_BLOCK)
+			n = VCHORUS_BLOCK;
 
 		/*
-		 * The output buffers get a filtered volume fraction, plus a phase 
-		 * component.
+		 * Work out the delay for each sample of the block, then take them
+		 * all from the history together.
 		 */
-		if ((scanr -= 1) <= 0)
+		for (j = 0; j < n; j++)
 		{
-			scanr = speed;
+			mod[j] = delay;
+			delay += step;
 
-			/*
-			 * Freq1 will initially define a length of the delay chain. Then
-			 * we interpolate the changes we need to make to histout to move
-			 * to this depth.
-			 */
-			freq1 = depth - table[(int) ((scanp + 100) >= TABSIZE?
-				scanp + 100 - TABSIZE:scanp + 100)] * depth;
+			if (--scanr <= 0)
+			{
+				scanr = speed;
 
-#ifdef DEBUG2
-			printf("scan %3.0f: ddepth %f, tbl %f", scanp, freq1,
-				table[(int) ((scanp + 100) >= TABSIZE?
-					scanp + 100 - TABSIZE
-					:scanp + 100)]);
-#endif
+				/*
+				 * Target will define a length of the delay chain, we ramp
+				 * the delay to it over the next scan.
+				 */
+				target = depth - table[(int) ((scanp + 100) >= TABSIZE?
+					scanp + 100 - TABSIZE:scanp + 100)] * depth;
 
-			/*
-			 * Get the current depth
-			 */
-			delay = histin + speed - histout < 0?
-				((float) histin) + speed - histout + HISTSIZE
-				:((float) histin) + speed - histout;
-
-			freq1 = (delay - freq1) / speed;
+				step = (target - delay) / speed;
 #ifdef DEBUG2
-			printf(" adepth %f, step %f\n", delay, freq1);
+				printf("scan %3.0f: ddepth %f, adepth %f, step %f\n",
+					scanp, target, delay, step);
 #endif
-			if (++scanp >= TABSIZE)
-				scanp = 0;
+				if (++scanp >= TABSIZE)
+					scanp = 0;
+			}
 		}
+
+		delayLineWrite(&local->dl, source + i, n);
+		delayLineRead(&local->dl, dest + i, n, mod, chorus? 1.0f:0.0f);
 	}
 
-	local->Freq1 = freq1;
-	local->Histin = histin;
-	local->Histout = histout;
+	local->delay = delay;
+	local->step = step;
 	local->scanr = scanr;
 	local->scanp = scanp;
 	return(0);
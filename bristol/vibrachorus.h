@@ -22,10 +22,13 @@
 #ifndef VCHORUS_H
 #define VCHORUS_H
 
+#include "delayline.h"
+
 #define VCHORUS_TBL_SZE 4096
 
 #define TABSIZE 720
 #define HISTSIZE 4096
+#define VCHORUS_BLOCK 64
 
 typedef struct BristolVCHORUS {
 	bristolOPSpec spec;
@@ -34,9 +37,9 @@ typedef struct BristolVCHORUS {
 
 typedef struct BristolVCHORUSlocal {
 	unsigned int flags;
-	float Freq1;
-	float Histin;
-	float Histout;
+	bristolDelayLine dl;
+	float delay;
+	float step;
 	float scanp;
 	float scanr;
 	float cg;
@@ -94,14 +94,14 @@ static int destroy(bristolOP *operator)
 	/*
 	 * Unmalloc anything we added to this structure
 	 */
-	bristolfree(((bristolVOX *) operator)->wave[0]);
-	bristolfree(((bristolVOX *) operator)->wave[1]);
-	bristolfree(((bristolVOX *) operator)->wave[2]);
-	bristolfree(((bristolVOX *) operator)->wave[3]);
-	bristolfree(((bristolVOX *) operator)->wave[4]);
-	bristolfree(((bristolVOX *) operator)->wave[5]);
-	bristolfree(((bristolVOX *) operator)->wave[6]);
-	bristolfree(((bristolVOX *) operator)->wave[7]);
+	bristolfree(((bristolVOX *) operator->specs)->wave[0]);
+	bristolfree(((bristolVOX *) operator->specs)->wave[1]);
+	bristolfree(((bristolVOX *) operator->specs)->wave[2]);
+	bristolfree(((bristolVOX *) operator->specs)->wave[3]);
+	bristolfree(((bristolVOX *) operator->specs)->wave[4]);
+	bristolfree(((bristolVOX *) operator->specs)->wave[5]);
+	bristolfree(((bristolVOX *) operator->specs)->wave[6]);
+	bristolfree(((bristolVOX *) operator->specs)->wave[7]);
 
 	bristolfree(operator->specs);
 
@@ -0,0 +1,112 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Wavetable stepping for the oscillators. They used to keep a float position
+ * in the table, cast it to an int for every sample, test it against the end of
+ * the table to wrap it and test it again to find the sample to interpolate
+ * with. Over a long note the float position also lost the low bits of the
+ * step, which is audible as a slow drift in the pitch of the higher notes.
+ *
+ * The phase here is fixed point and wraps on its own, see wavecore.h. Stepping
+ * it is one integer add per sample and is done first for a whole block, then
+ * the samples are interpolated BRISTOL_WAVE_BLOCK at a time in loops that the
+ * compiler vectorises. Only the loads from the table are scalar.
+ */
+
+#include "wavecore.h"
+
+/*
+ * Phase of each of 'count' samples starting with 'phase', stepping by
+ * step[i] * scale after each one. Returns the phase of the next sample.
+ */
+bristolPhase
+waveCorePhases(bristolPhase *ph, int count, bristolPhase phase, float *step,
+float scale)
+{
+	int i;
+
+	for (i = 0; i < count; i++)
+	{
+		ph[i] = phase;
+		phase += (bristolPhase) (long long) (step[i] * scale);
+	}
+
+	return(phase);
+}
+
+/*
+ * Add the table interpolated at each phase to ob, the gain of sample i being
+ * gain + dgain * i.
+ */
+void
+waveCoreRead(float *ob, int count, float *wt, int shift, bristolPhase *ph,
+float gain, float dgain)
+{
+	float f[BRISTOL_WAVE_BLOCK], s0[BRISTOL_WAVE_BLOCK], s1[BRISTOL_WAVE_BLOCK];
+	float scale = 1.0f / (float) (1u << shift);
+	bristolPhase mask = (1u << shift) - 1;
+	unsigned int idx[BRISTOL_WAVE_BLOCK];
+	int i, j;
+
+	for (j = 0; j + BRISTOL_WAVE_BLOCK <= count; j += BRISTOL_WAVE_BLOCK)
+	{
+		for (i = 0; i < BRISTOL_WAVE_BLOCK; i++)
+		{
+			idx[i] = ph[i + j] >> shift;
+			f[i] = (float) (int) (ph[i + j] & mask) * scale;
+		}
+		for (i = 0; i < BRISTOL_WAVE_BLOCK; i++)
+		{
+			s0[i] = wt[idx[i]];
+			s1[i] = wt[idx[i] + 1];
+		}
+		for (i = 0; i < BRISTOL_WAVE_BLOCK; i++)
+			ob[i + j] += (s0[i] + (s1[i] - s0[i]) * f[i])
+				* (gain + dgain * (i + j));
+	}
+
+	for (; j < count; j++)
+		ob[j] += waveCoreLerp(wt, ph[j], shift) * (gain + dgain * j);
+}
+
+/*
+ * The whole oscillator for the simple cases: step through wt by step[i] * scale
+ * table samples and add the result to ob. Returns the phase to continue from.
+ */
+bristolPhase
+waveCoreRun(float *ob, int count, float *wt, int shift, bristolPhase phase,
+float *step, float scale, float gain, float dgain)
+{
+	bristolPhase ph[BRISTOL_WAVE_CHUNK];
+	int i, n;
+
+	for (i = 0; i < count; i += n)
+	{
+		if ((n = count - i) > BRISTOL_WAVE_CHUNK)
+			n = BRISTOL_WAVE_CHUNK;
+
+		phase = waveCorePhases(ph, n, phase, &step[i], scale);
+		waveCoreRead(&ob[i], n, wt, shift, ph, gain + dgain * i, dgain);
+	}
+
+	return(phase);
+}
@@ -0,0 +1,107 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef WAVECORE_H
+#define WAVECORE_H
+
+/*
+ * Phase of the wavetable oscillators. A table of 2^n samples is covered by
+ * the full 32 bits of the phase, the top n bits are the sample and the rest the
+ * fraction, so the phase wraps by itself and running backwards is just adding
+ * a negative step. The tables carry one guard sample after the last, a copy of
+ * the first, so that interpolating the last sample never has to wrap.
+ */
+typedef unsigned int bristolPhase;
+
+#define BRISTOL_WAVE_GUARD 1
+
+/* Samples that the block reads take together */
+#define BRISTOL_WAVE_BLOCK 8
+
+/* Phases that waveCoreRun() steps in one go, for callers that keep their own */
+#define BRISTOL_WAVE_CHUNK (BRISTOL_WAVE_BLOCK * 8)
+
+/* Fraction bits for a table of 'size' samples, a power of two */
+static inline int
+waveCoreShift(int size)
+{
+	int shift = 32;
+
+	while (size > 1) {
+		size >>= 1;
+		shift--;
+	}
+	return(shift);
+}
+
+/* Table position as a float, as the oscillators used to keep it */
+static inline float
+waveCorePos(bristolPhase p, int shift)
+{
+	return((float) (p >> shift)
+		+ (float) (p & ((1u << shift) - 1)) * (1.0f / (float) (1u << shift)));
+}
+
+static inline bristolPhase
+waveCorePhase(float pos, int shift)
+{
+	return((bristolPhase) (long long) (pos * (float) (1u << shift)));
+}
+
+/*
+ * A step of 'step' table samples, either direction. FM can ask for steps of
+ * more than half the table, these wrap like any other phase.
+ */
+static inline bristolPhase
+waveCoreStep(float step, int shift)
+{
+	return((bristolPhase) (long long) (step * (float) (1u << shift)));
+}
+
+static inline float
+waveCoreFrac(bristolPhase p, int shift)
+{
+	return((float) (int) (p & ((1u << shift) - 1))
+		* (1.0f / (float) (1u << shift)));
+}
+
+static inline float
+waveCoreLerp(float *wt, bristolPhase p, int shift)
+{
+	float *s = &wt[p >> shift];
+
+	return(s[0] + (s[1] - s[0]) * waveCoreFrac(p, shift));
+}
+
+static inline void
+waveCoreGuard(float *wt, int size)
+{
+	wt[size] = wt[0];
+}
+
+extern bristolPhase waveCorePhases(bristolPhase *, int, bristolPhase, float *,
+	float);
+extern void waveCoreRead(float *, int, float *, int, bristolPhase *, float,
+	float);
+extern bristolPhase waveCoreRun(float *, int, float *, int, bristolPhase,
+	float *, float, float, float);
+
+#endif /* WAVECORE_H */
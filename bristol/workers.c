@@ -0,0 +1,288 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Emulation worker threads. With -workers the audio thread still does the
+ * voice list management and the final mix but hands the voices, postops and
+ * effects of each emulation to one of a pool of realtime threads. Every
+ * emulation renders into its own buffers so they can run at the same time,
+ * the audio thread then waits for all the workers and mixes the emulations in
+ * the same order as it always has.
+ *
+ * The operators keep their IO pointers in the palette, so each worker gets a
+ * palette of its own and a copy of audioMain that points at it, and the
+ * parameter changes are passed to every palette. Emulations that share code,
+ * the variants of a family, also share static buffers, wgroup keeps them on
+ * the same worker.
+ */
+
+#include <stdlib.h>
+#include <semaphore.h>
+
+#include "bristol.h"
+
+extern pthread_t spawnThreadOn(void * (*)(void *), void *, int, int);
+extern void initPalette(audioMain *, bristolOP *[]);
+extern void freePalette(audioMain *, bristolOP *[]);
+
+typedef struct BristolWorker {
+	struct BristolWorkerPool *pool;
+	pthread_t thread;
+	sem_t start;
+	int index;
+	int busy; /* Has emulations this period */
+	int rendered; /* Voices it rendered */
+	float *startbuf;
+	audioMain ops; /* What its emulations are given */
+} bristolWorker;
+
+typedef struct BristolWorkerPool {
+	audioMain *audiomain;
+	sem_t done;
+	int count;
+	volatile int exit;
+	float *input; /* The audio thread's startbuf for this period */
+	bristolWorker worker[BRISTOL_WORKERS_MAX];
+} bristolWorkerPool;
+
+/*
+ * The palettes outlive the pool, like the main one they are built once and
+ * only rebuilt for a new period size.
+ */
+static bristolOP **palettes[BRISTOL_WORKERS_MAX];
+static int palettecount[BRISTOL_WORKERS_MAX];
+
+static void *
+bristolWorkerThread(void *arg)
+{
+	bristolWorker *worker = (bristolWorker *) arg;
+	bristolWorkerPool *pool = worker->pool;
+	audioMain *audiomain = pool->audiomain;
+
+	bristolAllocRealtime(1);
+	bristolTraceThread("worker");
+
+	while (1)
+	{
+		while (sem_wait(&worker->start) != 0)
+			;
+
+		if (pool->exit)
+			break;
+
+		bristolDenormals(audiomain);
+
+		/*
+		 * Take a fresh copy each period, the MIDI thread changes audiomain
+		 * under us as it always has.
+		 */
+		bcopy(audiomain, &worker->ops, sizeof(audioMain));
+		worker->ops.palette = palettes[worker->index];
+		worker->ops.effects = palettes[worker->index];
+
+		bcopy(pool->input, worker->startbuf, audiomain->segmentsize * 2);
+
+		BRISTOL_TRACE_BEGIN("worker", worker->index, 0);
+		worker->rendered = bristolWorkerRender(audiomain, &worker->ops,
+			worker->startbuf, worker->index);
+		BRISTOL_TRACE_END("worker");
+
+		sem_post(&pool->done);
+	}
+
+	return(NULL);
+}
+
+/*
+ * Next CPU from the -workercpus list, -1 when there is none.
+ */
+static int
+bristolWorkerCPU(char **list)
+{
+	int cpu;
+
+	if ((*list == NULL) || (**list == '\0'))
+		return(-1);
+
+	cpu = strtol(*list, list, 10);
+
+	if (**list == ',')
+		(*list)++;
+
+	return(cpu);
+}
+
+int
+bristolWorkersInit(audioMain *audiomain)
+{
+	bristolWorkerPool *pool;
+	bristolWorker *worker;
+	char *cpus = audiomain->workercpus;
+	int i, priority;
+
+	if ((audiomain->workers <= 0) || (audiomain->pool != NULL))
+		return(0);
+
+	if (audiomain->workers > BRISTOL_WORKERS_MAX)
+		audiomain->workers = BRISTOL_WORKERS_MAX;
+
+	if ((priority = audiomain->workerprio) < 0)
+		priority = audiomain->priority;
+	/* As for the audio thread, they never wait on a device */
+	if (audiomain->flags & BRISTOL_FREEWHEEL)
+		priority = 0;
+
+	pool = (bristolWorkerPool *) bristolmalloc0(sizeof(bristolWorkerPool));
+	pool->audiomain = audiomain;
+	pool->count = audiomain->workers;
+	sem_init(&pool->done, 0, 0);
+
+	for (i = 0; i < pool->count; i++)
+	{
+		worker = &pool->worker[i];
+
+		if (palettecount[i] != audiomain->samplecount)
+		{
+			if (palettes[i] != NULL)
+			{
+				freePalette(audiomain, palettes[i]);
+				bristolfree(palettes[i]);
+			}
+			palettes[i] = (bristolOP **)
+				bristolmalloc0(sizeof(bristolOP *) * BRISTOL_SYNTHCOUNT);
+			initPalette(audiomain, palettes[i]);
+			palettecount[i] = audiomain->samplecount;
+		}
+
+		worker->pool = pool;
+		worker->index = i;
+		worker->startbuf = (float *) bristolmalloc0(audiomain->segmentsize * 2);
+		sem_init(&worker->start, 0, 0);
+
+		worker->thread = spawnThreadOn(bristolWorkerThread, worker, priority,
+			bristolWorkerCPU(&cpus));
+	}
+
+	audiomain->pool = pool;
+
+	printf("started %i emulation workers\n", pool->count);
+
+	return(pool->count);
+}
+
+void
+bristolWorkersStop(audioMain *audiomain)
+{
+	bristolWorkerPool *pool;
+	int i;
+
+	if ((pool = audiomain->pool) == NULL)
+		return;
+
+	audiomain->pool = NULL;
+	pool->exit = 1;
+
+	for (i = 0; i < pool->count; i++)
+	{
+		sem_post(&pool->worker[i].start);
+		pthread_join(pool->worker[i].thread, NULL);
+		sem_destroy(&pool->worker[i].start);
+		bristolfree(pool->worker[i].startbuf);
+	}
+
+	sem_destroy(&pool->done);
+	bristolfree(pool);
+}
+
+/*
+ * Called by the audio thread in place of its voice loop. Emulations are given
+ * to the workers oldest first so a new one does not move the rest, and an
+ * emulation that shares a group with an older one goes where that one went.
+ * Returns the number of voices rendered.
+ */
+int
+bristolWorkersRun(audioMain *audiomain, float *startbuf)
+{
+	bristolWorkerPool *pool = audiomain->pool;
+	Baudio *thisaudio, *other, *tail = NULL;
+	int i, next = 0, started = 0, rendered = 0;
+
+	for (i = 0; i < pool->count; i++)
+		pool->worker[i].busy = 0;
+
+	for (thisaudio = audiomain->audiolist; thisaudio != NULL;
+		thisaudio = thisaudio->next)
+		tail = thisaudio;
+
+	for (thisaudio = tail; thisaudio != NULL; thisaudio = thisaudio->last)
+	{
+		for (other = tail; other != thisaudio; other = other->last)
+			if (other->wgroup == thisaudio->wgroup)
+				break;
+
+		if (other != thisaudio)
+			thisaudio->worker = other->worker;
+		else
+			thisaudio->worker = next++ % pool->count;
+
+		pool->worker[thisaudio->worker].busy = 1;
+	}
+
+	pool->input = startbuf;
+
+	for (i = 0; i < pool->count; i++)
+		if (pool->worker[i].busy)
+		{
+			sem_post(&pool->worker[i].start);
+			started++;
+		}
+
+	for (i = 0; i < started; i++)
+		while (sem_wait(&pool->done) != 0)
+			;
+
+	for (i = 0; i < pool->count; i++)
+		if (pool->worker[i].busy)
+			rendered += pool->worker[i].rendered;
+
+	return(rendered);
+}
+
+/*
+ * Operator parameters can change the operator as well as the parameter table,
+ * every palette has to see them. Called after the main palette has been
+ * given the change.
+ */
+void
+bristolWorkersParam(audioMain *audiomain, bristolSound *sound,
+u_char controller, float value)
+{
+	bristolOP *op;
+	int i;
+
+	if (audiomain->pool == NULL)
+		return;
+
+	for (i = 0; i < audiomain->pool->count; i++)
+		if ((op = palettes[i][sound->index]) != NULL)
+			op->param(op, sound->param, controller, value);
+}
+
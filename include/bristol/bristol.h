@@ -116,6 +116,8 @@
 #define BRISTOL_UNISON			0x00001100
 #define BRISTOL_REQ_FORWARD		0x00001200 /* Disable event forwarding on chan*/
 #define BRISTOL_REQ_DEBUG		0x00001300 /* Debug level */
+#define BRISTOL_REQ_STATS		0x00001400 /* (stat << 1) | high 14 bits */
+#define BRISTOL_REQ_DENORMALS	0x00001500 /* 1 keeps denormals, 0 flushes */
 #define BRISTOL_MIDI_DEBUG1		0x00008000 /* Just messages */
 #define BRISTOL_MIDI_DEBUG2		0x00010000 /* And internal functions() */
 #define BRISTOL_MIDI_NRP_ENABLE	0x00020000
@@ -221,6 +223,11 @@
 #define B_TRILOGYOSC	33
 #define B_ENV5S			34
 #define B_NRO			35
+#define B_FDNREVERB		36
+
+/* The reverb an emulation puts on its effects list, B_REVERB by default */
+#define B_REVERB_ALGO(audiomain) \
+	((audiomain)->fdnreverb? B_FDNREVERB:B_REVERB)
 
 /*
  * Audio interface types. The lowest bytes is reserved.
@@ -238,6 +245,7 @@
 #define BRISTOL_PULSE_T			0x10000000 /* Threaded */
 #define BRISTOL_PULSE_S			0x20000000 /* Simple - lots of latency */
 #define BRISTOL_DUMMY			0x40000000
+#define BRISTOL_FREEWHEEL		0x00001000 /* Dummy audio runs unclocked */
 /* This appears to collide */
 #define BRISTOL_AUDIOWAIT		0x00002000
 
@@ -355,6 +363,9 @@ typedef struct BristolParam {
 #define BRISTOL_KEYOFFING	0x0020
 #define BRISTOL_KEYSUSTAIN	0x0040
 #define BRISTOL_KEYREOFF	0x0080
+#define BRISTOL_KEYSTEAL	0x0100 /* Stolen, envelopes use a fast release */
+
+#define BRISTOL_STEAL_TIME	0.005f /* Seconds for a stolen voice to release */
 /*
  * There are Korg Mono/Poly specifics for VCO assignment.
  */
@@ -401,9 +412,12 @@ typedef struct BristolVoice {
 	float cFreqstep; /* rate of change from C to D */
 	float cFreqmult; /* rate of change from C to D */
 	float oFreq; /* Used to return pitchbend to original value */
+	float aFreq; /* Step frequency until an arpeggiator step at offset */
+	float afreq; /* and the same in Hz */
 	float chanpressure; /* Need a copy here */
 	int transpose;
 	float detune;
+	int steal; /* Periods a stolen voice has left to release */
 } bristolVoice;
 
 /*
@@ -503,6 +517,7 @@ typedef struct BristolOP {
 	bristolAlgo init;
 	bristolAlgo destroy;
 	bristolAlgo reset;
+	bristolAlgo freelocal; /* Memory operate() hung off a voice's locals */
 	int (*param)(struct BristolOP *, bristolOPParams *, unsigned char, float);
 	int (*operate)(struct BristolOP *, bristolVoice *, bristolOPParams *,
 		void *);
@@ -511,6 +526,144 @@ typedef struct BristolOP {
 extern bristolOP *bristolOPinit();
 extern bristolIO *bristolIOinit();
 
+/*
+ * Control rate smoothing for operator parameters. The param() callbacks still
+ * write the raw value into bristolOPParams, an operator that wants to sweep
+ * cleanly keeps one of these in its voice locals and chases the raw value
+ * once per control block of BRISTOL_SMOOTH_BLOCK frames. Only the parameter
+ * is smoothed, modulation inputs are still taken every sample.
+ */
+#define BRISTOL_SMOOTH_BLOCK 16
+#define BRISTOL_SMOOTH_MS 10.0f /* Default ramp time */
+
+#define BRISTOL_SMOOTH_SET 0x01 /* Has a value, otherwise jump to target */
+
+typedef struct BristolSmooth {
+	unsigned int flags;
+	float value; /* Value at the end of the current control block */
+	float target;
+	float delta; /* Change per control block during the ramp */
+	int steps; /* Control blocks left in the ramp */
+} bristolSmooth;
+
+extern int bristolSmoothBlocks(int, float);
+extern void bristolSmoothInit(bristolSmooth *, float);
+extern void bristolSmoothTarget(bristolSmooth *, float, int);
+extern float bristolSmoothStep(bristolSmooth *);
+
+/*
+ * Half band up/down sampling for operators that generate harmonics, filter
+ * saturation for example, and would otherwise alias. Each voice keeps its own
+ * bristolOversample in its locals, the factor normally comes from the
+ * emulation's baudio->oversampling, see libbristol/oversample.c
+ */
+#define BRISTOL_HB_PAIRS 12 /* Non-zero taps each side of the centre */
+#define BRISTOL_HB_TAPS (BRISTOL_HB_PAIRS * 2)
+#define BRISTOL_OVERSAMPLE_MAX 4
+
+typedef struct BristolHalfband {
+	int index;
+	int cindex;
+	float fir[BRISTOL_HB_TAPS * 2];
+	float centre[BRISTOL_HB_PAIRS - 1];
+} bristolHalfband;
+
+typedef struct BristolOversample {
+	int factor; /* 1, 2 or 4 */
+	bristolHalfband up[2];
+	bristolHalfband down[2];
+} bristolOversample;
+
+extern int bristolOversampleInit(bristolOversample *, int);
+extern void bristolOversampleUp(bristolOversample *, float *, float *, int);
+extern void bristolOversampleDown(bristolOversample *, float *, float *,
+	float, int);
+
+/*
+ * Voice CPU budget. The cost per voice is measured each period and smoothed,
+ * when the active voices would take more than the budgeted fraction of the
+ * period the excess is stolen, see bristolVoiceSteal().
+ */
+typedef struct BristolVoiceBudget {
+	float budget; /* -cpubudget as a fraction of the period, 0 is no limit */
+	float cost; /* seconds per voice per period */
+	int limit; /* voices the budget currently allows */
+	int stolen; /* running count of stolen voices */
+} bristolVoiceBudget;
+
+/*
+ * Shared master effects. An emulation sends the fraction baudio->fxsend of
+ * its signal to the bus buffers, taken just before the first of its effects
+ * that is also on the bus, or from its output if it has none. The rest goes
+ * direct and still runs through the emulation's own effects, with a full send
+ * they are skipped. The bus chain runs once per period on the sum and is
+ * mixed into the output. Each bus effect has the parameters of its owner, the
+ * oldest emulation that has the same operator, its defaults when none does.
+ */
+#define BRISTOL_FXBUS_MAX 8
+
+typedef struct BristolFXBus {
+	int count;
+	int op[BRISTOL_FXBUS_MAX]; /* palette indices from -fxbus */
+	bristolSound *effect[BRISTOL_FXBUS_MAX];
+	char *locals[BRISTOL_FXBUS_MAX];
+	float *leftbuf;
+	float *rightbuf;
+	bristolVoice *voice; /* Last voice to send, for operators that want one */
+	struct BAudio *owner[BRISTOL_FXBUS_MAX]; /* Whose settings each effect has */
+	float send; /* -fxsend, copied to each new baudio */
+} bristolFXBus;
+
+/*
+ * Emulation worker threads, see bristol/workers.c. With -workers the voices,
+ * postops and effects of each emulation are rendered on one of a pool of
+ * threads, each with its own copy of the operator palette. The audio thread
+ * waits for all of them and then does the final mix as before.
+ */
+#define BRISTOL_WORKERS_MAX 16
+
+/*
+ * Engine health, see bristol/telemetry.c. The audio thread, or the JACK
+ * callback, marks the start and end of each period. Everything else reads
+ * these without locking, a torn value only costs one odd sample.
+ */
+#define BRISTOL_HIST_BUCKETS 16 /* 10% of the period each, last is overrun */
+#define BRISTOL_JITTER_RING 1024 /* Wakeups kept for the percentiles */
+
+typedef struct BristolTelemetry {
+	u_int64_t wake; /* Start of the current period, ns */
+	u_int64_t last; /* Start of the previous one */
+	float load; /* Smoothed fraction of the period spent computing */
+	float peak;
+	unsigned int periods;
+	unsigned int xruns;
+	unsigned int restarts; /* Audio device reopened or restarted */
+	unsigned int steals; /* Note stealing, the CPU budget counts its own */
+	unsigned int clips; /* Periods with clipped output */
+	unsigned int hist[BRISTOL_HIST_BUCKETS];
+	int jitter[BRISTOL_JITTER_RING]; /* Wakeup error, us */
+	unsigned int jindex;
+	char *file; /* -metrics */
+} bristolTelemetry;
+
+/*
+ * Values that can be requested with BRISTOL_REQ_STATS. Load is in tenths of
+ * a percent, jitter in microseconds.
+ */
+#define BRISTOL_STAT_LOAD		0
+#define BRISTOL_STAT_PEAK		1
+#define BRISTOL_STAT_PERIODS	2
+#define BRISTOL_STAT_XRUNS		3
+#define BRISTOL_STAT_RESTARTS	4
+#define BRISTOL_STAT_STEALS		5
+#define BRISTOL_STAT_CLIPS		6
+#define BRISTOL_STAT_JITTER50	7
+#define BRISTOL_STAT_JITTER90	8
+#define BRISTOL_STAT_JITTER99	9
+#define BRISTOL_STAT_JITTERMAX	10
+#define BRISTOL_STAT_HIST		11 /* First of BRISTOL_HIST_BUCKETS */
+#define BRISTOL_STAT_COUNT		(BRISTOL_STAT_HIST + BRISTOL_HIST_BUCKETS)
+
 /*
  * This are mixflags: the system reserves the space 0xffff0000.00000000, and
  * a poly algorithm can use the rest.
@@ -541,39 +694,76 @@ extern bristolIO *bristolIOinit();
 #define BRISTOL_MNL_TRIG	0x0010
 #define BRISTOL_MNL_VELOC	0x0020
 
+/*
+ * The MIDI mapping tables for an emulation. They are only read at note on and
+ * on controller changes so they are allocated apart from the Baudio, they are
+ * a lot bigger than everything else in it.
+ */
+typedef struct BAudioMaps {
+	fTab ctab[DEF_TAB_SIZE];
+	fTab microtonalmap[128];
+	float velocitymap[128];
+	int midimap[128];
+	int GM2values[MIDI_CONTROLLER_COUNT];
+	u_char valuemap[128][128];
+} baudioMaps;
+
 /*
  * Audio globals structure.
  */
 typedef struct BAudio {
+	/*
+	 * Everything that the audio thread walks through on each period is kept
+	 * here at the head, it fits in 128 bytes. Keep it that way, put anything
+	 * that is not used per period further down.
+	 */
 	struct BAudio *next;
-	struct BAudio *last;
-	int soundCount;
-	bristolSound **sound; /* operator instance sequences */
-	bristolSound **effect;
-	int (*param)(struct BAudio *, u_char, u_char, float); /* param change */
+	u_int64_t mixflags;
 	bristolAlgo preops; /* Pre polyphonic (ie, monophonic) voicing routine */
 	bristolAlgo operate; /* Polyphonic voice mixing routine */
 	bristolAlgo postops; /* Post polyphonic voicing routine: FX, etc. */
-	bristolAlgo destroy; /* Voice destruction routine */
 	bristolVoice *firstVoice;
+	bristolSound **effect;
+	char ***FXlocals;
+	float *leftbuf;
+	float *rightbuf;
+	int soundCount;
+	int voicecount;
+	int cvoices;
+	int lvoices;
+	int sid;
+	unsigned int midiflags;
+	float gain;
+	float fxsend; /* Fraction of the output sent to the shared effects bus */
+	float *fxleft, *fxright; /* The send, taken ahead of the first bus effect */
+	int fxtapped;
+	/* For the corrected monophonic note logic, the flags are also per period */
+	struct {
+		int count;
+		int flags;
+		int extreme;
+		int low;
+		int high;
+		int key[128];
+		int velocity[128];
+	} notemap;
+	struct BAudio *last;
+	bristolSound **sound; /* operator instance sequences */
+	int (*param)(struct BAudio *, u_char, u_char, float); /* param change */
+	bristolAlgo destroy; /* Voice destruction routine */
 	int debuglevel;
 	/*
 	 * This should become a generic MIDI modifier table.
 	 */
 	float contcontroller[MIDI_CONTROLLER_COUNT];
-	int GM2values[MIDI_CONTROLLER_COUNT];
 	/* We should put in a callback function here. */
 	int (*midi)(struct BAudio *, int, float); /* param change */
 	chanPressMsg chanPress;
 	float chanpressure;
-	int sid;
 	int controlid;
 	int midichannel;
 	char ***locals; /* Unique locals per voice, a basic necessity. */
 	void ***params; /* Unique params per voice, for MIDI poly support, etc. */
-	char ***FXlocals;
-	u_int64_t mixflags;
-	unsigned int midiflags;
 	/*
 	 * These need to remain to the baudio structure
 	 */
@@ -584,42 +774,34 @@ typedef struct BAudio {
 	float note_diff;
 	float gain_diff;
 	int transpose;
-	arpeggiator arpeggio;
 	float pitchwheel;
 	int midi_pitch;
 	float midi_pitchfreq;
-	int cvoices;
-	int lvoices;
-	float *leftbuf;
-	float *rightbuf;
-	fTab ctab[DEF_TAB_SIZE];
 	float *mixlocals;
-	int voicecount;
 	char lowkey;
 	char highkey;
 	unsigned char lastkey;
 	float detune;
 	float finetune;
 	float coarsetune;
-	float gain;
-	fTab microtonalmap[128];
-	float velocitymap[128];
-	int midimap[128];
-	u_char valuemap[128][128];
 	int sensecount;
 	int samplerate;
 	int samplecount;
-	int oversampling;
-	/* For the corrected monophonic note logic */
-	struct {
-		int key[128];
-		int velocity[128];
-		int count;
-		int flags;
-		int low;
-		int high;
-		int extreme;
-	} notemap;
+	int oversampling; /* Nonlinear operator rate, 0 = default for samplerate */
+	int reserved; /* Voices that cannot be stolen by the CPU budget */
+	/* These all point into maps */
+	baudioMaps *maps;
+	fTab *ctab;
+	fTab *microtonalmap;
+	float *velocitymap;
+	int *midimap;
+	int *GM2values;
+	u_char (*valuemap)[128];
+	arpeggiator arpeggio;
+	int wgroup; /* Emulations that share code share a worker, see workers.c */
+	int worker; /* Worker rendering this emulation this period, -1 for none */
+	int fxout; /* What its effects left for the mix, from the worker */
+	struct AudioMain *audiomain; /* The engine it runs in */
 } Baudio;
 
 typedef struct AudioMain {
@@ -678,6 +860,21 @@ typedef struct AudioMain {
 	char *cmdline;
 	char *sessionfile;
 	char *controldev;
+	arpClock clock; /* Arpeggiator and sequencer sync */
+	int oversampling; /* -oversample, copied to each new baudio */
+	bristolFXBus fxbus;
+	bristolVoiceBudget vbudget;
+	int reserved; /* -reserve, copied to each new baudio */
+	int arena; /* -arena, MB of locked memory for engine allocations */
+	bristolTelemetry telemetry;
+	int workers; /* -workers, 0 renders everything on the audio thread */
+	int workerprio; /* -workerprio, -1 follows -priority */
+	char *workercpus; /* -workercpus, CPU list for the workers in order */
+	struct BristolWorkerPool *pool;
+	int denormals; /* -denormals, leave the FPU flush to zero mode off */
+	int fdnreverb; /* -fdnreverb, emulations take B_FDNREVERB for B_REVERB */
+	int midiecho; /* -midiecho, sequencer input back out of our port */
+	void *mixer; /* Engine mixer when the mixer GUI is linked, bristolmixer.c */
 } audioMain;
 
 extern int cleanup();
@@ -692,6 +889,42 @@ extern void * bristolmalloc();
 extern void * bristolmalloc0();
 extern void bristolfree();
 extern void bristolbzero();
+extern int bristolArenaInit(int);
+extern int bristolArenaStats();
+extern int bristolAllocRealtime(int);
+extern unsigned long bristolDenormals(audioMain *);
+extern void bristolDenormalsRestore(unsigned long);
+
+/*
+ * Span and instant events for the trace rings, see libbristol/trace.c. These
+ * cost a flag test when -trace was not given.
+ */
+extern int bristolTraceOn;
+extern int bristolTraceInit(int);
+extern void bristolTraceThread(const char *);
+extern void bristolTrace(char, const char *, int, int);
+extern int bristolTraceDump(char *);
+
+#define BRISTOL_TRACE_BEGIN(n, a, i) \
+	do { if (bristolTraceOn) bristolTrace('B', n, a, i); } while (0)
+#define BRISTOL_TRACE_END(n) \
+	do { if (bristolTraceOn) bristolTrace('E', n, 0, 0); } while (0)
+#define BRISTOL_TRACE_INSTANT(n, a, i) \
+	do { if (bristolTraceOn) bristolTrace('i', n, a, i); } while (0)
+
+extern int bristolWorkersInit(audioMain *);
+extern void bristolWorkersStop(audioMain *);
+extern int bristolWorkersRun(audioMain *, float *);
+extern void bristolWorkersParam(audioMain *, bristolSound *, u_char, float);
+extern int bristolWorkerRender(audioMain *, audioMain *, float *, int);
+
+extern int bristolMixerInput(audioMain *, Baudio *, float *, float *, float);
+extern void bristolMixerRender(audioMain *, float *);
+
+extern void bristolTelemetryStart(audioMain *);
+extern void bristolTelemetryEnd(audioMain *, float *, float);
+extern int bristolTelemetryRead(audioMain *, int);
+extern int bristolTelemetryDump(audioMain *);
 
 extern void alterAllNotes();
 extern int fillFreqTable();
@@ -708,6 +941,8 @@ int bristolArpegReAudio(audioMain *, Baudio *);
 void bristolArpeggiatorInit(Baudio *);
 void bristolArpeggiator(audioMain *, bristolMidiMsg *);
 void bristolArpeggiatorNoteEvent(Baudio *, bristolMidiMsg *);
+void bristolArpeggiatorClock(audioMain *, int, int);
+void bristolArpeggiatorTransport(audioMain *, int, double, double);
 
 #endif /* _BRISTOL_H */
 
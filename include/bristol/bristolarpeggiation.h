@@ -96,9 +96,11 @@ typedef struct ArpSeq {
 	int span; /* Configured number of octaves to cover */
 	int dir; /* Configured sequence direction */
 	int max;	/* Total number of notes in the sequence (config/learnt) */
-	int count; /* current scan through the rate */
+	int count; /* frames from the start of this period to the next step */
 	int step; /* going up or down through the sequence */
-	//int d_offset; /* sample accurate correction for note events */
+	int d_offset; /* frame offset of the last step in this period, or -1 */
+	int ticks; /* clock ticks per step when synced to an external clock */
+	int tick; /* last clock tick this sequence stepped on */
 	int dif; /* Note difference - for sequencer only */
 	int vdif; /* velocity difference - for sequencer only */
 	int current; /* current note index */
@@ -106,6 +108,31 @@ typedef struct ArpSeq {
 	arpNote notes[BRISTOL_SEQ_MAX + 1];
 } arpSeq;
 
+/*
+ * External clock at 24 ticks per quarter note, from MIDI clock or derived from
+ * the JACK transport. This is kept in audioMain as all the emulations follow
+ * the same clock. Times are in frames since the engine started, the incoming
+ * ticks are smoothed with a second order delay locked loop so the steps can be
+ * placed at exact frame offsets even though MIDI clock only arrives with the
+ * jitter of the MIDI thread and the period size.
+ */
+#define BRISTOL_CLOCK_PPQN	24
+#define BRISTOL_CLOCK_AHEAD	BRISTOL_CLOCK_PPQN /* freewheel one beat */
+
+#define BRISTOL_CLOCK_RUN	0x0001
+#define BRISTOL_CLOCK_LOCK	0x0002
+#define BRISTOL_CLOCK_FIRST	0x0004
+#define BRISTOL_CLOCK_JACK	0x0008
+
+typedef struct ArpClock {
+	unsigned int flags;
+	double frame; /* frame time of the start of the current period */
+	double t0; /* time of the last tick received */
+	double t1; /* predicted time of the next tick */
+	double period; /* filtered frames per tick */
+	int tick; /* index of the next tick since the last MIDI start */
+} arpClock;
+
 /*
  * This gets buried into the baudio structure for the emulation
  */
@@ -0,0 +1,83 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * The engine as a library, libbristolengine. The host creates the engine,
+ * starts one or more emulations and then pulls audio from it a block at a
+ * time with bristolEngineProcess(). There are no threads, devices or sockets,
+ * MIDI and parameters are given to the engine with the calls below.
+ *
+ * A host would do something like:
+ *
+ *	engine = bristolEngineCreate(48000, 256, 32);
+ *	id = bristolEngineEmulation(engine, bristolEngineAlgo("mini"), 0, 8);
+ *	...
+ *	bristolEngineMidi(engine, noteon, 3, 17);
+ *	bristolEngineProcess(engine, out, nframes);
+ *	...
+ *	bristolEngineDestroy(engine);
+ *
+ * Several emulations can be run in an engine on different MIDI channels and
+ * there can be several engines, each with its own emulations and voices. The
+ * engines of a process share the operator code and its tables and buffers so
+ * they have to have the same samplerate, they all run the period of the
+ * first one and they render one at a time. MIDI events are queued for the
+ * next bristolEngineProcess() and should be given from the thread that calls
+ * it, the other calls can come from a control thread in the same way as the
+ * MIDI thread of the bristol daemon.
+ */
+
+#ifndef _BRISTOL_ENGINE_H
+#define _BRISTOL_ENGINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct BristolEngine bristolEngine;
+
+/* Events that can be queued for one call to bristolEngineProcess() */
+#define BRISTOL_ENGINE_EVENTS 512
+
+extern bristolEngine *bristolEngineCreate(int, int, int);
+extern void bristolEngineDestroy(bristolEngine *);
+
+extern int bristolEngineAlgo(char *);
+extern char *bristolEngineName(int);
+extern int bristolEngineAlgoCount();
+extern int bristolEngineEmulation(bristolEngine *, int, int, int);
+extern int bristolEngineDefault(int, int, int *, int *, float *);
+
+extern int bristolEngineMidi(bristolEngine *, unsigned char *, int, int);
+extern int bristolEngineNRP(bristolEngine *, int, int, int, int);
+extern int bristolEngineParam(bristolEngine *, int, int, int, float);
+extern int bristolEngineBudget(bristolEngine *, float);
+extern int bristolEngineVoices(bristolEngine *);
+extern int bristolEngineDenormals(bristolEngine *, int);
+
+extern int bristolEnginePeriod(bristolEngine *);
+extern int bristolEngineProcess(bristolEngine *, float **, int);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BRISTOL_ENGINE_H */
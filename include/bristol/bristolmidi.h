@@ -114,6 +114,10 @@ typedef struct BristolALSADev {
 
 typedef struct BristolSeqDev {
 	snd_seq_t *handle; /* ALSA driver handle */
+	int queue;
+	int port;
+	int delay; /* us after the flush that batched output is scheduled */
+	snd_midi_event_t *encoder; /* Raw bytes to events for the batch */
 } bristolSeqDev;
 #endif /* BRISTOL_HAS_ALSA */
 
@@ -148,6 +152,29 @@ typedef struct BristolMidiDev {
 	bristolMidiMsg msg;
 } bristolMidiDev;
 
+/*
+ * Caller owned output batch, see bristolMidiBatchWrite(). RAWSIZE covers the
+ * largest message on the wire, status, 255 bytes and the EOS.
+ */
+#define BRISTOL_MIDI_RAWSIZE 260
+#define BRISTOL_MIDI_BATCHDEVS 4
+#define BRISTOL_MIDI_BATCHSIZE 2048
+
+typedef struct BristolMidiBatch {
+	int dev[BRISTOL_MIDI_BATCHDEVS];
+	int count[BRISTOL_MIDI_BATCHDEVS];
+	unsigned char buf[BRISTOL_MIDI_BATCHDEVS][BRISTOL_MIDI_BATCHSIZE];
+} bristolMidiBatch;
+
+/*
+ * The engine's forwarding ringbuffer carries messages already encoded for the
+ * wire, each behind one of these.
+ */
+typedef struct BristolMidiFwdHdr {
+	unsigned short dev;
+	unsigned short count;
+} bristolMidiFwdHdr;
+
 typedef struct BristolMidiMain {
 	unsigned int flags;
 	unsigned int SysID;
@@ -169,6 +196,14 @@ extern int bristolMidiSendKeyMsg(int, int, int, int, int);
 
 extern int bristolMidiControl(int, int, int, int, int);
 
+extern int bristolMidiRawEncode(bristolMidiMsg *, int, unsigned char *, int);
+extern void bristolMidiBatchInit(bristolMidiBatch *);
+extern int bristolMidiBatchWrite(bristolMidiBatch *, int, bristolMidiMsg *, int);
+extern int bristolMidiBatchRaw(bristolMidiBatch *, int, unsigned char *, int);
+extern int bristolMidiBatchFlush(bristolMidiBatch *);
+extern int bristolMidiOutputBatch(int, int);
+extern int bristolMidiFlush(int);
+
 extern int bristolMidiOption(int, int, int);
 extern void bristolMidiRegisterForwarder(int (*)());
 
@@ -179,6 +214,31 @@ extern void resetBristolCache();
 extern int bristolGetMap(char *, char *, float *, int, int);
 extern int bristolGetFreqMap(char *, char *, fTab *, int, int, int);
 
+/*
+ * Profiles parsed once per process, see profileCache.c. Line is the offset of
+ * the text in the profile, index is -1 if it is not a map entry.
+ */
+typedef struct BristolProfileEntry {
+	int line;
+	int index;
+	float value;
+} bristolProfileEntry;
+
+typedef struct BristolProfile {
+	struct BristolProfile *next;
+	char path[BUFSZE];
+	long long mtime;
+	long long size;
+	int count;
+	bristolProfileEntry *entries;
+	char *text;
+} bristolProfile;
+
+extern bristolProfile *bristolProfileOpen(char *);
+extern char *bristolProfileLine(bristolProfile *, int);
+extern void bristolProfileClose(bristolProfile *);
+extern void bristolProfileFlush();
+
 extern int bristolParseScala(char *, float *);
 
 extern pthread_t bristolOpenStdio(int);
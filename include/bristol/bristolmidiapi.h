@@ -70,6 +70,7 @@ extern void bristolMidiPrintGM2();
 #define BRISTOL_CONN_NBLOCK		0x00004000
 #define BRISTOL_CONN_SYSEX		0x00008000
 #define BRISTOL_CONN_FORWARD	0x00010000
+#define BRISTOL_CONN_BATCH		0x00020000 /* Output held for bristolMidiFlush */
 
 /*
  * API flags
@@ -143,11 +144,22 @@ extern void bristolMidiPrintGM2();
 #define BRISTOL_NRP_REQ_SYSEX	16368 /* = NRP 0x7f-70 = 0x3ff0 */
 #define BRISTOL_NRP_REQ_FORWARD	16367 /* = NRP 0x7f-6f = 0x3fef */
 #define BRISTOL_NRP_REQ_DEBUG	16366 /* = NRP 0x7f-6e = 0x3fee */
+#define BRISTOL_NRP_FXSEND		16365 /* = NRP 0x7f-6d = 0x3fed */
+#define BRISTOL_NRP_RESERVE		16364 /* = NRP 0x7f-6c = 0x3fec */
 
 #define MIDI_SYSTEM		0x0f0
 #define MIDI_SYSEX		0x0f8
 #define MIDI_EOS		0x0f7
 
+/*
+ * System realtime. The timing clock is 0xf8 on the wire, that is already
+ * MIDI_SYSEX in bristol so internally the clock is carried as 0xf9.
+ */
+#define MIDI_RT_CLOCK		0x0f9
+#define MIDI_RT_START		0x0fa
+#define MIDI_RT_CONTINUE	0x0fb
+#define MIDI_RT_STOP		0x0fc
+
 #define BRISTOL_REQ_ON		0x001
 #define BRISTOL_REQ_OFF		0x002
 #define BRISTOL_REQ_PP		0x004
@@ -156,9 +168,10 @@ extern void bristolMidiPrintGM2();
 #define BRISTOL_REQ_CHAN	0x020
 #define BRISTOL_REQ_PITCH	0x040
 #define BRISTOL_REQ_SYSEX	0x080
+#define BRISTOL_REQ_CLOCK	0x100 /* system realtime, clock and transport */
 
 #define BRISTOL_REQ_ALL		0x0ff
-#define BRISTOL_REQ_NSX		0x07f /* not SysEx messages....... */
+#define BRISTOL_REQ_NSX		0x17f /* not SysEx messages....... */
 
 #define MIDI_GM_DATAENTRY	6
 #define MIDI_GM_NRP			99
@@ -240,6 +253,30 @@ typedef struct BristolMidiMsg {
 	} GM2;
 } bristolMidiMsg;
 
+/*
+ * The full bristolMidiMsg is rather large (timestamp, the bristol message
+ * union and the GM2 block) and most of it is not needed to get a note from
+ * the MIDI thread to the audio thread. This is the packed record that goes
+ * through audiomain->rb, it is 16 bytes so four events fit in a cacheline.
+ * The audio thread reads them in place so the size has to stay a power of
+ * two, a record must never straddle the end of the ringbuffer.
+ * Control and system traffic still uses the full message.
+ *
+ * sid is the first emulation that will take the event as resolved by the
+ * MIDI thread, -1 if there was none at the time.
+ */
+typedef struct BristolEventMsg {
+	int offset; /* frame offset into the period */
+	unsigned char command;
+	unsigned char channel;
+	unsigned char key;
+	unsigned char velocity;
+	unsigned char flags;
+	unsigned char midiHandle;
+	short sid;
+	unsigned int sequence;
+} bristolEventMsg;
+
 #define DEF_TAB_SIZE 128
 
 typedef struct TableEntry {
@@ -51,16 +51,29 @@ jack_ringbuffer_data_t ;
 #define JRB_LOCKED	0x01
 #define JRB_STOPPED	0x02
 
+/*
+ * Each side has the index it owns on a cache line of its own, together with
+ * its last look at the other side's index, so the producer and the consumer
+ * only touch the other's line when they appear to have run out of data or of
+ * space. The indices run free and are only masked to address the buffer, all
+ * of it is usable.
+ */
+#define JRB_CACHELINE	64
+
 typedef struct
 {
   char		 *buf;
-  volatile size_t write_ptr;
-  volatile size_t read_ptr;
   size_t	  size;
   size_t	  size_mask;
-  int		  flags;
   int		  mlocked;
-} 
+  volatile int	  flags;
+  /* Producer */
+  volatile size_t write_ptr __attribute__ ((aligned (JRB_CACHELINE)));
+  size_t	  read_cache;
+  /* Consumer */
+  volatile size_t read_ptr __attribute__ ((aligned (JRB_CACHELINE)));
+  size_t	  write_cache;
+} __attribute__ ((aligned (JRB_CACHELINE)))
 jack_ringbuffer_t ;
 
 /**
@@ -188,13 +201,53 @@ size_t jack_ringbuffer_read_space(const jack_ringbuffer_t *rb);
  */
 int jack_ringbuffer_mlock(jack_ringbuffer_t *rb);
 
+/**
+ * Deactivate the ringbuffer. Writes are discarded until it is started again
+ * and anything already queued is dropped.
+ *
+ * Only the reading thread may call this.
+ *
+ * @param rb a pointer to the ringbuffer structure.
+ */
 void jack_ringbuffer_stop(jack_ringbuffer_t *rb);
+
+/**
+ * Reactivate a stopped ringbuffer. The pointers are left alone so this is
+ * safe from either thread.
+ *
+ * @param rb a pointer to the ringbuffer structure.
+ */
 void jack_ringbuffer_go(jack_ringbuffer_t *rb);
 
+/**
+ * Return non-zero if the ringbuffer has been stopped.
+ *
+ * @param rb a pointer to the ringbuffer structure.
+ */
+int jack_ringbuffer_stopped(const jack_ringbuffer_t *rb);
+
+/**
+ * Zero-copy access to a batch of fixed size records. The records are read
+ * in place, then released with jack_ringbuffer_read_advance() of
+ * count * recsize bytes. Only the run up to the end of the buffer is
+ * returned, call again after the advance for any that follow.
+ *
+ * The record size must be a power of two and every write a whole record
+ * so that no record straddles the end of the buffer.
+ *
+ * @param rb a pointer to the ringbuffer structure.
+ * @param recsize the size of one record in bytes.
+ * @param records set to the first record.
+ *
+ * @return the number of whole records available at @a records.
+ */
+size_t jack_ringbuffer_peek_records(jack_ringbuffer_t *rb, size_t recsize,
+				    void **records);
+
 /**
  * Reset the read and write pointers, making an empty buffer.
  *
- * This is not thread safe.
+ * This is not thread safe, it is for use before the ringbuffer is shared.
  *
  * @param rb a pointer to the ringbuffer structure.
  */
@@ -32,6 +32,7 @@
 #endif
 
 #define AUDIO_DUMMY 0x8000
+#define AUDIO_FREEWHEEL 0x10000 /* Dummy device does not wait for the period */
 
 #ifdef CD_WRITE
 #define ISO_OPTS_COUNT 7
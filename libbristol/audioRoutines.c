@@ -111,6 +111,8 @@ bristolAudioOpen(char *device, int rate, int count, int flags)
 
 	if (flags & BRISTOL_DUMMY)
 		audioDev.flags |= AUDIO_DUMMY;
+	if (flags & BRISTOL_FREEWHEEL)
+		audioDev.flags |= AUDIO_FREEWHEEL;
 
 	if (audioOpen(&audioDev, 0, SLAB_ORDWR) < 0)
 		return(-1);
@@ -129,6 +131,7 @@ bristolAudioStart()
 }
 
 static short accum = 0;
+static int clipping = 0;
 
 int
 bristolAudioWrite(register float *buf, register int count)
@@ -211,8 +214,16 @@ bristolAudioWrite(register float *buf, register int count)
 			d = write(dupfd, audioDev.fragBuf, audioDev.fragSize);
 	}
 #endif
-	if (clipped)
-		printf("Clipping output\n");
+	/*
+	 * Only report the start of clipping, a print every period of a loud
+	 * passage just backs up the log thread.
+	 */
+	if (clipped) {
+		BRISTOL_TRACE_INSTANT("clip", count, 0);
+		if (clipping == 0)
+			printf("Clipping output\n");
+	}
+	clipping = clipped;
 
 	return(0);
 }
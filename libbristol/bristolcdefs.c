@@ -20,16 +20,235 @@
  */
 
 #include <stdlib.h> /* only for init library */
+#include <sys/mman.h>
+#include <assert.h>
 
 #include "bristol.h"
 
+/*
+ * Engine allocations come out of a single arena that is allocated, touched
+ * and mlock()ed at startup so that loading or removing an emulation while the
+ * audio thread is running does not page fault or wait on the malloc locks.
+ * Blocks are power of two size classes with a header giving the class, freed
+ * blocks go onto a free list for their class and are never returned. Sizes
+ * above the largest class, or anything after the arena is used up, go to the
+ * heap as before.
+ *
+ * The free lists are lock free stacks, the head carries a tag that changes
+ * on every update so a pop cannot be fooled by the same block having been
+ * popped and pushed back again in the meantime. Blocks are addressed by
+ * offset into the arena so the head fits into one 64 bit word.
+ *
+ * The audio thread marks itself with bristolAllocRealtime(). Any heap call it
+ * makes is counted and reported by bristolArenaStats(), with -DBRISTOL_RT_ASSERT
+ * it will assert.
+ */
+#define BRISTOL_POOL_MIN 5 /* 32 byte blocks */
+#define BRISTOL_POOL_MAX 22 /* 4MB blocks */
+#define BRISTOL_POOL_CLASSES (BRISTOL_POOL_MAX - BRISTOL_POOL_MIN + 1)
+#define BRISTOL_POOL_HDR 16 /* Keeps the blocks 16 byte aligned */
+
+typedef struct BristolPoolHdr {
+	u_int32_t class;
+	u_int32_t next; /* Free list link, block offset / 16 + 1, 0 terminates */
+	u_int32_t size; /* As requested, for the statistics */
+	u_int32_t magic;
+} bristolPoolHdr;
+
+#define BRISTOL_POOL_MAGIC 0xb1a0c8ed
+
+static struct {
+	char *base;
+	size_t size;
+	volatile size_t next; /* Offset of the unused part of the arena */
+	volatile u_int64_t free[BRISTOL_POOL_CLASSES];
+	volatile int poolallocs;
+	volatile int heapallocs;
+	volatile int rtheap;
+	volatile size_t inuse;
+	int locked;
+} arena;
+
+static __thread int bristolrt = 0;
+
+/*
+ * Returns the previous setting, a thread that only calls into the engine for
+ * a while can put it back.
+ */
+int
+bristolAllocRealtime(int on)
+{
+	int previous = bristolrt;
+
+	bristolrt = on;
+
+	return(previous);
+}
+
+/*
+ * Size the arena in megabytes, 0 leaves everything on the heap. This has to
+ * be called before the engine threads start.
+ */
+int
+bristolArenaInit(int mb)
+{
+	if ((mb <= 0) || (arena.base != NULL))
+		return(0);
+
+	arena.size = ((size_t) mb) << 20;
+
+	if ((arena.base = malloc(arena.size)) == NULL)
+	{
+		printf("could not allocate %iMB engine arena\n", mb);
+		arena.size = 0;
+		return(-1);
+	}
+
+	/* Fault it all in now, mlock() may not be permitted */
+	bzero(arena.base, arena.size);
+
+	if (mlock(arena.base, arena.size) == 0)
+		arena.locked = 1;
+	else
+		printf("could not lock %iMB engine arena, check ulimit -l\n", mb);
+
+	return(0);
+}
+
+static bristolPoolHdr *
+bristolPoolPop(int class)
+{
+	u_int64_t old, new;
+	bristolPoolHdr *hdr;
+	u_int32_t index;
+
+	do {
+		old = arena.free[class];
+		if ((index = (u_int32_t) old) == 0)
+			return(NULL);
+		/* May be stale if we lose the race, the tag then fails the swap */
+		hdr = (bristolPoolHdr *) (arena.base + (((size_t) index - 1) << 4));
+		new = (((old >> 32) + 1) << 32) | hdr->next;
+	} while (!__sync_bool_compare_and_swap(&arena.free[class], old, new));
+
+	return(hdr);
+}
+
+static void
+bristolPoolPush(int class, bristolPoolHdr *hdr)
+{
+	u_int64_t old, new;
+	u_int32_t index = ((((char *) hdr) - arena.base) >> 4) + 1;
+
+	do {
+		old = arena.free[class];
+		hdr->next = (u_int32_t) old;
+		new = (((old >> 32) + 1) << 32) | index;
+	} while (!__sync_bool_compare_and_swap(&arena.free[class], old, new));
+}
+
+static void *
+bristolPoolAlloc(size_t size)
+{
+	bristolPoolHdr *hdr;
+	size_t need, offset;
+	int class = 0;
+
+	if ((arena.base == NULL) || (size > (1 << BRISTOL_POOL_MAX)))
+		return(NULL);
+
+	while ((size_t) (1 << (class + BRISTOL_POOL_MIN)) < size)
+		class++;
+
+	if ((hdr = bristolPoolPop(class)) == NULL)
+	{
+		need = BRISTOL_POOL_HDR + (1 << (class + BRISTOL_POOL_MIN));
+
+		/*
+		 * Only take the space if it fits, a large request that does not
+		 * fit must not use up the room left for smaller ones.
+		 */
+		do {
+			if ((offset = arena.next) + need > arena.size)
+				return(NULL);
+		} while (!__sync_bool_compare_and_swap(&arena.next, offset,
+			offset + need));
+
+		hdr = (bristolPoolHdr *) (arena.base + offset);
+		hdr->class = class;
+		hdr->magic = BRISTOL_POOL_MAGIC;
+	}
+
+	hdr->size = size;
+	__sync_fetch_and_add(&arena.poolallocs, 1);
+	__sync_fetch_and_add(&arena.inuse, size);
+
+	return(((char *) hdr) + BRISTOL_POOL_HDR);
+}
+
+static int
+bristolPoolFree(void *mem)
+{
+	bristolPoolHdr *hdr;
+
+	if (((char *) mem < arena.base) || ((char *) mem >= arena.base + arena.size))
+		return(0);
+
+	hdr = (bristolPoolHdr *) (((char *) mem) - BRISTOL_POOL_HDR);
+
+	if (hdr->magic != BRISTOL_POOL_MAGIC)
+	{
+		printf("bristolfree: bad arena block %p\n", mem);
+		return(1);
+	}
+
+	__sync_fetch_and_sub(&arena.inuse, hdr->size);
+	bristolPoolPush(hdr->class, hdr);
+
+	return(1);
+}
+
+static void
+bristolHeapCall()
+{
+	if (bristolrt)
+	{
+		__sync_fetch_and_add(&arena.rtheap, 1);
+#ifdef BRISTOL_RT_ASSERT
+		assert(bristolrt == 0);
+#endif
+	}
+}
+
+/*
+ * Returns the KB still in use, an engine that has freed everything it took is
+ * back where it started.
+ */
+int
+bristolArenaStats()
+{
+	printf("arena: %iMB%s, %i pool, %i heap allocations, %iKB in use\n",
+		(int) (arena.size >> 20), arena.locked? " locked":"",
+		arena.poolallocs, arena.heapallocs, (int) (arena.inuse >> 10));
+
+	if (arena.rtheap)
+		printf("arena: %i heap calls from the audio thread\n", arena.rtheap);
+
+	return((int) (arena.inuse >> 10));
+}
+
 void *
 bristolmalloc(size)
 size_t size;
 {
 	char *mem;
 
-	mem = malloc(size);
+	if ((mem = bristolPoolAlloc(size)) == NULL)
+	{
+		bristolHeapCall();
+		__sync_fetch_and_add(&arena.heapallocs, 1);
+		mem = malloc(size);
+	}
 
 #ifdef DEBUG
 	printf("bristolmalloc: %x, %i\n", mem, size);
@@ -63,7 +282,12 @@ bristolfree(void *mem)
 #endif
 
 	if (mem != NULL)
+	{
+		if (bristolPoolFree(mem))
+			return;
+		bristolHeapCall();
 		free(mem);
+	}
 #ifdef DEBUG
 	else
 		printf("attempt to free (null)\n");
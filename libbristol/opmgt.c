@@ -101,9 +101,73 @@ bristolOPinit(bristolOP **operator, int index, int samplecount)
 	 */
 	(*operator)->index = index;
 	(*operator)->flags = 0;
+	(*operator)->freelocal = NULL;
 	(*operator)->last = (struct BristolOP *) NULL; /* filled in by parent */
 	(*operator)->next = (struct BristolOP *) NULL; /* filled in by parent */
 
 	return(*operator);
 }
 
+/*
+ * Smoothed parameters. Ramp time in milliseconds to a number of control
+ * blocks at the given rate, at least one.
+ */
+int
+bristolSmoothBlocks(int samplerate, float ms)
+{
+	int blocks = ms * samplerate / (1000 * BRISTOL_SMOOTH_BLOCK);
+
+	return(blocks < 1? 1:blocks);
+}
+
+/*
+ * Jump straight to a value, typically on KEYON so that new notes do not
+ * sweep in from wherever the voice was last left.
+ */
+void
+bristolSmoothInit(bristolSmooth *smooth, float value)
+{
+	smooth->flags = BRISTOL_SMOOTH_SET;
+	smooth->value = smooth->target = value;
+	smooth->delta = 0;
+	smooth->steps = 0;
+}
+
+/*
+ * Give the smoother the current raw parameter. This is called once per
+ * period, a new target restarts the ramp over the given number of blocks
+ * from wherever we are now.
+ */
+void
+bristolSmoothTarget(bristolSmooth *smooth, float target, int blocks)
+{
+	if (~smooth->flags & BRISTOL_SMOOTH_SET)
+	{
+		bristolSmoothInit(smooth, target);
+		return;
+	}
+
+	if (target == smooth->target)
+		return;
+
+	smooth->target = target;
+	smooth->steps = blocks < 1? 1:blocks;
+	smooth->delta = (target - smooth->value) / smooth->steps;
+}
+
+/*
+ * Move on one control block and return the value for the end of it.
+ */
+float
+bristolSmoothStep(bristolSmooth *smooth)
+{
+	if (smooth->steps > 0)
+	{
+		if (--smooth->steps == 0)
+			smooth->value = smooth->target;
+		else
+			smooth->value += smooth->delta;
+	}
+
+	return(smooth->value);
+}
@@ -0,0 +1,225 @@
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Polyphase half band resampling for the nonlinear operators. These used to
+ * 'oversample' by running their loop twice on the same input sample which
+ * does very little for the aliasing they generate. An operator that wants to
+ * run at 2x or 4x keeps a bristolOversample in its voice local, upsamples its
+ * input into a scratch buffer, runs at the higher rate and then decimates back
+ * into its output buffer.
+ *
+ * The half band filter has every other tap zero apart from the centre tap of
+ * 0.5 so each 2x stage only needs BRISTOL_HB_PAIRS multiplies per output
+ * sample: the interpolator computes one phase with the symmetric taps and the
+ * other is just the delayed input, the decimator is the reverse. 4x is two
+ * cascaded 2x stages. The latency is BRISTOL_HB_PAIRS - 1 base rate samples
+ * for 2x, a little more for 4x.
+ */
+
+#include <math.h>
+
+#include "bristol.h"
+
+static float hbcoeff[BRISTOL_HB_PAIRS];
+static int hbinit = 0;
+
+/*
+ * Blackman windowed sinc at half the sample rate. Only the odd offsets from
+ * the centre tap are non-zero and those are symmetric so we keep one side.
+ * The taps are normalised for unity gain at DC.
+ */
+static void
+bristolHalfbandCoeffs()
+{
+	int i, k, n = BRISTOL_HB_PAIRS * 4 - 1;
+	float w, sum = 0;
+
+	for (i = 0; i < BRISTOL_HB_PAIRS; i++)
+	{
+		k = i * 2 + 1;
+		w = 0.42 - 0.5 * cosf(2 * M_PI * (n / 2 + k) / (n - 1))
+			+ 0.08 * cosf(4 * M_PI * (n / 2 + k) / (n - 1));
+		hbcoeff[i] = w * sinf(M_PI * k / 2) / (M_PI * k);
+		sum += hbcoeff[i];
+	}
+
+	for (i = 0; i < BRISTOL_HB_PAIRS; i++)
+		hbcoeff[i] *= 0.25 / sum;
+
+	hbinit = 1;
+}
+
+static void
+bristolHalfbandReset(bristolHalfband *hb)
+{
+	bzero(hb, sizeof(bristolHalfband));
+	hb->index = BRISTOL_HB_TAPS;
+}
+
+/*
+ * The newest BRISTOL_HB_TAPS samples, newest first, start at h[0]. The taps
+ * are symmetric about the middle of them. Four partial sums so that the
+ * compiler can keep the multiplies in flight, BRISTOL_HB_PAIRS has to be a
+ * multiple of 4.
+ */
+static inline float
+bristolHalfbandFIR(float *h, float *c)
+{
+	float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+	float *n = &h[BRISTOL_HB_PAIRS - 1], *o = &h[BRISTOL_HB_PAIRS];
+	int i;
+
+	for (i = 0; i < BRISTOL_HB_PAIRS; i += 4)
+	{
+		s0 += c[i] * (n[-i] + o[i]);
+		s1 += c[i + 1] * (n[-i - 1] + o[i + 1]);
+		s2 += c[i + 2] * (n[-i - 2] + o[i + 2]);
+		s3 += c[i + 3] * (n[-i - 3] + o[i + 3]);
+	}
+
+	return((s0 + s1) + (s2 + s3));
+}
+
+/*
+ * 2x up, out takes count * 2 samples. The zero stuffed input would lose half
+ * its level so the filtered phase is doubled and the centre phase, 0.5 * 2, is
+ * just the delayed input.
+ *
+ * Each input is written to the history twice so that the taps are always
+ * contiguous, the index is kept local as out could alias the history as far
+ * as the compiler knows.
+ */
+static void
+bristolHalfbandUp(bristolHalfband *hb, float *in, float *out, int count)
+{
+	int index = hb->index;
+	float *fir = hb->fir, *h;
+
+	for (; count > 0; count--)
+	{
+		if (--index < 0)
+			index = BRISTOL_HB_TAPS - 1;
+		h = &fir[index];
+		h[0] = h[BRISTOL_HB_TAPS] = *in++;
+
+		*out++ = bristolHalfbandFIR(h, hbcoeff) * 2;
+		*out++ = h[BRISTOL_HB_PAIRS - 1];
+	}
+
+	hb->index = index;
+}
+
+/*
+ * 2x down, takes count * 2 samples from in and writes count samples. The even
+ * samples only meet the centre tap so they go through a short delay.
+ */
+static void
+bristolHalfbandDown(bristolHalfband *hb, float *in, float *out, int count)
+{
+	int index = hb->index, cindex = hb->cindex;
+	float *fir = hb->fir, *h, centre;
+
+	for (; count > 0; count--)
+	{
+		centre = hb->centre[cindex];
+		hb->centre[cindex] = *in++;
+		if (++cindex >= BRISTOL_HB_PAIRS - 1)
+			cindex = 0;
+
+		if (--index < 0)
+			index = BRISTOL_HB_TAPS - 1;
+		h = &fir[index];
+		h[0] = h[BRISTOL_HB_TAPS] = *in++;
+
+		*out++ = bristolHalfbandFIR(h, hbcoeff) + centre * 0.5f;
+	}
+
+	hb->index = index;
+	hb->cindex = cindex;
+}
+
+/*
+ * Set the oversampling factor and clear the filter history. Factor should be
+ * 1, 2 or 4, anything else is rounded down to one of them.
+ */
+int
+bristolOversampleInit(bristolOversample *os, int factor)
+{
+	if (hbinit == 0)
+		bristolHalfbandCoeffs();
+
+	if (factor >= 4)
+		os->factor = 4;
+	else if (factor >= 2)
+		os->factor = 2;
+	else
+		os->factor = 1;
+
+	bristolHalfbandReset(&os->up[0]);
+	bristolHalfbandReset(&os->up[1]);
+	bristolHalfbandReset(&os->down[0]);
+	bristolHalfbandReset(&os->down[1]);
+
+	return(os->factor);
+}
+
+/*
+ * Upsample count samples from in to count * factor samples in out. For 4x the
+ * first stage is written to the top half of out and the second stage then
+ * works down from the front of the same buffer, it never overtakes its input.
+ */
+void
+bristolOversampleUp(bristolOversample *os, float *in, float *out, int count)
+{
+	switch (os->factor) {
+		case 4:
+			bristolHalfbandUp(&os->up[0], in, &out[count * 2], count);
+			bristolHalfbandUp(&os->up[1], &out[count * 2], out, count * 2);
+			break;
+		case 2:
+			bristolHalfbandUp(&os->up[0], in, out, count);
+			break;
+		default:
+			bcopy(in, out, count * sizeof(float));
+			break;
+	}
+}
+
+/*
+ * Decimate count * factor samples from in and mix count samples into out with
+ * the given gain. The contents of in are used as workspace for 4x.
+ */
+void
+bristolOversampleDown(bristolOversample *os, float *in, float *out, float gain,
+int count)
+{
+	switch (os->factor) {
+		case 4:
+			bristolHalfbandDown(&os->down[1], in, in, count * 2);
+			/* Fall through to the second stage */
+		case 2:
+			bristolHalfbandDown(&os->down[0], in, in, count);
+			break;
+	}
+
+	for (; count > 0; count--)
+		*out++ += *in++ * gain;
+}
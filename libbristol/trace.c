@@ -0,0 +1,263 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Event tracing for the engine threads. Printing from the audio thread goes
+ * through the log thread pipe and can stall it, these calls only write a
+ * fixed size record into a ring that belongs to the calling thread. Another
+ * thread drains the rings into a Chrome trace JSON file that can be loaded
+ * into chrome://tracing or Perfetto.
+ *
+ * Each ring has one writer, the thread that claimed it, and one reader, the
+ * dump, so the indices need no locking. A full ring is a flight recorder, the
+ * newest event overwrites the oldest and the writer never waits. Each record
+ * carries the index it was written for so that the dump can tell one that was
+ * overwritten while it read it. Names must be string constants, only the
+ * pointer is stored.
+ *
+ * The rings are not in the engine arena. They are calloc()ed at init, and
+ * the pages are only committed as the threads write to them, so a ring that
+ * no thread claims costs address space and not memory.
+ */
+
+#include <stdlib.h>
+#include <time.h>
+
+#include "bristol.h"
+
+#define BRISTOL_TRACE_RINGS 8
+
+typedef struct BristolTraceEvent {
+	volatile unsigned int seq; /* index + 1 once written, 0 while writing */
+	u_int64_t ts; /* nanoseconds */
+	const char *name;
+	int arg;
+	int id;
+	char phase;
+} bristolTraceEvent;
+
+typedef struct BristolTraceRing {
+	volatile unsigned int head; /* written by the owning thread */
+	unsigned int tail; /* the dump's alone */
+	const char *name;
+	bristolTraceEvent *events;
+} bristolTraceRing;
+
+int bristolTraceOn = 0;
+
+static bristolTraceRing rings[BRISTOL_TRACE_RINGS];
+static volatile int ringcount = 0;
+static unsigned int ringsize = 0, ringmask = 0;
+static __thread bristolTraceRing *myring = NULL;
+
+/*
+ * Allocate the rings, events is per thread and is rounded up to a power of
+ * two. This has to be done before the threads start.
+ */
+int
+bristolTraceInit(int events)
+{
+	int i, size = 1024;
+
+	if (bristolTraceOn)
+		return(0);
+
+	while (size < events)
+		size <<= 1;
+
+	for (i = 0; i < BRISTOL_TRACE_RINGS; i++)
+		if ((rings[i].events = (bristolTraceEvent *)
+			calloc(size, sizeof(bristolTraceEvent))) == NULL)
+			return(-1);
+
+	ringsize = size;
+	ringmask = size - 1;
+	bristolTraceOn = 1;
+
+	return(0);
+}
+
+static bristolTraceRing *
+bristolTraceRingClaim()
+{
+	int i;
+
+	if (myring == NULL)
+	{
+		if ((i = __sync_fetch_and_add(&ringcount, 1)) >= BRISTOL_TRACE_RINGS)
+			return(NULL);
+
+		myring = &rings[i];
+		myring->name = "engine";
+	}
+
+	return(myring);
+}
+
+/*
+ * Name the calling thread in the trace, for example "audio" or "midi".
+ */
+void
+bristolTraceThread(const char *name)
+{
+	bristolTraceRing *ring;
+
+	if (bristolTraceOn && ((ring = bristolTraceRingClaim()) != NULL))
+		ring->name = name;
+}
+
+/*
+ * Phase is 'B' or 'E' for the start and end of a span and 'i' for an
+ * instant. Use the BRISTOL_TRACE macros rather than calling this directly.
+ */
+void
+bristolTrace(char phase, const char *name, int arg, int id)
+{
+	bristolTraceRing *ring;
+	bristolTraceEvent *event;
+	struct timespec now;
+	unsigned int head;
+
+	if ((ring = bristolTraceRingClaim()) == NULL)
+		return;
+
+	head = ring->head;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	event = &ring->events[head & ringmask];
+
+	/* The dump discards a record it sees being rewritten */
+	event->seq = 0;
+	__sync_synchronize();
+
+	event->ts = ((u_int64_t) now.tv_sec) * 1000000000 + now.tv_nsec;
+	event->name = name;
+	event->arg = arg;
+	event->id = id;
+	event->phase = phase;
+
+	/* The event has to be visible before the index that covers it */
+	__sync_synchronize();
+	event->seq = head + 1;
+	ring->head = head + 1;
+}
+
+/*
+ * Drain everything recorded since the last dump into file as Chrome trace
+ * JSON. Not for use from the audio thread. What was overwritten before the
+ * dump got to it is counted, and the ends of spans whose start went with it
+ * are left out.
+ */
+int
+bristolTraceDump(char *file)
+{
+	bristolTraceEvent *event, copy;
+	unsigned int head, tail, seq;
+	int i, count, depth, lost, pid = getpid(), events = 0;
+	char *sep = "";
+	FILE *fd;
+
+	if ((bristolTraceOn == 0) || (file == NULL))
+		return(0);
+
+	if ((fd = fopen(file, "w")) == NULL)
+	{
+		printf("could not open trace file %s\n", file);
+		return(-1);
+	}
+
+	fprintf(fd, "{\"traceEvents\":[\n");
+
+	if ((count = ringcount) > BRISTOL_TRACE_RINGS)
+		count = BRISTOL_TRACE_RINGS;
+
+	for (i = 0; i < count; i++)
+	{
+		fprintf(fd, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%i,"
+			"\"tid\":%i,\"args\":{\"name\":\"%s\"}}", sep, pid, i + 1,
+			rings[i].name);
+		sep = ",\n";
+
+		head = rings[i].head;
+		__sync_synchronize();
+
+		tail = rings[i].tail;
+		lost = depth = 0;
+
+		if (head - tail > ringsize)
+		{
+			lost = head - tail - ringsize;
+			tail = head - ringsize;
+		}
+
+		for (; tail != head; tail++)
+		{
+			event = &rings[i].events[tail & ringmask];
+
+			/* Take a copy, then make sure it was not rewritten meanwhile */
+			seq = event->seq;
+			__sync_synchronize();
+			copy = *event;
+			__sync_synchronize();
+
+			if ((seq != tail + 1) || (event->seq != seq))
+			{
+				lost++;
+				continue;
+			}
+
+			if (copy.phase == 'B')
+				depth++;
+			else if (copy.phase == 'E') {
+				if (depth == 0)
+					continue;
+				depth--;
+			}
+
+			fprintf(fd, ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,"
+				"\"pid\":%i,\"tid\":%i", copy.name, copy.phase,
+				copy.ts / 1000.0, pid, i + 1);
+
+			if (copy.phase == 'i')
+				fprintf(fd, ",\"s\":\"t\"");
+			if (copy.phase != 'E')
+				fprintf(fd, ",\"args\":{\"arg\":%i,\"id\":%i}",
+					copy.arg, copy.id);
+			fprintf(fd, "}");
+
+			events++;
+		}
+
+		rings[i].tail = head;
+
+		if (lost)
+			printf("trace: %s overwrote its oldest %i events\n",
+				rings[i].name, lost);
+	}
+
+	fprintf(fd, "\n]}\n");
+	fclose(fd);
+
+	printf("trace: wrote %i events to %s\n", events, file);
+
+	return(events);
+}
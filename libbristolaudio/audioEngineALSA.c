@@ -484,6 +484,40 @@ void showstat(snd_pcm_t *handle, size_t frames)
 }
 #endif /* BRISTOL_HAS_ALSA */
 
+/*
+ * The dummy device keeps the engine to the nominal period against an absolute
+ * deadline so that headless runs see the same timing as a real device. If we
+ * fall more than a period behind the clock is restarted rather than running
+ * a burst of periods to catch up.
+ */
+static void
+dummyWait(duplexDev *audioDev, int count)
+{
+	static struct timespec deadline = {0, 0};
+	struct timespec now;
+	long period;
+
+	if (audioDev->readSampleRate <= 0)
+		return;
+
+	period = count * 1000000000LL / audioDev->readSampleRate;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	if ((deadline.tv_sec == 0)
+		|| ((now.tv_sec - deadline.tv_sec) * 1000000000LL
+			+ now.tv_nsec - deadline.tv_nsec > period))
+		deadline = now;
+
+	if ((deadline.tv_nsec += period) >= 1000000000)
+	{
+		deadline.tv_sec += deadline.tv_nsec / 1000000000;
+		deadline.tv_nsec %= 1000000000;
+	}
+
+	clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL);
+}
+
 int
 audioWrite(audioDev, buffer, count)
 duplexDev *audioDev;
@@ -549,7 +583,8 @@ int count;
 
 	if (audioDev->flags & AUDIO_DUMMY)
 	{
-		usleep(100000);
+		if ((audioDev->flags & AUDIO_FREEWHEEL) == 0)
+			dummyWait(audioDev, count);
 		return(count * 2 * audioDev->channels);
 	}
 
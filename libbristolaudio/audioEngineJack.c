@@ -92,6 +92,15 @@ jack_shutdown(void *jackdev)
 	((jackDev *) jackdev)->audiomain->atReq = BRISTOL_REQSTOP;
 }
 
+static int
+jack_xrun(void *jackdev)
+{
+	((jackDev *) jackdev)->audiomain->telemetry.xruns++;
+	BRISTOL_TRACE_INSTANT("xrun", 0, 0);
+
+	return(0);
+}
+
 #ifdef _BRISTOL_JACK_SESSION
 /*
  * This is polled by the GUI to see if any session events need handling. It is
@@ -111,7 +120,11 @@ bristolJackSessionCheck(audioMain *audiomain)
 	snprintf(commandline, 1024, "%s -jsmfile \"${SESSION_DIR}%s\" -jsmuuid %s",
 		audiomain->cmdline, regname, jackdev.sEvent->client_uuid);
 
-	jackdev.sEvent->command_line = bristolmalloc(strlen(commandline) + 1);
+	/*
+	 * JACK owns the event and frees the command line with it, this has to
+	 * come from malloc() and not the engine arena.
+	 */
+	jackdev.sEvent->command_line = malloc(strlen(commandline) + 1);
 	sprintf(jackdev.sEvent->command_line, "%s", commandline);
 
 	/*
@@ -184,12 +197,30 @@ audioShim(jack_nframes_t nframes, void *jd)
 	jackDev *jackdev = (jackDev *) jd;
 	register float *outL, *outR, *toutbuf = outbuf, gain;
 	register int i, nint;
+	jack_position_t jpos;
+
+	bristolTelemetryStart(jackdev->audiomain);
 
 #ifdef _BRISTOL_JACK_MIDI
 	if (~jackdev->audiomain->flags & BRISTOL_JACK_DUAL)
 		jackMidiRoutine(nframes, NULL);
 #endif
 
+	/*
+	 * Clocked arpeggiators and sequencers follow the transport if it is
+	 * rolling and someone is giving out bar/beat/tick. The position goes over
+	 * in quarter notes.
+	 */
+	if ((jack_transport_query(jackdev->handle, &jpos) == JackTransportRolling)
+		&& (jpos.valid & JackPositionBBT) && (jpos.beat_type > 0)
+		&& (jpos.ticks_per_beat > 0))
+		bristolArpeggiatorTransport(jackdev->audiomain, 1,
+			jpos.beats_per_minute,
+			((jpos.bar - 1) * jpos.beats_per_bar + jpos.beat - 1
+				+ jpos.tick / jpos.ticks_per_beat) * 4.0 / jpos.beat_type);
+	else
+		bristolArpeggiatorTransport(jackdev->audiomain, 0, 0, 0);
+
 	/*
 	 * We may need to consider JACK changing its nframes on the fly. Whilst
 	 * decreasing frames is not an issue, increasing them could be painful.
@@ -291,6 +322,9 @@ audioShim(jack_nframes_t nframes, void *jd)
 	 */
 	if ((gain = jackdev->audiomain->outgain) < 1)
 		gain = 1.0f;
+
+	bristolTelemetryEnd(jackdev->audiomain, outbuf, gain);
+
 	gain /= 32768.0;
 
 	outL = (float *)
@@ -580,6 +614,7 @@ JackProcessCallback shim)
 	jack_set_process_callback(jackdev->handle, shim, (void *) jackdev);
 
 	jack_on_shutdown(jackdev->handle, jack_shutdown, (void *) jackdev);
+	jack_set_xrun_callback(jackdev->handle, jack_xrun, (void *) jackdev);
 
 #ifdef _BRISTOL_JACK_SESSION
 	if (jack_set_session_callback)
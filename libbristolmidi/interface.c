@@ -49,6 +49,9 @@ extern int bristolMidiSeqKeyEvent();
 extern int bristolMidiSeqPressureEvent();
 extern int bristolMidiSeqPPressureEvent();
 extern int bristolMidiSeqCCEvent();
+extern int bristolMidiSeqBatch();
+extern int bristolMidiSeqFlush();
+extern int bristolMidiSeqRawOutput();
 #ifdef _BRISTOL_JACK_MIDI
 extern int bristolMidiJackOpen();
 #endif
@@ -534,9 +537,55 @@ bristolMidiTerminate()
 	return(0);
 }
 
+/*
+ * Lay a message out as it goes on the wire, returns the byte count or -1 if
+ * it does not fit in max. msgLen is a byte so a message never needs more
+ * than BRISTOL_MIDI_RAWSIZE.
+ */
+int
+bristolMidiRawEncode(bristolMidiMsg *msg, int size, unsigned char *buf, int max)
+{
+	int count = 1, len;
+
+	/*
+	 * For short messages we are going to join the channel back together. This
+	 * is not needed for SYSEX/Bristol messages.
+	 */
+	if (msg->params.bristol.msgLen < 4)
+		buf[0] = (msg->command & 0xf0)|msg->channel;
+	else
+		buf[0] = msg->command;
+
+	if (msg->command != MIDI_SYSEX)
+		len = size - 1;
+	else if (msg->params.bristol.msgType < 8)
+		len = size;
+	else
+		len = msg->params.bristol.msgLen;
+
+	if ((len < 0) || (count + len + 1 > max))
+		return(-1);
+
+	if ((msg->command != MIDI_SYSEX) || (msg->params.bristol.msgType < 8))
+		bcopy(&msg->params, &buf[count], len);
+	else {
+		bcopy(&msg->params, &buf[count], 12);
+		bcopy(msg->params.bristolt2.data, &buf[count + 12], len - 12);
+	}
+	count += len;
+
+	if (msg->command == MIDI_SYSEX)
+		buf[count++] = MIDI_EOS;
+
+	return(count);
+}
+
 int
 bristolMidiRawWrite(int dev, bristolMidiMsg *msg, int size)
 {
+	unsigned char buf[BRISTOL_MIDI_RAWSIZE];
+	int count;
+
 	if (bristolMidiDevSanity(dev) < 0)
 		return(bristolMidiDevSanity(dev));
 
@@ -547,52 +596,194 @@ bristolMidiRawWrite(int dev, bristolMidiMsg *msg, int size)
 			size);
 
 	/*
-	 * For short messages we are going to join the channel back together. This
-	 * is not needed for SYSEX/Bristol messages.
+	 * One write per message, the forwarding path used to make three or four
+	 * system calls for each of them.
 	 */
-	if (msg->params.bristol.msgLen < 4)
+	if ((count = bristolMidiRawEncode(msg, size, buf, sizeof(buf))) < 0)
 	{
-		unsigned char ch = (msg->command & 0xf0)|msg->channel;
+		printf("bristolMidiRawWrite: bad message length %i\n", size);
+		return(1);
+	}
 
-		if (bristolPhysWrite(bmidi.dev[dev].fd, (unsigned char *) &ch, 1) != 0)
-			return(1);
-	} else
-		if (bristolPhysWrite(bmidi.dev[dev].fd,
-			(unsigned char *) &msg->command, 1) != 0)
-			return(1);
+	return(bristolPhysWrite(bmidi.dev[dev].fd, buf, count));
+}
 
-	if (msg->command != MIDI_SYSEX)
+/*
+ * Output batching. The batch belongs to the caller so that it needs no
+ * locking, messages are packed per device and go out with one write for each
+ * device on the flush, or sooner if a device's buffer fills up.
+ */
+void
+bristolMidiBatchInit(bristolMidiBatch *batch)
+{
+	int i;
+
+	for (i = 0; i < BRISTOL_MIDI_BATCHDEVS; i++)
 	{
-		if (bristolPhysWrite(bmidi.dev[dev].fd,
-			(unsigned char *) &msg->params, size - 1) != 0)
-			return(1);
-	} else {
-		if (msg->params.bristol.msgType < 8)
-		{
-			if (bristolPhysWrite(bmidi.dev[dev].fd,
-				(unsigned char *) &msg->params, size) != 0)
-				return(1);
-		} else {
-			if (bristolPhysWrite(bmidi.dev[dev].fd,
-				(unsigned char *) &msg->params, 12) != 0)
-				return(1);
-			if (bristolPhysWrite(bmidi.dev[dev].fd,
-				(unsigned char *) msg->params.bristolt2.data,
-					msg->params.bristol.msgLen - 12) != 0)
-				return(1);
-		}
+		batch->dev[i] = -1;
+		batch->count[i] = 0;
 	}
+}
 
-	if (msg->command == MIDI_SYSEX)
+static int
+bristolMidiBatchOut(bristolMidiBatch *batch, int slot)
+{
+	int result = 0;
+
+	/* The sequencer takes events, they are held until bristolMidiFlush() */
+	if ((batch->count[slot] > 0)
+		&& ((bmidi.dev[batch->dev[slot]].flags & BRISTOL_CONNMASK)
+			== BRISTOL_CONN_SEQ))
+		result = bristolMidiSeqRawOutput(batch->dev[slot],
+			batch->buf[slot], batch->count[slot]);
+	else if (batch->count[slot] > 0)
+		result = bristolPhysWrite(bmidi.dev[batch->dev[slot]].fd,
+			batch->buf[slot], batch->count[slot]);
+
+	batch->count[slot] = 0;
+
+	return(result);
+}
+
+/*
+ * The slot for a device, taking a free one if it has none. If there are more
+ * destinations than slots the lot is sent and we start over.
+ */
+static int
+bristolMidiBatchSlot(bristolMidiBatch *batch, int dev)
+{
+	int slot, free = -1;
+
+	for (slot = 0; slot < BRISTOL_MIDI_BATCHDEVS; slot++)
+	{
+		if (batch->dev[slot] == dev)
+			return(slot);
+		if ((free < 0) && (batch->dev[slot] < 0))
+			free = slot;
+	}
+
+	if (free < 0)
+	{
+		bristolMidiBatchFlush(batch);
+		free = 0;
+	}
+
+	batch->dev[free] = dev;
+
+	return(free);
+}
+
+int
+bristolMidiBatchWrite(bristolMidiBatch *batch, int dev, bristolMidiMsg *msg,
+int size)
+{
+	int slot, count;
+
+	if (bristolMidiDevSanity(dev) < 0)
+		return(bristolMidiDevSanity(dev));
+
+	slot = bristolMidiBatchSlot(batch, dev);
+
+	if ((count = bristolMidiRawEncode(msg, size,
+		&batch->buf[slot][batch->count[slot]],
+		BRISTOL_MIDI_BATCHSIZE - batch->count[slot])) > 0)
 	{
-		unsigned char comm = MIDI_EOS;
+		batch->count[slot] += count;
+		return(0);
+	}
 
-		return(bristolPhysWrite(bmidi.dev[dev].fd, (unsigned char *) &comm, 1));
+	bristolMidiBatchOut(batch, slot);
+
+	if ((count = bristolMidiRawEncode(msg, size, batch->buf[slot],
+		BRISTOL_MIDI_BATCHSIZE)) < 0)
+	{
+		printf("bristolMidiBatchWrite: bad message length %i\n", size);
+		return(1);
 	}
 
+	batch->count[slot] = count;
+
+	return(0);
+}
+
+/*
+ * As above for a message that has already been through bristolMidiRawEncode.
+ */
+int
+bristolMidiBatchRaw(bristolMidiBatch *batch, int dev, unsigned char *raw,
+int count)
+{
+	int slot;
+
+	if (bristolMidiDevSanity(dev) < 0)
+		return(bristolMidiDevSanity(dev));
+
+	if ((count <= 0) || (count > BRISTOL_MIDI_BATCHSIZE))
+		return(1);
+
+	slot = bristolMidiBatchSlot(batch, dev);
+
+	if (batch->count[slot] + count > BRISTOL_MIDI_BATCHSIZE)
+		bristolMidiBatchOut(batch, slot);
+
+	bcopy(raw, &batch->buf[slot][batch->count[slot]], count);
+	batch->count[slot] += count;
+
 	return(0);
 }
 
+int
+bristolMidiBatchFlush(bristolMidiBatch *batch)
+{
+	int slot, result = 0;
+
+	for (slot = 0; slot < BRISTOL_MIDI_BATCHDEVS; slot++)
+	{
+		if (batch->dev[slot] < 0)
+			continue;
+
+		/* The device may have gone since the messages were queued */
+		if (bristolMidiDevSanity(batch->dev[slot]) >= 0)
+			result |= bristolMidiBatchOut(batch, slot);
+
+		batch->dev[slot] = -1;
+		batch->count[slot] = 0;
+	}
+
+	return(result);
+}
+
+/*
+ * Hold the key, pressure and controller events of a handle until
+ * bristolMidiFlush(), usec < 0 turns it off again. Only the sequencer can do
+ * this, the other connections can use a bristolMidiBatch.
+ */
+int
+bristolMidiOutputBatch(int handle, int usec)
+{
+	if (bristolMidiSanity(handle) < 0)
+		return(bristolMidiSanity(handle));
+
+	if ((bmidi.dev[bmidi.handle[handle].dev].flags & BRISTOL_CONNMASK)
+		== BRISTOL_CONN_SEQ)
+		return(bristolMidiSeqBatch(bmidi.handle[handle].dev, usec));
+
+	return(BRISTOL_MIDI_DRIVER);
+}
+
+int
+bristolMidiFlush(int handle)
+{
+	if (bristolMidiSanity(handle) < 0)
+		return(bristolMidiSanity(handle));
+
+	if ((bmidi.dev[bmidi.handle[handle].dev].flags & BRISTOL_CONNMASK)
+		== BRISTOL_CONN_SEQ)
+		return(bristolMidiSeqFlush(bmidi.handle[handle].dev));
+
+	return(BRISTOL_MIDI_OK);
+}
+
 int
 bristolMidiWrite(int dev, bristolMsg *msg, int size)
 {
@@ -149,6 +149,9 @@ checkcallbacks(bristolMidiMsg *msg)
 {
 	int i = 0, message = 1 << ((msg->command & 0x70) >> 4);
 
+	if ((msg->command >= MIDI_RT_CLOCK) && (msg->command <= MIDI_RT_STOP))
+		message = BRISTOL_REQ_CLOCK;
+
 	if (bmidi.flags & BRISTOL_BMIDI_DEBUG)
 		printf("msg from %i, chan %i, %i bytes\n", msg->params.bristol.from,
 			msg->params.bristol.channel, msg->params.bristol.msgLen);
@@ -61,6 +61,8 @@ resetBristolCache(char *dir)
 
 	setenv("BRISTOL_CACHE", dir, 1);
 
+	bristolProfileFlush();
+
 	if (myHome == NULL)
 		return;
 
@@ -213,82 +215,38 @@ getBristolCache(char *file)
 	return(myHome);
 }
 
-int
-bristolGetMap(char *file, char *match, float *points, int count, int flags)
+/*
+ * Fill points from the '<match>: index value' lines of an open profile and
+ * interpolate between them unless NO_INTERPOLATE.
+ */
+static int
+bristolProfileMap(bristolProfile *profile, char *match, float *points,
+int count, int flags)
 {
-	int i, n = 0, mapped = 0;
-	FILE *fd;
+	bristolProfileEntry *entry;
+	int i, n = 0, mapped = 0, len = strlen(match);
 	float from, delta;
 
-	/*
-	 * Open and read configuration. Should consider searching
-	 * $HOME/.bristol/memory and $BRISTOL_DB/memory.
-	 */
-	sprintf(tmppath, "%s/memory/profiles/%s", getBristolCache("profiles"), file);
-/*printf("		%s\n", tmppath);*/
+	for (i = 0; i < count; i++)
+		points[i] = 0;
 
-	/*
-	 * If we can open the file then clean the array and start again. If not
-	 * then see if we have a factory copy available.
-	 */
-	if ((fd = fopen(&tmppath[0], "r")) == NULL)
+	for (i = 0; i < profile->count; i++)
 	{
-		sprintf(tmppath, "%s/memory/profiles/%s", getenv("BRISTOL"), file);
-/*printf("attempt	%s\n", tmppath); */
-		fd = fopen(&tmppath[0], "r");
-	}
+		entry = &profile->entries[i];
 
-	if (fd != NULL)
-	{
-		char param[256];
+		if ((entry->index < 0) || (entry->index >= count))
+			continue;
 
-		for (i = 0; i < count; i++)
-			points[i] = 0;
+		if (strncmp(&profile->text[entry->line], match, len) != 0)
+			continue;
 
-		while (fgets(param, 256, fd) != NULL)
+		if (entry->value > 0)
 		{
-			if (param[0] == '#')
-				continue;
-			if (strlen(param) < 5)
-				continue;
-
-			if (strncmp(param, match, strlen(match)) == 0)
-			{
-				int wheel;
-				float value;
-				char *offset;
-
-				/*
-				 * We should now have a line with something like:
-				 * <match>: wheel value
-				if ((offset = strpbrk(param, " 	")) == NULL)
-				 */
-				if ((offset = index(param, ' ')) == NULL)
-					continue;
-
-				if ((wheel = atoi(offset)) < 0)
-					continue;
-				if (wheel >= count)
-					continue;
-
-				/*if ((offset = strpbrk(param, " 	")) == NULL) */
-				if ((offset = index(++offset, ' ')) == NULL)
-					continue;
-
-				value = atof(offset);
-
-				if (value > 0)
-				{
-					points[wheel] = value;
-					mapped++;
-					//printf("mapped %i to %0.2f\n", wheel, value);
-				}
-			}
+			points[entry->index] = entry->value;
+			mapped++;
+			//printf("mapped %i to %0.2f\n", entry->index, entry->value);
 		}
-	} else
-		return(0);
-
-	fclose(fd);
+	}
 
 	if (flags & NO_INTERPOLATE)
 		return(mapped);
@@ -385,6 +343,26 @@ if (mapped)
 	return(mapped);
 }
 
+int
+bristolGetMap(char *file, char *match, float *points, int count, int flags)
+{
+	bristolProfile *profile;
+	int mapped;
+
+	/*
+	 * The profile is searched for in the private cache and then the factory
+	 * tree, if neither has it the points are left alone.
+	 */
+	if ((profile = bristolProfileOpen(file)) == NULL)
+		return(0);
+
+	mapped = bristolProfileMap(profile, match, points, count, flags);
+
+	bristolProfileClose(profile);
+
+	return(mapped);
+}
+
 int
 bristolGetFreqMap(char *file, char *match, fTab *freqs, int count, int flags,
 int sr)
@@ -467,6 +445,7 @@ parabolaMap(u_char map[128])
 void
 bristolMidiValueMappingTable(u_char valuemap[128][128], int midimap[128], char *synth)
 {
+	bristolProfile *profile;
 	float tmap[128];
 	char name[256];
 	int i, j;
@@ -477,6 +456,14 @@ bristolMidiValueMappingTable(u_char valuemap[128][128], int midimap[128], char *
 		for (j = 0; j < 128; j++)
 			valuemap[i][j] = j;
 
+	/* All the lookups below are against the same profile, open it once */
+	if ((profile = bristolProfileOpen(name)) == NULL)
+	{
+		for (i = 0; i < 128; i++)
+			midimap[i] = i;
+		return;
+	}
+
 	/*
 	 * We first want to look for predefined curves:
 	 *
@@ -491,7 +478,8 @@ bristolMidiValueMappingTable(u_char valuemap[128][128], int midimap[128], char *
 	 * are also going to be required. These will build non-linear curves from
 	 * 0 to 127 over the 127 available values.
 	 */
-	if (bristolGetMap(name, "controllerMap", &tmap[0], 128, NO_INTERPOLATE) > 0)
+	if (bristolProfileMap(profile, "controllerMap", &tmap[0], 128,
+		NO_INTERPOLATE) > 0)
 	{
 		for (i = 0; i < 128; i++)
 		{
@@ -506,7 +494,8 @@ bristolMidiValueMappingTable(u_char valuemap[128][128], int midimap[128], char *
 			midimap[i] = i;
 	}
 
-	if (bristolGetMap(name, "inverseLinear", &tmap[0], 128, NO_INTERPOLATE) > 0)
+	if (bristolProfileMap(profile, "inverseLinear", &tmap[0], 128,
+		NO_INTERPOLATE) > 0)
 	{
 		/* We have some requirements to map inverse linear */
 		for (i = 0; i < 128; i++)
@@ -517,7 +506,8 @@ bristolMidiValueMappingTable(u_char valuemap[128][128], int midimap[128], char *
 		bzero(tmap, sizeof(tmap));
 	}
 
-	if (bristolGetMap(name, "log", &tmap[0], 128, NO_INTERPOLATE) > 0)
+	if (bristolProfileMap(profile, "log", &tmap[0], 128,
+		NO_INTERPOLATE) > 0)
 	{
 		for (i = 0; i < 128; i++)
 		{
@@ -526,7 +516,8 @@ bristolMidiValueMappingTable(u_char valuemap[128][128], int midimap[128], char *
 		}
 		bzero(tmap, sizeof(tmap));
 	}
-	if (bristolGetMap(name, "inverseLog", &tmap[0], 128, NO_INTERPOLATE) > 0)
+	if (bristolProfileMap(profile, "inverseLog", &tmap[0], 128,
+		NO_INTERPOLATE) > 0)
 	{
 		for (i = 0; i < 128; i++)
 		{
@@ -539,7 +530,8 @@ bristolMidiValueMappingTable(u_char valuemap[128][128], int midimap[128], char *
 		bzero(tmap, sizeof(tmap));
 	}
 
-	if (bristolGetMap(name, "exponential", &tmap[0], 128, NO_INTERPOLATE) > 0)
+	if (bristolProfileMap(profile, "exponential", &tmap[0], 128,
+		NO_INTERPOLATE) > 0)
 	{
 		for (i = 0; i < 128; i++)
 		{
@@ -548,7 +540,8 @@ bristolMidiValueMappingTable(u_char valuemap[128][128], int midimap[128], char *
 		}
 		bzero(tmap, sizeof(tmap));
 	}
-	if (bristolGetMap(name, "inverseExponential", &tmap[0], 128, NO_INTERPOLATE) > 0)
+	if (bristolProfileMap(profile, "inverseExponential", &tmap[0], 128,
+		NO_INTERPOLATE) > 0)
 	{
 		for (i = 0; i < 128; i++)
 		{
@@ -561,7 +554,8 @@ bristolMidiValueMappingTable(u_char valuemap[128][128], int midimap[128], char *
 		bzero(tmap, sizeof(tmap));
 	}
 
-	if (bristolGetMap(name, "parabola", &tmap[0], 128, NO_INTERPOLATE) > 0)
+	if (bristolProfileMap(profile, "parabola", &tmap[0], 128,
+		NO_INTERPOLATE) > 0)
 	{
 		for (i = 0; i < 128; i++)
 		{
@@ -570,7 +564,8 @@ bristolMidiValueMappingTable(u_char valuemap[128][128], int midimap[128], char *
 		}
 		bzero(tmap, sizeof(tmap));
 	}
-	if (bristolGetMap(name, "inverseParabola", &tmap[0], 128, NO_INTERPOLATE) > 0)
+	if (bristolProfileMap(profile, "inverseParabola", &tmap[0], 128,
+		NO_INTERPOLATE) > 0)
 	{
 		for (i = 0; i < 128; i++)
 		{
@@ -592,7 +587,7 @@ bristolMidiValueMappingTable(u_char valuemap[128][128], int midimap[128], char *
 		if (controllerName[i] == NULL)
 			continue;
 
-		if (bristolGetMap(name, controllerName[i], &tmap[0], 128, 0) > 0)
+		if (bristolProfileMap(profile, controllerName[i], &tmap[0], 128, 0) > 0)
 		{
 			/*
 			 * If something was mapped for this controller then see about
@@ -604,6 +599,8 @@ bristolMidiValueMappingTable(u_char valuemap[128][128], int midimap[128], char *
 			bzero(tmap, sizeof(tmap));
 		}
 	}
+
+	bristolProfileClose(profile);
 }
 
 static int ztime = 0, uztime, std_out, f_out = -1, bsyslog = 0;
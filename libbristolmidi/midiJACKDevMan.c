@@ -95,6 +95,29 @@ jackMidiRoutine(jack_nframes_t nframes, void *arg)
 		 * JACK always gives me a status byte. We need to parse this then parse
 		 * the actual MIDI message.
 		 */
+		/*
+		 * System realtime is a single status byte and would be taken as our
+		 * SysEx by the raw parser. It is only of interest for the arpeggiator
+		 * clock so give it the offset into this period and dispatch it.
+		 */
+		if ((in_event.size == 1) && (*(in_event.buffer) >= 0xf8)
+			&& (*(in_event.buffer) <= MIDI_RT_STOP))
+		{
+			if (*(in_event.buffer) == 0xf8)
+				msg.command = MIDI_RT_CLOCK;
+			else if (*(in_event.buffer) == 0xf9)
+				continue;
+			else
+				msg.command = *(in_event.buffer);
+			msg.offset = in_event.time;
+			msg.params.key.flags = BRISTOL_KF_JACK;
+			msg.params.bristol.msgLen = 1;
+			msg.params.bristol.from = deviceIndex;
+
+			checkcallbacks(&msg);
+			continue;
+		}
+
 		bristolMidiRawToMsg(in_event.buffer, in_event.size, 0, deviceIndex,
 			&msg);
 		if (bristolMidiRawToMsg(in_event.buffer + 1, in_event.size - 1, 0,
@@ -37,6 +37,8 @@ extern int bristolFreeHandle();
 extern int bristolFreeDevice();
 extern int checkcallbacks();
 
+int bristolMidiSeqFlush(int);
+
 /*
  * This is the ALSA code. Should separate it out already.
  */
@@ -119,6 +121,8 @@ int (*callback)(), void *param, int dev, int handle)
 		return(BRISTOL_MIDI_DRIVER);
 	}
 	printf("Queue ID = %i\n", queue);
+	bmidi.dev[dev].driver.seq.queue = queue;
+	bmidi.dev[dev].driver.seq.delay = 0;
 	if ((err = snd_seq_nonblock(bmidi.dev[dev].driver.seq.handle, 1)) < 0)
 		printf( "Cannot set nonblock mode: %s\n", snd_strerror(err));
 
@@ -142,6 +146,9 @@ int (*callback)(), void *param, int dev, int handle)
 		return(BRISTOL_MIDI_DRIVER);
 	}
 
+	bmidi.dev[dev].driver.seq.port = snd_seq_port_info_get_port(pinfo);
+	bmidi.dev[dev].driver.seq.encoder = NULL;
+
 /*
 	port = snd_seq_port_info_get_port(pinfo);
 
@@ -262,6 +269,11 @@ bristolMidiSeqClose(int handle)
 		return(BRISTOL_MIDI_OK);
 	}
 
+	if (bmidi.dev[bmidi.handle[handle].dev].driver.seq.encoder != NULL)
+		snd_midi_event_free(
+			bmidi.dev[bmidi.handle[handle].dev].driver.seq.encoder);
+	bmidi.dev[bmidi.handle[handle].dev].driver.seq.encoder = NULL;
+
 	snd_seq_close(bmidi.dev[bmidi.handle[handle].dev].driver.seq.handle);
 
 	bristolFreeDevice(bmidi.handle[handle].dev);
@@ -596,6 +608,25 @@ translate_event(snd_seq_event_t *ev, bristolMidiMsg *msg, int dev)
 			if (bmidi.dev[dev].flags & _BRISTOL_MIDI_DEBUG)
 				printf("; queue = %i\n", ev->data.queue.queue);
 #endif
+			/*
+			 * System realtime for the arpeggiator and sequencer clock. There
+			 * is no frame offset from the sequencer, the engine places the
+			 * tick at the start of the next period and the clock filter takes
+			 * out the jitter.
+			 */
+			if (ev->type == SND_SEQ_EVENT_CLOCK)
+				msg->command = MIDI_RT_CLOCK;
+			else if (ev->type == SND_SEQ_EVENT_START)
+				msg->command = MIDI_RT_START;
+			else if (ev->type == SND_SEQ_EVENT_CONTINUE)
+				msg->command = MIDI_RT_CONTINUE;
+			else
+				msg->command = MIDI_RT_STOP;
+			msg->channel = 0;
+			msg->offset = 0;
+			msg->params.key.flags = BRISTOL_KF_RAW;
+			msg->sequence = bmidi.dev[dev].sequence++;
+			msg->params.bristol.msgLen = 1;
 			break;
 
 		case SND_SEQ_EVENT_SENSING:
@@ -711,6 +742,162 @@ bristolMidiSeqRead(int dev, bristolMidiMsg *msg)
 	return(BRISTOL_MIDI_OK);
 }
 
+#if (BRISTOL_HAS_ALSA == 1)
+#if (SND_LIB_MAJOR == 1)
+/*
+ * Events go out directly unless the device is batching, then they sit in the
+ * library output buffer until bristolMidiSeqFlush() drains the lot in one
+ * call. With a delay they are also given a time on our queue relative to the
+ * drain so a batch plays out with its own spacing rather than all at once.
+ */
+static int
+bristolMidiSeqOutput(int dev, snd_seq_event_t *ev)
+{
+	snd_seq_t *handle = bmidi.dev[dev].driver.seq.handle;
+	snd_seq_real_time_t rt;
+	int delay;
+
+	if (~bmidi.dev[dev].flags & BRISTOL_CONN_BATCH)
+	{
+		if (snd_seq_event_output_direct(handle, ev) >= 0)
+			return(BRISTOL_MIDI_OK);
+
+		printf("SeqSend failed: %p\n", handle);
+		return(BRISTOL_MIDI_DRIVER);
+	}
+
+	if ((delay = bmidi.dev[dev].driver.seq.delay) > 0)
+	{
+		rt.tv_sec = delay / 1000000;
+		rt.tv_nsec = (delay % 1000000) * 1000;
+		snd_seq_ev_schedule_real(ev, bmidi.dev[dev].driver.seq.queue, 1, &rt);
+	}
+
+	/* A full output buffer is pushed out early */
+	if ((snd_seq_event_output(handle, ev) < 0)
+		&& ((snd_seq_drain_output(handle) < 0)
+			|| (snd_seq_event_output(handle, ev) < 0)))
+	{
+		printf("SeqSend failed: %p\n", handle);
+		return(BRISTOL_MIDI_DRIVER);
+	}
+
+	return(BRISTOL_MIDI_OK);
+}
+#endif
+#endif
+
+/*
+ * Start or stop batching on a device, usec < 0 stops it and sends anything
+ * that is held. Otherwise it is the scheduling delay, zero for none.
+ */
+int
+bristolMidiSeqBatch(int dev, int usec)
+{
+#if (BRISTOL_HAS_ALSA == 1)
+#if (SND_LIB_MAJOR == 1)
+	snd_seq_t *handle = bmidi.dev[dev].driver.seq.handle;
+
+	if (usec < 0)
+	{
+		bmidi.dev[dev].flags &= ~BRISTOL_CONN_BATCH;
+		return(bristolMidiSeqFlush(dev));
+	}
+
+	if ((bmidi.dev[dev].driver.seq.encoder == NULL)
+		&& (snd_midi_event_new(BRISTOL_MIDI_BATCHSIZE,
+			&bmidi.dev[dev].driver.seq.encoder) < 0))
+	{
+		printf("Cannot allocate MIDI event encoder\n");
+		bmidi.dev[dev].driver.seq.encoder = NULL;
+	}
+
+	if ((usec > 0) && (bmidi.dev[dev].driver.seq.delay == 0)
+		&& (snd_seq_start_queue(handle, bmidi.dev[dev].driver.seq.queue,
+			NULL) < 0))
+	{
+		printf("Cannot start queue %i\n", bmidi.dev[dev].driver.seq.queue);
+		usec = 0;
+	}
+
+	bmidi.dev[dev].driver.seq.delay = usec;
+	bmidi.dev[dev].flags |= BRISTOL_CONN_BATCH;
+
+	snd_seq_drain_output(handle);
+
+	return(BRISTOL_MIDI_OK);
+#endif
+#endif
+	return(BRISTOL_MIDI_DRIVER);
+}
+
+/*
+ * Raw bytes from a bristolMidiBatch, the engine's echo of its MIDI input.
+ * They go to whoever is subscribed to our port, held like the other events
+ * when the device is batching. Only the sequencer output batch needs this so
+ * the encoder is made when that starts.
+ */
+int
+bristolMidiSeqRawOutput(int dev, unsigned char *buf, int count)
+{
+#if (BRISTOL_HAS_ALSA == 1)
+#if (SND_LIB_MAJOR == 1)
+	snd_midi_event_t *encoder = bmidi.dev[dev].driver.seq.encoder;
+	snd_seq_event_t ev;
+	long used;
+
+	if (encoder == NULL)
+		return(BRISTOL_MIDI_DRIVER);
+
+	snd_midi_event_reset_encode(encoder);
+
+	while (count > 0)
+	{
+		snd_seq_ev_clear(&ev);
+
+		if ((used = snd_midi_event_encode(encoder, buf, count, &ev)) <= 0)
+			return(BRISTOL_MIDI_DRIVER);
+
+		buf += used;
+		count -= used;
+
+		/* Not a whole message yet, the rest is in the next bytes */
+		if (ev.type == SND_SEQ_EVENT_NONE)
+			continue;
+
+		snd_seq_ev_set_source(&ev, bmidi.dev[dev].driver.seq.port);
+		snd_seq_ev_set_subs(&ev);
+		snd_seq_ev_set_direct(&ev);
+
+		if (bristolMidiSeqOutput(dev, &ev) != BRISTOL_MIDI_OK)
+			return(BRISTOL_MIDI_DRIVER);
+	}
+#endif
+#endif
+
+	return(BRISTOL_MIDI_OK);
+}
+
+int
+bristolMidiSeqFlush(int dev)
+{
+#if (BRISTOL_HAS_ALSA == 1)
+#if (SND_LIB_MAJOR == 1)
+	int result;
+
+	/* Nonblocking, it returns what is still to go when the kernel is full */
+	while ((result = snd_seq_drain_output(bmidi.dev[dev].driver.seq.handle))
+		> 0)
+		;
+
+	if (result < 0)
+		return(BRISTOL_MIDI_DRIVER);
+#endif
+#endif
+
+	return(BRISTOL_MIDI_OK);
+}
+
 /*
  * Note that we should not read on a handle - we should read on a device, and
  * then forward to all the handles.
@@ -746,11 +933,7 @@ bristolMidiSeqKeyEvent(int dev, int op, int ch, int key, int velocity)
 	ev.data.note.note = key;
 	ev.data.note.velocity = velocity;
 
-	if (snd_seq_event_output_direct(bmidi.dev[dev].driver.seq.handle, &ev) < 0)
-	{
-		printf("SeqSend failed: %p\n", bmidi.dev[dev].driver.seq.handle);
-		return(BRISTOL_MIDI_DRIVER);
-	}
+	return(bristolMidiSeqOutput(dev, &ev));
 #endif
 #endif
 
@@ -776,6 +959,7 @@ bristolMidiSeqPPressureEvent(int dev, int op, int ch, int k, int p)
 	/*
 	 * Build seq event, send it.
 	 */
+	snd_seq_ev_clear(&ev);
 	ev.type = SND_SEQ_EVENT_KEYPRESS;
 
 	ev.queue = SND_SEQ_QUEUE_DIRECT;
@@ -787,11 +971,7 @@ bristolMidiSeqPPressureEvent(int dev, int op, int ch, int k, int p)
 	ev.data.control.param = k;
 	ev.data.control.value = p;
 
-	if (snd_seq_event_output_direct(bmidi.dev[dev].driver.seq.handle, &ev) < 0)
-	{
-		printf("SeqSend failed: %p\n", bmidi.dev[dev].driver.seq.handle);
-		return(BRISTOL_MIDI_DRIVER);
-	}
+	return(bristolMidiSeqOutput(dev, &ev));
 #endif
 #endif
 
@@ -817,6 +997,7 @@ bristolMidiSeqPressureEvent(int dev, int op, int ch, int p)
 	/*
 	 * Build seq event, send it.
 	 */
+	snd_seq_ev_clear(&ev);
 	ev.type = SND_SEQ_EVENT_CHANPRESS;
 
 	ev.queue = SND_SEQ_QUEUE_DIRECT;
@@ -827,11 +1008,7 @@ bristolMidiSeqPressureEvent(int dev, int op, int ch, int p)
 	ev.data.control.channel = ch;
 	ev.data.control.value = p;
 
-	if (snd_seq_event_output_direct(bmidi.dev[dev].driver.seq.handle, &ev) < 0)
-	{
-		printf("SeqSend failed: %p\n", bmidi.dev[dev].driver.seq.handle);
-		return(BRISTOL_MIDI_DRIVER);
-	}
+	return(bristolMidiSeqOutput(dev, &ev));
 #endif
 #endif
 
@@ -858,6 +1035,7 @@ bristolMidiSeqCCEvent(int dev, int op, int ch, int CC, int CV)
 	/*
 	 * Build seq event, send it.
 	 */
+	snd_seq_ev_clear(&ev);
 	ev.type = SND_SEQ_EVENT_CONTROLLER;
 
 	ev.queue = SND_SEQ_QUEUE_DIRECT;
@@ -869,11 +1047,7 @@ bristolMidiSeqCCEvent(int dev, int op, int ch, int CC, int CV)
 	ev.data.control.param = CC;
 	ev.data.control.value = CV;
 
-	if (snd_seq_event_output_direct(bmidi.dev[dev].driver.seq.handle, &ev) < 0)
-	{
-		printf("SeqSend failed: %p\n", bmidi.dev[dev].driver.seq.handle);
-		return(BRISTOL_MIDI_DRIVER);
-	}
+	return(bristolMidiSeqOutput(dev, &ev));
 #endif
 #endif
 
@@ -0,0 +1,367 @@
+/*
+ *  Diverse Bristol MIDI routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Parsed copies of the files under memory/profiles. Every emulation start
+ * used to open and scan the same profiles for each map it wanted, the MIDI
+ * controller tables alone are well over a hundred passes through the file,
+ * and with -multi that was all done on the MIDI thread. A profile is now read
+ * once per process and kept until the file's mtime or size changes.
+ *
+ * The lines are kept as they were read, minus comments, along with the
+ * '<name>: <index> <value>' fields that bristolGetMap() wants already
+ * converted. If BRISTOL_PROFILE_CACHE names a directory the parsed form is
+ * also written there and reloaded by the next process in a single read.
+ */
+
+#include <stdio.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <pthread.h>
+
+#include "bristolmidi.h"
+
+#define BRISTOL_PROFILE_MAGIC 0x42504331 /* BPC1 */
+
+typedef struct BristolProfileHeader {
+	int magic;
+	int count;
+	int textlen;
+	int pad;
+	long long mtime;
+	long long size;
+} bristolProfileHeader;
+
+static bristolProfile *profiles = NULL;
+static pthread_mutex_t profilelock = PTHREAD_MUTEX_INITIALIZER;
+
+static void
+bristolProfileFree(bristolProfile *profile)
+{
+	if (profile->entries != NULL)
+		free(profile->entries);
+	if (profile->text != NULL)
+		free(profile->text);
+	free(profile);
+}
+
+/*
+ * Name of the compiled copy of a profile, the path is folded into the name
+ * so that a private and a factory profile of the same name do not collide.
+ */
+static int
+bristolProfileCacheName(bristolProfile *profile, char *name)
+{
+	char *dir, *s;
+
+	if ((dir = getenv("BRISTOL_PROFILE_CACHE")) == NULL)
+		return(-1);
+
+	snprintf(name, BUFSZE, "%s/", dir);
+
+	for (s = &name[strlen(name)], dir = profile->path;
+		(*dir != '\0') && (s < &name[BUFSZE - 5]); dir++)
+		*s++ = (*dir == '/')? '_':*dir;
+	sprintf(s, ".bpc");
+
+	return(0);
+}
+
+static int
+bristolProfileLoadCache(bristolProfile *profile)
+{
+	bristolProfileHeader header;
+	char name[BUFSZE];
+	int fd, esize;
+
+	if (bristolProfileCacheName(profile, name) < 0)
+		return(-1);
+
+	if ((fd = open(name, O_RDONLY)) < 0)
+		return(-1);
+
+	if ((read(fd, &header, sizeof(header)) != sizeof(header))
+		|| (header.magic != BRISTOL_PROFILE_MAGIC)
+		|| (header.mtime != profile->mtime)
+		|| (header.size != profile->size)
+		|| (header.count < 0) || (header.textlen < 0))
+	{
+		close(fd);
+		return(-1);
+	}
+
+	esize = header.count * sizeof(bristolProfileEntry);
+
+	profile->entries = (bristolProfileEntry *) malloc(esize + 1);
+	profile->text = (char *) malloc(header.textlen + 1);
+
+	if ((profile->entries == NULL) || (profile->text == NULL)
+		|| (read(fd, profile->entries, esize) != esize)
+		|| (read(fd, profile->text, header.textlen) != header.textlen))
+	{
+		close(fd);
+		if (profile->entries != NULL)
+			free(profile->entries);
+		if (profile->text != NULL)
+			free(profile->text);
+		profile->entries = NULL;
+		profile->text = NULL;
+		return(-1);
+	}
+
+	close(fd);
+
+	profile->text[header.textlen] = '\0';
+	profile->count = header.count;
+
+	return(0);
+}
+
+static void
+bristolProfileSaveCache(bristolProfile *profile, int textlen)
+{
+	bristolProfileHeader header;
+	char name[BUFSZE], tmpname[BUFSZE + 4];
+	int fd, esize = profile->count * sizeof(bristolProfileEntry);
+
+	if (bristolProfileCacheName(profile, name) < 0)
+		return;
+
+	mkdir(getenv("BRISTOL_PROFILE_CACHE"), 0755);
+
+	/* Written aside and renamed so another process never reads half of it */
+	snprintf(tmpname, BUFSZE + 4, "%s.tmp", name);
+
+	if ((fd = open(tmpname, O_WRONLY|O_CREAT|O_TRUNC, 0644)) < 0)
+		return;
+
+	bzero(&header, sizeof(header));
+	header.magic = BRISTOL_PROFILE_MAGIC;
+	header.count = profile->count;
+	header.textlen = textlen;
+	header.mtime = profile->mtime;
+	header.size = profile->size;
+
+	if ((write(fd, &header, sizeof(header)) != sizeof(header))
+		|| (write(fd, profile->entries, esize) != esize)
+		|| (write(fd, profile->text, textlen) != textlen))
+	{
+		close(fd);
+		unlink(tmpname);
+		return;
+	}
+
+	close(fd);
+
+	if (rename(tmpname, name) != 0)
+		unlink(tmpname);
+}
+
+/*
+ * Read the text profile. Lines are taken exactly as bristolGetMap() used to
+ * see them, 256 byte fgets() with comments and anything shorter than 5
+ * characters dropped, so matching on them gives the same results.
+ */
+static int
+bristolProfileParse(bristolProfile *profile)
+{
+	bristolProfileEntry *entry;
+	char param[256], *offset;
+	int len, textlen = 0, space = 0, lines = 0;
+	FILE *fd;
+
+	if ((fd = fopen(profile->path, "r")) == NULL)
+		return(-1);
+
+	while (fgets(param, 256, fd) != NULL)
+		lines++;
+
+	/* Every piece of a line split by fgets() gets its own terminator */
+	space = profile->size + lines + 1;
+
+	profile->text = (char *) malloc(space);
+	profile->entries = (bristolProfileEntry *)
+		malloc((lines + 1) * sizeof(bristolProfileEntry));
+
+	if ((profile->text == NULL) || (profile->entries == NULL))
+	{
+		fclose(fd);
+		return(-1);
+	}
+
+	rewind(fd);
+
+	while (fgets(param, 256, fd) != NULL)
+	{
+		if (param[0] == '#')
+			continue;
+		if ((len = strlen(param)) < 5)
+			continue;
+		if (textlen + len + 1 > space)
+			break;
+
+		entry = &profile->entries[profile->count++];
+		entry->line = textlen;
+		entry->index = -1;
+		entry->value = 0;
+
+		bcopy(param, &profile->text[textlen], len + 1);
+		textlen += len + 1;
+
+		/*
+		 * Maps are '<match>: index value', anything else is left for the
+		 * caller to parse from the line.
+		 */
+		if ((offset = index(param, ' ')) == NULL)
+			continue;
+
+		entry->index = atoi(offset);
+
+		if ((offset = index(++offset, ' ')) == NULL)
+			entry->index = -1;
+		else
+			entry->value = atof(offset);
+	}
+
+	fclose(fd);
+
+	profile->text[textlen] = '\0';
+
+	bristolProfileSaveCache(profile, textlen);
+
+	return(0);
+}
+
+/*
+ * Find the profile in the private cache and then in the factory tree, the
+ * same search that the profile readers used. The profile stays locked until
+ * bristolProfileClose() so it cannot be reloaded under the caller.
+ */
+bristolProfile *
+bristolProfileOpen(char *file)
+{
+	bristolProfile *profile, *last = NULL;
+	struct stat statbuf;
+	char path[BUFSZE];
+	long long mtime;
+
+	snprintf(path, BUFSZE, "%s/memory/profiles/%s",
+		getBristolCache("profiles"), file);
+
+	if (stat(path, &statbuf) != 0)
+	{
+		snprintf(path, BUFSZE, "%s/memory/profiles/%s",
+			getenv("BRISTOL"), file);
+		if (stat(path, &statbuf) != 0)
+			return(NULL);
+	}
+
+	/* Edits inside the same second still have to be noticed */
+	mtime = ((long long) statbuf.st_mtim.tv_sec) * 1000000000
+		+ statbuf.st_mtim.tv_nsec;
+
+	pthread_mutex_lock(&profilelock);
+
+	for (profile = profiles; profile != NULL; profile = profile->next)
+	{
+		if (strcmp(profile->path, path) == 0)
+		{
+			if ((profile->mtime == mtime)
+				&& (profile->size == statbuf.st_size))
+				return(profile);
+
+			/* Edited since we parsed it */
+			if (last == NULL)
+				profiles = profile->next;
+			else
+				last->next = profile->next;
+			bristolProfileFree(profile);
+			break;
+		}
+		last = profile;
+	}
+
+	if ((profile = (bristolProfile *) calloc(1, sizeof(bristolProfile)))
+		== NULL)
+	{
+		pthread_mutex_unlock(&profilelock);
+		return(NULL);
+	}
+
+	snprintf(profile->path, BUFSZE, "%s", path);
+	profile->mtime = mtime;
+	profile->size = statbuf.st_size;
+
+	if ((bristolProfileLoadCache(profile) != 0)
+		&& (bristolProfileParse(profile) != 0))
+	{
+		bristolProfileFree(profile);
+		pthread_mutex_unlock(&profilelock);
+		return(NULL);
+	}
+
+	profile->next = profiles;
+	profiles = profile;
+
+	return(profile);
+}
+
+/*
+ * Line n of an open profile, NULL past the last one.
+ */
+char *
+bristolProfileLine(bristolProfile *profile, int n)
+{
+	if ((n < 0) || (n >= profile->count))
+		return(NULL);
+
+	return(&profile->text[profile->entries[n].line]);
+}
+
+void
+bristolProfileClose(bristolProfile *profile)
+{
+	if (profile != NULL)
+		pthread_mutex_unlock(&profilelock);
+}
+
+/*
+ * Drop everything, used when the cache directory is changed.
+ */
+void
+bristolProfileFlush()
+{
+	bristolProfile *profile;
+
+	pthread_mutex_lock(&profilelock);
+
+	while ((profile = profiles) != NULL)
+	{
+		profiles = profile->next;
+		bristolProfileFree(profile);
+	}
+
+	pthread_mutex_unlock(&profilelock);
+}
+
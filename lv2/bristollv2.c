@@ -0,0 +1,332 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * The emulations as LV2 plugins, one plugin per algorithm. Each instance has
+ * the engine from libbristolengine running the one emulation on MIDI channel
+ * 1 and is run from the host's audio thread, there is no bristol daemon and
+ * no JACK client.
+ *
+ * The MIDI from the host's event port is given to the engine with the frame
+ * it arrived on, the channel is ignored. The emulation also takes the NRP for
+ * its parameters, operator << 7 | controller, as from any other MIDI source.
+ * Gain, detune and glide are control ports and go to the emulation as the GUI
+ * sends them.
+ *
+ * The emulation starts with its GUI's default memory. The parameters in that
+ * memory are control ports after these, see bristolLV2Param(), with the value
+ * from the memory as their default and are sent when the host changes them.
+ *
+ * Each instance has an engine of its own. The engines share the operator code
+ * so the instances in a host render one at a time, see bristolengine.c.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <lv2/core/lv2.h>
+#include <lv2/urid/urid.h>
+#include <lv2/atom/atom.h>
+#include <lv2/atom/util.h>
+#include <lv2/midi/midi.h>
+#include <lv2/options/options.h>
+#include <lv2/buf-size/buf-size.h>
+
+#include "bristolmidiapi.h"
+#include "bristollv2.h"
+
+/* When the host does not give its block size */
+#define BRISTOL_LV2_PERIOD 256
+
+typedef struct BristolLV2Descriptor {
+	LV2_Descriptor lv2;
+	int algo;
+	char uri[256];
+} bristolLV2Descriptor;
+
+typedef struct BristolLV2Port {
+	int operator;
+	int controller;
+	float *port;
+	float last;
+} bristolLV2Port;
+
+typedef struct BristolLV2 {
+	bristolEngine *engine;
+	int algo, id;
+	LV2_URID midievent;
+	const LV2_Atom_Sequence *midi;
+	float *out[2];
+	float *gain, *detune, *glide;
+	float lastgain, lastdetune, lastglide;
+	int count;
+	bristolLV2Port *param;
+} bristolLV2;
+
+static bristolLV2Descriptor *descriptors = NULL;
+
+/*
+ * NRP values are 14 bits that the engine takes as 0.0 to 1.0.
+ */
+static void
+bristolLV2NRP(bristolLV2 *plugin, int nrp, float value)
+{
+	if (value < 0.0f)
+		value = 0.0f;
+	else if (value > 1.0f)
+		value = 1.0f;
+
+	bristolEngineNRP(plugin->engine, 0, nrp, (int) (value * 16383), 0);
+}
+
+static int
+bristolLV2Period(const LV2_Feature *const *features, LV2_URID_Map *map)
+{
+	const LV2_Options_Option *option = NULL;
+	LV2_URID nominal, max, atomint;
+	int i, period = 0;
+
+	for (i = 0; features[i]; i++)
+		if (strcmp(features[i]->URI, LV2_OPTIONS__options) == 0)
+			option = (const LV2_Options_Option *) features[i]->data;
+
+	if (option == NULL)
+		return(BRISTOL_LV2_PERIOD);
+
+	nominal = map->map(map->handle, LV2_BUF_SIZE__nominalBlockLength);
+	max = map->map(map->handle, LV2_BUF_SIZE__maxBlockLength);
+	atomint = map->map(map->handle, LV2_ATOM__Int);
+
+	/* The nominal length is the one the host will use, if it has one */
+	for (; option->key != 0; option++)
+	{
+		if (option->type != atomint)
+			continue;
+
+		if (option->key == nominal)
+			period = *(const int32_t *) option->value;
+		else if ((option->key == max) && (period == 0))
+			period = *(const int32_t *) option->value;
+	}
+
+	return(period > 0? period:BRISTOL_LV2_PERIOD);
+}
+
+static LV2_Handle
+bristolLV2Instantiate(const LV2_Descriptor *descriptor, double rate,
+const char *path, const LV2_Feature *const *features)
+{
+	bristolLV2 *plugin;
+	LV2_URID_Map *map = NULL;
+	bristolLV2Port *param;
+	int i, op, cc;
+	float value;
+
+	for (i = 0; features[i]; i++)
+		if (strcmp(features[i]->URI, LV2_URID__map) == 0)
+			map = (LV2_URID_Map *) features[i]->data;
+
+	if (map == NULL)
+	{
+		printf("bristol lv2 needs the host to map URIs\n");
+		return(NULL);
+	}
+
+	if ((plugin = (bristolLV2 *) calloc(1, sizeof(bristolLV2))) == NULL)
+		return(NULL);
+
+	plugin->algo = ((const bristolLV2Descriptor *) descriptor)->algo;
+	plugin->midievent = map->map(map->handle, LV2_MIDI__MidiEvent);
+
+	if ((plugin->engine = bristolEngineCreate((int) rate,
+		bristolLV2Period(features, map), 0)) == NULL)
+	{
+		printf("bristol lv2 could not start an engine at %.0fHz\n", rate);
+		free(plugin);
+		return(NULL);
+	}
+
+	for (plugin->count = 0; bristolLV2Param(plugin->algo, plugin->count,
+		&op, &cc, &value) == 0; plugin->count++)
+		;
+
+	if (((plugin->param = (bristolLV2Port *) calloc(plugin->count + 1,
+		sizeof(bristolLV2Port))) == NULL)
+		|| ((plugin->id = bristolEngineEmulation(plugin->engine,
+			plugin->algo, 0, 0)) < 0))
+	{
+		bristolEngineDestroy(plugin->engine);
+		free(plugin->param);
+		free(plugin);
+		return(NULL);
+	}
+
+	/*
+	 * The emulation has its default memory, the ports only go to the engine
+	 * when the host gives them another value.
+	 */
+	for (i = 0; i < plugin->count; i++)
+	{
+		param = &plugin->param[i];
+		bristolLV2Param(plugin->algo, i, &param->operator, &param->controller,
+			&param->last);
+	}
+
+	/* Take the parameters as NRP, the controls are sent on the first run */
+	bristolEngineNRP(plugin->engine, 0, BRISTOL_NRP_ENABLE_NRP, 1, 0);
+	plugin->lastgain = plugin->lastdetune = plugin->lastglide = -1;
+
+	return((LV2_Handle) plugin);
+}
+
+static void
+bristolLV2Connect(LV2_Handle instance, uint32_t port, void *data)
+{
+	bristolLV2 *plugin = (bristolLV2 *) instance;
+
+	switch (port) {
+		case BRISTOL_LV2_MIDI:
+			plugin->midi = (const LV2_Atom_Sequence *) data;
+			break;
+		case BRISTOL_LV2_LEFT:
+			plugin->out[0] = (float *) data;
+			break;
+		case BRISTOL_LV2_RIGHT:
+			plugin->out[1] = (float *) data;
+			break;
+		case BRISTOL_LV2_GAIN:
+			plugin->gain = (float *) data;
+			break;
+		case BRISTOL_LV2_DETUNE:
+			plugin->detune = (float *) data;
+			break;
+		case BRISTOL_LV2_GLIDE:
+			plugin->glide = (float *) data;
+			break;
+		default:
+			if (port - BRISTOL_LV2_PORTS < plugin->count)
+				plugin->param[port - BRISTOL_LV2_PORTS].port = (float *) data;
+			break;
+	}
+}
+
+static void
+bristolLV2Run(LV2_Handle instance, uint32_t frames)
+{
+	bristolLV2 *plugin = (bristolLV2 *) instance;
+	bristolLV2Port *param;
+	const uint8_t *data;
+	unsigned char msg[3];
+	int i;
+
+	/* The engine takes gain up to 64 */
+	if ((plugin->gain) && (*plugin->gain != plugin->lastgain))
+		bristolLV2NRP(plugin, BRISTOL_NRP_GAIN,
+			(plugin->lastgain = *plugin->gain) / 64.0f);
+	if ((plugin->detune) && (*plugin->detune != plugin->lastdetune))
+		bristolLV2NRP(plugin, BRISTOL_NRP_DETUNE,
+			plugin->lastdetune = *plugin->detune);
+	if ((plugin->glide) && (*plugin->glide != plugin->lastglide))
+		bristolLV2NRP(plugin, BRISTOL_NRP_GLIDE,
+			(plugin->lastglide = *plugin->glide) / BRISTOL_LV2_GLIDE_MAX);
+
+	for (i = 0; i < plugin->count; i++)
+	{
+		param = &plugin->param[i];
+
+		if ((param->port) && (*param->port != param->last))
+			bristolEngineParam(plugin->engine, plugin->id, param->operator,
+				param->controller, param->last = *param->port);
+	}
+
+	if (plugin->midi)
+	{
+		LV2_ATOM_SEQUENCE_FOREACH(plugin->midi, ev)
+		{
+			if ((ev->body.type != plugin->midievent)
+				|| (ev->body.size == 0) || (ev->body.size > 3))
+				continue;
+
+			data = (const uint8_t *) (ev + 1);
+
+			/* Everything goes to the emulation on channel 1 */
+			memcpy(msg, data, ev->body.size);
+			if (msg[0] < MIDI_SYSTEM)
+				msg[0] &= MIDI_COMMAND_MASK;
+
+			bristolEngineMidi(plugin->engine, msg, ev->body.size,
+				(int) ev->time.frames);
+		}
+	}
+
+	bristolEngineProcess(plugin->engine, plugin->out, frames);
+}
+
+static void
+bristolLV2Cleanup(LV2_Handle instance)
+{
+	bristolLV2 *plugin = (bristolLV2 *) instance;
+
+	bristolEngineDestroy(plugin->engine);
+	free(plugin->param);
+	free(plugin);
+}
+
+static const void *
+bristolLV2Extension(const char *uri)
+{
+	return(NULL);
+}
+
+LV2_SYMBOL_EXPORT const LV2_Descriptor *
+lv2_descriptor(uint32_t index)
+{
+	bristolLV2Descriptor *descriptor;
+	char name[64];
+	int algo;
+
+	if ((algo = bristolLV2Algo(index)) < 0)
+		return(NULL);
+
+	if ((descriptors == NULL) && ((descriptors = (bristolLV2Descriptor *)
+		calloc(bristolEngineAlgoCount(), sizeof(bristolLV2Descriptor)))
+			== NULL))
+		return(NULL);
+
+	descriptor = &descriptors[algo];
+
+	if (descriptor->lv2.URI == NULL)
+	{
+		bristolLV2Name(algo, name, sizeof(name));
+		snprintf(descriptor->uri, sizeof(descriptor->uri), "%s%s",
+			BRISTOL_LV2_URI, name);
+
+		descriptor->algo = algo;
+		descriptor->lv2.instantiate = bristolLV2Instantiate;
+		descriptor->lv2.connect_port = bristolLV2Connect;
+		descriptor->lv2.run = bristolLV2Run;
+		descriptor->lv2.cleanup = bristolLV2Cleanup;
+		descriptor->lv2.extension_data = bristolLV2Extension;
+		descriptor->lv2.URI = descriptor->uri;
+	}
+
+	return(&descriptor->lv2);
+}
@@ -0,0 +1,119 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Shared between the LV2 plugin and bristolttl that writes its description,
+ * they have to agree on the plugin URIs and the ports.
+ */
+
+#ifndef _BRISTOL_LV2_H
+#define _BRISTOL_LV2_H
+
+#include <stdio.h>
+#include <string.h>
+
+#include "bristolengine.h"
+
+#define BRISTOL_LV2_URI "http://bristol.sourceforge.net/lv2/"
+
+#define BRISTOL_LV2_MIDI 0
+#define BRISTOL_LV2_LEFT 1
+#define BRISTOL_LV2_RIGHT 2
+#define BRISTOL_LV2_GAIN 3
+#define BRISTOL_LV2_DETUNE 4
+#define BRISTOL_LV2_GLIDE 5
+#define BRISTOL_LV2_PORTS 6 /* The emulation's parameters follow */
+
+/* Glide port is in seconds, the emulations take up to 30 */
+#define BRISTOL_LV2_GLIDE_MAX 30.0f
+
+/*
+ * Algorithm of the index'th plugin, they are the algorithms that have an
+ * emulation. The B3 lower manual is left out, the GUI starts it with the
+ * upper manual and it cannot run on its own. Returns -1 past the last one.
+ */
+static inline int
+bristolLV2Algo(int index)
+{
+	int algo;
+
+	for (algo = 0; algo < bristolEngineAlgoCount(); algo++)
+	{
+		if ((bristolEngineName(algo) == NULL)
+			|| (strcmp(bristolEngineName(algo), "hammondB3") == 0))
+			continue;
+
+		if (index-- == 0)
+			return(algo);
+	}
+
+	return(-1);
+}
+
+/*
+ * The index'th parameter port of an algorithm. They are the parameters its
+ * GUI sends for the default memory, see bristolEngineDefault(), each operator
+ * and controller once in the order they are first sent and with the last
+ * value they are given. Returns -1 past the last one.
+ */
+static inline int
+bristolLV2Param(int algo, int index, int *operator, int *controller,
+float *value)
+{
+	int i, j, op, cc;
+	float v;
+
+	for (i = 0;
+		bristolEngineDefault(algo, i, operator, controller, value) == 0; i++)
+	{
+		for (j = 0; bristolEngineDefault(algo, j, &op, &cc, &v) == 0; j++)
+		{
+			if ((op != *operator) || (cc != *controller))
+				continue;
+			if (j < i)
+				break;
+			*value = v;
+		}
+
+		/* A parameter that was already given is not a new port */
+		if ((j < i) || (index-- > 0))
+			continue;
+
+		return(0);
+	}
+
+	return(-1);
+}
+
+/*
+ * Some algorithms share a name, the dx and rhodes for example. The first one
+ * gets the name, the others have the algorithm number added to it.
+ */
+static inline void
+bristolLV2Name(int algo, char *name, int len)
+{
+	if (bristolEngineAlgo(bristolEngineName(algo)) == algo)
+		snprintf(name, len, "%s", bristolEngineName(algo));
+	else
+		snprintf(name, len, "%s%i", bristolEngineName(algo), algo);
+}
+
+#endif /* _BRISTOL_LV2_H */
@@ -0,0 +1,153 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Write the turtle for the LV2 bundle at build time, the plugins come from
+ * the algorithm table of the engine so the list does not have to be kept by
+ * hand:
+ *
+ *	bristolttl manifest > manifest.ttl
+ *	bristolttl plugins > bristol.ttl
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "bristollv2.h"
+
+static char *prefixes =
+"@prefix atom:  <http://lv2plug.in/ns/ext/atom#> .\n"
+"@prefix bufsz: <http://lv2plug.in/ns/ext/buf-size#> .\n"
+"@prefix doap:  <http://usefulinc.com/ns/doap#> .\n"
+"@prefix lv2:   <http://lv2plug.in/ns/lv2core#> .\n"
+"@prefix midi:  <http://lv2plug.in/ns/ext/midi#> .\n"
+"@prefix opts:  <http://lv2plug.in/ns/ext/options#> .\n"
+"@prefix rdfs:  <http://www.w3.org/2000/01/rdf-schema#> .\n"
+"@prefix urid:  <http://lv2plug.in/ns/ext/urid#> .\n\n";
+
+static void
+manifest(int algo, char *name)
+{
+	printf("<%s%s>\n", BRISTOL_LV2_URI, name);
+	printf("\ta lv2:Plugin ;\n");
+	printf("\tlv2:binary <bristol.so> ;\n");
+	printf("\trdfs:seeAlso <bristol.ttl> .\n\n");
+}
+
+static void
+control(int index, char *symbol, char *label, float def, float min, float max,
+int last)
+{
+	printf("\t\ta lv2:InputPort, lv2:ControlPort ;\n");
+	printf("\t\tlv2:index %i ;\n", index);
+	printf("\t\tlv2:symbol \"%s\" ;\n", symbol);
+	printf("\t\tlv2:name \"%s\" ;\n", label);
+	printf("\t\tlv2:default %f ;\n", def);
+	printf("\t\tlv2:minimum %f ;\n", min);
+	printf("\t\tlv2:maximum %f\n", max);
+	printf(last? "\t] .\n\n":"\t], [\n");
+}
+
+static void
+plugin(int algo, char *name)
+{
+	char symbol[32], label[64];
+	int i, op, cc, count;
+	float value;
+
+	for (count = 0; bristolLV2Param(algo, count, &op, &cc, &value) == 0;
+		count++)
+		;
+
+	printf("<%s%s>\n", BRISTOL_LV2_URI, name);
+	printf("\ta lv2:Plugin, lv2:InstrumentPlugin ;\n");
+	printf("\tdoap:name \"Bristol %s\" ;\n", name);
+	printf("\tdoap:license <http://usefulinc.com/doap/licenses/gpl> ;\n");
+	printf("\tlv2:minorVersion 0 ;\n");
+	printf("\tlv2:microVersion 1 ;\n");
+	printf("\trdfs:comment \"The bristol %s emulation. Its parameters are "
+		"also taken as MIDI NRP, operator << 7 | controller.\" ;\n", name);
+	printf("\tlv2:requiredFeature urid:map ;\n");
+	printf("\tlv2:optionalFeature lv2:hardRTCapable, opts:options ;\n");
+	printf("\topts:supportedOption bufsz:nominalBlockLength, "
+		"bufsz:maxBlockLength ;\n");
+
+	printf("\tlv2:port [\n");
+	printf("\t\ta lv2:InputPort, atom:AtomPort ;\n");
+	printf("\t\tatom:bufferType atom:Sequence ;\n");
+	printf("\t\tatom:supports midi:MidiEvent ;\n");
+	printf("\t\tlv2:designation lv2:control ;\n");
+	printf("\t\tlv2:index %i ;\n", BRISTOL_LV2_MIDI);
+	printf("\t\tlv2:symbol \"midi\" ;\n");
+	printf("\t\tlv2:name \"MIDI In\"\n");
+	printf("\t], [\n");
+	printf("\t\ta lv2:OutputPort, lv2:AudioPort ;\n");
+	printf("\t\tlv2:index %i ;\n", BRISTOL_LV2_LEFT);
+	printf("\t\tlv2:symbol \"left\" ;\n");
+	printf("\t\tlv2:name \"Left\"\n");
+	printf("\t], [\n");
+	printf("\t\ta lv2:OutputPort, lv2:AudioPort ;\n");
+	printf("\t\tlv2:index %i ;\n", BRISTOL_LV2_RIGHT);
+	printf("\t\tlv2:symbol \"right\" ;\n");
+	printf("\t\tlv2:name \"Right\"\n");
+	printf("\t], [\n");
+
+	control(BRISTOL_LV2_GAIN, "gain", "Gain", 1.0, 0.0, 4.0, 0);
+	control(BRISTOL_LV2_DETUNE, "detune", "Detune", 0.0, 0.0, 1.0, 0);
+	control(BRISTOL_LV2_GLIDE, "glide", "Glide", 0.0, 0.0,
+		BRISTOL_LV2_GLIDE_MAX, count == 0);
+
+	/* The engine has no names for them, they are operator and controller */
+	for (i = 0; bristolLV2Param(algo, i, &op, &cc, &value) == 0; i++)
+	{
+		snprintf(symbol, sizeof(symbol), "op%i_%i", op, cc);
+		snprintf(label, sizeof(label), "Operator %i controller %i", op, cc);
+		control(BRISTOL_LV2_PORTS + i, symbol, label, value, 0.0, 1.0,
+			i == count - 1);
+	}
+}
+
+int
+main(int argc, char *argv[])
+{
+	void (*output)(int, char *);
+	char name[64];
+	int i, algo;
+
+	if ((argc == 2) && (strcmp(argv[1], "manifest") == 0))
+		output = manifest;
+	else if ((argc == 2) && (strcmp(argv[1], "plugins") == 0))
+		output = plugin;
+	else {
+		fprintf(stderr, "usage: %s manifest | plugins\n", argv[0]);
+		return(1);
+	}
+
+	printf("%s", prefixes);
+
+	for (i = 0; (algo = bristolLV2Algo(i)) >= 0; i++)
+	{
+		bristolLV2Name(algo, name, sizeof(name));
+		output(algo, name);
+	}
+
+	return(0);
+}
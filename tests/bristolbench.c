@@ -0,0 +1,696 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Engine benchmarks. They are built with 'make check' but not run by it, the
+ * numbers depend on the machine and there is nothing to pass or fail:
+ *
+ *	bristolbench [-p periods] [benchmark ...]
+ *
+ * With no names they all run. Each one runs in a child process as with
+ * bristolcheck, the engine is global to the process.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <sys/wait.h>
+
+#include "bristolengine.h"
+#include "bristolmidiapi.h"
+#include "ringbuffer.h"
+
+#define BENCH_RATE 48000
+#define BENCH_PERIOD 256
+#define BENCH_PERIODS 2000
+#define BENCH_VOICES 32 /* The default BRISTOL_VOICECOUNT */
+
+/* From libbristol, the KB of the engine arena in use */
+extern int bristolArenaStats();
+
+typedef struct BenchTest {
+	char *name;
+	int (*run)(FILE *, int);
+	char *help;
+} benchTest;
+
+static double
+benchTime()
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return(now.tv_sec + now.tv_nsec / 1000000000.0);
+}
+
+static void
+benchNote(bristolEngine *engine, int channel, int key, int offset)
+{
+	unsigned char msg[3];
+
+	msg[0] = MIDI_NOTE_ON | channel;
+	msg[1] = key;
+	msg[2] = 100;
+
+	bristolEngineMidi(engine, msg, 3, offset);
+}
+
+static void
+benchNoteOff(bristolEngine *engine, int channel, int key, int offset)
+{
+	unsigned char msg[3];
+
+	msg[0] = MIDI_NOTE_OFF | channel;
+	msg[1] = key;
+	msg[2] = 0;
+
+	bristolEngineMidi(engine, msg, 3, offset);
+}
+
+/*
+ * Sixteen different emulations, one per MIDI channel with two voices and a two
+ * note chord each, the per period walk over the emulations with all of them
+ * busy. The engine is built and destroyed a few times, the arena should be
+ * back where it was after each destroy.
+ */
+static char *benchEmulations[16] = {
+	"mini", "prophet", "juno", "obx", "explorer", "pro1", "odyssey",
+	"memoryMoog", "jupiter8", "poly", "poly800", "axxe", "realistic",
+	"prophet52", "sid", "vox",
+};
+
+#define BENCH_ROUNDS 4
+
+static int
+benchEmulation(FILE *out, int periods)
+{
+	float left[BENCH_PERIOD], right[BENCH_PERIOD], *buf[2];
+	int round, i, n, inuse[BENCH_ROUNDS];
+	double start, took, total = 0, worst = 0;
+	bristolEngine *engine;
+
+	buf[0] = left;
+	buf[1] = right;
+
+	for (round = 0; round < BENCH_ROUNDS; round++)
+	{
+		if ((engine = bristolEngineCreate(BENCH_RATE, BENCH_PERIOD,
+			BENCH_VOICES)) == NULL)
+			return(-1);
+
+		for (i = 0; i < 16; i++)
+			if (bristolEngineEmulation(engine,
+				bristolEngineAlgo(benchEmulations[i]), i, 2) < 0)
+			{
+				bristolEngineDestroy(engine);
+				return(-1);
+			}
+
+		for (n = 0; n < periods; n++)
+		{
+			if (n == 0)
+				for (i = 0; i < 16; i++)
+				{
+					benchNote(engine, i, 48 + i, 0);
+					benchNote(engine, i, 55 + i, 0);
+				}
+
+			start = benchTime();
+			bristolEngineProcess(engine, buf, BENCH_PERIOD);
+			took = benchTime() - start;
+
+			/* The first round warms the caches and the arena */
+			if (round == 0)
+				continue;
+
+			total += took;
+			if (took > worst)
+				worst = took;
+		}
+
+		bristolEngineDestroy(engine);
+
+		inuse[round] = bristolArenaStats();
+	}
+
+	fprintf(out, "emulations: 16 emulations, %i voices, %.1fus mean, "
+		"%.1fus worst per %i frame period, %.1f%% of realtime\n", BENCH_VOICES,
+		total * 1000000 / ((BENCH_ROUNDS - 1) * periods),
+		worst * 1000000, BENCH_PERIOD,
+		total * 100 / ((BENCH_ROUNDS - 1) * periods)
+			/ (BENCH_PERIOD / (double) BENCH_RATE));
+	fprintf(out, "emulations: arena %iKB in use after the first destroy, "
+		"%+iKB over the next %i\n", inuse[0],
+		inuse[BENCH_ROUNDS - 1] - inuse[0], BENCH_ROUNDS - 1);
+
+	return(0);
+}
+
+/*
+ * The note events from the MIDI thread to the audio thread, the full message
+ * they used to be against the packed record, through a ringbuffer the size of
+ * audiomain->rb. One thread, this is the cost of the copies in and out and of
+ * how many events a period's burst can hold.
+ */
+#define BENCH_RB 8192
+
+static double
+benchRecords(int size, int events, int *burst)
+{
+	char record[sizeof(bristolMidiMsg)];
+	jack_ringbuffer_t *rb;
+	double start;
+	int done, n;
+
+	if ((rb = jack_ringbuffer_create(BENCH_RB)) == NULL)
+		return(-1);
+
+	memset(record, 0, sizeof(record));
+	*burst = jack_ringbuffer_write_space(rb) / size;
+
+	start = benchTime();
+
+	for (done = 0; done < events; done += *burst)
+	{
+		for (n = 0; n < *burst; n++)
+		{
+			record[0] = n;
+			jack_ringbuffer_write(rb, record, size);
+		}
+		for (n = 0; n < *burst; n++)
+			jack_ringbuffer_read(rb, record, size);
+	}
+
+	start = benchTime() - start;
+
+	jack_ringbuffer_free(rb);
+
+	return(start * 1000000000 / done);
+}
+
+static int
+benchEvents(FILE *out, int periods)
+{
+	int burst, events = periods * 1000;
+	double ns;
+
+	if ((ns = benchRecords(sizeof(bristolMidiMsg), events, &burst)) < 0)
+		return(-1);
+	fprintf(out, "events: bristolMidiMsg %i bytes, %i events in %i bytes, "
+		"%.1fns per event\n", (int) sizeof(bristolMidiMsg), burst, BENCH_RB,
+		ns);
+
+	if ((ns = benchRecords(sizeof(bristolEventMsg), events, &burst)) < 0)
+		return(-1);
+	fprintf(out, "events: bristolEventMsg %i bytes, %i events in %i bytes, "
+		"%.1fns per event\n", (int) sizeof(bristolEventMsg), burst, BENCH_RB,
+		ns);
+
+	return(0);
+}
+
+/*
+ * The DX with a 16 note chord through each of its 24 algorithms, the fused
+ * operator kernel renders all six operators of a voice in one pass. The
+ * algorithm is the emulation's global controller 101, it takes the algorithm
+ * number as the raw controller value. The default voice decays in a few
+ * seconds so each algorithm gets a new engine and chord, at most a second of
+ * it is timed.
+ */
+#define BENCH_DX_ALGOS 24
+#define BENCH_DX_PERIODS 187
+
+static int
+benchDX(FILE *out, int periods)
+{
+	float left[BENCH_PERIOD], right[BENCH_PERIOD], *buf[2];
+	double start, took, total = 0, worst;
+	bristolEngine *engine;
+	int algo, id, i, n;
+
+	buf[0] = left;
+	buf[1] = right;
+
+	if ((periods /= 8) > BENCH_DX_PERIODS)
+		periods = BENCH_DX_PERIODS;
+
+	for (algo = 0; algo < BENCH_DX_ALGOS; algo++)
+	{
+		if ((engine = bristolEngineCreate(BENCH_RATE, BENCH_PERIOD, 16))
+			== NULL)
+			return(-1);
+
+		if ((id = bristolEngineEmulation(engine, bristolEngineAlgo("dx"),
+			0, 16)) < 0)
+		{
+			bristolEngineDestroy(engine);
+			return(-1);
+		}
+
+		bristolEngineParam(engine, id, 126, 101,
+			algo / (float) (CONTROLLER_RANGE - 1));
+
+		for (i = 0; i < 16; i++)
+			benchNote(engine, 0, 36 + i * 3, 0);
+		bristolEngineProcess(engine, buf, BENCH_PERIOD);
+
+		for (worst = took = 0, n = 0; n < periods; n++)
+		{
+			start = benchTime();
+			bristolEngineProcess(engine, buf, BENCH_PERIOD);
+			start = benchTime() - start;
+
+			took += start;
+			if (start > worst)
+				worst = start;
+		}
+
+		/* A voice that ended early would make the algorithm look cheap */
+		if (bristolEngineVoices(engine) != 16)
+		{
+			bristolEngineDestroy(engine);
+			return(-1);
+		}
+
+		total += took;
+
+		fprintf(out, "dx: algorithm %2i, %.2fus per voice, %.1fus worst "
+			"period\n", algo + 1, took * 1000000 / (periods * 16),
+			worst * 1000000);
+
+		bristolEngineDestroy(engine);
+	}
+
+	fprintf(out, "dx: 16 voices, %.2fus per voice per %i frame period over "
+		"the %i algorithms\n", total * 1000000 / (BENCH_DX_ALGOS * periods * 16),
+		BENCH_PERIOD, BENCH_DX_ALGOS);
+
+	return(0);
+}
+
+/*
+ * The ringbuffer between two threads, a producer writing numbered event
+ * records into one the size of audiomain->rb and a consumer checking that
+ * they come out whole and in order. The consumer either copies each record
+ * out or takes them in batches in place as the audio thread does. Each side
+ * yields when the buffer is full or empty, on one CPU that is what lets the
+ * other run.
+ */
+typedef struct BenchRing {
+	jack_ringbuffer_t *rb;
+	int events;
+	volatile int stop; /* The consumer found a bad record */
+} benchRing;
+
+static void *
+benchProducer(void *arg)
+{
+	benchRing *ring = (benchRing *) arg;
+	bristolEventMsg event;
+	int n;
+
+	memset(&event, 0, sizeof(event));
+	event.command = MIDI_NOTE_ON;
+
+	for (n = 0; n < ring->events; n++)
+	{
+		event.sequence = n;
+		event.key = n & 0x7f;
+
+		while (jack_ringbuffer_write_space(ring->rb) < sizeof(event))
+		{
+			if (ring->stop)
+				return(NULL);
+			sched_yield();
+		}
+
+		jack_ringbuffer_write(ring->rb, (char *) &event, sizeof(event));
+	}
+
+	return(NULL);
+}
+
+/*
+ * Events per second, 0 if one was lost or out of order, -1 on failure.
+ */
+static double
+benchConsumer(int events, int batch)
+{
+	bristolEventMsg event, *records;
+	unsigned int expect = 0;
+	pthread_t producer;
+	benchRing ring;
+	double start;
+	size_t count, i;
+
+	if ((ring.rb = jack_ringbuffer_create(BENCH_RB)) == NULL)
+		return(-1);
+	ring.events = events;
+	ring.stop = 0;
+
+	start = benchTime();
+
+	if (pthread_create(&producer, NULL, benchProducer, &ring) != 0)
+	{
+		jack_ringbuffer_free(ring.rb);
+		return(-1);
+	}
+
+	while (expect < events)
+	{
+		if (batch)
+		{
+			if ((count = jack_ringbuffer_peek_records(ring.rb,
+				sizeof(bristolEventMsg), (void **) &records)) == 0)
+			{
+				sched_yield();
+				continue;
+			}
+
+			for (i = 0; i < count; i++)
+				if ((records[i].sequence != expect++)
+					|| (records[i].key != (records[i].sequence & 0x7f)))
+					break;
+
+			if (i != count)
+				break;
+
+			jack_ringbuffer_read_advance(ring.rb,
+				count * sizeof(bristolEventMsg));
+		} else {
+			if (jack_ringbuffer_read_space(ring.rb) < sizeof(event))
+			{
+				sched_yield();
+				continue;
+			}
+
+			jack_ringbuffer_read(ring.rb, (char *) &event, sizeof(event));
+
+			if ((event.sequence != expect++)
+				|| (event.key != (event.sequence & 0x7f)))
+				break;
+		}
+	}
+
+	ring.stop = 1;
+	pthread_join(producer, NULL);
+
+	start = benchTime() - start;
+
+	jack_ringbuffer_free(ring.rb);
+
+	if (expect != events)
+		return(0);
+
+	return(events / start);
+}
+
+static int
+benchRingbuffer(FILE *out, int periods)
+{
+	int events = periods * 5000, batch;
+	double rate;
+
+	for (batch = 0; batch < 2; batch++)
+	{
+		if ((rate = benchConsumer(events, batch)) < 0)
+			return(-1);
+
+		if (rate == 0)
+		{
+			fprintf(out, "ringbuffer: %s path lost the order\n",
+				batch? "batch":"copying");
+			return(-1);
+		}
+
+		fprintf(out, "ringbuffer: %s path, %i %i byte events in order, "
+			"%.1fM events/s\n", batch? "batch":"copying", events,
+			(int) sizeof(bristolEventMsg), rate / 1000000);
+	}
+
+	return(0);
+}
+
+/*
+ * The release tails with denormals kept and flushed. An 8 note chord is held
+ * for half a second and released, then the tail is timed. Most emulations
+ * end their voices at the release, these two keep filter and effect feedback
+ * decaying through the denormal range long after the note.
+ */
+static char *benchTails[] = {"roadrunner", "prophet52", NULL};
+
+#define BENCH_TAIL_NOTES 8
+#define BENCH_TAIL_HOLD 94
+
+static int
+benchTail(int algo, int keep, int periods, double *mean, double *worst)
+{
+	float left[BENCH_PERIOD], right[BENCH_PERIOD], *buf[2];
+	bristolEngine *engine;
+	double start;
+	int i, n;
+
+	buf[0] = left;
+	buf[1] = right;
+
+	if ((engine = bristolEngineCreate(BENCH_RATE, BENCH_PERIOD, 16)) == NULL)
+		return(-1);
+
+	if ((bristolEngineEmulation(engine, algo, 0, BENCH_TAIL_NOTES) < 0)
+		|| (bristolEngineDenormals(engine, keep) < 0))
+	{
+		bristolEngineDestroy(engine);
+		return(-1);
+	}
+
+	for (i = 0; i < BENCH_TAIL_NOTES; i++)
+		benchNote(engine, 0, 48 + i * 3, 0);
+	for (n = 0; n < BENCH_TAIL_HOLD; n++)
+		bristolEngineProcess(engine, buf, BENCH_PERIOD);
+	for (i = 0; i < BENCH_TAIL_NOTES; i++)
+		benchNoteOff(engine, 0, 48 + i * 3, 0);
+
+	for (*mean = *worst = 0, n = 0; n < periods; n++)
+	{
+		start = benchTime();
+		bristolEngineProcess(engine, buf, BENCH_PERIOD);
+		start = benchTime() - start;
+
+		*mean += start;
+		if (start > *worst)
+			*worst = start;
+	}
+
+	*mean = *mean * 1000000 / periods;
+	*worst *= 1000000;
+
+	bristolEngineDestroy(engine);
+
+	return(0);
+}
+
+static int
+benchDenormals(FILE *out, int periods)
+{
+	double mean[2], worst[2];
+	int i, keep;
+
+	for (i = 0; benchTails[i] != NULL; i++)
+	{
+		for (keep = 0; keep < 2; keep++)
+			if (benchTail(bristolEngineAlgo(benchTails[i]), keep, periods,
+				&mean[keep], &worst[keep]) < 0)
+				return(-1);
+
+		fprintf(out, "denormals: %s, %i periods of release tail, "
+			"flushed %.1fus mean %.1fus worst, kept %.1fus mean %.1fus "
+			"worst, %.1fx\n", benchTails[i], periods, mean[0], worst[0],
+			mean[1], worst[1], mean[1] / mean[0]);
+	}
+
+	return(0);
+}
+
+/*
+ * The filter2 types under heavy automation: the OB-X filter, operator 4, with
+ * an 8 note chord held and the cutoff swept a step every period. Type 0 is the
+ * Chamberlin, 1 to 4 the Huovilainen types, the type is given as the raw
+ * controller value.
+ */
+#define BENCH_FILTER_OP 4
+#define BENCH_FILTER_TYPES 5
+
+static int
+benchFilter(FILE *out, int periods)
+{
+	float left[BENCH_PERIOD], right[BENCH_PERIOD], *buf[2];
+	double start, took, worst;
+	bristolEngine *engine;
+	int type, id, i, n;
+
+	buf[0] = left;
+	buf[1] = right;
+
+	for (type = 0; type < BENCH_FILTER_TYPES; type++)
+	{
+		if ((engine = bristolEngineCreate(BENCH_RATE, BENCH_PERIOD, 16))
+			== NULL)
+			return(-1);
+
+		if ((id = bristolEngineEmulation(engine, bristolEngineAlgo("obx"),
+			0, 8)) < 0)
+		{
+			bristolEngineDestroy(engine);
+			return(-1);
+		}
+
+		bristolEngineParam(engine, id, BENCH_FILTER_OP, 4,
+			type / (float) CONTROLLER_RANGE);
+
+		for (i = 0; i < 8; i++)
+			benchNote(engine, 0, 48 + i * 3, 0);
+
+		for (worst = took = 0, n = 0; n < periods; n++)
+		{
+			/* A triangle sweep of the cutoff, a second up and down */
+			bristolEngineParam(engine, id, BENCH_FILTER_OP, 0,
+				0.2 + 0.6 * abs((n % 376) - 188) / 188.0);
+
+			start = benchTime();
+			bristolEngineProcess(engine, buf, BENCH_PERIOD);
+			start = benchTime() - start;
+
+			took += start;
+			if (start > worst)
+				worst = start;
+		}
+
+		fprintf(out, "filter: type %i, 8 voices with a cutoff sweep, %.1fus "
+			"mean %.1fus worst per %i frame period\n", type,
+			took * 1000000 / periods, worst * 1000000, BENCH_PERIOD);
+
+		bristolEngineDestroy(engine);
+	}
+
+	return(0);
+}
+
+static benchTest benchTests[] = {
+	{"emulations", benchEmulation, "16 emulations at once, arena use"},
+	{"events", benchEvents, "MIDI to audio event records, old and new"},
+	{"dx", benchDX, "the DX operator kernel over its 24 algorithms"},
+	{"ringbuffer", benchRingbuffer, "event records between two threads"},
+	{"filter", benchFilter, "the filter2 types with a cutoff sweep"},
+	{"denormals", benchDenormals, "release tails, denormals kept and flushed"},
+	{NULL, NULL, NULL}
+};
+
+/*
+ * The engine talks on stdout, the results go to the original one.
+ */
+static int
+benchRun(benchTest *test, int periods)
+{
+	int status, fd;
+	FILE *out;
+	pid_t pid;
+
+	fflush(stdout);
+
+	if ((pid = fork()) < 0)
+		return(-1);
+
+	if (pid == 0)
+	{
+		if (((fd = dup(1)) < 0) || ((out = fdopen(fd, "w")) == NULL)
+			|| (freopen("/dev/null", "w", stdout) == NULL))
+			_exit(1);
+
+		setvbuf(out, NULL, _IOLBF, 0);
+
+		_exit(test->run(out, periods) < 0? 1:0);
+	}
+
+	if (waitpid(pid, &status, 0) < 0)
+		return(-1);
+
+	if (WIFSIGNALED(status) || (WEXITSTATUS(status) != 0))
+	{
+		printf("%s: failed\n", test->name);
+		return(-1);
+	}
+
+	return(0);
+}
+
+int
+main(int argc, char *argv[])
+{
+	int i, j, periods = BENCH_PERIODS, failed = 0, count = 0;
+
+	setvbuf(stdout, NULL, _IOLBF, 0);
+
+	for (argc--, argv++; argc > 0 && argv[0][0] == '-'; argc--, argv++)
+	{
+		if ((strcmp(argv[0], "-p") == 0) && (argc > 1)
+			&& ((periods = atoi(argv[1])) > 0))
+		{
+			argc--;
+			argv++;
+		} else {
+			fprintf(stderr, "usage: bristolbench [-p periods] "
+				"[benchmark ...]\n");
+			for (i = 0; benchTests[i].name != NULL; i++)
+				fprintf(stderr, "\t%-12s %s\n", benchTests[i].name,
+					benchTests[i].help);
+			return(2);
+		}
+	}
+
+	for (i = 0; benchTests[i].name != NULL; i++)
+	{
+		if (argc > 0)
+		{
+			for (j = 0; j < argc; j++)
+				if (strcmp(argv[j], benchTests[i].name) == 0)
+					break;
+			if (j == argc)
+				continue;
+		}
+
+		count++;
+		if (benchRun(&benchTests[i], periods) < 0)
+			failed++;
+	}
+
+	if (count == 0)
+	{
+		fprintf(stderr, "bristolbench: no such benchmark\n");
+		return(2);
+	}
+
+	return(failed? 1:0);
+}
@@ -0,0 +1,507 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * 'make check': render each emulation headless through libbristolengine with
+ * the same script of notes, controllers and an NRP and compare an envelope of
+ * the output with the golden file for that emulation. The envelope is the RMS
+ * of each channel, the peak and the zero crossings for each span of a few
+ * periods, they have to be within a tolerance of the golden ones so that a
+ * change in rounding from the compiler, the architecture or an optimisation
+ * passes where a change in level, timbre or timing does not. The time each
+ * one takes is reported with the result.
+ *
+ *	bristolcheck [-w] [-t seconds] [emulation ...]
+ *
+ * -w writes the golden files rather than checking them, for when an emulation
+ * is meant to sound different.
+ *
+ * When all of them are checked the first is checked again with a second engine
+ * playing the same script on another emulation between its periods, as a host
+ * with two plugin instances would run them. It has to match the same file.
+ *
+ * Each emulation runs in a child process, the engine has state that outlives
+ * bristolEngineDestroy() and a crash or a hang only fails that one emulation.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include <time.h>
+#include <math.h>
+#include <sys/wait.h>
+
+#include "bristolengine.h"
+#include "bristolmidiapi.h"
+
+#define CHECK_RATE 48000
+#define CHECK_PERIOD 256
+#define CHECK_BLOCKS 375 /* Two seconds */
+#define CHECK_SPAN 5 /* Blocks per envelope point, 27ms */
+#define CHECK_SPANS (CHECK_BLOCKS / CHECK_SPAN)
+#define CHECK_TIMEOUT 60
+#define CHECK_ALONGSIDE "juno"
+
+/*
+ * The tolerance, an absolute part for the quiet spans and a relative one. The
+ * crossings are counted on the left channel and can move by a few either way
+ * when the level is near zero.
+ */
+#define CHECK_ABS 0.0001
+#define CHECK_REL 0.02
+#define CHECK_CROSS 4
+
+typedef struct CheckSpan {
+	float rms[2];
+	float peak;
+	int cross;
+} checkSpan;
+
+typedef struct CheckResult {
+	checkSpan span[CHECK_SPANS];
+	float rms, peak;
+	double seconds;
+} checkResult;
+
+static int
+checkClose(float golden, float value, float abs)
+{
+	return(fabsf(golden - value) <= abs + CHECK_REL * fabsf(golden));
+}
+
+/*
+ * The number of spans out of tolerance, the first of them in 'first'.
+ */
+static int
+checkCompare(checkSpan *golden, checkSpan *result, int *first)
+{
+	int i, bad = 0;
+
+	*first = -1;
+
+	for (i = 0; i < CHECK_SPANS; i++)
+	{
+		if (checkClose(golden[i].rms[0], result[i].rms[0], CHECK_ABS)
+			&& checkClose(golden[i].rms[1], result[i].rms[1], CHECK_ABS)
+			&& checkClose(golden[i].peak, result[i].peak, CHECK_ABS)
+			&& checkClose(golden[i].cross, result[i].cross, CHECK_CROSS))
+			continue;
+
+		if (bad++ == 0)
+			*first = i;
+	}
+
+	return(bad);
+}
+
+static int
+checkRead(char *path, checkSpan *golden)
+{
+	char line[256];
+	FILE *fd;
+	int i = 0;
+
+	if ((fd = fopen(path, "r")) == NULL)
+		return(-1);
+
+	while ((i < CHECK_SPANS) && (fgets(line, sizeof(line), fd) != NULL))
+	{
+		if (line[0] == '#')
+			continue;
+
+		if (sscanf(line, "%f %f %f %i", &golden[i].rms[0], &golden[i].rms[1],
+			&golden[i].peak, &golden[i].cross) != 4)
+			break;
+		i++;
+	}
+
+	fclose(fd);
+
+	return(i == CHECK_SPANS? 0:-1);
+}
+
+static int
+checkWrite(char *path, char *name, checkSpan *span)
+{
+	FILE *fd;
+	int i;
+
+	if ((fd = fopen(path, "w")) == NULL)
+		return(-1);
+
+	fprintf(fd, "# bristolcheck %s: rms left, rms right, peak and left zero "
+		"crossings per %i frames at %iHz\n", name, CHECK_SPAN * CHECK_PERIOD,
+		CHECK_RATE);
+
+	for (i = 0; i < CHECK_SPANS; i++)
+		fprintf(fd, "%.5f %.5f %.5f %i\n", span[i].rms[0], span[i].rms[1],
+			span[i].peak, span[i].cross);
+
+	fclose(fd);
+
+	return(0);
+}
+
+static void
+checkNote(bristolEngine *engine, int command, int key, int offset)
+{
+	unsigned char msg[3];
+
+	msg[0] = command;
+	msg[1] = key;
+	msg[2] = command == MIDI_NOTE_ON? 100:0;
+
+	bristolEngineMidi(engine, msg, 3, offset);
+}
+
+/*
+ * The script: a note, a chord over it, mod wheel and pitch bend, an NRP to
+ * the first parameter of the default memory, then note off and the release.
+ */
+static void
+checkScript(bristolEngine *engine, int algo, int block)
+{
+	unsigned char msg[3];
+	int operator, controller;
+	float value;
+
+	switch (block) {
+		case 0:
+			checkNote(engine, MIDI_NOTE_ON, 48, 17);
+			break;
+		case 40:
+			checkNote(engine, MIDI_NOTE_ON, 55, 0);
+			checkNote(engine, MIDI_NOTE_ON, 60, 129);
+			checkNote(engine, MIDI_NOTE_ON, 64, 255);
+			break;
+		case 80:
+			msg[0] = MIDI_CONTROL;
+			msg[1] = 1;
+			msg[2] = 90;
+			bristolEngineMidi(engine, msg, 3, 0);
+			break;
+		case 100:
+			msg[0] = MIDI_PITCHWHEEL;
+			msg[1] = 0;
+			msg[2] = 0x50;
+			bristolEngineMidi(engine, msg, 3, 64);
+			break;
+		case 120:
+			if (bristolEngineDefault(algo, 0, &operator, &controller, &value)
+				== 0)
+				bristolEngineNRP(engine, 0, (operator << 7) | controller,
+					(int) ((1.0f - value) * 16383), 0);
+			break;
+		case 200:
+			checkNote(engine, MIDI_NOTE_OFF, 48, 3);
+			checkNote(engine, MIDI_NOTE_OFF, 55, 3);
+			checkNote(engine, MIDI_NOTE_OFF, 60, 3);
+			checkNote(engine, MIDI_NOTE_OFF, 64, 3);
+			break;
+	}
+}
+
+/*
+ * Render an emulation, with the 'other' emulation in a second engine unless
+ * that is -1.
+ */
+static int
+checkRender(int algo, int other, checkResult *result)
+{
+	float left[CHECK_PERIOD], right[CHECK_PERIOD], *out[2], last = 0;
+	double sum = 0, lsum = 0, rsum = 0;
+	struct timespec start, end;
+	bristolEngine *engine, *second = NULL;
+	checkSpan *span;
+	int block, i;
+
+	out[0] = left;
+	out[1] = right;
+
+	if ((engine = bristolEngineCreate(CHECK_RATE, CHECK_PERIOD, 16)) == NULL)
+		return(-1);
+
+	if (bristolEngineEmulation(engine, algo, 0, 8) < 0)
+		return(-1);
+
+	bristolEngineNRP(engine, 0, BRISTOL_NRP_ENABLE_NRP, 1, 0);
+
+	if ((other >= 0)
+		&& (((second = bristolEngineCreate(CHECK_RATE, CHECK_PERIOD, 16))
+			== NULL)
+		|| (bristolEngineEmulation(second, other, 0, 8) < 0)))
+		return(-1);
+
+	bzero(result, sizeof(checkResult));
+
+	for (block = 0; block < CHECK_BLOCKS; block++)
+	{
+		checkScript(engine, algo, block);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		bristolEngineProcess(engine, out, CHECK_PERIOD);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+
+		result->seconds += (end.tv_sec - start.tv_sec)
+			+ (end.tv_nsec - start.tv_nsec) / 1000000000.0;
+
+		span = &result->span[block / CHECK_SPAN];
+
+		/* Between our period and reading it, as a host runs two plugins */
+		if (second != NULL)
+		{
+			float sl[CHECK_PERIOD], sr[CHECK_PERIOD], *sout[2] = {sl, sr};
+
+			checkScript(second, other, block);
+			bristolEngineProcess(second, sout, CHECK_PERIOD);
+		}
+
+		for (i = 0; i < CHECK_PERIOD; i++)
+		{
+			lsum += left[i] * left[i];
+			rsum += right[i] * right[i];
+
+			if (fabsf(left[i]) > span->peak)
+				span->peak = fabsf(left[i]);
+			if (fabsf(right[i]) > span->peak)
+				span->peak = fabsf(right[i]);
+
+			if ((left[i] < 0) != (last < 0))
+				span->cross++;
+			last = left[i];
+		}
+
+		if ((block % CHECK_SPAN) == CHECK_SPAN - 1)
+		{
+			span->rms[0] = sqrt(lsum / (CHECK_SPAN * CHECK_PERIOD));
+			span->rms[1] = sqrt(rsum / (CHECK_SPAN * CHECK_PERIOD));
+			sum += lsum + rsum;
+			lsum = rsum = 0;
+
+			if (span->peak > result->peak)
+				result->peak = span->peak;
+		}
+	}
+
+	result->rms = sqrt(sum / (CHECK_BLOCKS * CHECK_PERIOD * 2));
+
+	bristolEngineDestroy(second);
+	bristolEngineDestroy(engine);
+
+	return(0);
+}
+
+/*
+ * Run the emulation in a child and take its result from a pipe.
+ */
+static int
+checkEmulation(int algo, int other, int timeout, checkResult *result)
+{
+	int fd[2], status, count;
+	pid_t pid;
+
+	if (pipe(fd) < 0)
+		return(-1);
+
+	fflush(stdout);
+
+	if ((pid = fork()) < 0)
+		return(-1);
+
+	if (pid == 0)
+	{
+		close(fd[0]);
+
+		/* The engine is verbose, only the result is of interest */
+		if (freopen("/dev/null", "w", stdout) == NULL)
+			_exit(1);
+
+		alarm(timeout);
+
+		if (checkRender(algo, other, result) < 0)
+			_exit(1);
+		if (write(fd[1], result, sizeof(checkResult)) != sizeof(checkResult))
+			_exit(1);
+		_exit(0);
+	}
+
+	close(fd[1]);
+	count = read(fd[0], result, sizeof(checkResult));
+	close(fd[0]);
+
+	if (waitpid(pid, &status, 0) < 0)
+		return(-1);
+
+	if (WIFSIGNALED(status))
+		return(-WTERMSIG(status));
+
+	if ((WEXITSTATUS(status) != 0) || (count != sizeof(checkResult)))
+		return(-1);
+
+	return(0);
+}
+
+/*
+ * Some algorithms share a name, the dx and rhodes for example. The first one
+ * gets the name, the others have the algorithm number added to it.
+ */
+static void
+checkName(int algo, char *name, int len)
+{
+	if (bristolEngineAlgo(bristolEngineName(algo)) == algo)
+		snprintf(name, len, "%s", bristolEngineName(algo));
+	else
+		snprintf(name, len, "%s%i", bristolEngineName(algo), algo);
+}
+
+static int
+checkSelected(char *name, int argc, char *argv[])
+{
+	int i;
+
+	if (argc == 0)
+		return(1);
+
+	for (i = 0; i < argc; i++)
+		if (strcmp(argv[i], name) == 0)
+			return(1);
+
+	return(0);
+}
+
+int
+main(int argc, char *argv[])
+{
+	int algo, update = 0, timeout = CHECK_TIMEOUT, err, failed = 0, count = 0;
+	int bad, first;
+	checkSpan golden[CHECK_SPANS];
+	char name[64], path[1024], *srcdir;
+	checkResult result;
+
+	setvbuf(stdout, NULL, _IOLBF, 0);
+
+	for (argc--, argv++; argc > 0 && argv[0][0] == '-'; argc--, argv++)
+	{
+		if (strcmp(argv[0], "-w") == 0)
+			update = 1;
+		else if ((strcmp(argv[0], "-t") == 0) && (argc > 1)) {
+			timeout = atoi(argv[1]);
+			argc--;
+			argv++;
+		} else {
+			fprintf(stderr, "usage: bristolcheck [-w] [-t seconds] "
+				"[emulation ...]\n");
+			return(2);
+		}
+	}
+
+	/* Set by make check, the golden files are in the source tree */
+	if ((srcdir = getenv("srcdir")) == NULL)
+		srcdir = ".";
+
+	for (algo = 0; algo < bristolEngineAlgoCount(); algo++)
+	{
+		/* The B3 lower manual is started with the upper, not alone */
+		if ((bristolEngineName(algo) == NULL)
+			|| (strcmp(bristolEngineName(algo), "hammondB3") == 0))
+			continue;
+
+		checkName(algo, name, sizeof(name));
+
+		if (!checkSelected(name, argc, argv))
+			continue;
+
+		count++;
+		snprintf(path, sizeof(path), "%s/golden/%s", srcdir, name);
+		bad = 0;
+
+		if ((err = checkEmulation(algo, -1, timeout, &result)) < 0)
+		{
+			if (err == -SIGALRM)
+				printf("%-12s FAIL timed out after %is\n", name, timeout);
+			else if (err < -1)
+				printf("%-12s FAIL signal %i\n", name, -err);
+			else
+				printf("%-12s FAIL did not render\n", name);
+			failed++;
+			continue;
+		}
+
+		if (update)
+		{
+			if (checkWrite(path, name, result.span) < 0)
+			{
+				printf("%-12s FAIL cannot write %s\n", name, path);
+				failed++;
+				continue;
+			}
+		} else if (checkRead(path, golden) < 0) {
+			printf("%-12s FAIL no golden file %s\n", name, path);
+			failed++;
+			continue;
+		} else if ((bad = checkCompare(golden, result.span, &first)) != 0)
+			failed++;
+
+		printf("%-12s %s rms %.4f peak %.4f %7.2fms %6.1fx", name,
+			update? "WROTE":(bad? "FAIL ":"PASS "),
+			result.rms, result.peak, result.seconds * 1000,
+			CHECK_BLOCKS * CHECK_PERIOD / (double) CHECK_RATE
+				/ result.seconds);
+
+		if (bad)
+			printf(", %i of %i spans differ from %.3fs", bad, CHECK_SPANS,
+				first * CHECK_SPAN * CHECK_PERIOD / (double) CHECK_RATE);
+		printf("\n");
+	}
+
+	if (count == 0)
+	{
+		fprintf(stderr, "bristolcheck: no such emulation\n");
+		return(2);
+	}
+
+	printf("%i of %i emulations %s\n", count - failed, count,
+		update? "written":"match their golden files");
+
+	/* The first one again with another engine alongside it */
+	if ((argc == 0) && (!update))
+	{
+		checkName(0, name, sizeof(name));
+		snprintf(path, sizeof(path), "%s/golden/%s", srcdir, name);
+
+		if ((checkRead(path, golden) < 0)
+			|| (checkEmulation(0, bristolEngineAlgo(CHECK_ALONGSIDE),
+				timeout, &result) < 0))
+			bad = -1;
+		else
+			bad = checkCompare(golden, result.span, &first);
+
+		printf("%s with a %s in a second engine: %s\n", name,
+			CHECK_ALONGSIDE, bad? "FAIL":"PASS");
+
+		if (bad)
+			failed++;
+	}
+
+	return(failed? 1:0);
+}
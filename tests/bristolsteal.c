@@ -0,0 +1,210 @@
+
+/*
+ *  Diverse Bristol audio routines.
+ *  Copyright (c) by Nick Copeland <nickycopeland@hotmail.com> 1996,2012
+ *
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * 'make check': voice stealing. Each emulation is given a chord against a CPU
+ * budget so small that only one voice fits, the others are stolen. Whatever
+ * envelopes the emulation has the stolen voices have to be gone within the
+ * steal time and the period that ends it:
+ *
+ *	bristolsteal [-t seconds] [emulation ...]
+ *
+ * As with bristolcheck each emulation runs in a child process.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/wait.h>
+
+#include "bristolengine.h"
+#include "bristolmidiapi.h"
+
+#define STEAL_RATE 48000
+#define STEAL_PERIOD 256
+#define STEAL_NOTES 8
+#define STEAL_BLOCKS 40
+/*
+ * The first period measures what a voice costs, the next steals, then 5ms of
+ * release is a period at this rate and one more ends it. One spare.
+ */
+#define STEAL_WAIT 5
+#define STEAL_TIMEOUT 60
+
+/*
+ * The most voices left sounding once they should have been stolen, -1 if the
+ * emulation did not render.
+ */
+static int
+stealRender(int algo)
+{
+	float left[STEAL_PERIOD], right[STEAL_PERIOD], *out[2];
+	bristolEngine *engine;
+	unsigned char msg[3];
+	int block, i, voices, most = 0;
+
+	out[0] = left;
+	out[1] = right;
+
+	if ((engine = bristolEngineCreate(STEAL_RATE, STEAL_PERIOD, 16)) == NULL)
+		return(-1);
+
+	if ((bristolEngineEmulation(engine, algo, 0, STEAL_NOTES) < 0)
+		|| (bristolEngineBudget(engine, 0.01) < 0))
+		return(-1);
+
+	for (i = 0; i < STEAL_NOTES; i++)
+	{
+		msg[0] = MIDI_NOTE_ON;
+		msg[1] = 48 + i * 3;
+		msg[2] = 100;
+		bristolEngineMidi(engine, msg, 3, 0);
+	}
+
+	for (block = 0; block < STEAL_BLOCKS; block++)
+	{
+		bristolEngineProcess(engine, out, STEAL_PERIOD);
+
+		if ((block >= STEAL_WAIT)
+			&& ((voices = bristolEngineVoices(engine)) > most))
+			most = voices;
+	}
+
+	bristolEngineDestroy(engine);
+
+	return(most);
+}
+
+static int
+stealEmulation(int algo, int timeout)
+{
+	int fd[2], status, most = -1;
+	pid_t pid;
+
+	if (pipe(fd) < 0)
+		return(-1);
+
+	fflush(stdout);
+
+	if ((pid = fork()) < 0)
+		return(-1);
+
+	if (pid == 0)
+	{
+		close(fd[0]);
+
+		if (freopen("/dev/null", "w", stdout) == NULL)
+			_exit(1);
+
+		alarm(timeout);
+
+		most = stealRender(algo);
+		if (write(fd[1], &most, sizeof(int)) != sizeof(int))
+			_exit(1);
+		_exit(0);
+	}
+
+	close(fd[1]);
+	if (read(fd[0], &most, sizeof(int)) != sizeof(int))
+		most = -1;
+	close(fd[0]);
+
+	if ((waitpid(pid, &status, 0) < 0) || WIFSIGNALED(status)
+		|| (WEXITSTATUS(status) != 0))
+		return(-1);
+
+	return(most);
+}
+
+static void
+stealName(int algo, char *name, int len)
+{
+	if (bristolEngineAlgo(bristolEngineName(algo)) == algo)
+		snprintf(name, len, "%s", bristolEngineName(algo));
+	else
+		snprintf(name, len, "%s%i", bristolEngineName(algo), algo);
+}
+
+int
+main(int argc, char *argv[])
+{
+	int algo, i, timeout = STEAL_TIMEOUT, most, failed = 0, count = 0;
+	char name[64];
+
+	setvbuf(stdout, NULL, _IOLBF, 0);
+
+	for (argc--, argv++; argc > 0 && argv[0][0] == '-'; argc--, argv++)
+	{
+		if ((strcmp(argv[0], "-t") == 0) && (argc > 1)) {
+			timeout = atoi(argv[1]);
+			argc--;
+			argv++;
+		} else {
+			fprintf(stderr, "usage: bristolsteal [-t seconds] "
+				"[emulation ...]\n");
+			return(2);
+		}
+	}
+
+	for (algo = 0; algo < bristolEngineAlgoCount(); algo++)
+	{
+		/* The B3 lower manual is started with the upper, not alone */
+		if ((bristolEngineName(algo) == NULL)
+			|| (strcmp(bristolEngineName(algo), "hammondB3") == 0))
+			continue;
+
+		stealName(algo, name, sizeof(name));
+
+		for (i = 0; i < argc; i++)
+			if (strcmp(argv[i], name) == 0)
+				break;
+		if ((argc > 0) && (i == argc))
+			continue;
+
+		count++;
+
+		if ((most = stealEmulation(algo, timeout)) < 0)
+		{
+			printf("%-12s FAIL did not render\n", name);
+			failed++;
+			continue;
+		}
+
+		if (most > 1)
+			failed++;
+
+		printf("%-12s %s %i of %i voices left after the steal\n", name,
+			most > 1? "FAIL":"PASS", most, STEAL_NOTES);
+	}
+
+	if (count == 0)
+	{
+		fprintf(stderr, "bristolsteal: no such emulation\n");
+		return(2);
+	}
+
+	printf("%i of %i emulations release their stolen voices\n",
+		count - failed, count);
+
+	return(failed? 1:0);
+}